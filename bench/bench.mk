@@ -0,0 +1,66 @@
+#-{ Shared rules for the benchmark projects }-----------------------------------
+#
+# Include from bench/<name>/Makefile after setting:
+#   NAME      - project name, used for the output files
+#   APP_SRC   - project sources (source/main.c etc.)
+# Optional:
+#   OPT       - optimization flags (default -Os), also passed to the link for -flto
+#   BIN       - output directory (default ./binary)
+
+ROOT?=../..
+BIN?=./binary
+APP_INC=./source
+DDL=$(ROOT)/drivers/hc32_ll_driver
+BSP=$(ROOT)/drivers/bsp/sk_hc32f120_lqfp44
+COMP=$(ROOT)/drivers/bsp/components
+DEV=$(ROOT)/drivers/cmsis/Device/HDSC/hc32f1xx
+
+#-{ Compiler Definitions }------------------------------------------------------
+
+CC=arm-none-eabi-gcc
+OBJCOPY=arm-none-eabi-objcopy
+SIZE=arm-none-eabi-size
+
+OPT?=-Os
+DFLAGS=-mcpu=cortex-m0plus -mthumb -msoft-float
+DEFS=-DHC32F120 -DUSE_DDL_DRIVER
+INCS=-I$(APP_INC) -I$(DDL)/inc -I$(BSP) $(addprefix -I,$(wildcard $(COMP)/*)) -I$(ROOT)/drivers/cmsis/Include -I$(DEV)/Include
+CFLAGS=$(DFLAGS) $(OPT) -g -Wall -Wextra -ffunction-sections -fdata-sections $(DEFS) $(INCS)
+
+LSCRIPT=$(DEV)/Source/GCC/linker/HC32F120x8.ld
+LFLAGS=$(DFLAGS) $(OPT) -T $(LSCRIPT) --specs=nosys.specs --specs=nano.specs -Wl,--gc-sections
+
+#-{ Sources }-------------------------------------------------------------------
+
+SRCS=$(APP_SRC) $(wildcard $(DDL)/src/*.c) $(wildcard $(BSP)/*.c) $(wildcard $(COMP)/*/*.c) $(DEV)/Source/system_hc32f120.c
+OBJS=$(addprefix $(BIN)/,$(notdir $(SRCS:.c=.o))) $(BIN)/startup_hc32f120.o
+
+vpath %.c $(sort $(dir $(SRCS)))
+
+ELF=$(BIN)/$(NAME).elf
+HEX=$(BIN)/$(NAME).hex
+
+#-{ Rules }---------------------------------------------------------------------
+
+all: $(HEX)
+
+$(HEX): $(ELF)
+	$(OBJCOPY) -O ihex $(ELF) $(HEX)
+	$(SIZE) $(ELF)
+
+$(ELF): $(OBJS)
+	$(CC) $(LFLAGS) $(OBJS) -o $(ELF)
+
+$(BIN)/%.o: %.c | $(BIN)
+	$(CC) $(CFLAGS) -c $< -o $@
+
+$(BIN)/startup_hc32f120.o: $(DEV)/Source/GCC/startup_hc32f120.S | $(BIN)
+	$(CC) $(DFLAGS) -c $< -o $@
+
+$(BIN):
+	mkdir -p $(BIN)
+
+clean:
+	rm -rf $(BIN)
+
+.PHONY: all clean
@@ -0,0 +1,341 @@
+/**
+ *******************************************************************************
+ * @file  bench/cycles/source/main.c
+ * @brief Cycle count benchmark of the LL driver hot paths: USART, SPI, CRC,
+ *        EFM, GPIO and the shared IRQ handlers.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-16       CDT             First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2022-2023, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "main.h"
+
+/**
+ * @addtogroup HC32F120_DDL_Benchmarks
+ * @{
+ */
+
+/**
+ * @defgroup CYCLES CYCLES
+ * @brief Each case prints "@<func>[/<variant>],<units>,<cycles>", the cycles
+ *        of one call with the measurement overhead removed. host/emu turns
+ *        the lines into the cycle table, see bench/cycles/Makefile.
+ * @note  On the device the USART, SPI and EFM cases include the wire and
+ *        flash operation time, under the emulator the peripherals are ready
+ *        at once and the counts are the driver software cost.
+ * @{
+ */
+
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @brief Shared IRQ handler under test.
+ */
+typedef struct {
+    const char *pcName;                 /*!< Symbol name. */
+    func_ptr_t pfnHandler;              /*!< Handler. */
+} stc_bench_irq_t;
+
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+#define BENCH_USART_UNIT        (CM_USART2)
+#define BENCH_USART_FCG         (FCG0_PERIPH_USART2)
+#define BENCH_SPI_UNIT          (CM_SPI)
+#define BENCH_SPI_FCG           (FCG0_PERIPH_SPI)
+#define BENCH_CRC_FCG           (FCG0_PERIPH_CRC)
+#define BENCH_GPIO_PORT         (GPIO_PORT_2)
+#define BENCH_GPIO_PIN          (GPIO_PIN_02)
+#define BENCH_FLASH_ADDR        (EFM_SECTOR_ADDR(120UL))
+
+#define BENCH_TIMEOUT           (0x10000UL)
+#define BENCH_BUF_LEN           (256U)
+#define BENCH_TOGGLE_NUM        (16UL)
+
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+static const uint32_t m_au32IoLen[] = {1UL, 16UL, 64UL};
+static const uint32_t m_au32BlockLen[] = {16UL, 64UL, BENCH_BUF_LEN};
+
+static const stc_bench_irq_t m_astcIrq[] = {
+    {"IRQ024_Handler", &IRQ024_Handler},
+    {"IRQ025_Handler", &IRQ025_Handler},
+    {"IRQ026_Handler", &IRQ026_Handler},
+    {"IRQ027_Handler", &IRQ027_Handler},
+    {"IRQ028_Handler", &IRQ028_Handler},
+    {"IRQ029_Handler", &IRQ029_Handler},
+    {"IRQ030_Handler", &IRQ030_Handler},
+    {"IRQ031_Handler", &IRQ031_Handler},
+};
+
+static uint8_t m_au8TxBuf[BENCH_BUF_LEN];
+static uint8_t m_au8RxBuf[BENCH_BUF_LEN];
+/* Cycles of an empty measurement */
+static uint32_t m_u32Overhead;
+
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @brief  Start SysTick as a free running 24-bit HCLK cycle counter.
+ * @param  None
+ * @retval None
+ */
+static void Bench_CycleCounterInit(void)
+{
+    uint32_t u32Start;
+
+    SysTick->CTRL = 0UL;
+    SysTick->LOAD = SysTick_LOAD_RELOAD_Msk;
+    SysTick->VAL = 0UL;
+    SysTick->CTRL = SysTick_CTRL_CLKSOURCE_Msk | SysTick_CTRL_ENABLE_Msk;
+
+    u32Start = SysTick->VAL;
+    m_u32Overhead = (u32Start - SysTick->VAL) & SysTick_VAL_CURRENT_Msk;
+}
+
+/**
+ * @brief  Get elapsed HCLK cycles since u32Start, the measurement overhead removed.
+ * @param  [in] u32Start                Value of SysTick->VAL at start
+ * @retval Elapsed cycles, valid for intervals up to 2^24 cycles
+ */
+static uint32_t Bench_CycleElapsed(uint32_t u32Start)
+{
+    return ((u32Start - SysTick->VAL) & SysTick_VAL_CURRENT_Msk) - m_u32Overhead;
+}
+
+/**
+ * @brief  Print one result line.
+ * @param  [in] pcFunc                  Function name, optionally followed by "/<variant>"
+ * @param  [in] u32Units                Bytes or calls the cycles were spent on
+ * @param  [in] u32Cycles               Cycles
+ * @retval None
+ */
+static void Bench_Report(const char *pcFunc, uint32_t u32Units, uint32_t u32Cycles)
+{
+    DDL_Printf("@%s,%lu,%lu\r\n", pcFunc, u32Units, u32Cycles);
+}
+
+/**
+ * @brief  USART_UART_Trans() per transfer length.
+ * @param  None
+ * @retval None
+ */
+static void Bench_Usart(void)
+{
+    stc_usart_uart_init_t stcUartInit;
+    uint32_t u32Start;
+    uint32_t u32Cycles;
+    uint32_t i;
+
+    (void)USART_UART_StructInit(&stcUartInit);
+    (void)USART_UART_Init(BENCH_USART_UNIT, &stcUartInit, NULL);
+    USART_FuncCmd(BENCH_USART_UNIT, USART_TX, ENABLE);
+
+    for (i = 0UL; i < ARRAY_SZ(m_au32IoLen); i++) {
+        u32Start = SysTick->VAL;
+        (void)USART_UART_Trans(BENCH_USART_UNIT, m_au8TxBuf, m_au32IoLen[i], BENCH_TIMEOUT);
+        u32Cycles = Bench_CycleElapsed(u32Start);
+        Bench_Report("USART_UART_Trans", m_au32IoLen[i], u32Cycles);
+    }
+    USART_FuncCmd(BENCH_USART_UNIT, USART_TX, DISABLE);
+}
+
+/**
+ * @brief  SPI_TransReceive() per transfer length, MOSI to MISO loopback.
+ * @param  None
+ * @retval None
+ */
+static void Bench_Spi(void)
+{
+    stc_spi_init_t stcSpiInit;
+    uint32_t u32Start;
+    uint32_t u32Cycles;
+    uint32_t i;
+
+    (void)SPI_StructInit(&stcSpiInit);
+    stcSpiInit.u32WireMode          = SPI_3_WIRE;
+    stcSpiInit.u32TransMode         = SPI_FULL_DUPLEX;
+    stcSpiInit.u32MasterSlave       = SPI_MASTER;
+    stcSpiInit.u32BaudRatePrescaler = SPI_BR_CLK_DIV2;
+    (void)SPI_Init(BENCH_SPI_UNIT, &stcSpiInit);
+    SPI_LoopbackModeConfig(BENCH_SPI_UNIT, SPI_LOOPBACK_MOSI);
+    SPI_Cmd(BENCH_SPI_UNIT, ENABLE);
+
+    for (i = 0UL; i < ARRAY_SZ(m_au32IoLen); i++) {
+        u32Start = SysTick->VAL;
+        (void)SPI_TransReceive(BENCH_SPI_UNIT, m_au8TxBuf, m_au8RxBuf, m_au32IoLen[i], BENCH_TIMEOUT);
+        u32Cycles = Bench_CycleElapsed(u32Start);
+        Bench_Report("SPI_TransReceive", m_au32IoLen[i], u32Cycles);
+    }
+    SPI_Cmd(BENCH_SPI_UNIT, DISABLE);
+}
+
+/**
+ * @brief  CRC_CalculateData8() per block length.
+ * @param  None
+ * @retval None
+ */
+static void Bench_Crc(void)
+{
+    stc_crc_init_t stcCrcInit;
+    uint32_t u32Start;
+    uint32_t u32Cycles;
+    uint32_t i;
+
+    (void)CRC_StructInit(&stcCrcInit);
+    stcCrcInit.u32Protocol = CRC_CRC32;
+    (void)CRC_Init(&stcCrcInit);
+
+    for (i = 0UL; i < ARRAY_SZ(m_au32BlockLen); i++) {
+        u32Start = SysTick->VAL;
+        (void)CRC_CalculateData8(0xFFFFFFFFUL, m_au8TxBuf, m_au32BlockLen[i]);
+        u32Cycles = Bench_CycleElapsed(u32Start);
+        Bench_Report("CRC_CalculateData8", m_au32BlockLen[i], u32Cycles);
+    }
+}
+
+/**
+ * @brief  EFM_Program() per block length, each into an erased sector.
+ * @param  None
+ * @retval None
+ */
+static void Bench_Efm(void)
+{
+    uint32_t u32Start;
+    uint32_t u32Cycles;
+    uint32_t i;
+
+    EFM_FWMC_Cmd(ENABLE);
+    for (i = 0UL; i < ARRAY_SZ(m_au32BlockLen); i++) {
+        (void)EFM_SectorErase(BENCH_FLASH_ADDR);
+        u32Start = SysTick->VAL;
+        (void)EFM_Program(BENCH_FLASH_ADDR, m_au8TxBuf, m_au32BlockLen[i]);
+        u32Cycles = Bench_CycleElapsed(u32Start);
+        Bench_Report("EFM_Program", m_au32BlockLen[i], u32Cycles);
+    }
+    (void)EFM_SectorErase(BENCH_FLASH_ADDR);
+    EFM_FWMC_Cmd(DISABLE);
+}
+
+/**
+ * @brief  GPIO_TogglePins(), BENCH_TOGGLE_NUM calls.
+ * @param  None
+ * @retval None
+ */
+static void Bench_Gpio(void)
+{
+    uint32_t u32Start;
+    uint32_t u32Cycles;
+    uint32_t i;
+
+    u32Start = SysTick->VAL;
+    for (i = 0UL; i < BENCH_TOGGLE_NUM; i++) {
+        GPIO_TogglePins(BENCH_GPIO_PORT, BENCH_GPIO_PIN);
+    }
+    u32Cycles = Bench_CycleElapsed(u32Start);
+    Bench_Report("GPIO_TogglePins", BENCH_TOGGLE_NUM, u32Cycles);
+}
+
+/**
+ * @brief  Shared IRQ handlers called directly with no source flag pending,
+ *         once with no source selected (ISELBRxx = 0) and once with all.
+ * @param  None
+ * @retval None
+ */
+static void Bench_IrqShare(void)
+{
+    __IO uint32_t *pu32Isel = &CM_INTC->ISELBR24;
+    uint32_t u32Start;
+    uint32_t u32Cycles;
+    uint32_t u32Sel;
+    uint32_t i;
+
+    for (u32Sel = 0UL; u32Sel < 2UL; u32Sel++) {
+        for (i = 0UL; i < ARRAY_SZ(m_astcIrq); i++) {
+            WRITE_REG32(pu32Isel[i], (0UL != u32Sel) ? 0xFFFFFFFFUL : 0UL);
+        }
+        for (i = 0UL; i < ARRAY_SZ(m_astcIrq); i++) {
+            u32Start = SysTick->VAL;
+            m_astcIrq[i].pfnHandler();
+            u32Cycles = Bench_CycleElapsed(u32Start);
+            DDL_Printf("@%s/sel%lu,1,%lu\r\n", m_astcIrq[i].pcName, u32Sel, u32Cycles);
+        }
+    }
+    for (i = 0UL; i < ARRAY_SZ(m_astcIrq); i++) {
+        WRITE_REG32(pu32Isel[i], 0UL);
+    }
+}
+
+/**
+ * @brief  Main function of the cycle benchmark
+ * @param  None
+ * @retval int32_t return value, if needed
+ */
+int32_t main(void)
+{
+    uint32_t i;
+
+    LL_PERIPH_WE(LL_PERIPH_ALL);
+    DDL_PrintfInit(BSP_PRINTF_DEVICE, BSP_PRINTF_BAUDRATE, BSP_PRINTF_Preinit);
+    FCG_Fcg0PeriphClockCmd(BENCH_USART_FCG | BENCH_SPI_FCG | BENCH_CRC_FCG, ENABLE);
+    GPIO_OutputCmd(BENCH_GPIO_PORT, BENCH_GPIO_PIN, ENABLE);
+
+    for (i = 0UL; i < BENCH_BUF_LEN; i++) {
+        m_au8TxBuf[i] = (uint8_t)((i * 0x9EUL) ^ 0x5AUL);
+    }
+
+    /* Interrupts would add jitter to the cycle counts */
+    __disable_irq();
+    Bench_CycleCounterInit();
+    DDL_Printf("cycles: overhead %lu\r\n", m_u32Overhead);
+    Bench_Usart();
+    Bench_Spi();
+    Bench_Crc();
+    Bench_Efm();
+    Bench_Gpio();
+    Bench_IrqShare();
+    __enable_irq();
+
+    LL_PERIPH_WP(LL_PERIPH_ALL);
+    DDL_Printf("cycles: done\r\n");
+
+    for (;;) {
+    }
+}
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
@@ -0,0 +1,30 @@
+/**
+ *******************************************************************************
+ * @file  bench/cycles/source/main.h
+ * @brief This file contains the including files of main routine.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-16       CDT             First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2022-2023, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+#ifndef __MAIN_H__
+#define __MAIN_H__
+
+#include "hc32_ll.h"
+#include "sk_hc32f120_lqfp44.h"
+
+#endif /* __MAIN_H__ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
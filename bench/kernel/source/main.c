@@ -0,0 +1,200 @@
+/**
+ *******************************************************************************
+ * @file  bench/kernel/source/main.c
+ * @brief Context switch cost benchmark of the preemptive micro-kernel.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-16       CDT             First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2022-2023, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "main.h"
+
+/**
+ * @addtogroup HC32F120_DDL_Benchmarks
+ * @{
+ */
+
+/**
+ * @addtogroup KERNEL_SWITCH
+ * @{
+ */
+
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+#define BENCH_LOOP              (1000UL)
+#define BENCH_CYCLE_PER_US      (HCLK_VALUE / 1000000UL)
+
+#define BENCH_PRIO_MASTER       (1U)
+#define BENCH_PRIO_ECHO         (2U)
+
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+void SysTick_Handler(void);
+
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+static stc_kernel_sem_t m_stcSemPing;
+static stc_kernel_sem_t m_stcSemPong;
+static stc_kernel_queue_t m_stcQueuePing;
+static stc_kernel_queue_t m_stcQueuePong;
+static uint32_t m_au32QueuePingBuf[2U];
+static uint32_t m_au32QueuePongBuf[2U];
+
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @brief  SysTick IRQ handler: DDL and kernel tick.
+ * @param  None
+ * @retval None
+ */
+void SysTick_Handler(void)
+{
+    SysTick_IncTick();
+    KERNEL_TickHandler();
+}
+
+/**
+ * @brief  Print the cost of one loop iteration.
+ * @param  [in] pcFunc                  Case name
+ * @param  [in] u32Units                Context switches per iteration
+ * @param  [in] u32Us                   Microseconds of BENCH_LOOP iterations
+ * @retval Cycles per iteration
+ */
+static uint32_t Bench_Report(const char *pcFunc, uint32_t u32Units, uint32_t u32Us)
+{
+    uint32_t u32Cycles = (u32Us * BENCH_CYCLE_PER_US) / BENCH_LOOP;
+
+    DDL_Printf("@%s,%lu,%lu\r\n", pcFunc, u32Units, u32Cycles);
+    return u32Cycles;
+}
+
+/**
+ * @brief  Echo thread: returns every ping as a pong.
+ * @param  [in] pvArg                   Not used
+ * @retval None
+ */
+static void Bench_EchoThread(void *pvArg)
+{
+    uint32_t u32Item;
+
+    (void)pvArg;
+    /* Semaphore ping-pong, then queue ping-pong */
+    for (;;) {
+        (void)KERNEL_SemTake(&m_stcSemPing, KERNEL_WAIT_FOREVER);
+        if (LL_OK == KERNEL_QueueReceive(&m_stcQueuePing, &u32Item, KERNEL_NO_WAIT)) {
+            (void)KERNEL_QueueSend(&m_stcQueuePong, &u32Item, KERNEL_NO_WAIT);
+        } else {
+            (void)KERNEL_SemGive(&m_stcSemPong);
+        }
+    }
+}
+
+/**
+ * @brief  Master thread: runs the cases, the echo thread of lower priority runs whenever it waits.
+ * @param  [in] pvArg                   Not used
+ * @retval None
+ */
+static void Bench_MasterThread(void *pvArg)
+{
+    uint32_t i;
+    uint32_t u32Start;
+    uint32_t u32Item = 0UL;
+    uint32_t u32Base;
+    uint32_t u32Cycles;
+
+    (void)pvArg;
+
+    /* Give and take without a switch: the semaphore cost alone */
+    u32Start = SysTick_GetMicros();
+    for (i = 0UL; i < BENCH_LOOP; i++) {
+        (void)KERNEL_SemGive(&m_stcSemPong);
+        (void)KERNEL_SemTake(&m_stcSemPong, KERNEL_WAIT_FOREVER);
+        (void)KERNEL_SemGive(&m_stcSemPong);
+        (void)KERNEL_SemTake(&m_stcSemPong, KERNEL_WAIT_FOREVER);
+    }
+    u32Base = Bench_Report("KERNEL_SemGive+Take", 0UL, SysTick_GetMicros() - u32Start);
+
+    /* Same calls, the take blocks: one switch to the echo thread and one back */
+    u32Start = SysTick_GetMicros();
+    for (i = 0UL; i < BENCH_LOOP; i++) {
+        (void)KERNEL_SemGive(&m_stcSemPing);
+        (void)KERNEL_SemTake(&m_stcSemPong, KERNEL_WAIT_FOREVER);
+    }
+    u32Cycles = Bench_Report("KERNEL_SemPingPong", 2UL, SysTick_GetMicros() - u32Start);
+    DDL_Printf("@KERNEL_ContextSwitch,1,%lu\r\n", (u32Cycles - u32Base) / 2UL);
+
+    /* Queue round trip, the semaphore only wakes the echo thread */
+    u32Start = SysTick_GetMicros();
+    for (i = 0UL; i < BENCH_LOOP; i++) {
+        (void)KERNEL_QueueSend(&m_stcQueuePing, &i, KERNEL_NO_WAIT);
+        (void)KERNEL_SemGive(&m_stcSemPing);
+        (void)KERNEL_QueueReceive(&m_stcQueuePong, &u32Item, KERNEL_WAIT_FOREVER);
+    }
+    (void)Bench_Report("KERNEL_QueuePingPong", 2UL, SysTick_GetMicros() - u32Start);
+
+    DDL_Printf("kernel: done, last item %lu\r\n", u32Item);
+    for (;;) {
+        KERNEL_Delay(KERNEL_TICK_FREQ);
+    }
+}
+
+/**
+ * @brief  Main function of kernel benchmark
+ * @param  None
+ * @retval int32_t return value, if needed
+ */
+int32_t main(void)
+{
+    LL_PERIPH_WE(LL_PERIPH_ALL);
+    DDL_PrintfInit(BSP_PRINTF_DEVICE, BSP_PRINTF_BAUDRATE, BSP_PRINTF_Preinit);
+    LL_PERIPH_WP(LL_PERIPH_ALL);
+
+    KERNEL_Init();
+    (void)KERNEL_SemInit(&m_stcSemPing, 0UL, 1UL);
+    (void)KERNEL_SemInit(&m_stcSemPong, 0UL, 1UL);
+    (void)KERNEL_QueueInit(&m_stcQueuePing, m_au32QueuePingBuf, sizeof(uint32_t), ARRAY_SZ(m_au32QueuePingBuf));
+    (void)KERNEL_QueueInit(&m_stcQueuePong, m_au32QueuePongBuf, sizeof(uint32_t), ARRAY_SZ(m_au32QueuePongBuf));
+    (void)KERNEL_ThreadCreate(&Bench_MasterThread, NULL, BENCH_PRIO_MASTER);
+    (void)KERNEL_ThreadCreate(&Bench_EchoThread, NULL, BENCH_PRIO_ECHO);
+    KERNEL_Start();
+
+    return 0;
+}
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
@@ -0,0 +1,248 @@
+/**
+ *******************************************************************************
+ * @file  bench/spi_pipeline/source/main.c
+ * @brief Cycle count benchmark of SPI_TransReceive() and SPI_PipelineTransReceive().
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-16       CDT             First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2022-2023, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include <string.h>
+#include "main.h"
+
+/**
+ * @addtogroup HC32F120_DDL_Benchmarks
+ * @{
+ */
+
+/**
+ * @addtogroup SPI_PIPELINE
+ * @{
+ */
+
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @brief Result of one benchmark case, all cycle counts in HCLK cycles.
+ */
+typedef struct {
+    uint32_t u32DataBits;               /*!< Frame width, 8 or 16. */
+    uint32_t u32Len;                    /*!< Number of frames. */
+    uint32_t u32CyclesNormal;           /*!< SPI_TransReceive(). */
+    uint32_t u32CyclesPipeline;         /*!< SPI_PipelineTransReceive(). */
+    uint32_t u32CyclesWire;             /*!< Theoretical SCK time of the transfer. */
+    int32_t i32Ret;                     /*!< LL_OK if both transfers succeeded and the data looped back intact. */
+} stc_bench_result_t;
+
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+#define BENCH_SPI_UNIT          (CM_SPI)
+#define BENCH_SPI_FCG           (FCG0_PERIPH_SPI)
+/* SCK = PCLK1 / 2, 2 HCLK cycles per bit with the reset default PCLK1 = HCLK */
+#define BENCH_SPI_BR_DIV        (SPI_BR_CLK_DIV2)
+#define BENCH_CYCLES_PER_BIT    (2UL)
+
+#define BENCH_TIMEOUT           (0x10000UL)
+#define BENCH_BUF_LEN           (256U)
+#define BENCH_LEN_NUM           (4U)
+#define BENCH_CASE_NUM          (BENCH_LEN_NUM * 2U)
+
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+/* Kept in RAM for inspection with the debugger */
+stc_bench_result_t g_astcBenchResult[BENCH_CASE_NUM];
+
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+static const uint32_t m_au32BenchLen[BENCH_LEN_NUM] = {1UL, 16UL, 64UL, BENCH_BUF_LEN / 2U};
+
+static uint16_t m_au16TxBuf[BENCH_BUF_LEN / 2U];
+static uint16_t m_au16RxBuf[BENCH_BUF_LEN / 2U];
+
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @brief  Start SysTick as a free running 24-bit HCLK cycle counter.
+ * @param  None
+ * @retval None
+ */
+static void Bench_CycleCounterInit(void)
+{
+    SysTick->CTRL = 0UL;
+    SysTick->LOAD = SysTick_LOAD_RELOAD_Msk;
+    SysTick->VAL = 0UL;
+    SysTick->CTRL = SysTick_CTRL_CLKSOURCE_Msk | SysTick_CTRL_ENABLE_Msk;
+}
+
+/**
+ * @brief  Get elapsed HCLK cycles since u32Start.
+ * @param  [in] u32Start                Value of SysTick->VAL at start
+ * @retval Elapsed cycles, valid for intervals up to 2^24 cycles
+ */
+static uint32_t Bench_CycleElapsed(uint32_t u32Start)
+{
+    return (u32Start - SysTick->VAL) & SysTick_VAL_CURRENT_Msk;
+}
+
+/**
+ * @brief  Configure SPI as master with internal MOSI to MISO loopback.
+ * @param  [in] u32DataBits             SPI_DATA_SIZE_8BIT or SPI_DATA_SIZE_16BIT
+ * @retval None
+ */
+static void Bench_SpiConfig(uint32_t u32DataBits)
+{
+    stc_spi_init_t stcSpiInit;
+
+    SPI_DeInit(BENCH_SPI_UNIT);
+    (void)SPI_StructInit(&stcSpiInit);
+    stcSpiInit.u32WireMode          = SPI_3_WIRE;
+    stcSpiInit.u32TransMode         = SPI_FULL_DUPLEX;
+    stcSpiInit.u32MasterSlave       = SPI_MASTER;
+    stcSpiInit.u32BaudRatePrescaler = BENCH_SPI_BR_DIV;
+    stcSpiInit.u32DataBits          = u32DataBits;
+    (void)SPI_Init(BENCH_SPI_UNIT, &stcSpiInit);
+    SPI_LoopbackModeConfig(BENCH_SPI_UNIT, SPI_LOOPBACK_MOSI);
+    SPI_Cmd(BENCH_SPI_UNIT, ENABLE);
+}
+
+/**
+ * @brief  Check the looped back data.
+ * @param  [in] u32Bytes                Number of bytes to compare
+ * @retval int32_t:
+ *           - LL_OK:                   Data matches.
+ *           - LL_ERR:                  Data mismatch.
+ */
+static int32_t Bench_Verify(uint32_t u32Bytes)
+{
+    uint32_t i;
+    int32_t i32Ret = LL_OK;
+    const uint8_t *pu8Tx = (const uint8_t *)m_au16TxBuf;
+    const uint8_t *pu8Rx = (const uint8_t *)m_au16RxBuf;
+
+    for (i = 0UL; i < u32Bytes; i++) {
+        if (pu8Tx[i] != pu8Rx[i]) {
+            i32Ret = LL_ERR;
+            break;
+        }
+    }
+    return i32Ret;
+}
+
+/**
+ * @brief  Run both transfer functions for one frame width and length.
+ * @param  [in] u32DataBits             SPI_DATA_SIZE_8BIT or SPI_DATA_SIZE_16BIT
+ * @param  [in] u32Len                  Number of frames
+ * @param  [out] pstcResult             Pointer to the result
+ * @retval None
+ */
+static void Bench_RunCase(uint32_t u32DataBits, uint32_t u32Len, stc_bench_result_t *pstcResult)
+{
+    uint32_t u32Start;
+    uint32_t u32Bytes;
+    int32_t i32Ret;
+
+    pstcResult->u32DataBits = (SPI_DATA_SIZE_8BIT == u32DataBits) ? 8UL : 16UL;
+    pstcResult->u32Len = u32Len;
+    pstcResult->u32CyclesWire = u32Len * pstcResult->u32DataBits * BENCH_CYCLES_PER_BIT;
+    u32Bytes = u32Len * (pstcResult->u32DataBits / 8UL);
+
+    Bench_SpiConfig(u32DataBits);
+
+    (void)memset(m_au16RxBuf, 0, sizeof(m_au16RxBuf));
+    u32Start = SysTick->VAL;
+    i32Ret = SPI_TransReceive(BENCH_SPI_UNIT, m_au16TxBuf, m_au16RxBuf, u32Len, BENCH_TIMEOUT);
+    pstcResult->u32CyclesNormal = Bench_CycleElapsed(u32Start);
+    if (LL_OK == i32Ret) {
+        i32Ret = Bench_Verify(u32Bytes);
+    }
+
+    if (LL_OK == i32Ret) {
+        (void)memset(m_au16RxBuf, 0, sizeof(m_au16RxBuf));
+        u32Start = SysTick->VAL;
+        i32Ret = SPI_PipelineTransReceive(BENCH_SPI_UNIT, m_au16TxBuf, m_au16RxBuf, u32Len, BENCH_TIMEOUT);
+        pstcResult->u32CyclesPipeline = Bench_CycleElapsed(u32Start);
+        if (LL_OK == i32Ret) {
+            i32Ret = Bench_Verify(u32Bytes);
+        }
+    }
+    pstcResult->i32Ret = i32Ret;
+}
+
+/**
+ * @brief  Main function of SPI pipeline benchmark
+ * @param  None
+ * @retval int32_t return value, if needed
+ */
+int32_t main(void)
+{
+    uint32_t i;
+    uint32_t u32Case = 0UL;
+    const stc_bench_result_t *pstcResult;
+
+    LL_PERIPH_WE(LL_PERIPH_ALL);
+    DDL_PrintfInit(BSP_PRINTF_DEVICE, BSP_PRINTF_BAUDRATE, BSP_PRINTF_Preinit);
+    FCG_Fcg0PeriphClockCmd(BENCH_SPI_FCG, ENABLE);
+    LL_PERIPH_WP(LL_PERIPH_ALL);
+
+    for (i = 0UL; i < ARRAY_SZ(m_au16TxBuf); i++) {
+        m_au16TxBuf[i] = (uint16_t)((i * 0x9E37UL) ^ 0xA55AUL);
+    }
+
+    /* Interrupts would add jitter to the cycle counts and may overload the pipelined transfer */
+    __disable_irq();
+    Bench_CycleCounterInit();
+    for (i = 0UL; i < ARRAY_SZ(m_au32BenchLen); i++) {
+        Bench_RunCase(SPI_DATA_SIZE_8BIT, m_au32BenchLen[i], &g_astcBenchResult[u32Case++]);
+    }
+    for (i = 0UL; i < ARRAY_SZ(m_au32BenchLen); i++) {
+        Bench_RunCase(SPI_DATA_SIZE_16BIT, m_au32BenchLen[i], &g_astcBenchResult[u32Case++]);
+    }
+    __enable_irq();
+
+    /* One line per case: bits, frames, normal cycles, pipeline cycles, wire cycles, result */
+    DDL_Printf("bits,frames,normal,pipeline,wire,ret\r\n");
+    for (i = 0UL; i < BENCH_CASE_NUM; i++) {
+        pstcResult = &g_astcBenchResult[i];
+        DDL_Printf("%lu,%lu,%lu,%lu,%lu,%ld\r\n", pstcResult->u32DataBits, pstcResult->u32Len,
+                   pstcResult->u32CyclesNormal, pstcResult->u32CyclesPipeline, pstcResult->u32CyclesWire,
+                   (long)pstcResult->i32Ret);
+    }
+
+    for (;;) {
+    }
+}
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
@@ -0,0 +1,516 @@
+/**
+ *******************************************************************************
+ * @file  spi_nor.c
+ * @brief This file provides firmware functions for the SPI NOR flash
+ *        component: JEDEC ID probe, fast read, page program and erase of the
+ *        25-series parts with 3 address bytes.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-17       CDT             First version
+                                    Single exit in the API functions
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2022-2023, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "spi_nor.h"
+#include "hc32_ll_gpio.h"
+#include "hc32_ll_spi.h"
+
+/**
+ * @addtogroup BSP
+ * @{
+ */
+
+/**
+ * @addtogroup Components
+ * @{
+ */
+
+/**
+ * @defgroup SPI_NOR SPI_NOR
+ * @{
+ */
+
+#if (BSP_SPI_NOR_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup SPI_NOR_Local_Macros SPI NOR Local Macros
+ * @{
+ */
+#define SPI_NOR_CMD_JEDEC_ID            (0x9FU)
+#define SPI_NOR_CMD_READ_STATUS         (0x05U)
+#define SPI_NOR_CMD_WRITE_ENABLE        (0x06U)
+#define SPI_NOR_CMD_FAST_READ           (0x0BU)
+#define SPI_NOR_CMD_PAGE_PROGRAM        (0x02U)
+
+#define SPI_NOR_STATUS_WIP              (0x01U)
+
+/* Capacity byte of the JEDEC ID: 2^n bytes, 3 address bytes reach 16MB */
+#define SPI_NOR_CAPACITY_MIN            (10UL)
+#define SPI_NOR_CAPACITY_MAX            (24UL)
+
+/* Command, 3 address bytes and the dummy byte of the fast read */
+#define SPI_NOR_HEAD_LEN                (5UL)
+
+#define SPI_NOR_CS_ACTIVE(p)            GPIO_FAST_WritePin((p)->u8CsPort, (p)->u16CsPin, PIN_RESET)
+#define SPI_NOR_CS_INACTIVE(p)          GPIO_FAST_WritePin((p)->u8CsPort, (p)->u16CsPin, PIN_SET)
+
+#define IS_SPI_NOR_ERASE_TYPE(x)                                               \
+(   ((x) == SPI_NOR_ERASE_SECTOR)               ||                             \
+    ((x) == SPI_NOR_ERASE_BLOCK_32K)            ||                             \
+    ((x) == SPI_NOR_ERASE_BLOCK_64K)            ||                             \
+    ((x) == SPI_NOR_ERASE_CHIP))
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @defgroup SPI_NOR_Local_Functions SPI NOR Local Functions
+ * @{
+ */
+
+/**
+ * @brief  Run one command under the chip select: the head, then the data out or in.
+ * @param  [in] pstcNor                 Pointer to the handle
+ * @param  [in] pu8Head                 Command and address bytes
+ * @param  [in] u32HeadLen              Number of head bytes
+ * @param  [in] pu8Tx                   Data to send, NULL if none
+ * @param  [out] pu8Rx                  Buffer for the data read, NULL if none
+ * @param  [in] u32Len                  Number of data bytes, 0 for a head only command
+ * @retval int32_t:
+ *           - LL_OK:                   Done.
+ *           - Others:                  @ref SPI_PipelineTransReceive
+ */
+static int32_t SPI_NOR_Cmd(const stc_spi_nor_t *pstcNor, const uint8_t *pu8Head, uint32_t u32HeadLen,
+                           const uint8_t *pu8Tx, uint8_t *pu8Rx, uint32_t u32Len)
+{
+    int32_t i32Ret;
+
+    SPI_NOR_CS_ACTIVE(pstcNor);
+    i32Ret = SPI_PipelineTransReceive(pstcNor->SPIx, pu8Head, NULL, u32HeadLen, SPI_NOR_SPI_TIMEOUT);
+    if ((LL_OK == i32Ret) && (0UL != u32Len)) {
+        /* Straight between the caller buffer and the bus, NULL TX shifts out 0xFF */
+        i32Ret = SPI_PipelineTransReceive(pstcNor->SPIx, pu8Tx, pu8Rx, u32Len, SPI_NOR_SPI_TIMEOUT);
+    }
+    SPI_NOR_CS_INACTIVE(pstcNor);
+    return i32Ret;
+}
+
+/**
+ * @brief  Fill the command and the 3 address bytes, MSB first.
+ * @param  [out] pu8Head                Head buffer, SPI_NOR_HEAD_LEN bytes
+ * @param  [in] u8Cmd                   Command
+ * @param  [in] u32Addr                 Flash address
+ * @retval None
+ */
+static void SPI_NOR_Head(uint8_t *pu8Head, uint8_t u8Cmd, uint32_t u32Addr)
+{
+    pu8Head[0] = u8Cmd;
+    pu8Head[1] = (uint8_t)(u32Addr >> 16U);
+    pu8Head[2] = (uint8_t)(u32Addr >> 8U);
+    pu8Head[3] = (uint8_t)u32Addr;
+    pu8Head[4] = 0xFFU;
+}
+
+/**
+ * @brief  Wait for the last program or erase, then set the write enable latch.
+ * @param  [in] pstcNor                 Pointer to the handle
+ * @retval int32_t:
+ *           - LL_OK:                   The part takes a program or erase command.
+ *           - Others:                  @ref SPI_NOR_WaitReady
+ */
+static int32_t SPI_NOR_WriteEnable(stc_spi_nor_t *pstcNor)
+{
+    const uint8_t u8Cmd = SPI_NOR_CMD_WRITE_ENABLE;
+    int32_t i32Ret;
+
+    i32Ret = SPI_NOR_WaitReady(pstcNor, SPI_NOR_BUSY_TIMEOUT);
+    if (LL_OK == i32Ret) {
+        i32Ret = SPI_NOR_Cmd(pstcNor, &u8Cmd, 1UL, NULL, NULL, 0UL);
+    }
+    return i32Ret;
+}
+
+/**
+ * @brief  Start a page program, do not wait for its end.
+ * @param  [in] pstcNor                 Pointer to the handle
+ * @param  [in] u32Addr                 Flash address
+ * @param  [in] pu8Data                 Data, not referenced after the return
+ * @param  [in] u32Len                  Number of bytes, not crossing a page
+ * @retval int32_t:
+ *           - LL_OK:                   Program started.
+ *           - Others:                  @ref SPI_NOR_WaitReady, @ref SPI_PipelineTransReceive
+ */
+static int32_t SPI_NOR_Program(stc_spi_nor_t *pstcNor, uint32_t u32Addr, const uint8_t *pu8Data, uint32_t u32Len)
+{
+    uint8_t au8Head[SPI_NOR_HEAD_LEN];
+    int32_t i32Ret;
+
+    i32Ret = SPI_NOR_WriteEnable(pstcNor);
+    if (LL_OK == i32Ret) {
+        SPI_NOR_Head(au8Head, SPI_NOR_CMD_PAGE_PROGRAM, u32Addr);
+        i32Ret = SPI_NOR_Cmd(pstcNor, au8Head, SPI_NOR_HEAD_LEN - 1UL, pu8Data, NULL, u32Len);
+        if (LL_OK == i32Ret) {
+            pstcNor->u8Busy = 1U;
+        }
+    }
+    return i32Ret;
+}
+
+/**
+ * @brief  Program the buffered bytes, do not wait for the end.
+ * @param  [in] pstcNor                 Pointer to the handle
+ * @retval int32_t:
+ *           - LL_OK:                   Buffer empty or program started.
+ *           - Others:                  @ref SPI_NOR_Program
+ */
+static int32_t SPI_NOR_ProgramBuf(stc_spi_nor_t *pstcNor)
+{
+    int32_t i32Ret = LL_OK;
+
+    if (0UL != pstcNor->u32BufLen) {
+        i32Ret = SPI_NOR_Program(pstcNor, pstcNor->u32BufAddr, pstcNor->au8Buf, pstcNor->u32BufLen);
+        /* The part holds the data now, or it is lost with the error */
+        pstcNor->u32BufLen = 0UL;
+    }
+    return i32Ret;
+}
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup SPI_NOR_Global_Functions SPI NOR Global Functions
+ * @{
+ */
+
+/**
+ * @brief  Probe the part by its JEDEC ID and initialize the handle.
+ * @param  [out] pstcNor                Pointer to the handle
+ * @param  [in] SPIx                    SPI unit, initialized, @ref stc_spi_nor_t
+ * @param  [in] u8CsPort                Chip select port, @ref GPIO_Port_Source for details
+ * @param  [in] u16CsPin                Chip select pin, a single one of @ref GPIO_Pins_Define
+ * @retval int32_t:
+ *           - LL_OK:                   Part found.
+ *           - LL_ERR:                  No part answers, or the capacity is not supported.
+ *           - LL_ERR_INVD_PARAM:       pstcNor or SPIx is NULL.
+ *           - Others:                  @ref SPI_PipelineTransReceive
+ */
+int32_t SPI_NOR_Init(stc_spi_nor_t *pstcNor, CM_SPI_TypeDef *SPIx, uint8_t u8CsPort, uint16_t u16CsPin)
+{
+    uint32_t u32Capacity;
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+
+    if ((NULL != pstcNor) && (NULL != SPIx)) {
+        pstcNor->SPIx = SPIx;
+        pstcNor->u8CsPort = u8CsPort;
+        pstcNor->u16CsPin = u16CsPin;
+        pstcNor->u32JedecId = 0UL;
+        pstcNor->u32Size = 0UL;
+        pstcNor->u32BufAddr = 0UL;
+        pstcNor->u32BufLen = 0UL;
+        pstcNor->u8Busy = 0U;
+        pstcNor->u32PollCount = 0UL;
+        SPI_NOR_CS_INACTIVE(pstcNor);
+
+        i32Ret = SPI_NOR_ReadId(pstcNor, &pstcNor->u32JedecId);
+        if (LL_OK == i32Ret) {
+            u32Capacity = pstcNor->u32JedecId & 0xFFUL;
+            /* A floating MISO reads all ones, a shorted one all zeros */
+            if ((0UL == pstcNor->u32JedecId) || (0xFFFFFFUL == pstcNor->u32JedecId) ||
+                (u32Capacity < SPI_NOR_CAPACITY_MIN) || (u32Capacity > SPI_NOR_CAPACITY_MAX)) {
+                i32Ret = LL_ERR;
+            } else {
+                pstcNor->u32Size = 1UL << u32Capacity;
+            }
+        }
+    }
+    return i32Ret;
+}
+
+/**
+ * @brief  Read the JEDEC ID.
+ * @param  [in] pstcNor                 Pointer to the handle
+ * @param  [out] pu32JedecId            Manufacturer << 16 | memory type << 8 | capacity
+ * @retval int32_t:
+ *           - LL_OK:                   Read.
+ *           - LL_ERR_INVD_PARAM:       pstcNor or pu32JedecId is NULL.
+ *           - Others:                  @ref SPI_NOR_WaitReady, @ref SPI_PipelineTransReceive
+ */
+int32_t SPI_NOR_ReadId(stc_spi_nor_t *pstcNor, uint32_t *pu32JedecId)
+{
+    const uint8_t u8Cmd = SPI_NOR_CMD_JEDEC_ID;
+    uint8_t au8Id[3];
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+
+    if ((NULL != pstcNor) && (NULL != pu32JedecId)) {
+        i32Ret = SPI_NOR_WaitReady(pstcNor, SPI_NOR_BUSY_TIMEOUT);
+        if (LL_OK == i32Ret) {
+            i32Ret = SPI_NOR_Cmd(pstcNor, &u8Cmd, 1UL, NULL, au8Id, 3UL);
+        }
+        if (LL_OK == i32Ret) {
+            *pu32JedecId = ((uint32_t)au8Id[0] << 16U) | ((uint32_t)au8Id[1] << 8U) | au8Id[2];
+        }
+    }
+    return i32Ret;
+}
+
+/**
+ * @brief  Wait for the end of the last program or erase.
+ * @param  [in] pstcNor                 Pointer to the handle
+ * @param  [in] u32Timeout              Status register reads, SPI_NOR_BUSY_TIMEOUT for a program
+ *                                      or a sector/block erase, more for a chip erase
+ * @retval int32_t:
+ *           - LL_OK:                   The part is ready.
+ *           - LL_ERR_TIMEOUT:          Still busy after u32Timeout reads.
+ *           - LL_ERR_INVD_PARAM:       pstcNor is NULL.
+ *           - Others:                  @ref SPI_PipelineTransReceive
+ * @note   Returns at once if no operation is pending. The status is read continuously under one
+ *         chip select, one byte per poll.
+ */
+int32_t SPI_NOR_WaitReady(stc_spi_nor_t *pstcNor, uint32_t u32Timeout)
+{
+    const uint8_t u8Cmd = SPI_NOR_CMD_READ_STATUS;
+    uint8_t u8Status = SPI_NOR_STATUS_WIP;
+    uint32_t u32Count = 0UL;
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+
+    if (NULL != pstcNor) {
+        i32Ret = LL_OK;
+        if (0U != pstcNor->u8Busy) {
+            SPI_NOR_CS_ACTIVE(pstcNor);
+            i32Ret = SPI_PipelineTransReceive(pstcNor->SPIx, &u8Cmd, NULL, 1UL, SPI_NOR_SPI_TIMEOUT);
+            while (LL_OK == i32Ret) {
+                i32Ret = SPI_PipelineTransReceive(pstcNor->SPIx, NULL, &u8Status, 1UL, SPI_NOR_SPI_TIMEOUT);
+                if ((LL_OK != i32Ret) || (0U == (u8Status & SPI_NOR_STATUS_WIP))) {
+                    break;
+                }
+                pstcNor->u32PollCount++;
+                u32Count++;
+                if (u32Count >= u32Timeout) {
+                    i32Ret = LL_ERR_TIMEOUT;
+                }
+            }
+            SPI_NOR_CS_INACTIVE(pstcNor);
+
+            if (LL_OK == i32Ret) {
+                pstcNor->u8Busy = 0U;
+            }
+        }
+    }
+    return i32Ret;
+}
+
+/**
+ * @brief  Read with the fast read command, straight into the caller buffer.
+ * @param  [in] pstcNor                 Pointer to the handle
+ * @param  [in] u32Addr                 Flash address
+ * @param  [out] pu8Buf                 Buffer for the data
+ * @param  [in] u32Len                  Number of bytes
+ * @retval int32_t:
+ *           - LL_OK:                   Read.
+ *           - LL_ERR_INVD_PARAM:       NULL pointer, u32Len is 0 or the range is out of the array.
+ *           - Others:                  @ref SPI_NOR_WaitReady, @ref SPI_PipelineTransReceive
+ * @note   Bytes written but still in the coalescing buffer are read from the buffer.
+ */
+int32_t SPI_NOR_Read(stc_spi_nor_t *pstcNor, uint32_t u32Addr, uint8_t *pu8Buf, uint32_t u32Len)
+{
+    uint8_t au8Head[SPI_NOR_HEAD_LEN];
+    uint32_t u32Start;
+    uint32_t u32End;
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+
+    if ((NULL != pstcNor) && (NULL != pu8Buf) && (0UL != u32Len) &&
+        (u32Addr < pstcNor->u32Size) && (u32Len <= (pstcNor->u32Size - u32Addr))) {
+        i32Ret = SPI_NOR_WaitReady(pstcNor, SPI_NOR_BUSY_TIMEOUT);
+        if (LL_OK == i32Ret) {
+            SPI_NOR_Head(au8Head, SPI_NOR_CMD_FAST_READ, u32Addr);
+            i32Ret = SPI_NOR_Cmd(pstcNor, au8Head, SPI_NOR_HEAD_LEN, NULL, pu8Buf, u32Len);
+        }
+        if ((LL_OK == i32Ret) && (0UL != pstcNor->u32BufLen)) {
+            /* Overlap of the read range and the buffered range */
+            u32Start = (u32Addr > pstcNor->u32BufAddr) ? u32Addr : pstcNor->u32BufAddr;
+            u32End = ((u32Addr + u32Len) < (pstcNor->u32BufAddr + pstcNor->u32BufLen)) ?
+                     (u32Addr + u32Len) : (pstcNor->u32BufAddr + pstcNor->u32BufLen);
+            for (; u32Start < u32End; u32Start++) {
+                /* Not programmed yet, the result is what the program would leave */
+                pu8Buf[u32Start - u32Addr] &= pstcNor->au8Buf[u32Start - pstcNor->u32BufAddr];
+            }
+        }
+    }
+    return i32Ret;
+}
+
+/**
+ * @brief  Write through the coalescing buffer.
+ * @param  [in] pstcNor                 Pointer to the handle
+ * @param  [in] u32Addr                 Flash address, erased before
+ * @param  [in] pu8Data                 Data
+ * @param  [in] u32Len                  Number of bytes
+ * @retval int32_t:
+ *           - LL_OK:                   Written, or buffered.
+ *           - LL_ERR_INVD_PARAM:       NULL pointer, u32Len is 0 or the range is out of the array.
+ *           - Others:                  @ref SPI_NOR_WaitReady, @ref SPI_PipelineTransReceive
+ * @note   Writes following each other are collected up to the end of a page and programmed by one
+ *         page program. A page program is started once the page is complete, by a write elsewhere,
+ *         or by SPI_NOR_Flush(). The part of a write that reaches the end of a page while the buffer
+ *         is empty is programmed from pu8Data without copying.
+ * @note   The function returns without waiting for the program, it is waited for by the next
+ *         command: the caller prepares the next data while the part programs.
+ */
+int32_t SPI_NOR_Write(stc_spi_nor_t *pstcNor, uint32_t u32Addr, const uint8_t *pu8Data, uint32_t u32Len)
+{
+    uint32_t u32PageEnd;
+    uint32_t u32Chunk;
+    uint32_t i;
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+
+    if ((NULL != pstcNor) && (NULL != pu8Data) && (0UL != u32Len) &&
+        (u32Addr < pstcNor->u32Size) && (u32Len <= (pstcNor->u32Size - u32Addr))) {
+        i32Ret = LL_OK;
+        while ((0UL != u32Len) && (LL_OK == i32Ret)) {
+            u32PageEnd = (u32Addr | (SPI_NOR_PAGE_SIZE - 1UL)) + 1UL;
+            u32Chunk = ((u32PageEnd - u32Addr) < u32Len) ? (u32PageEnd - u32Addr) : u32Len;
+
+            if ((0UL != pstcNor->u32BufLen) && (u32Addr != (pstcNor->u32BufAddr + pstcNor->u32BufLen))) {
+                /* Not contiguous with the buffer */
+                i32Ret = SPI_NOR_ProgramBuf(pstcNor);
+            }
+            if (LL_OK == i32Ret) {
+                if ((0UL == pstcNor->u32BufLen) && ((u32Addr + u32Chunk) == u32PageEnd)) {
+                    i32Ret = SPI_NOR_Program(pstcNor, u32Addr, pu8Data, u32Chunk);
+                } else {
+                    if (0UL == pstcNor->u32BufLen) {
+                        pstcNor->u32BufAddr = u32Addr;
+                    }
+                    for (i = 0UL; i < u32Chunk; i++) {
+                        pstcNor->au8Buf[pstcNor->u32BufLen + i] = pu8Data[i];
+                    }
+                    pstcNor->u32BufLen += u32Chunk;
+                    if ((pstcNor->u32BufAddr + pstcNor->u32BufLen) == u32PageEnd) {
+                        i32Ret = SPI_NOR_ProgramBuf(pstcNor);
+                    }
+                }
+            }
+            u32Addr += u32Chunk;
+            pu8Data += u32Chunk;
+            u32Len -= u32Chunk;
+        }
+    }
+    return i32Ret;
+}
+
+/**
+ * @brief  Program the buffered bytes and wait for the end of all writes.
+ * @param  [in] pstcNor                 Pointer to the handle
+ * @retval int32_t:
+ *           - LL_OK:                   All written data is in the array.
+ *           - LL_ERR_INVD_PARAM:       pstcNor is NULL.
+ *           - Others:                  @ref SPI_NOR_WaitReady, @ref SPI_PipelineTransReceive
+ */
+int32_t SPI_NOR_Flush(stc_spi_nor_t *pstcNor)
+{
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+
+    if (NULL != pstcNor) {
+        i32Ret = SPI_NOR_ProgramBuf(pstcNor);
+        if (LL_OK == i32Ret) {
+            i32Ret = SPI_NOR_WaitReady(pstcNor, SPI_NOR_BUSY_TIMEOUT);
+        }
+    }
+    return i32Ret;
+}
+
+/**
+ * @brief  Start an erase, do not wait for its end.
+ * @param  [in] pstcNor                 Pointer to the handle
+ * @param  [in] u32Addr                 Address in the sector or block, not used for the chip
+ * @param  [in] u8Type                  Erase size, @ref SPI_NOR_Erase_Type
+ * @retval int32_t:
+ *           - LL_OK:                   Erase started.
+ *           - LL_ERR_INVD_PARAM:       pstcNor is NULL, u8Type is invalid or u32Addr out of the array.
+ *           - Others:                  @ref SPI_NOR_WaitReady, @ref SPI_PipelineTransReceive
+ * @note   The buffered bytes are programmed first. After a chip erase, call SPI_NOR_WaitReady()
+ *         with a timeout long enough for the part before the next command.
+ */
+int32_t SPI_NOR_Erase(stc_spi_nor_t *pstcNor, uint32_t u32Addr, uint8_t u8Type)
+{
+    uint8_t au8Head[SPI_NOR_HEAD_LEN];
+    uint32_t u32HeadLen = SPI_NOR_HEAD_LEN - 1UL;
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+
+    if ((NULL != pstcNor) && IS_SPI_NOR_ERASE_TYPE(u8Type) && (u32Addr < pstcNor->u32Size)) {
+        i32Ret = SPI_NOR_ProgramBuf(pstcNor);
+        if (LL_OK == i32Ret) {
+            i32Ret = SPI_NOR_WriteEnable(pstcNor);
+        }
+        if (LL_OK == i32Ret) {
+            SPI_NOR_Head(au8Head, u8Type, u32Addr);
+            if (SPI_NOR_ERASE_CHIP == u8Type) {
+                u32HeadLen = 1UL;
+            }
+            i32Ret = SPI_NOR_Cmd(pstcNor, au8Head, u32HeadLen, NULL, NULL, 0UL);
+            if (LL_OK == i32Ret) {
+                pstcNor->u8Busy = 1U;
+            }
+        }
+    }
+    return i32Ret;
+}
+
+/**
+ * @}
+ */
+
+#endif /* BSP_SPI_NOR_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
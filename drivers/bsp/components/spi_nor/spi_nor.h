@@ -0,0 +1,180 @@
+/**
+ *******************************************************************************
+ * @file  spi_nor.h
+ * @brief This file contains all the functions prototypes of the SPI NOR flash
+ *        component driver library.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-17       CDT             First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2022-2023, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+#ifndef __SPI_NOR_H__
+#define __SPI_NOR_H__
+
+/* C binding of definitions if building with C++ compiler */
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_ll_def.h"
+
+#include "hc32f1xx.h"
+#include "hc32f1xx_conf.h"
+
+/**
+ * @addtogroup BSP
+ * @{
+ */
+
+/**
+ * @addtogroup Components
+ * @{
+ */
+
+/**
+ * @addtogroup SPI_NOR
+ * @{
+ */
+
+#if (BSP_SPI_NOR_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Global pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup SPI_NOR_Global_Macros SPI NOR Global Macros
+ * @{
+ */
+
+/**
+ * @defgroup SPI_NOR_Config SPI NOR Configuration
+ * @brief Can be overridden in hc32f1xx_conf.h.
+ * @{
+ */
+#ifndef SPI_NOR_PAGE_SIZE
+#define SPI_NOR_PAGE_SIZE               (256UL)     /*!< Page program size of the part, also the size of
+                                                         the write coalescing buffer */
+#endif
+#ifndef SPI_NOR_SPI_TIMEOUT
+#define SPI_NOR_SPI_TIMEOUT             (0x1000UL)  /*!< SPI flag wait, @ref SPI_PipelineTransReceive */
+#endif
+#ifndef SPI_NOR_BUSY_TIMEOUT
+#define SPI_NOR_BUSY_TIMEOUT            (0x400000UL)
+                                                    /*!< Status polls for a program or a sector/block erase
+                                                         to end, about 3s at 12MHz SCK */
+#endif
+/**
+ * @}
+ */
+
+/**
+ * @defgroup SPI_NOR_Erase_Type SPI NOR Erase Type
+ * @{
+ */
+#define SPI_NOR_ERASE_SECTOR            (0x20U)     /*!< 4KB sector */
+#define SPI_NOR_ERASE_BLOCK_32K         (0x52U)     /*!< 32KB block */
+#define SPI_NOR_ERASE_BLOCK_64K         (0xD8U)     /*!< 64KB block */
+#define SPI_NOR_ERASE_CHIP              (0xC7U)     /*!< Whole array, the address is not used */
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @defgroup SPI_NOR_Global_Types SPI NOR Global Types
+ * @{
+ */
+
+/**
+ * @brief SPI NOR flash handle structure definition
+ * @note  The SPI is initialized by the application as full duplex master with 8-bit words, mode 0 or
+ *        mode 3, MSB first. The chip select pin is a GPIO output, it is driven through PODR by
+ *        GPIO_FAST_WritePin().
+ * @note  Program and erase return when the part has taken the command. The next command that
+ *        needs the part waits for it, so the caller can prepare the next page while the part
+ *        programs the last one. SPI_NOR_Flush() waits for the end of all writes.
+ */
+typedef struct {
+    CM_SPI_TypeDef *SPIx;               /*!< SPI unit. */
+    uint8_t u8CsPort;                   /*!< Chip select port, @ref GPIO_Port_Source for details. */
+    uint16_t u16CsPin;                  /*!< Chip select pin, active low, a single one of @ref GPIO_Pins_Define. */
+    uint32_t u32JedecId;                /*!< Manufacturer, memory type and capacity of the part. */
+    uint32_t u32Size;                   /*!< Array size in bytes, from the capacity byte. */
+    uint32_t u32BufAddr;                /*!< Flash address of the first buffered byte. */
+    uint32_t u32BufLen;                 /*!< Buffered bytes not yet programmed, 0 if the buffer is empty. */
+    uint8_t u8Busy;                     /*!< 1U after a program or erase until the part was seen ready. */
+    uint32_t u32PollCount;              /*!< Status register reads with WIP set, for tuning. */
+    uint8_t au8Buf[SPI_NOR_PAGE_SIZE];  /*!< Write coalescing buffer, never crosses a page. */
+} stc_spi_nor_t;
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions ('extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+  Global function prototypes (definition in C source)
+ ******************************************************************************/
+/**
+ * @addtogroup SPI_NOR_Global_Functions
+ * @{
+ */
+int32_t SPI_NOR_Init(stc_spi_nor_t *pstcNor, CM_SPI_TypeDef *SPIx, uint8_t u8CsPort, uint16_t u16CsPin);
+int32_t SPI_NOR_ReadId(stc_spi_nor_t *pstcNor, uint32_t *pu32JedecId);
+int32_t SPI_NOR_WaitReady(stc_spi_nor_t *pstcNor, uint32_t u32Timeout);
+
+int32_t SPI_NOR_Read(stc_spi_nor_t *pstcNor, uint32_t u32Addr, uint8_t *pu8Buf, uint32_t u32Len);
+int32_t SPI_NOR_Write(stc_spi_nor_t *pstcNor, uint32_t u32Addr, const uint8_t *pu8Data, uint32_t u32Len);
+int32_t SPI_NOR_Flush(stc_spi_nor_t *pstcNor);
+int32_t SPI_NOR_Erase(stc_spi_nor_t *pstcNor, uint32_t u32Addr, uint8_t u8Type);
+
+/**
+ * @}
+ */
+
+#endif /* BSP_SPI_NOR_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __SPI_NOR_H__ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
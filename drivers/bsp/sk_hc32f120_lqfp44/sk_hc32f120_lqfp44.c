@@ -6,6 +6,7 @@
    Change Logs:
    Date             Author          Notes
    2022-03-31       CDT             First version
+   2026-10-17       CDT             Initialize the LED and key pins by GPIO_InitTable()
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2022-2023, Xiaohua Semiconductor Co., Ltd. All rights reserved.
@@ -65,12 +66,30 @@ static const uint8_t BSP_LED_PORT[BSP_LED_NUM] =                               \
 static const uint8_t BSP_LED_PIN[BSP_LED_NUM] =                                \
 {BSP_LED_RED_PIN, BSP_LED_YELLOW_PIN, BSP_LED_BLUE_PIN};
 
+static const stc_gpio_pin_cfg_t BSP_LED_PIN_CFG[BSP_LED_NUM] = {
+    GPIO_PIN_CFG(BSP_LED_RED_PORT,      BSP_LED_RED_PIN,    GPIO_FUNC_0, PIN_DIR_OUT | PIN_STAT_SET),
+    GPIO_PIN_CFG(BSP_LED_YELLOW_PORT,   BSP_LED_YELLOW_PIN, GPIO_FUNC_0, PIN_DIR_OUT | PIN_STAT_SET),
+    GPIO_PIN_CFG(BSP_LED_BLUE_PORT,     BSP_LED_BLUE_PIN,   GPIO_FUNC_0, PIN_DIR_OUT | PIN_STAT_SET),
+};
+
 static const uint8_t BSP_KEY_PORT[BSP_KEY_NUM] =                               \
 {BSP_KEY1_PORT, BSP_KEY2_PORT};
 
 static const uint8_t BSP_KEY_PIN[BSP_KEY_NUM] =                                \
 {BSP_KEY1_PIN, BSP_KEY2_PIN};
 
+static const stc_gpio_pin_cfg_t BSP_KEY_PIN_CFG[BSP_KEY_NUM] = {
+    GPIO_PIN_CFG(BSP_KEY1_PORT,         BSP_KEY1_PIN,       GPIO_FUNC_0, 0U),
+    GPIO_PIN_CFG(BSP_KEY2_PORT,         BSP_KEY2_PIN,       GPIO_FUNC_0, 0U),
+};
+
+#if (DDL_ON == BSP_INT_KEY_ENABLE)
+static const stc_gpio_pin_cfg_t BSP_KEY_EXTINT_PIN_CFG[BSP_KEY_NUM] = {
+    GPIO_PIN_CFG(BSP_KEY1_PORT,         BSP_KEY1_PIN,       GPIO_FUNC_0, PIN_EXTINT_ON),
+    GPIO_PIN_CFG(BSP_KEY2_PORT,         BSP_KEY2_PIN,       GPIO_FUNC_0, PIN_EXTINT_ON),
+};
+#endif
+
 static uint32_t m_u32GlobalKey = 0x00UL;
 
 /*******************************************************************************
@@ -88,18 +107,8 @@ static uint32_t m_u32GlobalKey = 0x00UL;
  */
 void BSP_LED_Init(void)
 {
-    uint8_t i;
-    stc_gpio_init_t stcGpioInit;
-
-    /* Initialize GPIO structure */
-    (void)GPIO_StructInit(&stcGpioInit);
-    stcGpioInit.u16PinDir = PIN_DIR_OUT;
-    stcGpioInit.u16PinState = PIN_STAT_SET;
-
     /* Initialize RGB LED pin */
-    for (i = 0U; i < BSP_LED_NUM; i++) {
-        (void)GPIO_Init(BSP_LED_PORT[i], BSP_LED_PIN[i], &stcGpioInit);
-    }
+    (void)GPIO_InitTable(BSP_LED_PIN_CFG, BSP_LED_NUM);
 }
 
 /**
@@ -324,23 +333,15 @@ __WEAKDEF void BSP_KEY_KEY2_IrqCallback(void)
  */
 void BSP_KEY_Init(uint8_t u8Mode)
 {
-    uint8_t i;
-    stc_gpio_init_t stcGpioInit;
 #if (DDL_ON == BSP_INT_KEY_ENABLE)
     stc_extint_init_t stcExtIntInit;
 #endif
-    (void)GPIO_StructInit(&stcGpioInit);
     if (BSP_KEY_MD_GPIO == u8Mode) {
-        for (i = 0U; i < BSP_KEY_NUM; i++) {
-            (void)GPIO_Init(BSP_KEY_PORT[i], BSP_KEY_PIN[i], &stcGpioInit);
-        }
+        (void)GPIO_InitTable(BSP_KEY_PIN_CFG, BSP_KEY_NUM);
     }
 #if (DDL_ON == BSP_INT_KEY_ENABLE)
     else if (BSP_KEY_MD_EXTINT == u8Mode) {
-        stcGpioInit.u16ExtInt = PIN_EXTINT_ON;
-        for (i = 0U; i < BSP_KEY_NUM; i++) {
-            (void)GPIO_Init(BSP_KEY_PORT[i], BSP_KEY_PIN[i], &stcGpioInit);
-        }
+        (void)GPIO_InitTable(BSP_KEY_EXTINT_PIN_CFG, BSP_KEY_NUM);
 
         (void)EXTINT_StructInit(&stcExtIntInit);
         stcExtIntInit.u32Edge = EXTINT_TRIG_FALLING;
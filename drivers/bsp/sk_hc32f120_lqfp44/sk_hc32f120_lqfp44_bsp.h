@@ -7,6 +7,7 @@
    Change Logs:
    Date             Author          Notes
    2022-03-31       CDT             First version
+   2026-10-17       CDT             Add SPI NOR flash component
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2022-2023, Xiaohua Semiconductor Co., Ltd. All rights reserved.
@@ -41,7 +42,9 @@ extern "C"
 /**
  * @brief Include BSP device component's header file
  */
-
+#if (BSP_SPI_NOR_ENABLE == DDL_ON)
+#include "spi_nor.h"
+#endif /* BSP_SPI_NOR_ENABLE */
 
 /*******************************************************************************
  * Global type definitions ('typedef')
@@ -6,6 +6,7 @@
    Change Logs:
    Date             Author          Notes
    2022-03-31       CDT             First version
+   2026-10-16       CDT             Fix HCLK_VALUE, SystemCoreClock is divided already
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2022-2023, Xiaohua Semiconductor Co., Ltd. All rights reserved.
@@ -64,7 +65,7 @@ extern "C"
 #endif
 
 #if !defined (HCLK_VALUE)
-#define HCLK_VALUE                      (SystemCoreClock >> (CM_CMU->SCKDIVR & CMU_SCKDIVR_SCKDIV))
+#define HCLK_VALUE                      (SystemCoreClock)   /*!< SystemCoreClockUpdate() applies SCKDIV */
 #endif
 
 /**
@@ -113,6 +113,10 @@ extern "C"
 #include "hc32_ll_adc.h"
 #endif /* LL_ADC_ENABLE */
 
+#if (LL_ADC_ACQ_ENABLE == DDL_ON)
+#include "hc32_ll_adc_acq.h"
+#endif /* LL_ADC_ACQ_ENABLE */
+
 #if (LL_AOS_ENABLE == DDL_ON)
 #include "hc32_ll_aos.h"
 #endif /* LL_AOS_ENABLE */
@@ -129,10 +133,18 @@ extern "C"
 #include "hc32_ll_ctc.h"
 #endif /* LL_CTC_ENABLE */
 
+#if (LL_DVFS_ENABLE == DDL_ON)
+#include "hc32_ll_dvfs.h"
+#endif /* LL_DVFS_ENABLE */
+
 #if (LL_EFM_ENABLE == DDL_ON)
 #include "hc32_ll_efm.h"
 #endif /* LL_EFM_ENABLE */
 
+#if (LL_EFM_KV_ENABLE == DDL_ON)
+#include "hc32_ll_efm_kv.h"
+#endif /* LL_EFM_KV_ENABLE */
+
 #if (LL_FCG_ENABLE == DDL_ON)
 #include "hc32_ll_fcg.h"
 #endif /* LL_FCG_ENABLE */
@@ -145,10 +157,18 @@ extern "C"
 #include "hc32_ll_i2c.h"
 #endif /* LL_I2C_ENABLE */
 
+#if (LL_I2C_INT_ENABLE == DDL_ON)
+#include "hc32_ll_i2c_int.h"
+#endif /* LL_I2C_INT_ENABLE */
+
 #if (LL_ICG_ENABLE == DDL_ON)
 #include "hc32_ll_icg.h"
 #endif /* LL_ICG_ENABLE */
 
+#if (LL_INTC_STAT_ENABLE == DDL_ON)
+#include "hc32_ll_intc_stat.h"
+#endif /* LL_INTC_STAT_ENABLE */
+
 #if (LL_INTERRUPTS_ENABLE == DDL_ON)
 #include "hc32_ll_interrupts.h"
 #endif /* LL_INTERRUPTS_ENABLE */
@@ -157,26 +177,58 @@ extern "C"
 #include "hc32f120_ll_interrupts_share.h"
 #endif /* LL_INTERRUPTS_ENABLE */
 
+#if (LL_KERNEL_ENABLE == DDL_ON)
+#include "hc32_ll_kernel.h"
+#endif /* LL_KERNEL_ENABLE */
+
 #if (LL_PWC_ENABLE == DDL_ON)
 #include "hc32_ll_pwc.h"
 #endif /* LL_PWC_ENABLE */
 
+#if (LL_PWC_IDLE_ENABLE == DDL_ON)
+#include "hc32_ll_pwc_idle.h"
+#endif /* LL_PWC_IDLE_ENABLE */
+
+#if (LL_PROF_ENABLE == DDL_ON)
+#include "hc32_ll_prof.h"
+#endif /* LL_PROF_ENABLE */
+
 #if (LL_RMU_ENABLE == DDL_ON)
 #include "hc32_ll_rmu.h"
 #endif /* LL_RMU_ENABLE */
 
+#if (LL_SCHED_ENABLE == DDL_ON)
+#include "hc32_ll_sched.h"
+#endif /* LL_SCHED_ENABLE */
+
 #if (LL_SPI_ENABLE == DDL_ON)
 #include "hc32_ll_spi.h"
 #endif /* LL_SPI_ENABLE */
 
+#if (LL_SPI_INT_ENABLE == DDL_ON)
+#include "hc32_ll_spi_int.h"
+#endif /* LL_SPI_INT_ENABLE */
+
+#if (LL_SPSC_ENABLE == DDL_ON)
+#include "hc32_ll_spsc.h"
+#endif /* LL_SPSC_ENABLE */
+
 #if (LL_SWDT_ENABLE == DDL_ON)
 #include "hc32_ll_swdt.h"
 #endif /* LL_SWDT_ENABLE */
 
+#if (LL_TLOG_ENABLE == DDL_ON)
+#include "hc32_ll_tlog.h"
+#endif /* LL_TLOG_ENABLE */
+
 #if (LL_TMR0_ENABLE == DDL_ON)
 #include "hc32_ll_tmr0.h"
 #endif /* LL_TMR0_ENABLE */
 
+#if (LL_TMR0_WHEEL_ENABLE == DDL_ON)
+#include "hc32_ll_tmr0_wheel.h"
+#endif /* LL_TMR0_WHEEL_ENABLE */
+
 #if (LL_TMRB_ENABLE == DDL_ON)
 #include "hc32_ll_tmrb.h"
 #endif /* LL_TMRB_ENABLE */
@@ -185,6 +237,10 @@ extern "C"
 #include "hc32_ll_usart.h"
 #endif /* LL_USART_ENABLE */
 
+#if (LL_USART_ASYNC_ENABLE == DDL_ON)
+#include "hc32_ll_usart_async.h"
+#endif /* LL_USART_ASYNC_ENABLE */
+
 #if (LL_UTILITY_ENABLE == DDL_ON)
 #include "hc32_ll_utility.h"
 #endif /* LL_UTILITY_ENABLE */
@@ -0,0 +1,128 @@
+/**
+ *******************************************************************************
+ * @file  hc32_ll_adc_acq.h
+ * @brief This file contains all the functions prototypes of the ADC
+ *        timer-triggered acquisition driver library.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-16       CDT             First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2022-2023, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+#ifndef __HC32_LL_ADC_ACQ_H__
+#define __HC32_LL_ADC_ACQ_H__
+
+/* C binding of definitions if building with C++ compiler */
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_ll_def.h"
+
+#include "hc32f1xx.h"
+#include "hc32f1xx_conf.h"
+
+/**
+ * @addtogroup LL_Driver
+ * @{
+ */
+
+/**
+ * @addtogroup LL_ADC_ACQ
+ * @{
+ */
+
+#if (LL_ADC_ACQ_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Global type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @defgroup ADC_ACQ_Global_Types ADC Acquisition Global Types
+ * @{
+ */
+
+/**
+ * @brief ADC acquisition initialization structure definition
+ * @note  pu16Buf holds two blocks (ping and pong) of u32BlockScans scans each, a scan is
+ *        the results of the channels in u16ChMask in ascending channel order. Its size is
+ *        2 * u32BlockScans * (number of channels) halfwords.
+ */
+typedef struct {
+    uint16_t u16ChMask;                 /*!< Channels of sequence A, bit n for @ref ADC_Channel ADC_CHn. */
+    en_event_src_t enTriggerSrc;        /*!< Event starting sequence A, e.g. EVT_SRC_TMRB_1_CMP. */
+    uint16_t *pu16Buf;                  /*!< Ping-pong buffer. */
+    uint32_t u32BlockScans;             /*!< Number of scans per block. */
+    void (*pfnBlockCallback)(const uint16_t *pu16Block, uint32_t u32Len);
+                                        /*!< Called from the EOCA IRQ handler when a block is full,
+                                             u32Len in halfwords. NULL if unused. */
+} stc_adc_acq_init_t;
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Global variable definitions ('extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+  Global function prototypes (definition in C source)
+ ******************************************************************************/
+/**
+ * @addtogroup ADC_ACQ_Global_Functions
+ * @{
+ */
+int32_t ADC_ACQ_StructInit(stc_adc_acq_init_t *pstcAcqInit);
+int32_t ADC_ACQ_Init(CM_ADC_TypeDef *ADCx, const stc_adc_acq_init_t *pstcAcqInit);
+int32_t ADC_ACQ_IrqSignIn(CM_ADC_TypeDef *ADCx, IRQn_Type enIRQn, uint32_t u32IrqPrio);
+
+void ADC_ACQ_Start(CM_ADC_TypeDef *ADCx);
+void ADC_ACQ_Stop(CM_ADC_TypeDef *ADCx);
+
+int32_t ADC_ACQ_GetBlock(const CM_ADC_TypeDef *ADCx, const uint16_t **ppu16Block);
+void ADC_ACQ_ReleaseBlock(CM_ADC_TypeDef *ADCx);
+uint32_t ADC_ACQ_GetOverrunCount(const CM_ADC_TypeDef *ADCx);
+
+void ADC_ACQ_EocaIrqHandler(CM_ADC_TypeDef *ADCx);
+
+/**
+ * @}
+ */
+
+#endif /* LL_ADC_ACQ_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __HC32_LL_ADC_ACQ_H__ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
@@ -7,6 +7,7 @@
    Change Logs:
    Date             Author          Notes
    2022-03-31       CDT             First version
+   2026-10-16       CDT             Add CRC context API for interleaved streams.
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2022-2023, Xiaohua Semiconductor Co., Ltd. All rights reserved.
@@ -65,6 +66,16 @@ typedef struct {
                                  This parameter can be a value of @ref CRC_Initial_Value */
 } stc_crc_init_t;
 
+/**
+ * @brief CRC context structure definition, the running value of one data stream
+ * @note  Filled in by CRC_ContextInit() and CRC_ContextUpdate(), not to be modified.
+ */
+typedef struct {
+    uint32_t u32Protocol;   /*!< CRC Protocol of the stream, a value of @ref CRC_Protocol_Control_Bit */
+    uint32_t u32Value;      /*!< Value written to the result register before the next chunk */
+    uint32_t u32ReadXor;    /*!< Difference of the result register read value from the written value */
+} stc_crc_context_t;
+
 /**
  * @}
  */
@@ -136,6 +147,10 @@ en_flag_status_t CRC_CheckData16(uint32_t u32InitValue, const uint16_t au16Data[
 en_flag_status_t CRC_CheckData32(uint32_t u32InitValue, const uint32_t au32Data[],
                                  uint32_t u32Len, uint32_t u32ExpectValue);
 
+int32_t CRC_ContextInit(stc_crc_context_t *pstcCtx, uint32_t u32Protocol, uint32_t u32InitValue);
+int32_t CRC_ContextUpdate(stc_crc_context_t *pstcCtx, const uint8_t au8Data[], uint32_t u32Len);
+uint32_t CRC_ContextGetValue(const stc_crc_context_t *pstcCtx);
+
 /**
  * @}
  */
@@ -9,6 +9,7 @@
    2022-03-31       CDT             First version
    2023-01-15       CDT             Implemented the definition of __NO_INIT for AC6 and ARM Compiler
    2023-01-15       CDT             ARM Compiler suppress warning message: diag_1296
+   2026-10-16       CDT             RW_MEM8/16/32 can be predefined to relocate memory accesses
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2022-2023, Xiaohua Semiconductor Co., Ltd. All rights reserved.
@@ -311,9 +312,16 @@ area of a module to a memory space in physical RAM. */
  * @defgroup Register_Macros Register Macros
  * @{
  */
+/* RW_MEMx may be predefined to relocate the accessed address, e.g. the flash window of a host build */
+#ifndef RW_MEM8
 #define RW_MEM8(addr)                   (*(volatile uint8_t *)(addr))
+#endif
+#ifndef RW_MEM16
 #define RW_MEM16(addr)                  (*(volatile uint16_t *)(addr))
+#endif
+#ifndef RW_MEM32
 #define RW_MEM32(addr)                  (*(volatile uint32_t *)(addr))
+#endif
 
 #define SET_REG_BIT(REG, BIT)           ((REG) |= (BIT))
 #define SET_REG8_BIT(REG, BIT)          ((REG) |= ((uint8_t)(BIT)))
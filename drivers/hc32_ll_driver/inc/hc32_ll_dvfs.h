@@ -0,0 +1,206 @@
+/**
+ *******************************************************************************
+ * @file  hc32_ll_dvfs.h
+ * @brief This file contains all the functions prototypes of the dynamic
+ *        frequency scaling service.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-16       CDT             First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2022-2023, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+#ifndef __HC32_LL_DVFS_H__
+#define __HC32_LL_DVFS_H__
+
+/* C binding of definitions if building with C++ compiler */
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_ll_def.h"
+
+#include "hc32f1xx.h"
+#include "hc32f1xx_conf.h"
+#if (LL_I2C_ENABLE == DDL_ON)
+#include "hc32_ll_i2c.h"
+#endif
+
+/**
+ * @addtogroup LL_Driver
+ * @{
+ */
+
+/**
+ * @addtogroup LL_DVFS
+ * @{
+ */
+
+#if (LL_DVFS_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Global type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @defgroup DVFS_Global_Types DVFS Global Types
+ * @{
+ */
+
+/**
+ * @brief DVFS operating point structure definition
+ */
+typedef struct {
+    uint8_t u8SysClkSrc;                /*!< System clock source, @ref CLK_System_Clock_Source.
+                                             The oscillator must be running and stable. */
+    uint32_t u32HclkDiv;                /*!< HCLK divider, @ref CLK_HCLK_Divider. */
+    uint8_t u8PowerMode;                /*!< Power mode, @ref DVFS_Power_Mode. */
+} stc_dvfs_opp_t;
+
+/**
+ * @brief DVFS clock change structure definition, passed to the notifiers
+ */
+typedef struct {
+    uint32_t u32OldHclk;                /*!< HCLK frequency before the change. */
+    uint32_t u32NewHclk;                /*!< HCLK frequency after the change. */
+} stc_dvfs_change_t;
+
+/**
+ * @brief DVFS notifier structure definition
+ * @note  Owned by the caller from DVFS_NotifierRegister() to DVFS_NotifierUnregister().
+ */
+typedef struct stc_dvfs_notifier {
+    int32_t (*pfnCallback)(uint32_t u32Event, const stc_dvfs_change_t *pstcChange, void *pvUserData);
+                                        /*!< Called with a @ref DVFS_Event. On DVFS_EVT_PRE_CHANGE,
+                                             LL_ERR_BUSY vetoes the change. */
+    void *pvUserData;                   /*!< Callback argument. */
+    struct stc_dvfs_notifier *pstcNext; /*!< Notifier internal, chain link. */
+} stc_dvfs_notifier_t;
+
+#if (LL_USART_ENABLE == DDL_ON)
+/**
+ * @brief DVFS USART notifier argument structure definition, for DVFS_UsartCallback()
+ */
+typedef struct {
+    CM_USART_TypeDef *USARTx;           /*!< USART unit, in UART or clock sync mode. */
+    uint32_t u32Baudrate;               /*!< Baudrate to keep. */
+} stc_dvfs_usart_t;
+#endif
+
+#if (LL_I2C_ENABLE == DDL_ON)
+/**
+ * @brief DVFS I2C notifier argument structure definition, for DVFS_I2cCallback()
+ */
+typedef struct {
+    CM_I2C_TypeDef *I2Cx;               /*!< I2C unit. */
+    stc_i2c_init_t stcI2cInit;          /*!< Clock divider, baudrate and SCL time to keep. */
+} stc_dvfs_i2c_t;
+#endif
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup DVFS_Global_Macros DVFS Global Macros
+ * @{
+ */
+
+/**
+ * @defgroup DVFS_Config DVFS Configuration
+ * @brief Can be overridden in hc32f1xx_conf.h.
+ * @{
+ */
+#ifndef DVFS_WAIT_CYCLE0_MAX_FREQ
+#define DVFS_WAIT_CYCLE0_MAX_FREQ       (24000000UL)    /*!< Highest HCLK read without flash wait cycle */
+#endif
+/**
+ * @}
+ */
+
+/**
+ * @defgroup DVFS_Power_Mode DVFS Power Mode
+ * @{
+ */
+#define DVFS_PWR_MD_HIGH_SPEED          (0U)    /*!< High speed mode, any HCLK */
+#define DVFS_PWR_MD_LOW_SPEED           (1U)    /*!< Ultra low speed mode, low HCLK only as per the datasheet */
+/**
+ * @}
+ */
+
+/**
+ * @defgroup DVFS_Event DVFS Event
+ * @{
+ */
+#define DVFS_EVT_PRE_CHANGE             (0UL)   /*!< Before the change, the clocks are still the old ones */
+#define DVFS_EVT_POST_CHANGE            (1UL)   /*!< After the change, SystemCoreClock is the new one */
+#define DVFS_EVT_ABORT                  (2UL)   /*!< A later notifier vetoed the change, nothing changed */
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions ('extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+  Global function prototypes (definition in C source)
+ ******************************************************************************/
+/**
+ * @addtogroup DVFS_Global_Functions
+ * @{
+ */
+int32_t DVFS_NotifierRegister(stc_dvfs_notifier_t *pstcNotifier);
+int32_t DVFS_NotifierUnregister(stc_dvfs_notifier_t *pstcNotifier);
+
+uint32_t DVFS_GetOppFreq(const stc_dvfs_opp_t *pstcOpp);
+int32_t DVFS_SetOpp(const stc_dvfs_opp_t *pstcOpp);
+
+#if (LL_USART_ENABLE == DDL_ON)
+int32_t DVFS_UsartCallback(uint32_t u32Event, const stc_dvfs_change_t *pstcChange, void *pvUserData);
+#endif
+#if (LL_I2C_ENABLE == DDL_ON)
+int32_t DVFS_I2cCallback(uint32_t u32Event, const stc_dvfs_change_t *pstcChange, void *pvUserData);
+#endif
+
+/**
+ * @}
+ */
+
+#endif /* LL_DVFS_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __HC32_LL_DVFS_H__ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
@@ -10,6 +10,7 @@
    2022-10-31       CDT             Add Flash protect level define.
    2023-01-15       CDT             Code refine.
    2023-01-15       CDT             Remove redundancy code.
+   2026-10-16       CDT             Add __EFM_FUNC to place program/erase functions in RAM.
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2022-2023, Xiaohua Semiconductor Co., Ltd. All rights reserved.
@@ -176,6 +177,23 @@ typedef struct {
  * @}
  */
 
+/**
+ * @defgroup EFM_Ram_Func EFM RAM Function
+ * @brief Program and erase functions are linked to .ramfunc (copied to RAM by the
+ *        startup code) when LL_EFM_RAM_FUNC_ENABLE is DDL_ON, so that the core
+ *        and other RAM code keep running while the flash is busy.
+ * @note  The program source buffer should be in RAM as well.
+ * @{
+ */
+#if defined(LL_EFM_RAM_FUNC_ENABLE) && (LL_EFM_RAM_FUNC_ENABLE == DDL_ON)
+#define __EFM_FUNC                      __RAM_FUNC
+#else
+#define __EFM_FUNC
+#endif
+/**
+ * @}
+ */
+
 /**
  * @defgroup EFM_Sector_Size EFM Sector Size
  * @{
@@ -261,18 +279,18 @@ void EFM_ClearStatus(uint32_t u32Flag);
 int32_t EFM_SetWaitCycle(uint32_t u32WaitCycle);
 int32_t EFM_SetOperateMode(uint32_t u32Mode);
 int32_t EFM_ReadByte(uint32_t u32Addr, uint8_t *pu8ReadBuf, uint32_t u32ByteLen);
-int32_t EFM_Program(uint32_t u32Addr, uint8_t *pu8Buf, uint32_t u32Len);
-int32_t EFM_ProgramWord(uint32_t u32Addr, uint32_t u32Data);
-int32_t EFM_ProgramWordReadBack(uint32_t u32Addr, uint32_t u32Data);
-int32_t EFM_SequenceProgram(uint32_t u32Addr, uint8_t *pu8Buf, uint32_t u32Len);
-int32_t EFM_SectorErase(uint32_t u32Addr);
-int32_t EFM_ChipErase(uint8_t u8Chip);
+__EFM_FUNC int32_t EFM_Program(uint32_t u32Addr, uint8_t *pu8Buf, uint32_t u32Len);
+__EFM_FUNC int32_t EFM_ProgramWord(uint32_t u32Addr, uint32_t u32Data);
+__EFM_FUNC int32_t EFM_ProgramWordReadBack(uint32_t u32Addr, uint32_t u32Data);
+__EFM_FUNC int32_t EFM_SequenceProgram(uint32_t u32Addr, uint8_t *pu8Buf, uint32_t u32Len);
+__EFM_FUNC int32_t EFM_SectorErase(uint32_t u32Addr);
+__EFM_FUNC int32_t EFM_ChipErase(uint8_t u8Chip);
 
-int32_t EFM_ProgramHalfWord(uint32_t u32Addr, uint16_t u16Data);
-int32_t EFM_ProgramHalfWordReadBack(uint32_t u32Addr, uint16_t u16Data);
+__EFM_FUNC int32_t EFM_ProgramHalfWord(uint32_t u32Addr, uint16_t u16Data);
+__EFM_FUNC int32_t EFM_ProgramHalfWordReadBack(uint32_t u32Addr, uint16_t u16Data);
 
-int32_t EFM_ProgramByte(uint32_t u32Addr, uint8_t u8Data);
-int32_t EFM_ProgramByteReadBack(uint32_t u32Addr, uint8_t u8Data);
+__EFM_FUNC int32_t EFM_ProgramByte(uint32_t u32Addr, uint8_t u8Data);
+__EFM_FUNC int32_t EFM_ProgramByteReadBack(uint32_t u32Addr, uint8_t u8Data);
 
 en_flag_status_t EFM_GetAnyStatus(uint32_t u32Flag);
 en_flag_status_t EFM_GetStatus(uint32_t u32Flag);
@@ -283,7 +301,7 @@ void EFM_PrefetchCmd(en_functional_state_t enNewState);
 void EFM_SetWindowProtectAddr(uint32_t u32StartAddr, uint32_t u32EndAddr);
 
 void EFM_Protect_Enable(uint8_t u8Level);
-int32_t EFM_WriteSecurityCode(uint8_t *pu8Buf, uint32_t u32Len);
+__EFM_FUNC int32_t EFM_WriteSecurityCode(uint8_t *pu8Buf, uint32_t u32Len);
 
 /**
  * @}
@@ -0,0 +1,140 @@
+/**
+ *******************************************************************************
+ * @file  hc32_ll_efm_kv.h
+ * @brief This file contains all the functions prototypes of the EFM key/value
+ *        store (EEPROM emulation) driver library.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-16       CDT             First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2022-2023, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+#ifndef __HC32_LL_EFM_KV_H__
+#define __HC32_LL_EFM_KV_H__
+
+/* C binding of definitions if building with C++ compiler */
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_ll_def.h"
+
+#include "hc32f1xx.h"
+#include "hc32f1xx_conf.h"
+
+/**
+ * @addtogroup LL_Driver
+ * @{
+ */
+
+/**
+ * @addtogroup LL_EFM_KV
+ * @{
+ */
+
+#if (LL_EFM_KV_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Global type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @defgroup EFM_KV_Global_Types EFM Key/Value Store Global Types
+ * @{
+ */
+
+/**
+ * @brief EFM key/value store initialization structure definition
+ */
+typedef struct {
+    uint32_t u32StartAddr;              /*!< Address of the first sector, sector aligned. */
+    uint32_t u32SectorNum;              /*!< Number of consecutive sectors, at least 2.
+                                             Compaction runs in the background only with 3 or more. */
+} stc_efm_kv_init_t;
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup EFM_KV_Global_Macros EFM Key/Value Store Global Macros
+ * @{
+ */
+
+/**
+ * @defgroup EFM_KV_Config EFM Key/Value Store Configuration
+ * @brief Can be overridden in hc32f1xx_conf.h.
+ * @{
+ */
+#ifndef EFM_KV_KEY_NUM
+#define EFM_KV_KEY_NUM                  (32U)   /*!< Keys are 0 ~ EFM_KV_KEY_NUM - 1, 2 bytes of RAM index each */
+#endif
+#ifndef EFM_KV_VALUE_MAX
+#define EFM_KV_VALUE_MAX                (64U)   /*!< Maximum value length in bytes, 1 ~ 255 */
+#endif
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions ('extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+  Global function prototypes (definition in C source)
+ ******************************************************************************/
+/**
+ * @addtogroup EFM_KV_Global_Functions
+ * @{
+ */
+int32_t EFM_KV_StructInit(stc_efm_kv_init_t *pstcKvInit);
+int32_t EFM_KV_Init(const stc_efm_kv_init_t *pstcKvInit);
+
+int32_t EFM_KV_Read(uint16_t u16Key, uint8_t *pu8Buf, uint32_t u32Size, uint32_t *pu32Len);
+int32_t EFM_KV_Write(uint16_t u16Key, const uint8_t *pu8Data, uint32_t u32Len);
+int32_t EFM_KV_Delete(uint16_t u16Key);
+int32_t EFM_KV_Compact(void);
+uint32_t EFM_KV_GetFreeSize(void);
+
+/**
+ * @}
+ */
+
+#endif /* LL_EFM_KV_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __HC32_LL_EFM_KV_H__ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
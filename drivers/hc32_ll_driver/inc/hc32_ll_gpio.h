@@ -8,6 +8,8 @@
    Date             Author          Notes
    2022-03-31       CDT             First version
    2022-06-30       CDT             Add API GPIO_ExIntCmd().
+   2026-10-17       CDT             Add inline API GPIO_FAST_xxx().
+                                    Add API GPIO_InitTable().
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2022-2023, Xiaohua Semiconductor Co., Ltd. All rights reserved.
@@ -78,6 +80,15 @@ typedef struct {
     uint16_t u16ExtInt;         /*!< External interrupt pin setting, @ref GPIO_PinExtInt_Sel for details    */
     uint16_t u16PinInputType;   /*!< Input type setting, @ref GPIO_PinInType_Sel                            */
 } stc_gpio_init_t;
+
+/**
+ * @brief  GPIO pin configuration table entry definition, @ref GPIO_Pin_Config
+ */
+typedef struct {
+    uint8_t u8Port;             /*!< GPIO Port Source, @ref GPIO_Port_Source for details                    */
+    uint8_t u8Pin;              /*!< Pins of the port, @ref GPIO_Pins_Define for details                    */
+    uint16_t u16Pcr;            /*!< PCR value of the pins, function, level and attributes                  */
+} stc_gpio_pin_cfg_t;
 /**
  * @}
  */
@@ -283,6 +294,40 @@ typedef struct {
  * @}
  */
 
+/**
+ * @defgroup GPIO_Pin_Config GPIO Pin Configuration Table Entry
+ * @brief stc_gpio_pin_cfg_t initializer for GPIO_InitTable().
+ * @note  attr is the OR of @ref GPIO_PinState_Sel, @ref GPIO_PinDirection_Sel, @ref GPIO_PinOutType_Sel,
+ *        @ref GPIO_PinDrv_Sel, @ref GPIO_PinLatch_Sel, @ref GPIO_PinPU_Sel, @ref GPIO_PinInvert_Sel,
+ *        @ref GPIO_PinExtInt_Sel and @ref GPIO_PinInType_Sel values, 0 for the GPIO_StructInit() ones.
+ * @{
+ */
+#define GPIO_PIN_CFG(port, pin, func, attr)                                    \
+    {(uint8_t)(port), (uint8_t)(pin), (uint16_t)(((uint16_t)(func) << GPIO_PCR_FSEL_POS) | (uint16_t)(attr))}
+/**
+ * @}
+ */
+
+/**
+ * @defgroup GPIO_Fast_Access GPIO Fast Access
+ * @brief Port registers and their bit-band aliases, constant addresses for constant port and pin.
+ * @{
+ */
+#define GPIO_FAST_REG(reg, port)                                               \
+    (*(__IO uint8_t *)((uint32_t)&CM_GPIO->reg##0 + (uint32_t)(port)))
+/* Bit position of a single pin */
+#define GPIO_FAST_PIN_POS(pin)                                                 \
+(   (((0U != ((pin) & 0xAAU)) ? 1UL : 0UL))      |                             \
+    (((0U != ((pin) & 0xCCU)) ? 2UL : 0UL))      |                             \
+    (((0U != ((pin) & 0xF0U)) ? 4UL : 0UL)))
+#define GPIO_FAST_BB(reg, port, pin)                                           \
+    (*(__IO uint32_t *)((uint32_t)bCM_GPIO +                                   \
+                        ((((uint32_t)&CM_GPIO->reg##0 - CM_GPIO_BASE) + (uint32_t)(port)) << 5U) + \
+                        (GPIO_FAST_PIN_POS(pin) << 2U)))
+/**
+ * @}
+ */
+
 /**
  * @}
  */
@@ -318,9 +363,78 @@ __STATIC_INLINE void GPIO_REG_Unlock(void)
     WRITE_REG16(CM_GPIO->PWPR, GPIO_REG_UNLOCK_KEY);
 }
 
+/**
+ * @brief  Set GPIO output data port pins, a single store.
+ * @param  [in] u8Port: GPIO_PORT_x, x can be the suffix in @ref GPIO_Port_Source for each product
+ * @param  [in] u16Pin: GPIO_PIN_x, x can be the suffix in @ref GPIO_Pins_Define for each product
+ * @retval None
+ * @note   The GPIO_FAST_xxx() functions do not check the parameters, GPIO_SetPins() etc. do.
+ */
+__STATIC_INLINE void GPIO_FAST_SetPins(uint8_t u8Port, uint16_t u16Pin)
+{
+    WRITE_REG8(GPIO_FAST_REG(POSR, u8Port), (uint8_t)u16Pin);
+}
+
+/**
+ * @brief  Reset GPIO output data port pins, a single store.
+ * @param  [in] u8Port: GPIO_PORT_x, x can be the suffix in @ref GPIO_Port_Source for each product
+ * @param  [in] u16Pin: GPIO_PIN_x, x can be the suffix in @ref GPIO_Pins_Define for each product
+ * @retval None
+ */
+__STATIC_INLINE void GPIO_FAST_ResetPins(uint8_t u8Port, uint16_t u16Pin)
+{
+    WRITE_REG8(GPIO_FAST_REG(PORR, u8Port), (uint8_t)u16Pin);
+}
+
+/**
+ * @brief  Toggle GPIO output data port pins, a single store.
+ * @param  [in] u8Port: GPIO_PORT_x, x can be the suffix in @ref GPIO_Port_Source for each product
+ * @param  [in] u16Pin: GPIO_PIN_x, x can be the suffix in @ref GPIO_Pins_Define for each product
+ * @retval None
+ */
+__STATIC_INLINE void GPIO_FAST_TogglePins(uint8_t u8Port, uint16_t u16Pin)
+{
+    WRITE_REG8(GPIO_FAST_REG(POTR, u8Port), (uint8_t)u16Pin);
+}
+
+/**
+ * @brief  Write a GPIO output data pin, a single store to the bit-band alias.
+ * @param  [in] u8Port: GPIO_PORT_x, x can be the suffix in @ref GPIO_Port_Source for each product
+ * @param  [in] u16Pin: GPIO_PIN_x, a single pin of @ref GPIO_Pins_Define
+ * @param  [in] enState: An @ref en_pin_state_t enumeration value.
+ * @retval None
+ */
+__STATIC_INLINE void GPIO_FAST_WritePin(uint8_t u8Port, uint16_t u16Pin, en_pin_state_t enState)
+{
+    WRITE_REG32(GPIO_FAST_BB(PODR, u8Port, u16Pin), (uint32_t)enState);
+}
+
+/**
+ * @brief  Read a GPIO input data pin, a single load from the bit-band alias.
+ * @param  [in] u8Port: GPIO_PORT_x, x can be the suffix in @ref GPIO_Port_Source for each product
+ * @param  [in] u16Pin: GPIO_PIN_x, a single pin of @ref GPIO_Pins_Define
+ * @retval An @ref en_pin_state_t enumeration value.
+ */
+__STATIC_INLINE en_pin_state_t GPIO_FAST_ReadInputPin(uint8_t u8Port, uint16_t u16Pin)
+{
+    return (en_pin_state_t)READ_REG32(GPIO_FAST_BB(PIDR, u8Port, u16Pin));
+}
+
+/**
+ * @brief  Read a GPIO output data pin, a single load from the bit-band alias.
+ * @param  [in] u8Port: GPIO_PORT_x, x can be the suffix in @ref GPIO_Port_Source for each product
+ * @param  [in] u16Pin: GPIO_PIN_x, a single pin of @ref GPIO_Pins_Define
+ * @retval An @ref en_pin_state_t enumeration value.
+ */
+__STATIC_INLINE en_pin_state_t GPIO_FAST_ReadOutputPin(uint8_t u8Port, uint16_t u16Pin)
+{
+    return (en_pin_state_t)READ_REG32(GPIO_FAST_BB(PODR, u8Port, u16Pin));
+}
+
 int32_t GPIO_Init(uint8_t u8Port, uint16_t u16Pin, const stc_gpio_init_t *pstcGpioInit);
 void GPIO_DeInit(void);
 int32_t GPIO_StructInit(stc_gpio_init_t *pstcGpioInit);
+int32_t GPIO_InitTable(const stc_gpio_pin_cfg_t *pstcPinCfg, uint32_t u32Num);
 void GPIO_SetDebugPort(uint8_t u8DebugPort, en_functional_state_t enNewState);
 void GPIO_SetFunc(uint8_t u8Port, uint16_t u16Pin, uint16_t u16Func);
 void GPIO_SetReadWaitCycle(uint16_t u16ReadWait);
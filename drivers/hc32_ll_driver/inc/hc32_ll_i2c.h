@@ -8,6 +8,7 @@
    Date             Author          Notes
    2022-03-31       CDT             First version
    2022-06-30       CDT             Add API I2C_SlaveAddrCmd()
+   2026-10-17       CDT             Add API I2C_BaudrateConfigPpm()
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2022-2023, Xiaohua Semiconductor Co., Ltd. All rights reserved.
@@ -240,6 +241,7 @@ typedef struct {
 /* Initialization and Configuration **********************************/
 int32_t I2C_StructInit(stc_i2c_init_t *pstcI2cInit);
 int32_t I2C_BaudrateConfig(CM_I2C_TypeDef *I2Cx, const stc_i2c_init_t *pstcI2cInit, float32_t *pf32Error);
+int32_t I2C_BaudrateConfigPpm(CM_I2C_TypeDef *I2Cx, const stc_i2c_init_t *pstcI2cInit, int32_t *pi32ErrorPpm);
 void I2C_DeInit(CM_I2C_TypeDef *I2Cx);
 int32_t I2C_Init(CM_I2C_TypeDef *I2Cx, const stc_i2c_init_t *pstcI2cInit, float32_t *pf32Error);
 void I2C_SlaveAddrConfig(CM_I2C_TypeDef *I2Cx, uint32_t u32AddrNum, uint32_t u32AddrMode, uint32_t u32Addr);
@@ -0,0 +1,148 @@
+/**
+ *******************************************************************************
+ * @file  hc32_ll_i2c_int.h
+ * @brief This file contains all the functions prototypes of the I2C
+ *        interrupt-driven master transaction driver library.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-16       CDT             First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2022-2023, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+#ifndef __HC32_LL_I2C_INT_H__
+#define __HC32_LL_I2C_INT_H__
+
+/* C binding of definitions if building with C++ compiler */
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_ll_def.h"
+
+#include "hc32f1xx.h"
+#include "hc32f1xx_conf.h"
+
+/**
+ * @addtogroup LL_Driver
+ * @{
+ */
+
+/**
+ * @addtogroup LL_I2C_INT
+ * @{
+ */
+
+#if (LL_I2C_INT_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Global type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @defgroup I2C_INT_Global_Types I2C Interrupt Global Types
+ * @{
+ */
+
+/**
+ * @brief I2C master transaction structure definition
+ * @note  The transaction type is given by the lengths: write only (u32RxLen == 0),
+ *        read only (u32TxLen == 0) or write then repeated start read (both non-zero).
+ * @note  The structure is linked into the driver queue by I2C_Int_Submit() and must stay
+ *        valid until the callback is called or i32Result is no longer LL_ERR_BUSY.
+ */
+typedef struct stc_i2c_int_trans {
+    uint16_t u16SlaveAddr;              /*!< 7-bit slave address. */
+    const uint8_t *pu8TxBuf;            /*!< Data to write. */
+    uint32_t u32TxLen;                  /*!< Number of bytes to write. */
+    uint8_t *pu8RxBuf;                  /*!< Buffer for the read data. */
+    uint32_t u32RxLen;                  /*!< Number of bytes to read. */
+    void (*pfnCallback)(struct stc_i2c_int_trans *pstcTrans);
+                                        /*!< Called from the I2C IRQ handler when the transaction ends,
+                                             the result is in i32Result. NULL if unused. */
+    void *pvUserData;                   /*!< User context, not used by the driver. */
+    __IO int32_t i32Result;             /*!< LL_ERR_BUSY while queued or running, then:
+                                             LL_OK, LL_ERR(NACK or arbitration lost) or LL_ERR_TIMEOUT(aborted). */
+    struct stc_i2c_int_trans *pstcNext; /*!< Driver internal, queue link. */
+} stc_i2c_int_trans_t;
+
+/**
+ * @brief I2C interrupt IRQ registration structure definition
+ * @note  Every IRQ number must be one of the two dedicated vectors of the interrupt source group,
+ *        @ref INTC_IrqSignIn for details.
+ */
+typedef struct {
+    IRQn_Type enEeiIRQn;                /*!< IRQ number for INT_SRC_I2C_EEI. */
+    IRQn_Type enRxiIRQn;                /*!< IRQ number for INT_SRC_I2C_RXI. */
+    IRQn_Type enTxiIRQn;                /*!< IRQ number for INT_SRC_I2C_TXI. */
+    IRQn_Type enTeiIRQn;                /*!< IRQ number for INT_SRC_I2C_TEI. */
+    uint32_t u32IrqPrio;                /*!< IRQ priority, @ref INTC_Priority_Sel for details. */
+} stc_i2c_int_irq_t;
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Global variable definitions ('extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+  Global function prototypes (definition in C source)
+ ******************************************************************************/
+/**
+ * @addtogroup I2C_INT_Global_Functions
+ * @{
+ */
+int32_t I2C_Int_Init(CM_I2C_TypeDef *I2Cx);
+void I2C_Int_DeInit(CM_I2C_TypeDef *I2Cx);
+int32_t I2C_Int_IrqSignIn(CM_I2C_TypeDef *I2Cx, const stc_i2c_int_irq_t *pstcIrq);
+
+int32_t I2C_Int_TransStructInit(stc_i2c_int_trans_t *pstcTrans);
+int32_t I2C_Int_Submit(CM_I2C_TypeDef *I2Cx, stc_i2c_int_trans_t *pstcTrans);
+void I2C_Int_Abort(CM_I2C_TypeDef *I2Cx);
+en_flag_status_t I2C_Int_GetBusy(const CM_I2C_TypeDef *I2Cx);
+
+void I2C_Int_EeiIrqHandler(CM_I2C_TypeDef *I2Cx);
+void I2C_Int_RxiIrqHandler(CM_I2C_TypeDef *I2Cx);
+void I2C_Int_TxiIrqHandler(CM_I2C_TypeDef *I2Cx);
+void I2C_Int_TeiIrqHandler(CM_I2C_TypeDef *I2Cx);
+
+/**
+ * @}
+ */
+
+#endif /* LL_I2C_INT_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __HC32_LL_I2C_INT_H__ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
@@ -0,0 +1,174 @@
+/**
+ *******************************************************************************
+ * @file  hc32_ll_intc_stat.h
+ * @brief This file contains all the functions prototypes of the interrupt
+ *        timing statistics.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-17       CDT             First version
+                                    Count the IRQ entries without latency in u32Unseen
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2022-2023, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+#ifndef __HC32_LL_INTC_STAT_H__
+#define __HC32_LL_INTC_STAT_H__
+
+/* C binding of definitions if building with C++ compiler */
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_ll_def.h"
+
+#include "hc32f1xx.h"
+#include "hc32f1xx_conf.h"
+
+/**
+ * @addtogroup LL_Driver
+ * @{
+ */
+
+/**
+ * @addtogroup LL_INTC_STAT
+ * @{
+ */
+
+#if (LL_INTC_STAT_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Global pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup INTC_STAT_Global_Macros INTC_STAT Global Macros
+ * @{
+ */
+
+/**
+ * @defgroup INTC_STAT_Config INTC_STAT Configuration
+ * @brief Can be overridden in hc32f1xx_conf.h.
+ * @{
+ */
+#ifndef INTC_STAT_HIST_NUM
+#define INTC_STAT_HIST_NUM              (16U)   /*!< Histogram bins, bin n counts 2^n ~ 2^(n+1)-1 cycles,
+                                                     the last one also the longer times */
+#endif
+#ifndef INTC_STAT_NEST_MAX
+#define INTC_STAT_NEST_MAX              (4U)    /*!< Deepest nesting of instrumented handlers, one per
+                                                     priority level */
+#endif
+/**
+ * @}
+ */
+
+/**
+ * @brief Instrument a handler, no code unless LL_INTC_STAT_ENABLE is on.
+ * @note  In SysTick_Handler(), INTC_STAT_IRQ_ENTER() goes right after SysTick_IncTick().
+ */
+#define INTC_STAT_IRQ_ENTER(irqn)       INTC_STAT_Enter(irqn)
+#define INTC_STAT_IRQ_EXIT(irqn)        INTC_STAT_Exit(irqn)
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @defgroup INTC_STAT_Global_Types INTC_STAT Global Types
+ * @{
+ */
+
+/**
+ * @brief INTC_STAT time statistics structure definition, in HCLK cycles
+ */
+typedef struct {
+    uint32_t u32Count;                  /*!< Number of times. */
+    uint32_t u32Min;                    /*!< Shortest time, 0xFFFFFFFF until the first one. */
+    uint32_t u32Max;                    /*!< Longest time. */
+    uint64_t u64Sum;                    /*!< Sum of the times, for the mean. */
+    uint16_t au16Hist[INTC_STAT_HIST_NUM];  /*!< log2 histogram, saturating counters. */
+} stc_intc_stat_time_t;
+
+/**
+ * @brief INTC_STAT vector statistics structure definition
+ * @note  Allocated by the application and attached by INTC_STAT_Attach().
+ */
+typedef struct {
+    stc_intc_stat_time_t stcExec;       /*!< Execution time, without the nested instrumented handlers. */
+    stc_intc_stat_time_t stcLatency;    /*!< Entry latency, see INTC_STAT_Enter(). */
+    uint32_t u32Unseen;                 /*!< Entries of an IRQ no instrumented code saw pending,
+                                             they have no latency and are not in stcLatency. */
+    uint32_t u32PendTime;               /*!< Driver internal, time the IRQ was first seen pending. */
+} stc_intc_stat_t;
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions ('extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+  Global function prototypes (definition in C source)
+ ******************************************************************************/
+/**
+ * @addtogroup INTC_STAT_Global_Functions
+ * @{
+ */
+int32_t INTC_STAT_Init(void);
+int32_t INTC_STAT_Attach(IRQn_Type enIRQn, stc_intc_stat_t *pstcStat);
+void INTC_STAT_Detach(IRQn_Type enIRQn);
+
+void INTC_STAT_Enter(IRQn_Type enIRQn);
+void INTC_STAT_Exit(IRQn_Type enIRQn);
+
+int32_t INTC_STAT_Get(IRQn_Type enIRQn, stc_intc_stat_t *pstcStat);
+uint32_t INTC_STAT_GetMean(const stc_intc_stat_time_t *pstcTime);
+void INTC_STAT_Clear(IRQn_Type enIRQn);
+#if (LL_USART_ENABLE == DDL_ON)
+int32_t INTC_STAT_Dump(CM_USART_TypeDef *USARTx, uint32_t u32Timeout);
+#endif
+
+/**
+ * @}
+ */
+
+#else
+
+#define INTC_STAT_IRQ_ENTER(irqn)
+#define INTC_STAT_IRQ_EXIT(irqn)
+
+#endif /* LL_INTC_STAT_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __HC32_LL_INTC_STAT_H__ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
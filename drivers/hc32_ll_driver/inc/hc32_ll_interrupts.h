@@ -7,6 +7,7 @@
    Change Logs:
    Date             Author          Notes
    2022-03-31       CDT             First version
+   2026-10-17       CDT             Include hc32_ll_intc_stat.h for the handler instrumentation
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2022-2023, Xiaohua Semiconductor Co., Ltd. All rights reserved.
@@ -34,6 +35,7 @@ extern "C"
 
 #include "hc32f1xx.h"
 #include "hc32f1xx_conf.h"
+#include "hc32_ll_intc_stat.h"
 
 /**
  * @addtogroup LL_Driver
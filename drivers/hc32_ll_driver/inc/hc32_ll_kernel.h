@@ -0,0 +1,185 @@
+/**
+ *******************************************************************************
+ * @file  hc32_ll_kernel.h
+ * @brief This file contains all the functions prototypes of the preemptive
+ *        micro-kernel.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-16       CDT             First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2022-2023, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+#ifndef __HC32_LL_KERNEL_H__
+#define __HC32_LL_KERNEL_H__
+
+/* C binding of definitions if building with C++ compiler */
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_ll_def.h"
+
+#include "hc32f1xx.h"
+#include "hc32f1xx_conf.h"
+
+/**
+ * @addtogroup LL_Driver
+ * @{
+ */
+
+/**
+ * @addtogroup LL_KERNEL
+ * @{
+ */
+
+#if (LL_KERNEL_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Global type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @defgroup KERNEL_Global_Types KERNEL Global Types
+ * @{
+ */
+
+/**
+ * @brief Counting semaphore structure definition
+ */
+typedef struct {
+    __IO uint32_t u32Count;             /*!< Kernel internal, available count. */
+    uint32_t u32MaxCount;               /*!< Kernel internal, maximum count. */
+} stc_kernel_sem_t;
+
+/**
+ * @brief Message queue structure definition
+ * @note  The items are copied in and out, the buffer holds u32Capacity items of u32ItemSize bytes.
+ */
+typedef struct {
+    uint8_t *pu8Buf;                    /*!< Kernel internal, item buffer. */
+    uint32_t u32ItemSize;               /*!< Kernel internal, item size in bytes. */
+    uint32_t u32Capacity;               /*!< Kernel internal, number of items of the buffer. */
+    uint32_t u32Head;                   /*!< Kernel internal, index of the oldest item. */
+    __IO uint32_t u32Count;             /*!< Kernel internal, number of queued items. */
+    uint8_t u8RecvWait;                 /*!< Kernel internal, its address is the wait object of the receivers. */
+    uint8_t u8SendWait;                 /*!< Kernel internal, its address is the wait object of the senders. */
+} stc_kernel_queue_t;
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup KERNEL_Global_Macros KERNEL Global Macros
+ * @{
+ */
+
+/**
+ * @defgroup KERNEL_Config KERNEL Configuration
+ * @brief Can be overridden in hc32f1xx_conf.h.
+ * @{
+ */
+#ifndef KERNEL_THREAD_NUM
+#define KERNEL_THREAD_NUM               (3U)    /*!< Number of threads besides the idle thread */
+#endif
+#ifndef KERNEL_STACK_SIZE
+#define KERNEL_STACK_SIZE               (384U)  /*!< Stack bytes of each thread, multiple of 8. 64 bytes
+                                                     hold the saved context, IRQ handlers use the main stack */
+#endif
+#ifndef KERNEL_IDLE_STACK_SIZE
+#define KERNEL_IDLE_STACK_SIZE          (128U)  /*!< Stack bytes of the idle thread, multiple of 8 */
+#endif
+#ifndef KERNEL_PRIO_NUM
+#define KERNEL_PRIO_NUM                 (8U)    /*!< Thread priorities 0 (highest) ~ KERNEL_PRIO_NUM - 1 */
+#endif
+#ifndef KERNEL_TICK_FREQ
+#define KERNEL_TICK_FREQ                (1000UL)    /*!< SysTick frequency in Hz, 1 ~ 1000 */
+#endif
+#ifndef KERNEL_TIME_SLICE
+#define KERNEL_TIME_SLICE               (10UL)  /*!< Ticks before a thread yields to a ready one of the same priority */
+#endif
+/**
+ * @}
+ */
+
+/**
+ * @defgroup KERNEL_Timeout KERNEL Timeout
+ * @{
+ */
+#define KERNEL_NO_WAIT                  (0UL)
+#define KERNEL_WAIT_FOREVER             (0xFFFFFFFFUL)
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions ('extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+  Global function prototypes (definition in C source)
+ ******************************************************************************/
+/**
+ * @addtogroup KERNEL_Global_Functions
+ * @{
+ */
+void KERNEL_Init(void);
+int32_t KERNEL_ThreadCreate(void (*pfnEntry)(void *pvArg), void *pvArg, uint8_t u8Prio);
+void KERNEL_Start(void);
+void KERNEL_TickHandler(void);
+void KERNEL_Idle(void);
+
+uint32_t KERNEL_GetTick(void);
+void KERNEL_Delay(uint32_t u32Ticks);
+void KERNEL_Yield(void);
+
+int32_t KERNEL_SemInit(stc_kernel_sem_t *pstcSem, uint32_t u32InitCount, uint32_t u32MaxCount);
+int32_t KERNEL_SemTake(stc_kernel_sem_t *pstcSem, uint32_t u32Timeout);
+int32_t KERNEL_SemGive(stc_kernel_sem_t *pstcSem);
+
+int32_t KERNEL_QueueInit(stc_kernel_queue_t *pstcQueue, void *pvBuf, uint32_t u32ItemSize, uint32_t u32Capacity);
+int32_t KERNEL_QueueSend(stc_kernel_queue_t *pstcQueue, const void *pvItem, uint32_t u32Timeout);
+int32_t KERNEL_QueueReceive(stc_kernel_queue_t *pstcQueue, void *pvItem, uint32_t u32Timeout);
+
+/**
+ * @}
+ */
+
+#endif /* LL_KERNEL_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __HC32_LL_KERNEL_H__ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
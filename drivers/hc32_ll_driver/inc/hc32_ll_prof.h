@@ -0,0 +1,148 @@
+/**
+ *******************************************************************************
+ * @file  hc32_ll_prof.h
+ * @brief This file contains all the functions prototypes of the sampling
+ *        profiler.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-17       CDT             First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2022-2023, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+#ifndef __HC32_LL_PROF_H__
+#define __HC32_LL_PROF_H__
+
+/* C binding of definitions if building with C++ compiler */
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_ll_def.h"
+
+#include "hc32f1xx.h"
+#include "hc32f1xx_conf.h"
+
+/**
+ * @addtogroup LL_Driver
+ * @{
+ */
+
+/**
+ * @addtogroup LL_PROF
+ * @{
+ */
+
+#if (LL_PROF_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Global type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @defgroup PROF_Global_Types PROF Global Types
+ * @{
+ */
+
+/**
+ * @brief PROF initialization structure definition
+ */
+typedef struct {
+    uint32_t u32TextStart;              /*!< Lowest sampled address, the flash base by default. */
+    uint32_t u32TextEnd;                /*!< End of the sampled range, (uint32_t)&__etext of the linker script. */
+    uint16_t *pu16Bin;                  /*!< Histogram storage, saturating counters. */
+    uint32_t u32BinNum;                 /*!< Number of histogram bins. The bin size is the lowest power of 2
+                                             which fits the range in them, 2 bytes at least. */
+    uint16_t u16ClockDiv;               /*!< TMRB count clock division, @ref TMRB_Clock_Division. */
+    uint16_t u16Period;                 /*!< TMRB period value: one sample every u16Period + 1 counts. */
+} stc_prof_init_t;
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup PROF_Global_Macros PROF Global Macros
+ * @{
+ */
+
+/**
+ * @defgroup PROF_Config PROF Configuration
+ * @brief Can be overridden in hc32f1xx_conf.h.
+ * @{
+ */
+#ifndef PROF_FRAME_SCAN_MAX
+#define PROF_FRAME_SCAN_MAX             (48U)   /*!< Stack words searched for the exception frame, must cover
+                                                     the IRQ dispatch down to PROF_TimerIrqHandler() */
+#endif
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions ('extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+  Global function prototypes (definition in C source)
+ ******************************************************************************/
+/**
+ * @addtogroup PROF_Global_Functions
+ * @{
+ */
+int32_t PROF_StructInit(stc_prof_init_t *pstcProfInit);
+int32_t PROF_Init(CM_TMRB_TypeDef *TMRBx, const stc_prof_init_t *pstcProfInit);
+#if (LL_INTERRUPTS_ENABLE == DDL_ON)
+int32_t PROF_IrqSignIn(CM_TMRB_TypeDef *TMRBx, IRQn_Type enIRQn, uint32_t u32IrqPrio);
+#endif
+
+void PROF_Start(void);
+void PROF_Stop(void);
+void PROF_Clear(void);
+void PROF_AddSample(uint32_t u32Pc);
+uint32_t PROF_GetSampleCount(void);
+int32_t PROF_Dump(CM_USART_TypeDef *USARTx, uint32_t u32Timeout);
+
+void PROF_TimerIrqHandler(CM_TMRB_TypeDef *TMRBx);
+
+/**
+ * @}
+ */
+
+#endif /* LL_PROF_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __HC32_LL_PROF_H__ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
@@ -0,0 +1,176 @@
+/**
+ *******************************************************************************
+ * @file  hc32_ll_pwc_idle.h
+ * @brief This file contains all the functions prototypes of the low-power
+ *        idle governor.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-16       CDT             First version
+   2026-10-17       CDT             Add PWC_IDLE_WAIT_CYCLE0_MAX_FREQ and PWC_IDLE_LOW_SPEED_MAX_FREQ
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2022-2023, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+#ifndef __HC32_LL_PWC_IDLE_H__
+#define __HC32_LL_PWC_IDLE_H__
+
+/* C binding of definitions if building with C++ compiler */
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_ll_def.h"
+
+#include "hc32f1xx.h"
+#include "hc32f1xx_conf.h"
+
+/**
+ * @addtogroup LL_Driver
+ * @{
+ */
+
+/**
+ * @addtogroup LL_PWC_IDLE
+ * @{
+ */
+
+#if (LL_PWC_IDLE_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Global type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @defgroup PWC_IDLE_Global_Types PWC Idle Governor Global Types
+ * @{
+ */
+
+/**
+ * @brief PWC idle governor initialization structure definition
+ * @note  Ticks are the unit of pfnGetIdleTicks() and pfnGetTick(), from a clock which keeps
+ *        running in stop mode.
+ */
+typedef struct {
+    uint32_t u32StopMinTicks;           /*!< Shortest idle time for stop mode, it must pay for the stop
+                                             entry and the clock restore. Shorter idle times use sleep mode. */
+    uint32_t u32WakeupSrc;              /*!< Stop mode wakeup sources, @ref INTC_Stop_Wakeup_Source_Sel.
+                                             Added to the enabled ones during stop mode only. */
+    uint32_t (*pfnGetIdleTicks)(void);  /*!< Ticks until the next timer deadline, 0xFFFFFFFF for none.
+                                             NULL if unknown: the idle time is taken as unlimited. */
+    uint32_t (*pfnGetTick)(void);       /*!< Free running tick for the residency statistics, NULL if unused. */
+} stc_pwc_idle_init_t;
+
+/**
+ * @brief PWC idle governor statistics structure definition
+ */
+typedef struct {
+    uint32_t u32SleepCount;             /*!< Sleep mode entries. */
+    uint32_t u32SleepTicks;             /*!< Ticks in sleep mode. */
+    uint32_t u32StopCount;              /*!< Stop mode entries. */
+    uint32_t u32StopTicks;              /*!< Ticks in stop mode, clock restore included. */
+    uint32_t u32TotalTicks;             /*!< Ticks since PWC_Idle_Init() or PWC_Idle_ClearStat(). */
+    uint32_t u32XtalTimeout;            /*!< Wakeups left on HRC because XTAL did not stabilize. */
+} stc_pwc_idle_stat_t;
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup PWC_IDLE_Global_Macros PWC Idle Governor Global Macros
+ * @{
+ */
+
+/**
+ * @defgroup PWC_IDLE_Config PWC Idle Governor Configuration
+ * @brief Can be overridden in hc32f1xx_conf.h.
+ * @{
+ */
+#ifndef PWC_IDLE_XTAL_TIMEOUT
+#define PWC_IDLE_XTAL_TIMEOUT           (0x10000UL) /*!< XTAL stable flag polls after stop mode */
+#endif
+#ifndef PWC_IDLE_WAIT_CYCLE0_MAX_FREQ
+#define PWC_IDLE_WAIT_CYCLE0_MAX_FREQ   (24000000UL)
+                                                    /*!< Highest HCLK read without flash wait cycle, for the
+                                                         wakeup on HRC */
+#endif
+#ifndef PWC_IDLE_LOW_SPEED_MAX_FREQ
+#define PWC_IDLE_LOW_SPEED_MAX_FREQ     (2000000UL) /*!< Highest HCLK in ultra low speed mode, for the
+                                                         wakeup on HRC */
+#endif
+/**
+ * @}
+ */
+
+/**
+ * @defgroup PWC_IDLE_Mode PWC Idle Governor Mode
+ * @{
+ */
+#define PWC_IDLE_MD_NONE                (0U)    /*!< A deadline is due, no low-power mode entered */
+#define PWC_IDLE_MD_SLEEP               (1U)    /*!< Sleep mode */
+#define PWC_IDLE_MD_STOP                (2U)    /*!< Stop mode */
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions ('extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+  Global function prototypes (definition in C source)
+ ******************************************************************************/
+/**
+ * @addtogroup PWC_IDLE_Global_Functions
+ * @{
+ */
+int32_t PWC_Idle_StructInit(stc_pwc_idle_init_t *pstcIdleInit);
+int32_t PWC_Idle_Init(const stc_pwc_idle_init_t *pstcIdleInit);
+
+void PWC_Idle_StopInhibitCmd(uint32_t u32Inhibit, en_functional_state_t enNewState);
+uint8_t PWC_Idle_Enter(void);
+
+int32_t PWC_Idle_GetStat(stc_pwc_idle_stat_t *pstcStat);
+void PWC_Idle_ClearStat(void);
+
+/**
+ * @}
+ */
+
+#endif /* LL_PWC_IDLE_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __HC32_LL_PWC_IDLE_H__ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
@@ -0,0 +1,159 @@
+/**
+ *******************************************************************************
+ * @file  hc32_ll_sched.h
+ * @brief This file contains all the functions prototypes of the cooperative
+ *        event scheduler.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-16       CDT             First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2022-2023, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+#ifndef __HC32_LL_SCHED_H__
+#define __HC32_LL_SCHED_H__
+
+/* C binding of definitions if building with C++ compiler */
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_ll_def.h"
+
+#include "hc32f1xx.h"
+#include "hc32f1xx_conf.h"
+
+/**
+ * @addtogroup LL_Driver
+ * @{
+ */
+
+/**
+ * @addtogroup LL_SCHED
+ * @{
+ */
+
+#if (LL_SCHED_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Global type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @defgroup SCHED_Global_Types SCHED Global Types
+ * @{
+ */
+
+/**
+ * @brief Scheduler task statistics structure definition
+ * @note  Times are in microseconds of SysTick_GetMicros(), 0 while SysTick is not initialized.
+ */
+typedef struct {
+    uint32_t u32RunCount;               /*!< Number of runs. */
+    uint32_t u32RunTime;                /*!< Total run time. */
+    uint32_t u32RunTimeMax;             /*!< Longest run. */
+    uint32_t u32LatencyMax;             /*!< Longest time from the first post to the start of the run. */
+} stc_sched_stat_t;
+
+/**
+ * @brief Scheduler task structure definition
+ * @note  Allocated by the application and initialized with SCHED_TaskInit(), it must stay
+ *        valid while it can be posted.
+ */
+typedef struct stc_sched_task {
+    void (*pfnRun)(struct stc_sched_task *pstcTask, uint32_t u32Events);
+                                        /*!< Runs to completion with the events posted since the last run. */
+    void *pvUserData;                   /*!< User context, not used by the scheduler. */
+    uint8_t u8Prio;                     /*!< Priority, 0 (highest) ~ SCHED_PRIO_NUM - 1. */
+    __IO uint8_t u8Queued;              /*!< Scheduler internal, 1U while in the ready queue. */
+    __IO uint32_t u32Events;            /*!< Scheduler internal, pending events. */
+    uint32_t u32PostTime;               /*!< Scheduler internal, time of the first pending post. */
+    struct stc_sched_task *pstcNext;    /*!< Scheduler internal, ready queue link. */
+    stc_sched_stat_t stcStat;           /*!< Scheduler internal, statistics. */
+} stc_sched_task_t;
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup SCHED_Global_Macros SCHED Global Macros
+ * @{
+ */
+
+/**
+ * @defgroup SCHED_Config SCHED Configuration
+ * @brief Can be overridden in hc32f1xx_conf.h.
+ * @{
+ */
+#ifndef SCHED_PRIO_NUM
+#define SCHED_PRIO_NUM                  (8U)    /*!< Number of priorities, 1 ~ 32, 8 bytes of RAM each */
+#endif
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions ('extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+  Global function prototypes (definition in C source)
+ ******************************************************************************/
+/**
+ * @addtogroup SCHED_Global_Functions
+ * @{
+ */
+void SCHED_Init(void);
+int32_t SCHED_TaskInit(stc_sched_task_t *pstcTask, void (*pfnRun)(stc_sched_task_t *pstcTask, uint32_t u32Events),
+                       uint8_t u8Prio, void *pvUserData);
+
+int32_t SCHED_Post(stc_sched_task_t *pstcTask, uint32_t u32Events);
+int32_t SCHED_RunOnce(void);
+void SCHED_Run(void);
+void SCHED_Idle(void);
+
+int32_t SCHED_GetStat(const stc_sched_task_t *pstcTask, stc_sched_stat_t *pstcStat);
+void SCHED_ClearStat(stc_sched_task_t *pstcTask);
+
+/**
+ * @}
+ */
+
+#endif /* LL_SCHED_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __HC32_LL_SCHED_H__ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
@@ -0,0 +1,161 @@
+/**
+ *******************************************************************************
+ * @file  hc32_ll_spi_int.h
+ * @brief This file contains all the functions prototypes of the SPI
+ *        interrupt-driven master transaction queue driver library.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-17       CDT             First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2022-2023, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+#ifndef __HC32_LL_SPI_INT_H__
+#define __HC32_LL_SPI_INT_H__
+
+/* C binding of definitions if building with C++ compiler */
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_ll_def.h"
+
+#include "hc32f1xx.h"
+#include "hc32f1xx_conf.h"
+
+/**
+ * @addtogroup LL_Driver
+ * @{
+ */
+
+/**
+ * @addtogroup LL_SPI_INT
+ * @{
+ */
+
+#if (LL_SPI_INT_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Global type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @defgroup SPI_INT_Global_Types SPI Interrupt Global Types
+ * @{
+ */
+
+/**
+ * @brief SPI device structure definition
+ * @note  The bus is reconfigured when a transaction for another device starts.
+ */
+typedef struct {
+    uint32_t u32SpiMode;                /*!< SPI mode, @ref SPI_Mode_Define for details. */
+    uint32_t u32BaudRatePrescaler;      /*!< Baud rate prescaler, @ref SPI_Baud_Rate_Prescaler_Define for details. */
+    uint32_t u32DataBits;               /*!< Word size, @ref SPI_Data_Size_Define for details. */
+    uint32_t u32FirstBit;               /*!< MSB or LSB first, @ref SPI_First_Bit_Define for details. */
+    uint8_t u8CsPort;                   /*!< Chip select port, @ref GPIO_Port_Source for details. */
+    uint16_t u16CsPin;                  /*!< Chip select pin, active low, a single one of @ref GPIO_Pins_Define.
+                                             0 if the device has no chip select to drive. */
+} stc_spi_int_dev_t;
+
+/**
+ * @brief SPI transaction structure definition
+ * @note  A transaction is one or more phases linked by pstcChain (a command, then the data for
+ *        instance), run back to back with the chip select held. Only the first phase is submitted,
+ *        the device of the first phase is used for all of them.
+ * @note  The words are uint8_t for SPI_DATA_SIZE_8BIT and uint16_t for SPI_DATA_SIZE_16BIT.
+ * @note  The phases are linked into the driver queue by SPI_Int_Submit() and must stay valid and
+ *        unchanged until the callback of the last one is called or its i32Result is no longer LL_ERR_BUSY.
+ */
+typedef struct stc_spi_int_trans {
+    const stc_spi_int_dev_t *pstcDev;   /*!< Device, first phase only. */
+    const void *pvTxBuf;                /*!< Words to send, NULL to send 0xFFFF. */
+    void *pvRxBuf;                      /*!< Buffer for the received words, NULL to drop them. */
+    uint32_t u32Len;                    /*!< Number of words. */
+    struct stc_spi_int_trans *pstcChain;
+                                        /*!< Next phase under the same chip select, NULL for the last one. */
+    void (*pfnCallback)(struct stc_spi_int_trans *pstcTrans);
+                                        /*!< Called from the SPI IRQ handler when the phase ends,
+                                             the result is in i32Result. NULL if unused. */
+    void *pvUserData;                   /*!< User context, not used by the driver. */
+    __IO int32_t i32Result;             /*!< LL_ERR_BUSY while queued or running, then:
+                                             LL_OK, LL_ERR(SPI error) or LL_ERR_TIMEOUT(aborted). */
+    struct stc_spi_int_trans *pstcNext; /*!< Driver internal, queue link. */
+} stc_spi_int_trans_t;
+
+/**
+ * @brief SPI interrupt IRQ registration structure definition
+ * @note  Every IRQ number must be one of the two dedicated vectors of the interrupt source group,
+ *        @ref INTC_IrqSignIn for details.
+ */
+typedef struct {
+    IRQn_Type enErrIRQn;                /*!< IRQ number for INT_SRC_SPI_SPEI. */
+    IRQn_Type enRxIRQn;                 /*!< IRQ number for INT_SRC_SPI_SPRI. */
+    uint32_t u32IrqPrio;                /*!< IRQ priority, @ref INTC_Priority_Sel for details. */
+} stc_spi_int_irq_t;
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Global variable definitions ('extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+  Global function prototypes (definition in C source)
+ ******************************************************************************/
+/**
+ * @addtogroup SPI_INT_Global_Functions
+ * @{
+ */
+int32_t SPI_Int_Init(CM_SPI_TypeDef *SPIx);
+void SPI_Int_DeInit(CM_SPI_TypeDef *SPIx);
+int32_t SPI_Int_IrqSignIn(CM_SPI_TypeDef *SPIx, const stc_spi_int_irq_t *pstcIrq);
+
+int32_t SPI_Int_TransStructInit(stc_spi_int_trans_t *pstcTrans);
+int32_t SPI_Int_Submit(CM_SPI_TypeDef *SPIx, stc_spi_int_trans_t *pstcTrans);
+void SPI_Int_Abort(CM_SPI_TypeDef *SPIx);
+en_flag_status_t SPI_Int_GetBusy(const CM_SPI_TypeDef *SPIx);
+
+void SPI_Int_ErrIrqHandler(CM_SPI_TypeDef *SPIx);
+void SPI_Int_RxIrqHandler(CM_SPI_TypeDef *SPIx);
+
+/**
+ * @}
+ */
+
+#endif /* LL_SPI_INT_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __HC32_LL_SPI_INT_H__ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
@@ -0,0 +1,124 @@
+/**
+ *******************************************************************************
+ * @file  hc32_ll_spsc.h
+ * @brief This file contains all the functions prototypes of the lock-free
+ *        single-producer/single-consumer byte queue.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-16       CDT             First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2022-2023, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+#ifndef __HC32_LL_SPSC_H__
+#define __HC32_LL_SPSC_H__
+
+/* C binding of definitions if building with C++ compiler */
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_ll_def.h"
+
+#include "hc32f1xx.h"
+#include "hc32f1xx_conf.h"
+
+/**
+ * @addtogroup LL_Driver
+ * @{
+ */
+
+/**
+ * @addtogroup LL_SPSC
+ * @{
+ */
+
+#if (LL_SPSC_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Global type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @defgroup SPSC_Global_Types SPSC Global Types
+ * @{
+ */
+
+/**
+ * @brief Single-producer/single-consumer queue structure definition
+ * @note  The indexes are free running, the byte count is (u32In - u32Out). u32In is only
+ *        written by the producer and u32Out only by the consumer, so one context may push
+ *        while another pops without masking interrupts.
+ */
+typedef struct {
+    uint8_t *pu8Buf;                    /*!< Queue internal, storage. */
+    uint32_t u32Mask;                   /*!< Queue internal, storage size - 1. */
+    __IO uint32_t u32In;                /*!< Queue internal, producer index. */
+    __IO uint32_t u32Out;               /*!< Queue internal, consumer index. */
+} stc_spsc_t;
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Global variable definitions ('extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+  Global function prototypes (definition in C source)
+ ******************************************************************************/
+/**
+ * @addtogroup SPSC_Global_Functions
+ * @{
+ */
+int32_t SPSC_Init(stc_spsc_t *pstcQueue, void *pvBuf, uint32_t u32Size);
+
+uint32_t SPSC_GetCount(const stc_spsc_t *pstcQueue);
+uint32_t SPSC_GetSpace(const stc_spsc_t *pstcQueue);
+
+int32_t SPSC_PushByte(stc_spsc_t *pstcQueue, uint8_t u8Data);
+uint32_t SPSC_Push(stc_spsc_t *pstcQueue, const uint8_t au8Data[], uint32_t u32Len);
+
+int32_t SPSC_PopByte(stc_spsc_t *pstcQueue, uint8_t *pu8Data);
+uint32_t SPSC_Pop(stc_spsc_t *pstcQueue, uint8_t au8Data[], uint32_t u32Len);
+void SPSC_Flush(stc_spsc_t *pstcQueue);
+
+/**
+ * @}
+ */
+
+#endif /* LL_SPSC_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __HC32_LL_SPSC_H__ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
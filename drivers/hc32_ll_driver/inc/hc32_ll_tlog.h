@@ -0,0 +1,159 @@
+/**
+ *******************************************************************************
+ * @file  hc32_ll_tlog.h
+ * @brief This file contains all the functions prototypes of the deferred,
+ *        tokenized logging.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-16       CDT             First version
+   2026-10-17       CDT             Pass no argument array for records without arguments
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2022-2023, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+#ifndef __HC32_LL_TLOG_H__
+#define __HC32_LL_TLOG_H__
+
+/* C binding of definitions if building with C++ compiler */
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_ll_def.h"
+
+#include "hc32f1xx.h"
+#include "hc32f1xx_conf.h"
+
+/**
+ * @addtogroup LL_Driver
+ * @{
+ */
+
+/**
+ * @addtogroup LL_TLOG
+ * @{
+ */
+
+#if (LL_TLOG_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Global type definitions ('typedef')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Global pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup TLOG_Global_Macros TLOG Global Macros
+ * @{
+ */
+
+/**
+ * @defgroup TLOG_Config TLOG Configuration
+ * @brief Can be overridden in hc32f1xx_conf.h.
+ * @{
+ */
+#ifndef TLOG_ARG_MAX
+#define TLOG_ARG_MAX                    (8U)    /*!< Most arguments of a record, up to 15 */
+#endif
+
+/* Section of the format strings: the linker script keeps it out of the image, see LL_TLOG */
+#ifndef TLOG_SECTION
+#if defined (__GNUC__) || defined (__ARMCC_VERSION)
+#define TLOG_SECTION                    __attribute__((section(".tlog"), used))
+#else
+/* The format strings stay in flash, their addresses are the IDs */
+#define TLOG_SECTION
+#endif
+#endif
+/**
+ * @}
+ */
+
+/**
+ * @defgroup TLOG_Record_Format TLOG Record Format
+ * @brief Little-endian words: a header, then the arguments.
+ * @{
+ */
+#define TLOG_HDR_MARK                   (0xA0UL << 24U) /*!< Header bits 31:28, resynchronizes the decoder */
+#define TLOG_HDR_ARGN_POS               (24U)           /*!< Header bits 27:24, number of arguments */
+#define TLOG_ID_MASK                    (0x00FFFFFFUL)  /*!< Header bits 23:0, format string ID */
+#define TLOG_ID_DROP                    (TLOG_ID_MASK)  /*!< Reserved ID, one argument: records dropped */
+/**
+ * @}
+ */
+
+/**
+ * @brief Format string ID: the address of the string, in the .tlog section or in flash.
+ */
+#define TLOG_ID(pcFmt)                  ((uint32_t)(pcFmt) & TLOG_ID_MASK)
+
+/**
+ * @brief Log a record without blocking.
+ * @param [in] pcFmt                    printf() format string literal, kept out of the image.
+ * @param [in] ...                      Up to TLOG_ARG_MAX integer arguments, sent as 32-bit words.
+ *                                      Cast pointers to uint32_t, "%s" must point to constant strings.
+ * @note  A few dozen cycles plus the copy of the arguments, from any context.
+ */
+#define TLOG(pcFmt, ...)                                                       \
+do {                                                                           \
+    static const char TLOG_SECTION acTlogFmt[] = pcFmt;                        \
+    const uint32_t au32TlogArg[] = {0UL, ##__VA_ARGS__};                       \
+    (void)TLOG_Write(TLOG_ID(acTlogFmt), ARRAY_SZ(au32TlogArg) - 1UL,            \
+                     (ARRAY_SZ(au32TlogArg) > 1UL) ? &au32TlogArg[1] : NULL);  \
+} while (0)
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions ('extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+  Global function prototypes (definition in C source)
+ ******************************************************************************/
+/**
+ * @addtogroup TLOG_Global_Functions
+ * @{
+ */
+int32_t TLOG_Init(CM_USART_TypeDef *USARTx);
+int32_t TLOG_Write(uint32_t u32Id, uint32_t u32ArgNum, const uint32_t au32Arg[]);
+uint32_t TLOG_GetDropCount(void);
+
+/**
+ * @}
+ */
+
+#endif /* LL_TLOG_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __HC32_LL_TLOG_H__ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
@@ -0,0 +1,161 @@
+/**
+ *******************************************************************************
+ * @file  hc32_ll_tmr0_wheel.h
+ * @brief This file contains all the functions prototypes of the TMR0 software
+ *        timer wheel driver library.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-16       CDT             First version
+                                    Add TMR0_Wheel_GetIdleTicks()
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2022-2023, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+#ifndef __HC32_LL_TMR0_WHEEL_H__
+#define __HC32_LL_TMR0_WHEEL_H__
+
+/* C binding of definitions if building with C++ compiler */
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_ll_def.h"
+
+#include "hc32f1xx.h"
+#include "hc32f1xx_conf.h"
+
+/**
+ * @addtogroup LL_Driver
+ * @{
+ */
+
+/**
+ * @addtogroup LL_TMR0_WHEEL
+ * @{
+ */
+
+#if (LL_TMR0_WHEEL_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Global type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @defgroup TMR0_WHEEL_Global_Types TMR0 Timer Wheel Global Types
+ * @{
+ */
+
+/**
+ * @brief TMR0 timer wheel initialization structure definition
+ */
+typedef struct {
+    uint32_t u32ClockSrc;               /*!< Tick clock source, @ref TMR0_Clock_Source.
+                                             TMR0_CLK_SRC_LRC keeps counting in sleep and stop mode. */
+    uint32_t u32ClockDiv;               /*!< Tick clock division, @ref TMR0_Clock_Division. */
+} stc_tmr0_wheel_init_t;
+
+/**
+ * @brief TMR0 timer wheel timer structure definition
+ * @note  Allocated by the application, the driver only links it: it must stay valid
+ *        while the timer runs. Initialize it with TMR0_Wheel_TimerInit().
+ */
+typedef struct stc_tmr0_wheel_timer {
+    void (*pfnCallback)(struct stc_tmr0_wheel_timer *pstcTimer);
+                                        /*!< Called from the TMR0 IRQ handler when the timer expires. */
+    void *pvUserData;                   /*!< User context, not used by the driver. */
+    uint32_t u32Expire;                 /*!< Driver internal, expiry tick. */
+    uint32_t u32Period;                 /*!< Driver internal, reload ticks, 0 for one-shot. */
+    uint16_t u16Slot;                   /*!< Driver internal, wheel slot while running. */
+    struct stc_tmr0_wheel_timer *pstcNext;  /*!< Driver internal, slot list link. */
+    struct stc_tmr0_wheel_timer *pstcPrev;  /*!< Driver internal, slot list link. */
+} stc_tmr0_wheel_timer_t;
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup TMR0_WHEEL_Global_Macros TMR0 Timer Wheel Global Macros
+ * @{
+ */
+
+/**
+ * @defgroup TMR0_WHEEL_Config TMR0 Timer Wheel Configuration
+ * @brief Can be overridden in hc32f1xx_conf.h.
+ * @{
+ */
+#ifndef TMR0_WHEEL_LVL_NUM
+#define TMR0_WHEEL_LVL_NUM              (4U)    /*!< Wheel levels of 32 slots, 128 bytes of RAM each. Timeouts up
+                                                     to 2^(5 * TMR0_WHEEL_LVL_NUM) ticks need no re-cascading. */
+#endif
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions ('extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+  Global function prototypes (definition in C source)
+ ******************************************************************************/
+/**
+ * @addtogroup TMR0_WHEEL_Global_Functions
+ * @{
+ */
+int32_t TMR0_Wheel_StructInit(stc_tmr0_wheel_init_t *pstcWheelInit);
+int32_t TMR0_Wheel_Init(CM_TMR0_TypeDef *TMR0x, const stc_tmr0_wheel_init_t *pstcWheelInit);
+int32_t TMR0_Wheel_IrqSignIn(CM_TMR0_TypeDef *TMR0x, IRQn_Type enIRQn, uint32_t u32IrqPrio);
+
+int32_t TMR0_Wheel_TimerInit(stc_tmr0_wheel_timer_t *pstcTimer,
+                             void (*pfnCallback)(stc_tmr0_wheel_timer_t *pstcTimer), void *pvUserData);
+int32_t TMR0_Wheel_TimerStart(stc_tmr0_wheel_timer_t *pstcTimer, uint32_t u32Ticks, uint32_t u32Period);
+void TMR0_Wheel_TimerStop(stc_tmr0_wheel_timer_t *pstcTimer);
+en_flag_status_t TMR0_Wheel_TimerIsRunning(const stc_tmr0_wheel_timer_t *pstcTimer);
+
+uint32_t TMR0_Wheel_GetTick(void);
+uint32_t TMR0_Wheel_GetIdleTicks(void);
+
+void TMR0_Wheel_CmpIrqHandler(CM_TMR0_TypeDef *TMR0x);
+
+/**
+ * @}
+ */
+
+#endif /* LL_TMR0_WHEEL_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __HC32_LL_TMR0_WHEEL_H__ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
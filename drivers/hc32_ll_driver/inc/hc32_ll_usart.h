@@ -7,6 +7,7 @@
    Change Logs:
    Date             Author          Notes
    2022-03-31       CDT             First version
+   2026-10-17       CDT             Add API USART_CalculateBrr(), USART_SetBrr() and USART_SetBaudratePpm()
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2022-2023, Xiaohua Semiconductor Co., Ltd. All rights reserved.
@@ -145,6 +146,15 @@ typedef struct {
                                              This parameter can be a value of @ref USART_Over_Sample_Bit */
 } stc_usart_lin_init_t;
 
+/**
+ * @brief USART BRR division structure definition
+ */
+typedef struct {
+    uint32_t u32DivInteger;             /*!< BRR DIV_Integer. */
+    uint32_t u32DivFraction;            /*!< BRR DIV_Fraction, USART_BRR_DIV_FRACTION_OFF for the integer division. */
+    int32_t i32ErrorPpm;                /*!< Baudrate error in ppm: (actual / requested baudrate - 1) * 1000000. */
+} stc_usart_brr_t;
+
 /**
  * @}
  */
@@ -309,6 +319,33 @@ typedef struct {
  * @}
  */
 
+/**
+ * @defgroup USART_BRR_Constant USART BRR Constant
+ * @brief Initializers of @ref stc_usart_brr_t for baudrates known at build time, the integer
+ *        division: USART_SetBrr() then sets the baudrate without any calculation.
+ * @note  clk is the USART clock, the bus clock divided by USART_CLK_DIVx. The division is not
+ *        range checked, USART_CalculateBrr() returns the same result or LL_ERR_INVD_PARAM.
+ * @{
+ */
+#define USART_BRR_DIV_FRACTION_OFF      (0xFFFFFFFFUL)  /*!< Fraction division off */
+
+#define USART_BRR_CONST_DIV(clk, baud, scale)                                  \
+    (((uint32_t)(clk) + (((uint32_t)(scale) * (uint32_t)(baud)) / 2UL)) / ((uint32_t)(scale) * (uint32_t)(baud)))
+#define USART_BRR_CONST_PPM(clk, baud, scale)                                  \
+    ((int32_t)(((((uint64_t)(clk) * 2000000ULL) /                              \
+                 ((uint64_t)(scale) * (uint64_t)(baud) * (uint64_t)USART_BRR_CONST_DIV((clk), (baud), (scale)))) + 1ULL) / 2ULL) - 1000000L)
+#define USART_BRR_CONST(clk, baud, scale)                                      \
+    {USART_BRR_CONST_DIV((clk), (baud), (scale)) - 1UL, USART_BRR_DIV_FRACTION_OFF, USART_BRR_CONST_PPM((clk), (baud), (scale))}
+
+/* over is a value of @ref USART_Over_Sample_Bit */
+#define USART_UART_BRR_CONST(clk, baud, over)                                  \
+    USART_BRR_CONST((clk), (baud), ((USART_OVER_SAMPLE_8BIT == (over)) ? 8UL : 16UL))
+#define USART_CLOCKSYNC_BRR_CONST(clk, baud)                                   \
+    USART_BRR_CONST((clk), (baud), 4UL)
+/**
+ * @}
+ */
+
 /**
  * @defgroup USART_Max_Timeout USART Max Timeout
  * @{
@@ -371,6 +408,10 @@ void USART_WriteData(CM_USART_TypeDef *USARTx, uint16_t u16Data);
 void USART_WriteID(CM_USART_TypeDef *USARTx, uint16_t u16ID);
 
 int32_t USART_SetBaudrate(CM_USART_TypeDef *USARTx, uint32_t u32Baudrate, float32_t *pf32Error);
+int32_t USART_SetBaudratePpm(CM_USART_TypeDef *USARTx, uint32_t u32Baudrate, int32_t *pi32ErrorPpm);
+int32_t USART_CalculateBrr(const CM_USART_TypeDef *USARTx, uint32_t u32UsartClk, uint32_t u32Baudrate,
+                           stc_usart_brr_t *pstcBrr);
+void USART_SetBrr(CM_USART_TypeDef *USARTx, const stc_usart_brr_t *pstcBrr);
 
 int32_t USART_UART_Trans(CM_USART_TypeDef *USARTx, const void *pvBuf, uint32_t u32Len, uint32_t u32Timeout);
 int32_t USART_UART_Receive(const CM_USART_TypeDef *USARTx, void *pvBuf, uint32_t u32Len, uint32_t u32Timeout);
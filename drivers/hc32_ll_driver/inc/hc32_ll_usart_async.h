@@ -0,0 +1,170 @@
+/**
+ *******************************************************************************
+ * @file  hc32_ll_usart_async.h
+ * @brief This file contains all the functions prototypes of the USART
+ *        interrupt-driven asynchronous UART driver library.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-16       CDT             First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2022-2023, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+#ifndef __HC32_LL_USART_ASYNC_H__
+#define __HC32_LL_USART_ASYNC_H__
+
+/* C binding of definitions if building with C++ compiler */
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_ll_def.h"
+
+#include "hc32f1xx.h"
+#include "hc32f1xx_conf.h"
+
+/**
+ * @addtogroup LL_Driver
+ * @{
+ */
+
+/**
+ * @addtogroup LL_USART_ASYNC
+ * @{
+ */
+
+#if (LL_USART_ASYNC_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Global type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @defgroup USART_ASYNC_Global_Types USART Async Global Types
+ * @{
+ */
+
+/**
+ * @brief USART asynchronous mode initialization structure definition
+ * @note  The TX/RX buffer size must be a power of 2 and the buffers must stay valid until
+ *        USART_Async_DeInit() is called.
+ */
+typedef struct {
+    uint8_t *pu8TxBuf;                  /*!< Pointer to the TX ring buffer storage. */
+    uint32_t u32TxBufSize;              /*!< TX ring buffer size in bytes, must be a power of 2. */
+    uint8_t *pu8RxBuf;                  /*!< Pointer to the RX ring buffer storage. */
+    uint32_t u32RxBufSize;              /*!< RX ring buffer size in bytes, must be a power of 2. */
+    void (*pfnTxCpltCallback)(CM_USART_TypeDef *USARTx);
+                                        /*!< Called from the TCI handler once the TX ring buffer is drained
+                                             and the last frame left the shift register. NULL if unused. */
+    void (*pfnRxCallback)(CM_USART_TypeDef *USARTx, uint32_t u32RxCount);
+                                        /*!< Called from the RI handler after a frame is stored, with the
+                                             number of frames pending in the RX ring buffer. NULL if unused. */
+    void (*pfnErrorCallback)(CM_USART_TypeDef *USARTx, uint32_t u32Error);
+                                        /*!< Called from the EI handler with the error flags,
+                                             @ref USART_Async_Error for details. NULL if unused. */
+} stc_usart_async_init_t;
+
+/**
+ * @brief USART asynchronous mode IRQ registration structure definition
+ * @note  Every IRQ number must be one of the two dedicated vectors of the interrupt source group,
+ *        @ref INTC_IrqSignIn for details.
+ */
+typedef struct {
+    IRQn_Type enRxErrIRQn;              /*!< IRQ number for INT_SRC_USARTx_EI. */
+    IRQn_Type enRxFullIRQn;             /*!< IRQ number for INT_SRC_USARTx_RI. */
+    IRQn_Type enTxEmptyIRQn;            /*!< IRQ number for INT_SRC_USARTx_TI. */
+    IRQn_Type enTxCpltIRQn;             /*!< IRQ number for INT_SRC_USARTx_TCI. */
+    uint32_t u32IrqPrio;                /*!< IRQ priority, @ref INTC_Priority_Sel for details. */
+} stc_usart_async_irq_t;
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup USART_ASYNC_Global_Macros USART Async Global Macros
+ * @{
+ */
+
+/**
+ * @defgroup USART_Async_Error USART Async Error
+ * @{
+ */
+#define USART_ASYNC_ERR_PARITY          (USART_SR_PE)       /*!< Parity error */
+#define USART_ASYNC_ERR_FRAME           (USART_SR_FE)       /*!< Framing error */
+#define USART_ASYNC_ERR_OVERRUN         (USART_SR_ORE)      /*!< Hardware overrun error */
+#define USART_ASYNC_ERR_RX_BUF_FULL     (1UL << 16U)        /*!< Frame dropped because the RX ring buffer is full */
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions ('extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+  Global function prototypes (definition in C source)
+ ******************************************************************************/
+/**
+ * @addtogroup USART_ASYNC_Global_Functions
+ * @{
+ */
+int32_t USART_Async_StructInit(stc_usart_async_init_t *pstcAsyncInit);
+int32_t USART_Async_Init(CM_USART_TypeDef *USARTx, const stc_usart_async_init_t *pstcAsyncInit);
+void USART_Async_DeInit(CM_USART_TypeDef *USARTx);
+int32_t USART_Async_IrqSignIn(CM_USART_TypeDef *USARTx, const stc_usart_async_irq_t *pstcIrq);
+
+uint32_t USART_Async_Write(CM_USART_TypeDef *USARTx, const uint8_t au8Buf[], uint32_t u32Len);
+uint32_t USART_Async_Read(CM_USART_TypeDef *USARTx, uint8_t au8Buf[], uint32_t u32Len);
+uint32_t USART_Async_GetRxCount(const CM_USART_TypeDef *USARTx);
+uint32_t USART_Async_GetTxSpace(const CM_USART_TypeDef *USARTx);
+en_flag_status_t USART_Async_GetTxBusy(const CM_USART_TypeDef *USARTx);
+void USART_Async_FlushRx(CM_USART_TypeDef *USARTx);
+
+void USART_Async_RxErrorIrqHandler(CM_USART_TypeDef *USARTx);
+void USART_Async_RxFullIrqHandler(CM_USART_TypeDef *USARTx);
+void USART_Async_TxEmptyIrqHandler(CM_USART_TypeDef *USARTx);
+void USART_Async_TxCpltIrqHandler(CM_USART_TypeDef *USARTx);
+
+/**
+ * @}
+ */
+
+#endif /* LL_USART_ASYNC_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __HC32_LL_USART_ASYNC_H__ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
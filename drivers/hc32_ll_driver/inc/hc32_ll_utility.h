@@ -6,6 +6,8 @@
    Change Logs:
    Date             Author          Notes
    2022-03-31       CDT             First version
+   2026-10-16       CDT             Add SysTick_GetMicros & SysTick_SleepUntil
+   2026-10-17       CDT             Add LL_ENTER_CRITICAL & LL_EXIT_CRITICAL
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2022-2023, Xiaohua Semiconductor Co., Ltd. All rights reserved.
@@ -53,6 +55,32 @@ extern "C"
 /*******************************************************************************
  * Global pre-processor symbols/macros ('#define')
  ******************************************************************************/
+/**
+ * @defgroup UTILITY_Global_Macros UTILITY Global Macros
+ * @{
+ */
+
+/**
+ * @defgroup UTILITY_Critical_Section UTILITY Critical Section
+ * @brief Mask the interrupts with PRIMASK for a few instructions, Cortex-M0+ has no
+ *        exclusive access. The sections nest, prim is a uint32_t of the caller that
+ *        keeps the PRIMASK value to restore.
+ * @{
+ */
+#define LL_ENTER_CRITICAL(prim)                                                \
+do {                                                                           \
+    (prim) = __get_PRIMASK();                                                  \
+    __disable_irq();                                                           \
+} while (0)
+
+#define LL_EXIT_CRITICAL(prim)          __set_PRIMASK(prim)
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
 
 /*******************************************************************************
  * Global variable definitions ('extern')
@@ -66,7 +94,7 @@ extern "C"
  * @{
  */
 
-/* Imprecise delay */
+/* Imprecise delay, exact while SysTick runs */
 void DDL_DelayMS(uint32_t u32Count);
 void DDL_DelayUS(uint32_t u32Count);
 
@@ -75,6 +103,8 @@ int32_t SysTick_Init(uint32_t u32Freq);
 void SysTick_Delay(uint32_t u32Delay);
 void SysTick_IncTick(void);
 uint32_t SysTick_GetTick(void);
+uint32_t SysTick_GetMicros(void);
+void SysTick_SleepUntil(uint32_t u32Deadline);
 void SysTick_Suspend(void);
 void SysTick_Resume(void);
 
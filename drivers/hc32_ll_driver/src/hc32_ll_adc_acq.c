@@ -0,0 +1,413 @@
+/**
+ *******************************************************************************
+ * @file  hc32_ll_adc_acq.c
+ * @brief This file provides firmware functions to acquire multi-channel ADC
+ *        samples at a hardware trigger rate into ping-pong buffers.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-16       CDT             First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2022-2023, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_ll_adc_acq.h"
+#include "hc32_ll_adc.h"
+#include "hc32_ll_aos.h"
+#include "hc32_ll_interrupts.h"
+#include "hc32_ll_utility.h"
+
+/**
+ * @addtogroup LL_Driver
+ * @{
+ */
+
+/**
+ * @defgroup LL_ADC_ACQ ADC_ACQ
+ * @brief ADC Timer-triggered Acquisition Driver Library
+ * @{
+ */
+
+#if (LL_ADC_ACQ_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @defgroup ADC_ACQ_Local_Types ADC Acquisition Local Types
+ * @{
+ */
+
+/**
+ * @brief ADC acquisition control block definition
+ * @note  At most one block is ready at a time: the IRQ handler only hands over the block
+ *        it filled while the application holds none, so au8Ready[] needs no lock.
+ */
+typedef struct {
+    uint16_t *apu16Block[2U];           /*!< Ping and pong block. */
+    uint32_t u32BlockLen;               /*!< Block length in halfwords. */
+    uint32_t u32ChNum;                  /*!< Channels per scan. */
+    uint8_t au8DrOffset[ADC_CH11 + 1U]; /*!< Data register offset of each channel of a scan. */
+    void (*pfnBlockCallback)(const uint16_t *pu16Block, uint32_t u32Len);
+    uint32_t u32FillPos;                /*!< Next halfword of the block being filled. */
+    uint8_t u8FillBlock;                /*!< Block being filled, 0 or 1. */
+    __IO uint8_t au8Ready[2U];          /*!< 1U while the block is full and held by the application. */
+    __IO uint32_t u32OverrunCount;      /*!< Blocks dropped as the application held the other one. */
+} stc_adc_acq_ctrl_t;
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup ADC_ACQ_Local_Macros ADC Acquisition Local Macros
+ * @{
+ */
+
+/**
+ * @defgroup ADC_ACQ_Check_Parameters_Validity ADC Acquisition Check Parameters Validity
+ * @{
+ */
+#define IS_ADC_ACQ_UNIT(x)              ((x) == CM_ADC)
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+#if (LL_INTERRUPTS_ENABLE == DDL_ON)
+static void ADC_ACQ_Eoca_IrqCallback(void);
+#endif /* LL_INTERRUPTS_ENABLE */
+
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+/**
+ * @defgroup ADC_ACQ_Local_Variables ADC Acquisition Local Variables
+ * @{
+ */
+static stc_adc_acq_ctrl_t m_stcAdcAcq;
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @defgroup ADC_ACQ_Local_Functions ADC Acquisition Local Functions
+ * @{
+ */
+
+#if (LL_INTERRUPTS_ENABLE == DDL_ON)
+static void ADC_ACQ_Eoca_IrqCallback(void)
+{
+    ADC_ACQ_EocaIrqHandler(CM_ADC);
+}
+#endif /* LL_INTERRUPTS_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup ADC_ACQ_Global_Functions ADC Acquisition Global Functions
+ * @{
+ */
+
+/**
+ * @brief  Set the fields of structure stc_adc_acq_init_t to default values.
+ * @param  [out] pstcAcqInit        Pointer to a @ref stc_adc_acq_init_t structure.
+ * @retval int32_t:
+ *         - LL_OK:                 Success
+ *         - LL_ERR_INVD_PARAM:     pstcAcqInit is NULL.
+ */
+int32_t ADC_ACQ_StructInit(stc_adc_acq_init_t *pstcAcqInit)
+{
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+
+    if (NULL != pstcAcqInit) {
+        pstcAcqInit->u16ChMask = 0U;
+        pstcAcqInit->enTriggerSrc = EVT_SRC_TMRB_1_CMP;
+        pstcAcqInit->pu16Buf = NULL;
+        pstcAcqInit->u32BlockScans = 0UL;
+        pstcAcqInit->pfnBlockCallback = NULL;
+        i32Ret = LL_OK;
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Initialize the acquisition: channels and hard trigger of sequence A.
+ * @param  [in] ADCx                Pointer to ADC instance register base.
+ *                                  This parameter can be a value of the following:
+ *         @arg CM_ADC or CM_ADCx:  ADC instance register base.
+ * @param  [in] pstcAcqInit         Pointer to a @ref stc_adc_acq_init_t structure.
+ * @retval int32_t:
+ *         - LL_OK:                 Success
+ *         - LL_ERR_INVD_PARAM:     pstcAcqInit or its buffer is NULL, or no channel or scan.
+ * @note   Call ADC_Init() first with ADC_MD_SEQA_SINGLESHOT, and set the sampling times.
+ *         The ADC and AOS function clocks must be enabled, @ref FCG_Fcg0PeriphClockCmd.
+ * @note   The trigger rate must leave time for one scan of all channels and the IRQ handler.
+ */
+int32_t ADC_ACQ_Init(CM_ADC_TypeDef *ADCx, const stc_adc_acq_init_t *pstcAcqInit)
+{
+    uint32_t u32Ch;
+    uint32_t u32ChNum = 0UL;
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+
+    DDL_ASSERT(IS_ADC_ACQ_UNIT(ADCx));
+
+    if ((NULL != pstcAcqInit) && (NULL != pstcAcqInit->pu16Buf) && (0UL != pstcAcqInit->u32BlockScans) &&
+        (0U != pstcAcqInit->u16ChMask) && (0UL == ((uint32_t)pstcAcqInit->u16ChMask & ~ADC_CHSELRA_CHSELA))) {
+        ADC_ACQ_Stop(ADCx);
+
+        for (u32Ch = 0UL; u32Ch <= ADC_CH11; u32Ch++) {
+            if (0U != (pstcAcqInit->u16ChMask & (1U << u32Ch))) {
+                m_stcAdcAcq.au8DrOffset[u32ChNum] = (uint8_t)(u32Ch * 2UL);
+                u32ChNum++;
+            }
+        }
+        m_stcAdcAcq.u32ChNum = u32ChNum;
+        m_stcAdcAcq.u32BlockLen = pstcAcqInit->u32BlockScans * u32ChNum;
+        m_stcAdcAcq.apu16Block[0U] = pstcAcqInit->pu16Buf;
+        m_stcAdcAcq.apu16Block[1U] = &pstcAcqInit->pu16Buf[m_stcAdcAcq.u32BlockLen];
+        m_stcAdcAcq.pfnBlockCallback = pstcAcqInit->pfnBlockCallback;
+
+        WRITE_REG32(ADCx->CHSELRA, pstcAcqInit->u16ChMask);
+        AOS_SetTriggerEventSrc(AOS_ADC_0, pstcAcqInit->enTriggerSrc);
+        ADC_TriggerConfig(ADCx, ADC_SEQ_A, ADC_HARDTRIG_EVT0);
+        i32Ret = LL_OK;
+    }
+
+    return i32Ret;
+}
+
+#if (LL_INTERRUPTS_ENABLE == DDL_ON)
+/**
+ * @brief  Register the EOCA interrupt source and enable the NVIC IRQ.
+ * @param  [in] ADCx                Pointer to ADC instance register base.
+ *                                  This parameter can be a value of the following:
+ *         @arg CM_ADC or CM_ADCx:  ADC instance register base.
+ * @param  [in] enIRQn              IRQ number for INT_SRC_ADC_EOCA, @ref INTC_IrqSignIn for details.
+ * @param  [in] u32IrqPrio          IRQ priority, @ref INTC_Priority_Sel for details.
+ * @retval int32_t:
+ *         - LL_OK:                 Success
+ *         - LL_ERR_INVD_PARAM:     The IRQ number doesn't match the interrupt source.
+ * @note   INTC registers must be unlocked, @ref LL_PERIPH_WE for details.
+ * @note   To use the share IRQ handler instead, enable the source with INTC_ShareIrqCmd()
+ *         and call ADC_ACQ_EocaIrqHandler() from the ADC_SeqA_IrqHandler() hook.
+ */
+int32_t ADC_ACQ_IrqSignIn(CM_ADC_TypeDef *ADCx, IRQn_Type enIRQn, uint32_t u32IrqPrio)
+{
+    stc_irq_signin_config_t stcIrqSignConfig;
+    int32_t i32Ret;
+
+    DDL_ASSERT(IS_ADC_ACQ_UNIT(ADCx));
+    (void)ADCx;
+
+    stcIrqSignConfig.enIntSrc = INT_SRC_ADC_EOCA;
+    stcIrqSignConfig.enIRQn = enIRQn;
+    stcIrqSignConfig.pfnCallback = &ADC_ACQ_Eoca_IrqCallback;
+    i32Ret = INTC_IrqSignIn(&stcIrqSignConfig);
+    if (LL_OK == i32Ret) {
+        NVIC_ClearPendingIRQ(enIRQn);
+        NVIC_SetPriority(enIRQn, u32IrqPrio);
+        NVIC_EnableIRQ(enIRQn);
+    }
+
+    return i32Ret;
+}
+#endif /* LL_INTERRUPTS_ENABLE */
+
+/**
+ * @brief  Start the acquisition into the first block, sequence A then runs at every trigger event.
+ * @param  [in] ADCx                Pointer to ADC instance register base.
+ *                                  This parameter can be a value of the following:
+ *         @arg CM_ADC or CM_ADCx:  ADC instance register base.
+ * @retval None
+ * @note   Start the trigger source (the timer) after this function.
+ */
+void ADC_ACQ_Start(CM_ADC_TypeDef *ADCx)
+{
+    DDL_ASSERT(IS_ADC_ACQ_UNIT(ADCx));
+
+    m_stcAdcAcq.u32FillPos = 0UL;
+    m_stcAdcAcq.u8FillBlock = 0U;
+    m_stcAdcAcq.au8Ready[0U] = 0U;
+    m_stcAdcAcq.au8Ready[1U] = 0U;
+    m_stcAdcAcq.u32OverrunCount = 0UL;
+
+    ADC_ClearStatus(ADCx, ADC_FLAG_EOCA);
+    ADC_IntCmd(ADCx, ADC_INT_EOCA, ENABLE);
+    ADC_TriggerCmd(ADCx, ADC_SEQ_A, ENABLE);
+}
+
+/**
+ * @brief  Stop the acquisition. A partly filled block is dropped.
+ * @param  [in] ADCx                Pointer to ADC instance register base.
+ *                                  This parameter can be a value of the following:
+ *         @arg CM_ADC or CM_ADCx:  ADC instance register base.
+ * @retval None
+ */
+void ADC_ACQ_Stop(CM_ADC_TypeDef *ADCx)
+{
+    DDL_ASSERT(IS_ADC_ACQ_UNIT(ADCx));
+
+    ADC_TriggerCmd(ADCx, ADC_SEQ_A, DISABLE);
+    ADC_IntCmd(ADCx, ADC_INT_EOCA, DISABLE);
+    ADC_Stop(ADCx);
+}
+
+/**
+ * @brief  Get the full block held by the application.
+ * @param  [in] ADCx                Pointer to ADC instance register base.
+ *                                  This parameter can be a value of the following:
+ *         @arg CM_ADC or CM_ADCx:  ADC instance register base.
+ * @param  [out] ppu16Block         The block, u32BlockScans * (number of channels) halfwords.
+ * @retval int32_t:
+ *         - LL_OK:                 A block is ready.
+ *         - LL_ERR_BUF_EMPTY:      No block is ready.
+ *         - LL_ERR_INVD_PARAM:     ppu16Block is NULL.
+ * @note   The block stays valid until ADC_ACQ_ReleaseBlock(), acquisition goes on in the
+ *         other block meanwhile.
+ */
+int32_t ADC_ACQ_GetBlock(const CM_ADC_TypeDef *ADCx, const uint16_t **ppu16Block)
+{
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+
+    DDL_ASSERT(IS_ADC_ACQ_UNIT(ADCx));
+    (void)ADCx;
+
+    if (NULL != ppu16Block) {
+        i32Ret = LL_OK;
+        if (0U != m_stcAdcAcq.au8Ready[0U]) {
+            *ppu16Block = m_stcAdcAcq.apu16Block[0U];
+        } else if (0U != m_stcAdcAcq.au8Ready[1U]) {
+            *ppu16Block = m_stcAdcAcq.apu16Block[1U];
+        } else {
+            i32Ret = LL_ERR_BUF_EMPTY;
+        }
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Give the full block back to the acquisition.
+ * @param  [in] ADCx                Pointer to ADC instance register base.
+ *                                  This parameter can be a value of the following:
+ *         @arg CM_ADC or CM_ADCx:  ADC instance register base.
+ * @retval None
+ * @note   Can be called from the block callback.
+ */
+void ADC_ACQ_ReleaseBlock(CM_ADC_TypeDef *ADCx)
+{
+    DDL_ASSERT(IS_ADC_ACQ_UNIT(ADCx));
+    (void)ADCx;
+
+    if (0U != m_stcAdcAcq.au8Ready[0U]) {
+        m_stcAdcAcq.au8Ready[0U] = 0U;
+    } else {
+        m_stcAdcAcq.au8Ready[1U] = 0U;
+    }
+}
+
+/**
+ * @brief  Get the number of blocks dropped since ADC_ACQ_Start().
+ * @param  [in] ADCx                Pointer to ADC instance register base.
+ *                                  This parameter can be a value of the following:
+ *         @arg CM_ADC or CM_ADCx:  ADC instance register base.
+ * @retval uint32_t                 Number of blocks refilled because the application
+ *                                  still held the other block.
+ */
+uint32_t ADC_ACQ_GetOverrunCount(const CM_ADC_TypeDef *ADCx)
+{
+    DDL_ASSERT(IS_ADC_ACQ_UNIT(ADCx));
+    (void)ADCx;
+
+    return m_stcAdcAcq.u32OverrunCount;
+}
+
+/**
+ * @brief  ADC end of sequence A conversion(INT_SRC_ADC_EOCA) IRQ handler.
+ * @param  [in] ADCx                Pointer to ADC instance register base.
+ *                                  This parameter can be a value of the following:
+ *         @arg CM_ADC or CM_ADCx:  ADC instance register base.
+ * @retval None
+ * @note   Copies one scan into the block being filled. A full block is handed to the
+ *         application and filling goes on in the other one, unless the application
+ *         still holds it: then the full block is refilled and counted as an overrun.
+ */
+void ADC_ACQ_EocaIrqHandler(CM_ADC_TypeDef *ADCx)
+{
+    uint32_t i;
+    uint16_t *pu16Dest;
+    const uint32_t u32DrAddr = (uint32_t)&ADCx->DR0;
+    stc_adc_acq_ctrl_t *pstcCtrl = &m_stcAdcAcq;
+    uint8_t u8Block = pstcCtrl->u8FillBlock;
+
+    WRITE_REG8(ADCx->ISCLRR, ADC_FLAG_EOCA);
+
+    pu16Dest = &pstcCtrl->apu16Block[u8Block][pstcCtrl->u32FillPos];
+    for (i = 0UL; i < pstcCtrl->u32ChNum; i++) {
+        pu16Dest[i] = RW_MEM16(u32DrAddr + pstcCtrl->au8DrOffset[i]);
+    }
+
+    pstcCtrl->u32FillPos += pstcCtrl->u32ChNum;
+    if (pstcCtrl->u32FillPos >= pstcCtrl->u32BlockLen) {
+        pstcCtrl->u32FillPos = 0UL;
+        if (0U != pstcCtrl->au8Ready[u8Block ^ 1U]) {
+            pstcCtrl->u32OverrunCount++;
+        } else {
+            pstcCtrl->au8Ready[u8Block] = 1U;
+            pstcCtrl->u8FillBlock = (uint8_t)(u8Block ^ 1U);
+            if (NULL != pstcCtrl->pfnBlockCallback) {
+                pstcCtrl->pfnBlockCallback(pstcCtrl->apu16Block[u8Block], pstcCtrl->u32BlockLen);
+            }
+        }
+    }
+}
+
+/**
+ * @}
+ */
+
+#endif /* LL_ADC_ACQ_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/******************************************************************************
+ * EOF (not truncated)
+ *****************************************************************************/
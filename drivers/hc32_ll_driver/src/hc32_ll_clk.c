@@ -7,6 +7,7 @@
    Date             Author          Notes
    2022-03-31       CDT             First version
    2023-01-15       CDT             Add ADC clock assert.
+   2026-10-16       CDT             Fix HCLK of CLK_GetBusClockFreq(), SystemCoreClock is divided already
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2022-2023, Xiaohua Semiconductor Co., Ltd. All rights reserved.
@@ -685,7 +686,8 @@ uint32_t CLK_GetBusClockFreq(uint32_t u32Clock)
 
     switch (u32Clock) {
         case CLK_BUS_HCLK:
-            u32ClockFreq = SystemCoreClock >> (READ_REG8_BIT(CM_CMU->SCKDIVR, CMU_SCKDIVR_SCKDIV));
+            /* SystemCoreClockUpdate() applies SCKDIV already */
+            u32ClockFreq = SystemCoreClock;
             break;
         default:
             u32ClockFreq = SystemCoreClock;
@@ -8,6 +8,7 @@
    Date             Author          Notes
    2022-03-31       CDT             First version
    2022-06-30       CDT             Add waiting time after write CRC data
+   2026-10-16       CDT             Add CRC context API for interleaved streams.
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2022-2023, Xiaohua Semiconductor Co., Ltd. All rights reserved.
@@ -99,6 +100,15 @@
  * @}
  */
 
+/**
+ * @defgroup CRC_Context_Word_Align CRC Context Word Align
+ * @{
+ */
+#define CRC_WORD_ALIGN_MASK             (3UL)
+/**
+ * @}
+ */
+
 /**
  * @defgroup CRC_Calculate_Clock_Count CRC Calculate Clock Count
  * @{
@@ -319,6 +329,29 @@ static en_flag_status_t CRC_CheckData(uint32_t u32InitValue, uint8_t u8DataWidth
 
     return enStatus;
 }
+
+/**
+ * @brief  Set the CRC protocol and the value to start with.
+ * @param  [in] u32Protocol             CRC protocol control bit.
+ *         This parameter can be a value of @ref CRC_Protocol_Control_Bit
+ * @param  [in] u32Value                The value written to the result register.
+ * @retval uint32_t                     The result register value read back.
+ */
+static uint32_t CRC_SetValue(uint32_t u32Protocol, uint32_t u32Value)
+{
+    uint32_t u32ReadValue;
+
+    MODIFY_REG32(CM_CRC->CR, CRC_CR_CR, u32Protocol);
+    if (CRC_CRC32 == u32Protocol) {
+        WRITE_REG32(CM_CRC->RESLT, u32Value);
+        u32ReadValue = READ_REG32(CM_CRC->RESLT);
+    } else {
+        WRITE_REG16(CM_CRC->RESLT, (u32Value & CRC16_INIT_VALUE));
+        u32ReadValue = (READ_REG16(CM_CRC->RESLT) & CRC16_INIT_VALUE);
+    }
+
+    return u32ReadValue;
+}
 /**
  * @}
  */
@@ -581,6 +614,113 @@ en_flag_status_t CRC_CheckData32(uint32_t u32InitValue, const uint32_t au32Data[
     return enStatus;
 }
 
+/**
+ * @brief  Start a CRC data stream.
+ * @param  [out] pstcCtx                Pointer to a @ref stc_crc_context_t structure.
+ * @param  [in] u32Protocol             CRC protocol control bit.
+ *         This parameter can be a value of @ref CRC_Protocol_Control_Bit
+ * @param  [in] u32InitValue            Initial value of the stream, see @ref CRC_Initial_Value.
+ * @retval int32_t:
+ *           - LL_OK:                   No errors occurred.
+ *           - LL_ERR_INVD_PARAM:       The pointer pstcCtx value is NULL.
+ * @note   Any number of contexts can be fed in interleaved chunks, each chunk
+ *         restores the running value of its stream to the CRC unit and saves it
+ *         back. A chunk must not preempt another one (CRC_ContextUpdate() or the
+ *         other CRC functions) from an interrupt.
+ */
+int32_t CRC_ContextInit(stc_crc_context_t *pstcCtx, uint32_t u32Protocol, uint32_t u32InitValue)
+{
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+
+    if (NULL != pstcCtx) {
+        DDL_ASSERT(IS_CRC_PROTOCOL(u32Protocol));
+
+        pstcCtx->u32Protocol = u32Protocol;
+        pstcCtx->u32Value = u32InitValue;
+        if (CRC_CRC16 == u32Protocol) {
+            pstcCtx->u32Value &= CRC16_INIT_VALUE;
+        }
+        /* The result register may read differently from the value written to it, learn
+           the difference once so that the running value can be written back exactly. */
+        pstcCtx->u32ReadXor = CRC_SetValue(u32Protocol, pstcCtx->u32Value) ^ pstcCtx->u32Value;
+        i32Ret = LL_OK;
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Feed a chunk of a CRC data stream.
+ * @param  [in] pstcCtx                 Pointer to a @ref stc_crc_context_t structure started by CRC_ContextInit().
+ * @param  [in] au8Data                 Pointer to the buffer containing the data of the chunk.
+ * @param  [in] u32Len                  The length(countered in bytes) of the chunk, may be 0.
+ * @retval int32_t:
+ *           - LL_OK:                   No errors occurred.
+ *           - LL_ERR_INVD_PARAM:       The pointer pstcCtx value is NULL, or au8Data value is NULL
+ *                                      while u32Len value is not 0.
+ * @note   The word aligned middle of the buffer is written in words, the unaligned
+ *         head and tail in bytes, in the order of the buffer.
+ */
+int32_t CRC_ContextUpdate(stc_crc_context_t *pstcCtx, const uint8_t au8Data[], uint32_t u32Len)
+{
+    uint32_t u32Head;
+    uint32_t u32Words;
+    uint32_t i = 0UL;
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+
+    if ((NULL != pstcCtx) && ((NULL != au8Data) || (0UL == u32Len))) {
+        if (0UL != u32Len) {
+            (void)CRC_SetValue(pstcCtx->u32Protocol, pstcCtx->u32Value);
+
+            u32Head = (4UL - ((uint32_t)au8Data & CRC_WORD_ALIGN_MASK)) & CRC_WORD_ALIGN_MASK;
+            if (u32Head > u32Len) {
+                u32Head = u32Len;
+            }
+            u32Words = (u32Len - u32Head) >> 2U;
+
+            if (0UL != u32Head) {
+                (void)CRC_WriteData8(au8Data, u32Head);
+                i = u32Head;
+            }
+            if (0UL != u32Words) {
+                (void)CRC_WriteData32((const uint32_t *)(uint32_t)&au8Data[i], u32Words);
+                i += (u32Words << 2U);
+            }
+            if (i < u32Len) {
+                (void)CRC_WriteData8(&au8Data[i], u32Len - i);
+            }
+
+            /* Save the running value */
+            if (CRC_CRC32 == pstcCtx->u32Protocol) {
+                pstcCtx->u32Value = READ_REG32(CM_CRC->RESLT) ^ pstcCtx->u32ReadXor;
+            } else {
+                pstcCtx->u32Value = (READ_REG16(CM_CRC->RESLT) & CRC16_INIT_VALUE) ^ pstcCtx->u32ReadXor;
+            }
+        }
+        i32Ret = LL_OK;
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Get the CRC value of the data fed to a stream so far.
+ * @param  [in] pstcCtx                 Pointer to a @ref stc_crc_context_t structure started by CRC_ContextInit().
+ * @retval uint32_t                     The CRC value, as CRC_CalculateData8() returns for the
+ *                                      whole data. 0 if pstcCtx value is NULL.
+ * @note   The stream can be fed further after this.
+ */
+uint32_t CRC_ContextGetValue(const stc_crc_context_t *pstcCtx)
+{
+    uint32_t u32CrcValue = 0UL;
+
+    if (NULL != pstcCtx) {
+        u32CrcValue = pstcCtx->u32Value ^ pstcCtx->u32ReadXor;
+    }
+
+    return u32CrcValue;
+}
+
 /**
  * @}
  */
@@ -0,0 +1,497 @@
+/**
+ *******************************************************************************
+ * @file  hc32_ll_dvfs.c
+ * @brief This file provides firmware functions of the dynamic frequency
+ *        scaling service.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-16       CDT             First version
+   2026-10-17       CDT             Restore the USART and I2C baudrates without floating point
+                                    Use LL_ENTER_CRITICAL()/LL_EXIT_CRITICAL()
+                                    Back to low speed mode when the wait cycles cannot be raised
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2022-2023, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_ll_dvfs.h"
+#include "hc32_ll_clk.h"
+#include "hc32_ll_efm.h"
+#include "hc32_ll_pwc.h"
+#include "hc32_ll_utility.h"
+#if (LL_USART_ENABLE == DDL_ON)
+#include "hc32_ll_usart.h"
+#endif
+
+/**
+ * @addtogroup LL_Driver
+ * @{
+ */
+
+/**
+ * @defgroup LL_DVFS DVFS
+ * @brief Dynamic Frequency Scaling
+ * @note  DVFS_SetOpp() changes the system clock source, the HCLK divider and the power mode
+ *        in the order the hardware requires, keeps the flash wait cycles and the SysTick
+ *        frequency right, and tells the registered drivers to recompute their dividers.
+ * @{
+ */
+
+#if (LL_DVFS_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup DVFS_Local_Macros DVFS Local Macros
+ * @{
+ */
+
+/**
+ * @defgroup DVFS_Check_Parameters_Validity DVFS Check Parameters Validity
+ * @{
+ */
+#define IS_DVFS_SYSCLK_SRC(x)                                                  \
+(   ((x) == CLK_SYSCLK_SRC_HRC)                 ||                             \
+    ((x) == CLK_SYSCLK_SRC_XTAL)                ||                             \
+    ((x) == CLK_SYSCLK_SRC_LRC))
+
+#define IS_DVFS_HCLK_DIV(x)             ((x) <= CLK_HCLK_DIV64)
+
+#define IS_DVFS_PWR_MD(x)                                                      \
+(   ((x) == DVFS_PWR_MD_HIGH_SPEED)             ||                             \
+    ((x) == DVFS_PWR_MD_LOW_SPEED))
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+/**
+ * @defgroup DVFS_Local_Variables DVFS Local Variables
+ * @{
+ */
+static stc_dvfs_notifier_t *m_pstcDvfsChain = NULL;
+static uint32_t m_u32DvfsBusy = 0UL;
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @defgroup DVFS_Local_Functions DVFS Local Functions
+ * @{
+ */
+
+/**
+ * @brief  Check whether an oscillator can drive the system clock.
+ * @param  [in] u8SysClkSrc             System clock source, @ref CLK_System_Clock_Source
+ * @retval An @ref en_flag_status_t enumeration type value.
+ */
+static en_flag_status_t DVFS_IsClockReady(uint8_t u8SysClkSrc)
+{
+    en_flag_status_t enReady;
+
+    switch (u8SysClkSrc) {
+        case CLK_SYSCLK_SRC_HRC:
+            enReady = CLK_GetStableStatus(CLK_STB_FLAG_HRC);
+            break;
+        case CLK_SYSCLK_SRC_XTAL:
+            enReady = CLK_GetStableStatus(CLK_STB_FLAG_XTAL);
+            break;
+        default:
+            enReady = (0U == READ_REG8_BIT(CM_CMU->LRCCR, CMU_LRCCR_LRCSTP)) ? SET : RESET;
+            break;
+    }
+
+    return enReady;
+}
+
+/**
+ * @brief  Get the SysTick interrupt frequency to keep.
+ * @param  [in] u32Hclk                 HCLK frequency SysTick was set for.
+ * @retval Frequency, 0 if SysTick is stopped.
+ */
+static uint32_t DVFS_GetTickFreq(uint32_t u32Hclk)
+{
+    uint32_t u32Reload;
+    uint32_t u32Freq = 0UL;
+
+    if (0UL != (SysTick->CTRL & SysTick_CTRL_ENABLE_Msk)) {
+        u32Reload = (SysTick->LOAD & SysTick_LOAD_RELOAD_Msk) + 1UL;
+        u32Freq = (u32Hclk + (u32Reload / 2UL)) / u32Reload;
+    }
+
+    return u32Freq;
+}
+
+/**
+ * @brief  Run the notifier chain.
+ * @param  [in] u32Event                A @ref DVFS_Event value.
+ * @param  [in] pstcChange              Clock change.
+ * @param  [in] pstcEnd                 Notifier to stop before, NULL for the whole chain.
+ * @param  [out] ppstcVeto              DVFS_EVT_PRE_CHANGE: the vetoing notifier, NULL if none.
+ * @retval int32_t:
+ *           - LL_OK:                   All notifiers returned LL_OK.
+ *           - LL_ERR_BUSY:             DVFS_EVT_PRE_CHANGE was vetoed, the chain stopped there.
+ *           - LL_ERR:                  DVFS_EVT_POST_CHANGE failed for a notifier, the chain went on.
+ */
+static int32_t DVFS_Notify(uint32_t u32Event, const stc_dvfs_change_t *pstcChange,
+                           const stc_dvfs_notifier_t *pstcEnd, stc_dvfs_notifier_t **ppstcVeto)
+{
+    stc_dvfs_notifier_t *pstcNotifier = m_pstcDvfsChain;
+    int32_t i32Ret = LL_OK;
+
+    while ((NULL != pstcNotifier) && (pstcEnd != pstcNotifier)) {
+        if (LL_OK != pstcNotifier->pfnCallback(u32Event, pstcChange, pstcNotifier->pvUserData)) {
+            if (DVFS_EVT_PRE_CHANGE == u32Event) {
+                *ppstcVeto = pstcNotifier;
+                i32Ret = LL_ERR_BUSY;
+                break;
+            }
+            if (DVFS_EVT_POST_CHANGE == u32Event) {
+                i32Ret = LL_ERR;
+            }
+        }
+        pstcNotifier = pstcNotifier->pstcNext;
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Switch the system clock, HCLK never goes above the higher of the old and new ones.
+ * @param  [in] pstcOpp                 Operating point.
+ * @param  [in] u32TickFreq             SysTick frequency to keep, 0 if stopped.
+ * @retval None
+ */
+static void DVFS_SwitchClock(const stc_dvfs_opp_t *pstcOpp, uint32_t u32TickFreq)
+{
+    uint32_t u32Div;
+    uint32_t u32Primask;
+
+    LL_ENTER_CRITICAL(u32Primask);
+    if (pstcOpp->u8SysClkSrc != READ_REG8_BIT(CM_CMU->CKSWR, CMU_CKSWR_CKSW)) {
+        /* Switch the source under the larger divider */
+        u32Div = READ_REG8_BIT(CM_CMU->SCKDIVR, CMU_SCKDIVR_SCKDIV);
+        CLK_SetClockDiv(CLK_BUS_HCLK, LL_MAX(u32Div, pstcOpp->u32HclkDiv));
+        CLK_SetSysClockSrc(pstcOpp->u8SysClkSrc);
+    }
+    CLK_SetClockDiv(CLK_BUS_HCLK, pstcOpp->u32HclkDiv);
+    if (0UL != u32TickFreq) {
+        (void)SysTick_Init(u32TickFreq);
+    }
+    LL_EXIT_CRITICAL(u32Primask);
+}
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup DVFS_Global_Functions DVFS Global Functions
+ * @{
+ */
+
+/**
+ * @brief  Add a notifier at the end of the chain.
+ * @param  [in] pstcNotifier            Pointer to a @ref stc_dvfs_notifier_t structure, pfnCallback set.
+ * @retval int32_t:
+ *           - LL_OK:                   Registered.
+ *           - LL_ERR_INVD_PARAM:       pstcNotifier or its callback is NULL, or it is registered already.
+ *           - LL_ERR_BUSY:             A clock change is in progress.
+ * @note   The notifiers are called in the order of registration.
+ */
+int32_t DVFS_NotifierRegister(stc_dvfs_notifier_t *pstcNotifier)
+{
+    stc_dvfs_notifier_t **ppstcLink;
+    uint32_t u32Primask;
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+
+    if ((NULL != pstcNotifier) && (NULL != pstcNotifier->pfnCallback)) {
+        LL_ENTER_CRITICAL(u32Primask);
+        if (0UL != m_u32DvfsBusy) {
+            i32Ret = LL_ERR_BUSY;
+        } else {
+            ppstcLink = &m_pstcDvfsChain;
+            while ((NULL != *ppstcLink) && (pstcNotifier != *ppstcLink)) {
+                ppstcLink = &(*ppstcLink)->pstcNext;
+            }
+            if (NULL == *ppstcLink) {
+                pstcNotifier->pstcNext = NULL;
+                *ppstcLink = pstcNotifier;
+                i32Ret = LL_OK;
+            }
+        }
+        LL_EXIT_CRITICAL(u32Primask);
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Remove a notifier from the chain.
+ * @param  [in] pstcNotifier            Pointer to a registered @ref stc_dvfs_notifier_t structure.
+ * @retval int32_t:
+ *           - LL_OK:                   Unregistered.
+ *           - LL_ERR_INVD_PARAM:       pstcNotifier is NULL or not registered.
+ *           - LL_ERR_BUSY:             A clock change is in progress.
+ */
+int32_t DVFS_NotifierUnregister(stc_dvfs_notifier_t *pstcNotifier)
+{
+    stc_dvfs_notifier_t **ppstcLink;
+    uint32_t u32Primask;
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+
+    if (NULL != pstcNotifier) {
+        LL_ENTER_CRITICAL(u32Primask);
+        if (0UL != m_u32DvfsBusy) {
+            i32Ret = LL_ERR_BUSY;
+        } else {
+            ppstcLink = &m_pstcDvfsChain;
+            while ((NULL != *ppstcLink) && (pstcNotifier != *ppstcLink)) {
+                ppstcLink = &(*ppstcLink)->pstcNext;
+            }
+            if (NULL != *ppstcLink) {
+                *ppstcLink = pstcNotifier->pstcNext;
+                pstcNotifier->pstcNext = NULL;
+                i32Ret = LL_OK;
+            }
+        }
+        LL_EXIT_CRITICAL(u32Primask);
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Get the HCLK frequency of an operating point.
+ * @param  [in] pstcOpp                 Pointer to a @ref stc_dvfs_opp_t structure.
+ * @retval HCLK frequency, 0 if pstcOpp is NULL.
+ * @note   The HRC frequency is the one SystemCoreClockUpdate() read last.
+ */
+uint32_t DVFS_GetOppFreq(const stc_dvfs_opp_t *pstcOpp)
+{
+    uint32_t u32Freq = 0UL;
+
+    if (NULL != pstcOpp) {
+        DDL_ASSERT(IS_DVFS_SYSCLK_SRC(pstcOpp->u8SysClkSrc));
+        DDL_ASSERT(IS_DVFS_HCLK_DIV(pstcOpp->u32HclkDiv));
+
+        switch (pstcOpp->u8SysClkSrc) {
+            case CLK_SYSCLK_SRC_HRC:
+                u32Freq = HRC_VALUE;
+                break;
+            case CLK_SYSCLK_SRC_XTAL:
+                u32Freq = XTAL_VALUE;
+                break;
+            default:
+                u32Freq = LRC_VALUE;
+                break;
+        }
+        u32Freq >>= pstcOpp->u32HclkDiv;
+    }
+
+    return u32Freq;
+}
+
+/**
+ * @brief  Move to an operating point.
+ * @param  [in] pstcOpp                 Pointer to a @ref stc_dvfs_opp_t structure.
+ * @retval int32_t:
+ *           - LL_OK:                   Changed, all the notifiers followed.
+ *           - LL_ERR_INVD_PARAM:       pstcOpp is NULL.
+ *           - LL_ERR_NOT_RDY:          The oscillator of the new system clock is not stable.
+ *           - LL_ERR_BUSY:             Another change is in progress or a notifier vetoed, nothing changed.
+ *           - LL_ERR_TIMEOUT:          The flash wait cycles could not be raised, nothing changed.
+ *           - LL_ERR:                  Changed, but a notifier failed on DVFS_EVT_POST_CHANGE.
+ * @note   Sequence: DVFS_EVT_PRE_CHANGE, high speed mode and flash wait cycles for a faster clock,
+ *         the clock switch and the SysTick rescale, flash wait cycles and low speed mode for a
+ *         slower clock, DVFS_EVT_POST_CHANGE.
+ * @note   Call from thread level with CLK, EFM and PWC registers unlocked.
+ */
+int32_t DVFS_SetOpp(const stc_dvfs_opp_t *pstcOpp)
+{
+    stc_dvfs_change_t stcChange;
+    stc_dvfs_notifier_t *pstcVeto = NULL;
+    uint32_t u32TickFreq;
+    uint32_t u32Primask;
+    uint8_t u8HighSpeed = 0U;
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+
+    if (NULL != pstcOpp) {
+        DDL_ASSERT(IS_DVFS_SYSCLK_SRC(pstcOpp->u8SysClkSrc));
+        DDL_ASSERT(IS_DVFS_HCLK_DIV(pstcOpp->u32HclkDiv));
+        DDL_ASSERT(IS_DVFS_PWR_MD(pstcOpp->u8PowerMode));
+
+        i32Ret = LL_ERR_BUSY;
+        LL_ENTER_CRITICAL(u32Primask);
+        if (0UL == m_u32DvfsBusy) {
+            m_u32DvfsBusy = 1UL;
+            i32Ret = LL_OK;
+        }
+        LL_EXIT_CRITICAL(u32Primask);
+    }
+
+    if (LL_OK == i32Ret) {
+        if (SET != DVFS_IsClockReady(pstcOpp->u8SysClkSrc)) {
+            i32Ret = LL_ERR_NOT_RDY;
+        } else {
+            stcChange.u32OldHclk = CLK_GetBusClockFreq(CLK_BUS_HCLK);
+            stcChange.u32NewHclk = DVFS_GetOppFreq(pstcOpp);
+            i32Ret = DVFS_Notify(DVFS_EVT_PRE_CHANGE, &stcChange, NULL, &pstcVeto);
+        }
+        if (LL_OK == i32Ret) {
+            /* Before speeding up: high speed mode, then the flash wait cycles */
+            u8HighSpeed = (PWC_PWRC_PWDRV == READ_REG8_BIT(CM_PWC->PWRC, PWC_PWRC_PWDRV)) ? 1U : 0U;
+            if ((DVFS_PWR_MD_HIGH_SPEED == pstcOpp->u8PowerMode) && (0U == u8HighSpeed)) {
+                (void)PWC_LowSpeedToHighSpeed();
+            }
+            if (stcChange.u32NewHclk > DVFS_WAIT_CYCLE0_MAX_FREQ) {
+                i32Ret = EFM_SetWaitCycle(EFM_WAIT_CYCLE1);
+                /* Nothing changed on failure: undo the high speed mode */
+                if ((LL_OK != i32Ret) && (DVFS_PWR_MD_HIGH_SPEED == pstcOpp->u8PowerMode) && (0U == u8HighSpeed)) {
+                    (void)PWC_HighSpeedToLowSpeed();
+                }
+            }
+        }
+        if (LL_OK == i32Ret) {
+            u32TickFreq = DVFS_GetTickFreq(stcChange.u32OldHclk);
+            DVFS_SwitchClock(pstcOpp, u32TickFreq);
+
+            /* After slowing down: the flash wait cycles, then low speed mode */
+            if (stcChange.u32NewHclk <= DVFS_WAIT_CYCLE0_MAX_FREQ) {
+                (void)EFM_SetWaitCycle(EFM_WAIT_CYCLE0);
+            }
+            if ((DVFS_PWR_MD_LOW_SPEED == pstcOpp->u8PowerMode) && (0U != u8HighSpeed)) {
+                (void)PWC_HighSpeedToLowSpeed();
+            }
+            i32Ret = DVFS_Notify(DVFS_EVT_POST_CHANGE, &stcChange, NULL, NULL);
+        } else if (LL_ERR_NOT_RDY != i32Ret) {
+            /* The notifiers before the veto, or all of them, got DVFS_EVT_PRE_CHANGE */
+            (void)DVFS_Notify(DVFS_EVT_ABORT, &stcChange, pstcVeto, NULL);
+        } else {
+            /* No notifier was called */
+        }
+        m_u32DvfsBusy = 0UL;
+    }
+
+    return i32Ret;
+}
+
+#if (LL_USART_ENABLE == DDL_ON)
+/**
+ * @brief  Notifier callback keeping the baudrate of a USART unit.
+ * @param  [in] u32Event                A @ref DVFS_Event value.
+ * @param  [in] pstcChange              Clock change, not used.
+ * @param  [in] pvUserData              Pointer to a @ref stc_dvfs_usart_t structure.
+ * @retval int32_t:
+ *           - LL_OK:                   Done.
+ *           - LL_ERR_BUSY:             DVFS_EVT_PRE_CHANGE while a frame is being sent.
+ *           - Others:                  DVFS_EVT_POST_CHANGE: the USART_SetBaudratePpm() error.
+ * @note   A frame being received when the clock changes is lost.
+ */
+int32_t DVFS_UsartCallback(uint32_t u32Event, const stc_dvfs_change_t *pstcChange, void *pvUserData)
+{
+    const stc_dvfs_usart_t *pstcUsart = (const stc_dvfs_usart_t *)pvUserData;
+    int32_t i32Ret = LL_OK;
+
+    (void)pstcChange;
+    DDL_ASSERT(NULL != pstcUsart);
+
+    if (DVFS_EVT_PRE_CHANGE == u32Event) {
+        if ((0UL != READ_REG32_BIT(pstcUsart->USARTx->CR1, USART_CR1_TE)) &&
+            (RESET == USART_GetStatus(pstcUsart->USARTx, USART_FLAG_TX_CPLT))) {
+            i32Ret = LL_ERR_BUSY;
+        }
+    } else if (DVFS_EVT_POST_CHANGE == u32Event) {
+        i32Ret = USART_SetBaudratePpm(pstcUsart->USARTx, pstcUsart->u32Baudrate, NULL);
+    } else {
+        /* Nothing to undo */
+    }
+
+    return i32Ret;
+}
+#endif
+
+#if (LL_I2C_ENABLE == DDL_ON)
+/**
+ * @brief  Notifier callback keeping the baudrate of an I2C unit.
+ * @param  [in] u32Event                A @ref DVFS_Event value.
+ * @param  [in] pstcChange              Clock change, not used.
+ * @param  [in] pvUserData              Pointer to a @ref stc_dvfs_i2c_t structure.
+ * @retval int32_t:
+ *           - LL_OK:                   Done.
+ *           - LL_ERR_BUSY:             DVFS_EVT_PRE_CHANGE while the bus is busy.
+ *           - Others:                  DVFS_EVT_POST_CHANGE: the I2C_BaudrateConfigPpm() error.
+ */
+int32_t DVFS_I2cCallback(uint32_t u32Event, const stc_dvfs_change_t *pstcChange, void *pvUserData)
+{
+    const stc_dvfs_i2c_t *pstcI2c = (const stc_dvfs_i2c_t *)pvUserData;
+    int32_t i32Ret = LL_OK;
+
+    (void)pstcChange;
+    DDL_ASSERT(NULL != pstcI2c);
+
+    if (DVFS_EVT_PRE_CHANGE == u32Event) {
+        if (SET == I2C_GetStatus(pstcI2c->I2Cx, I2C_FLAG_BUSY)) {
+            i32Ret = LL_ERR_BUSY;
+        }
+    } else if (DVFS_EVT_POST_CHANGE == u32Event) {
+        i32Ret = I2C_BaudrateConfigPpm(pstcI2c->I2Cx, &pstcI2c->stcI2cInit, NULL);
+    } else {
+        /* Nothing to undo */
+    }
+
+    return i32Ret;
+}
+#endif
+
+/**
+ * @}
+ */
+
+#endif /* LL_DVFS_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/******************************************************************************
+ * EOF (not truncated)
+ *****************************************************************************/
@@ -10,6 +10,9 @@
    2022-10-31       CDT             Add API EFM_Protect_Enable & EFM_WriteSecurityCode.
    2022-10-31       CDT             Modify API EFM_Read & EFM_Program.
    2023-01-15       CDT             Code refine.
+   2026-10-16       CDT             Access the flash array through RW_MEM8/RW_MEM32.
+                                    Fix end address check of EFM_SequenceProgram.
+                                    Program and erase functions can run from RAM, see __EFM_FUNC.
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2022-2023, Xiaohua Semiconductor Co., Ltd. All rights reserved.
@@ -58,6 +61,12 @@
 #define EFM_ERASE_TIMEOUT               (HCLK_VALUE / 50UL)      /* EFM Erase timeout max 20ms */
 #define EFM_SEQ_PGM_TIMEOUT             (HCLK_VALUE / 62500UL)   /* EFM Sequence Program timeout max 16us */
 
+/* The program/erase functions may run from RAM (__EFM_FUNC) and must not call
+   code in flash while it is busy: the flags are accessed directly, and the
+   timeouts (a library division) are computed before the operation starts. */
+#define EFM_GET_FLAG(flag)              (((flag) == READ_REG32_BIT(CM_EFM->FSR, (flag))) ? SET : RESET)
+#define EFM_CLR_FLAG(flag)              SET_REG32_BIT(CM_EFM->FSCLR, (flag))
+
 /**
  * @defgroup EFM_Configuration_Bit_Mask EFM Configuration Bit Mask
  * @{
@@ -171,12 +180,12 @@
  *         - LL_OK: Flag was set.
  *         - LL_ERR_TIMEOUT: Flag was not set.
  */
-static int32_t EFM_WaitFlag(uint32_t u32Flag, uint32_t u32Time)
+static __EFM_FUNC int32_t EFM_WaitFlag(uint32_t u32Flag, uint32_t u32Time)
 {
     __IO uint32_t u32Timeout = 0UL;
     int32_t i32Ret = LL_OK;
 
-    while (SET != EFM_GetStatus(u32Flag)) {
+    while (SET != EFM_GET_FLAG(u32Flag)) {
         u32Timeout++;
         if (u32Timeout > u32Time) {
             i32Ret = LL_ERR_TIMEOUT;
@@ -190,18 +199,18 @@ static int32_t EFM_WaitFlag(uint32_t u32Flag, uint32_t u32Time)
 /**
  * @brief  Clear EFM flag.
  * @param  [in] u32Flag     Specifies the flag to be wait. @ref EFM_Flag_Sel
+ * @param  [in] u32Time     Specifies the time to wait while the flag not be cleared.
  * @retval int32_t:
  *         - LL_OK: Flag was set.
  *         - LL_ERR_TIMEOUT: Flag was not set.
  */
-static int32_t EFM_ClearFlag(uint32_t u32Flag)
+static __EFM_FUNC int32_t EFM_ClearFlag(uint32_t u32Flag, uint32_t u32Time)
 {
-    uint32_t u32Time = EFM_TIMEOUT;
     __IO uint32_t u32Timeout = 0UL;
     int32_t i32Ret = LL_OK;
 
-    while (RESET != EFM_GetStatus(u32Flag)) {
-        EFM_ClearStatus(u32Flag);
+    while (RESET != EFM_GET_FLAG(u32Flag)) {
+        EFM_CLR_FLAG(u32Flag);
         u32Timeout++;
         if (u32Timeout > u32Time) {
             i32Ret = LL_ERR_TIMEOUT;
@@ -401,7 +410,7 @@ void EFM_SetBusStatus(uint32_t u32Status)
 int32_t EFM_ReadByte(uint32_t u32Addr, uint8_t *pu8ReadBuf, uint32_t u32ByteLen)
 {
     int32_t i32Ret = LL_ERR_INVD_PARAM;
-    __IO uint8_t *pu8Buf = (uint8_t *)u32Addr;
+    uint32_t u32ReadAddr = u32Addr;
     uint32_t u32Len = u32ByteLen;
     uint32_t u32ReadyFlag = EFM_FLAG_RDY;
 
@@ -412,7 +421,8 @@ int32_t EFM_ReadByte(uint32_t u32Addr, uint8_t *pu8ReadBuf, uint32_t u32ByteLen)
 
         if (LL_OK == EFM_WaitFlag(u32ReadyFlag, EFM_TIMEOUT)) {
             while (0UL != u32Len) {
-                *(pu8ReadBuf++) = *(pu8Buf++);
+                *(pu8ReadBuf++) = RW_MEM8(u32ReadAddr);
+                u32ReadAddr++;
                 u32Len--;
             }
             i32Ret = LL_OK;
@@ -434,16 +444,16 @@ int32_t EFM_ReadByte(uint32_t u32Addr, uint8_t *pu8ReadBuf, uint32_t u32ByteLen)
  *         - LL_ERR_NOT_RDY: EFM if not ready.
  * @note  Call EFM_REG_Unlock() unlock EFM register first.
  */
-int32_t EFM_Program(uint32_t u32Addr, uint8_t *pu8Buf, uint32_t u32Len)
+__EFM_FUNC int32_t EFM_Program(uint32_t u32Addr, uint8_t *pu8Buf, uint32_t u32Len)
 {
     int32_t i32Ret = LL_OK;
+    const uint32_t u32PgmTimeout = EFM_PGM_TIMEOUT;
     uint32_t u32Tmp;
     uint8_t u8Shift;
     uint32_t u32LoopWords = u32Len >> 2UL;
     uint32_t u32RemainBytes = u32Len % 4UL;
     uint32_t *u32pSource = (uint32_t *)(uint32_t)pu8Buf;
-    uint32_t *u32pDest = (uint32_t *)u32Addr;
-    uint8_t *u8pDest;
+    uint32_t u32DestAddr = u32Addr;
     uint8_t *u8pSrc;
 
     DDL_ASSERT(IS_EFM_REG_UNLOCK());
@@ -454,7 +464,7 @@ int32_t EFM_Program(uint32_t u32Addr, uint8_t *pu8Buf, uint32_t u32Len)
     u8Shift = 0U;
 
     /* CLear the error flag. */
-    EFM_ClearStatus(EFM_FLAG_ALL);
+    EFM_CLR_FLAG(EFM_FLAG_ALL);
     /* Get CACHE status */
     u32Tmp = READ_REG32_BIT(CM_EFM->FRMC, EFM_CACHE_ALL);
     /* Disable CACHE */
@@ -465,26 +475,27 @@ int32_t EFM_Program(uint32_t u32Addr, uint8_t *pu8Buf, uint32_t u32Len)
 
     while (u32LoopWords-- > 0UL) {
         /* program data. */
-        *u32pDest++ = *u32pSource++;
+        RW_MEM32(u32DestAddr) = *u32pSource++;
+        u32DestAddr += 4UL;
         /* Wait for ready flag. */
-        if (LL_ERR_TIMEOUT == EFM_WaitFlag(EFM_FLAG_RDY << u8Shift, EFM_PGM_TIMEOUT)) {
+        if (LL_ERR_TIMEOUT == EFM_WaitFlag(EFM_FLAG_RDY << u8Shift, u32PgmTimeout)) {
             i32Ret = LL_ERR_NOT_RDY;
         }
         /* CLear the operation end flag. */
-        EFM_ClearStatus(EFM_FLAG_OPTEND << u8Shift);
+        EFM_CLR_FLAG(EFM_FLAG_OPTEND << u8Shift);
     }
 
     if (0U != u32RemainBytes) {
-        u8pDest = (uint8_t *)((uint32_t)u32pDest);
         u8pSrc = (uint8_t *)((uint32_t)u32pSource);
         while (u32RemainBytes-- > 0UL) {
-            *u8pDest++ = *u8pSrc++;
+            RW_MEM8(u32DestAddr) = *u8pSrc++;
+            u32DestAddr++;
             /* wait for ready flag. */
-            if (LL_ERR_TIMEOUT == EFM_WaitFlag(EFM_FLAG_RDY, EFM_PGM_TIMEOUT)) {
+            if (LL_ERR_TIMEOUT == EFM_WaitFlag(EFM_FLAG_RDY, u32PgmTimeout)) {
                 i32Ret = LL_ERR_NOT_RDY;
             }
             /* Clear operation end flag */
-            EFM_ClearStatus(EFM_FLAG_OPTEND);
+            EFM_CLR_FLAG(EFM_FLAG_OPTEND);
         }
     }
 
@@ -503,9 +514,10 @@ int32_t EFM_Program(uint32_t u32Addr, uint8_t *pu8Buf, uint32_t u32Len)
  *         - LL_ERR_NOT_RDY: EFM is not ready.
  * @note  Call EFM_REG_Unlock() unlock EFM register first.
  */
-int32_t EFM_ProgramWord(uint32_t u32Addr, uint32_t u32Data)
+__EFM_FUNC int32_t EFM_ProgramWord(uint32_t u32Addr, uint32_t u32Data)
 {
     int32_t i32Ret = LL_OK;
+    const uint32_t u32PgmTimeout = EFM_PGM_TIMEOUT;
     uint32_t u32Tmp;
     uint8_t u8Shift;
 
@@ -515,7 +527,7 @@ int32_t EFM_ProgramWord(uint32_t u32Addr, uint32_t u32Data)
     DDL_ASSERT(IS_ADDR_ALIGN_WORD(u32Addr));
 
     /* Clear the error flag. */
-    EFM_ClearStatus(EFM_FLAG_ALL);
+    EFM_CLR_FLAG(EFM_FLAG_ALL);
     /* Get CACHE status */
     u32Tmp = READ_REG32_BIT(CM_EFM->FRMC, EFM_CACHE_ALL);
     /* Disable CACHE function */
@@ -527,11 +539,11 @@ int32_t EFM_ProgramWord(uint32_t u32Addr, uint32_t u32Data)
     RW_MEM32(u32Addr) = u32Data;
 
     /* Wait for ready flag. */
-    if (LL_ERR_TIMEOUT == EFM_WaitFlag(EFM_FLAG_RDY << u8Shift, EFM_PGM_TIMEOUT)) {
+    if (LL_ERR_TIMEOUT == EFM_WaitFlag(EFM_FLAG_RDY << u8Shift, u32PgmTimeout)) {
         i32Ret = LL_ERR_NOT_RDY;
     }
     /* CLear the operation end flag. */
-    EFM_ClearStatus(EFM_FLAG_OPTEND << u8Shift);
+    EFM_CLR_FLAG(EFM_FLAG_OPTEND << u8Shift);
 
     /* Set read only mode. */
     MODIFY_REG32(CM_EFM->FWMC, EFM_FWMC_PEMOD, EFM_MD_READONLY);
@@ -551,9 +563,10 @@ int32_t EFM_ProgramWord(uint32_t u32Addr, uint32_t u32Data)
  *         - LL_ERR_NOT_RDY: EFM is not ready.
  * @note  Call EFM_REG_Unlock() unlock EFM register first.
  */
-int32_t EFM_ProgramHalfWord(uint32_t u32Addr, uint16_t u16Data)
+__EFM_FUNC int32_t EFM_ProgramHalfWord(uint32_t u32Addr, uint16_t u16Data)
 {
     int32_t i32Ret = LL_OK;
+    const uint32_t u32PgmTimeout = EFM_PGM_TIMEOUT;
     uint32_t u32Tmp;
 
     DDL_ASSERT(IS_EFM_REG_UNLOCK());
@@ -562,7 +575,7 @@ int32_t EFM_ProgramHalfWord(uint32_t u32Addr, uint16_t u16Data)
     DDL_ASSERT(IS_ADDR_ALIGN_HALFWORD(u32Addr));
 
     /* Clear the error flag. */
-    EFM_ClearStatus(EFM_FLAG_ALL);
+    EFM_CLR_FLAG(EFM_FLAG_ALL);
     /* Get CACHE status */
     u32Tmp = READ_REG32_BIT(CM_EFM->FRMC, EFM_CACHE_ALL);
     /* Disable CACHE function */
@@ -573,11 +586,11 @@ int32_t EFM_ProgramHalfWord(uint32_t u32Addr, uint16_t u16Data)
     /* Program data. */
     RW_MEM16(u32Addr) = u16Data;
     /* Wait for ready flag. */
-    if (LL_ERR_TIMEOUT == EFM_WaitFlag(EFM_FLAG_RDY, EFM_PGM_TIMEOUT)) {
+    if (LL_ERR_TIMEOUT == EFM_WaitFlag(EFM_FLAG_RDY, u32PgmTimeout)) {
         i32Ret = LL_ERR_NOT_RDY;
     }
     /* CLear the operation end flag. */
-    EFM_ClearStatus(EFM_FLAG_OPTEND);
+    EFM_CLR_FLAG(EFM_FLAG_OPTEND);
 
     /* Set read only mode. */
     MODIFY_REG32(CM_EFM->FWMC, EFM_FWMC_PEMOD, EFM_MD_READONLY);
@@ -597,9 +610,10 @@ int32_t EFM_ProgramHalfWord(uint32_t u32Addr, uint16_t u16Data)
  *         - LL_ERR_NOT_RDY: EFM is not ready.
  * @note  Call EFM_REG_Unlock() unlock EFM register first.
  */
-int32_t EFM_ProgramByte(uint32_t u32Addr, uint8_t u8Data)
+__EFM_FUNC int32_t EFM_ProgramByte(uint32_t u32Addr, uint8_t u8Data)
 {
     int32_t i32Ret = LL_OK;
+    const uint32_t u32PgmTimeout = EFM_PGM_TIMEOUT;
     uint32_t u32Tmp;
 
     DDL_ASSERT(IS_EFM_REG_UNLOCK());
@@ -607,7 +621,7 @@ int32_t EFM_ProgramByte(uint32_t u32Addr, uint8_t u8Data)
     DDL_ASSERT(IS_EFM_ADDR(u32Addr));
 
     /* Clear the error flag. */
-    EFM_ClearStatus(EFM_FLAG_ALL);
+    EFM_CLR_FLAG(EFM_FLAG_ALL);
     /* Get CACHE status */
     u32Tmp = READ_REG32_BIT(CM_EFM->FRMC, EFM_CACHE_ALL);
     /* Disable CACHE function */
@@ -618,11 +632,11 @@ int32_t EFM_ProgramByte(uint32_t u32Addr, uint8_t u8Data)
     /* Program data. */
     RW_MEM8(u32Addr) = u8Data;
     /* Wait for ready flag. */
-    if (LL_ERR_TIMEOUT == EFM_WaitFlag(EFM_FLAG_RDY, EFM_PGM_TIMEOUT)) {
+    if (LL_ERR_TIMEOUT == EFM_WaitFlag(EFM_FLAG_RDY, u32PgmTimeout)) {
         i32Ret = LL_ERR_NOT_RDY;
     }
     /* CLear the operation end flag. */
-    EFM_ClearStatus(EFM_FLAG_OPTEND);
+    EFM_CLR_FLAG(EFM_FLAG_OPTEND);
 
     /* Set read only mode. */
     MODIFY_REG32(CM_EFM->FWMC, EFM_FWMC_PEMOD, EFM_MD_READONLY);
@@ -643,9 +657,10 @@ int32_t EFM_ProgramByte(uint32_t u32Addr, uint8_t u8Data)
  *         - LL_ERR_NOT_RDY: EFM is not ready.
  * @note  Call EFM_REG_Unlock() unlock EFM register first.
  */
-int32_t EFM_ProgramWordReadBack(uint32_t u32Addr, uint32_t u32Data)
+__EFM_FUNC int32_t EFM_ProgramWordReadBack(uint32_t u32Addr, uint32_t u32Data)
 {
     int32_t i32Ret = LL_OK;
+    const uint32_t u32PgmTimeout = EFM_PGM_TIMEOUT;
     uint32_t u32Tmp;
     uint8_t u8Shift;
 
@@ -655,7 +670,7 @@ int32_t EFM_ProgramWordReadBack(uint32_t u32Addr, uint32_t u32Data)
     DDL_ASSERT(IS_ADDR_ALIGN_WORD(u32Addr));
 
     /* Clear the error flag. */
-    EFM_ClearStatus(EFM_FLAG_ALL);
+    EFM_CLR_FLAG(EFM_FLAG_ALL);
     /* Get CACHE status */
     u32Tmp = READ_REG32_BIT(CM_EFM->FRMC, EFM_CACHE_ALL);
     /* Disable CACHE */
@@ -667,18 +682,18 @@ int32_t EFM_ProgramWordReadBack(uint32_t u32Addr, uint32_t u32Data)
     RW_MEM32(u32Addr) = (uint32_t)u32Data;
 
     /* Wait for ready flag. */
-    if (LL_ERR_TIMEOUT == EFM_WaitFlag(EFM_FLAG_RDY << u8Shift, EFM_PGM_TIMEOUT)) {
+    if (LL_ERR_TIMEOUT == EFM_WaitFlag(EFM_FLAG_RDY << u8Shift, u32PgmTimeout)) {
         i32Ret = LL_ERR_NOT_RDY;
     }
 
     /* Get the flag PGMISMTCH */
-    if (SET == EFM_GetStatus(EFM_FLAG_PGMISMTCH << u8Shift)) {
+    if (SET == EFM_GET_FLAG(EFM_FLAG_PGMISMTCH << u8Shift)) {
         /* Clear flag PGMISMTCH */
-        EFM_ClearStatus(EFM_FLAG_PGMISMTCH << u8Shift);
+        EFM_CLR_FLAG(EFM_FLAG_PGMISMTCH << u8Shift);
         i32Ret = LL_ERR;
     }
     /* CLear the operation end flag. */
-    EFM_ClearStatus(EFM_FLAG_OPTEND << u8Shift);
+    EFM_CLR_FLAG(EFM_FLAG_OPTEND << u8Shift);
     /* Set read only mode. */
     MODIFY_REG32(CM_EFM->FWMC, EFM_FWMC_PEMOD, EFM_MD_READONLY);
 
@@ -698,9 +713,10 @@ int32_t EFM_ProgramWordReadBack(uint32_t u32Addr, uint32_t u32Data)
  *         - LL_ERR_NOT_RDY: EFM is not ready.
  * @note  Call EFM_REG_Unlock() unlock EFM register first.
  */
-int32_t EFM_ProgramHalfWordReadBack(uint32_t u32Addr, uint16_t u16Data)
+__EFM_FUNC int32_t EFM_ProgramHalfWordReadBack(uint32_t u32Addr, uint16_t u16Data)
 {
     int32_t i32Ret = LL_OK;
+    const uint32_t u32PgmTimeout = EFM_PGM_TIMEOUT;
     uint32_t u32Tmp;
 
     DDL_ASSERT(IS_EFM_REG_UNLOCK());
@@ -709,7 +725,7 @@ int32_t EFM_ProgramHalfWordReadBack(uint32_t u32Addr, uint16_t u16Data)
     DDL_ASSERT(IS_ADDR_ALIGN_HALFWORD(u32Addr));
 
     /* Clear the error flag. */
-    EFM_ClearStatus(EFM_FLAG_ALL);
+    EFM_CLR_FLAG(EFM_FLAG_ALL);
     /* Get CACHE status */
     u32Tmp = READ_REG32_BIT(CM_EFM->FRMC, EFM_CACHE_ALL);
     /* Disable CACHE */
@@ -720,18 +736,18 @@ int32_t EFM_ProgramHalfWordReadBack(uint32_t u32Addr, uint16_t u16Data)
     /* Program data. */
     RW_MEM16(u32Addr) = u16Data;
     /* Wait for ready flag. */
-    if (LL_ERR_TIMEOUT == EFM_WaitFlag(EFM_FLAG_RDY, EFM_PGM_TIMEOUT)) {
+    if (LL_ERR_TIMEOUT == EFM_WaitFlag(EFM_FLAG_RDY, u32PgmTimeout)) {
         i32Ret = LL_ERR_NOT_RDY;
     }
 
     /* Get the flag MISMTCH0*/
-    if (SET == EFM_GetStatus(EFM_FLAG_PGMISMTCH)) {
+    if (SET == EFM_GET_FLAG(EFM_FLAG_PGMISMTCH)) {
         /* Clear flag PGMISMTCH */
-        EFM_ClearStatus(EFM_FLAG_PGMISMTCH);
+        EFM_CLR_FLAG(EFM_FLAG_PGMISMTCH);
         i32Ret = LL_ERR;
     }
     /* CLear the operation end flag. */
-    EFM_ClearStatus(EFM_FLAG_OPTEND);
+    EFM_CLR_FLAG(EFM_FLAG_OPTEND);
 
     /* Set read only mode. */
     MODIFY_REG32(CM_EFM->FWMC, EFM_FWMC_PEMOD, EFM_MD_READONLY);
@@ -752,9 +768,10 @@ int32_t EFM_ProgramHalfWordReadBack(uint32_t u32Addr, uint16_t u16Data)
  *         - LL_ERR_NOT_RDY: EFM is not ready.
  * @note  Call EFM_REG_Unlock() unlock EFM register first.
  */
-int32_t EFM_ProgramByteReadBack(uint32_t u32Addr, uint8_t u8Data)
+__EFM_FUNC int32_t EFM_ProgramByteReadBack(uint32_t u32Addr, uint8_t u8Data)
 {
     int32_t i32Ret = LL_OK;
+    const uint32_t u32PgmTimeout = EFM_PGM_TIMEOUT;
     uint32_t u32Tmp;
 
     DDL_ASSERT(IS_EFM_REG_UNLOCK());
@@ -762,7 +779,7 @@ int32_t EFM_ProgramByteReadBack(uint32_t u32Addr, uint8_t u8Data)
     DDL_ASSERT(IS_EFM_ADDR(u32Addr));
 
     /* Clear the error flag. */
-    EFM_ClearStatus(EFM_FLAG_ALL);
+    EFM_CLR_FLAG(EFM_FLAG_ALL);
     /* Get CACHE status */
     u32Tmp = READ_REG32_BIT(CM_EFM->FRMC, EFM_CACHE_ALL);
     /* Disable CACHE */
@@ -773,18 +790,18 @@ int32_t EFM_ProgramByteReadBack(uint32_t u32Addr, uint8_t u8Data)
     /* Program data. */
     RW_MEM8(u32Addr) = u8Data;
     /* Wait for ready flag. */
-    if (LL_ERR_TIMEOUT == EFM_WaitFlag(EFM_FLAG_RDY, EFM_PGM_TIMEOUT)) {
+    if (LL_ERR_TIMEOUT == EFM_WaitFlag(EFM_FLAG_RDY, u32PgmTimeout)) {
         i32Ret = LL_ERR_NOT_RDY;
     }
 
     /* Get the flag MISMTCH0*/
-    if (SET == EFM_GetStatus(EFM_FLAG_PGMISMTCH)) {
+    if (SET == EFM_GET_FLAG(EFM_FLAG_PGMISMTCH)) {
         /* Clear flag PGMISMTCH */
-        EFM_ClearStatus(EFM_FLAG_PGMISMTCH);
+        EFM_CLR_FLAG(EFM_FLAG_PGMISMTCH);
         i32Ret = LL_ERR;
     }
     /* CLear the operation end flag. */
-    EFM_ClearStatus(EFM_FLAG_OPTEND);
+    EFM_CLR_FLAG(EFM_FLAG_OPTEND);
     /* Set read only mode. */
     MODIFY_REG32(CM_EFM->FWMC, EFM_FWMC_PEMOD, EFM_MD_READONLY);
 
@@ -804,25 +821,25 @@ int32_t EFM_ProgramByteReadBack(uint32_t u32Addr, uint8_t u8Data)
  *         - LL_ERR_TIMEOUT: program error timeout
  * @note  Call EFM_REG_Unlock() unlock EFM register first.
  */
-int32_t EFM_SequenceProgram(uint32_t u32Addr, uint8_t *pu8Buf, uint32_t u32Len)
+__EFM_FUNC int32_t EFM_SequenceProgram(uint32_t u32Addr, uint8_t *pu8Buf, uint32_t u32Len)
 {
     int32_t i32Ret = LL_OK;
+    const uint32_t u32PgmTimeout = EFM_PGM_TIMEOUT;
     uint32_t u32Tmp;
     uint32_t u32LoopWords = u32Len >> 2UL;
     uint32_t u32RemainBytes = u32Len % 4UL;
     uint32_t *u32pSource = (uint32_t *)(uint32_t)pu8Buf;
-    uint32_t *u32pDest = (uint32_t *)u32Addr;
+    uint32_t u32DestAddr = u32Addr;
     uint8_t u8Shift = 0U;
-    uint8_t *u8pDest;
     uint8_t *u8pSrc;
 
     DDL_ASSERT(IS_EFM_REG_UNLOCK());
     DDL_ASSERT(IS_EFM_FWMC_UNLOCK());
     DDL_ASSERT(IS_EFM_ADDR(u32Addr));
-    DDL_ASSERT(IS_EFM_ADDR(u32Addr + u32Len));
+    DDL_ASSERT(IS_EFM_ADDR(u32Addr + u32Len - 1UL));
 
     /* CLear the error flag. */
-    EFM_ClearStatus(EFM_FLAG_ALL);
+    EFM_CLR_FLAG(EFM_FLAG_ALL);
     /* Get CACHE status */
     u32Tmp = READ_REG32_BIT(CM_EFM->FRMC, EFM_CACHE_ALL);
     /* Disable CACHE */
@@ -833,35 +850,36 @@ int32_t EFM_SequenceProgram(uint32_t u32Addr, uint8_t *pu8Buf, uint32_t u32Len)
 
     while (u32LoopWords-- > 0UL) {
         /* program data. */
-        *u32pDest++ = *u32pSource++;
+        RW_MEM32(u32DestAddr) = *u32pSource++;
+        u32DestAddr += 4UL;
         /* wait for operation end flag. */
-        if (LL_ERR_TIMEOUT == EFM_WaitFlag(EFM_FLAG_OPTEND << u8Shift, EFM_PGM_TIMEOUT)) {
+        if (LL_ERR_TIMEOUT == EFM_WaitFlag(EFM_FLAG_OPTEND << u8Shift, u32PgmTimeout)) {
             i32Ret = LL_ERR_TIMEOUT;
         }
         /* Clear operation end flag */
-        if (LL_ERR_TIMEOUT == EFM_ClearFlag(EFM_FLAG_OPTEND << u8Shift)) {
+        if (LL_ERR_TIMEOUT == EFM_ClearFlag(EFM_FLAG_OPTEND << u8Shift, u32PgmTimeout)) {
             i32Ret = LL_ERR_TIMEOUT;
         }
     }
 
     if (0U != u32RemainBytes) {
-        u8pDest = (uint8_t *)((uint32_t)u32pDest);
         u8pSrc = (uint8_t *)((uint32_t)u32pSource);
         while (u32RemainBytes-- > 0UL) {
-            *u8pDest++ = *u8pSrc++;
+            RW_MEM8(u32DestAddr) = *u8pSrc++;
+            u32DestAddr++;
             /* wait for operation end flag. */
-            if (LL_ERR_TIMEOUT == EFM_WaitFlag(EFM_FLAG_OPTEND, EFM_PGM_TIMEOUT)) {
+            if (LL_ERR_TIMEOUT == EFM_WaitFlag(EFM_FLAG_OPTEND, u32PgmTimeout)) {
                 i32Ret = LL_ERR_TIMEOUT;
             }
             /* Clear operation end flag */
-            EFM_ClearStatus(EFM_FLAG_OPTEND);
+            EFM_CLR_FLAG(EFM_FLAG_OPTEND);
         }
     }
 
     /* Set read only mode. */
     MODIFY_REG32(CM_EFM->FWMC, EFM_FWMC_PEMOD, EFM_MD_READONLY);
     /* Wait for ready flag. */
-    if (LL_ERR_TIMEOUT == EFM_WaitFlag(EFM_FLAG_RDY << u8Shift, EFM_PGM_TIMEOUT)) {
+    if (LL_ERR_TIMEOUT == EFM_WaitFlag(EFM_FLAG_RDY << u8Shift, u32PgmTimeout)) {
         i32Ret = LL_ERR_NOT_RDY;
     }
 
@@ -878,9 +896,10 @@ int32_t EFM_SequenceProgram(uint32_t u32Addr, uint8_t *pu8Buf, uint32_t u32Len)
  *         - LL_ERR_NOT_RDY: EFM is not ready.
  * @note   Call EFM_REG_Unlock() unlock EFM register first.
  */
-int32_t EFM_SectorErase(uint32_t u32Addr)
+__EFM_FUNC int32_t EFM_SectorErase(uint32_t u32Addr)
 {
     int32_t i32Ret = LL_OK;
+    const uint32_t u32EraseTimeout = EFM_ERASE_TIMEOUT;
     uint32_t u32Tmp;
     uint8_t u8Shift;
 
@@ -890,7 +909,7 @@ int32_t EFM_SectorErase(uint32_t u32Addr)
     DDL_ASSERT(IS_EFM_FWMC_UNLOCK());
 
     /* CLear the error flag. */
-    EFM_ClearStatus(EFM_FLAG_ALL);
+    EFM_CLR_FLAG(EFM_FLAG_ALL);
     /* Get CACHE status */
     u32Tmp = READ_REG32_BIT(CM_EFM->FRMC, EFM_CACHE_ALL);
     /* Disable CACHE */
@@ -903,11 +922,11 @@ int32_t EFM_SectorErase(uint32_t u32Addr)
     RW_MEM32(u32Addr) = 0UL;
 
     /* Wait for ready flag. */
-    if (LL_ERR_TIMEOUT == EFM_WaitFlag(EFM_FLAG_RDY << u8Shift, EFM_ERASE_TIMEOUT)) {
+    if (LL_ERR_TIMEOUT == EFM_WaitFlag(EFM_FLAG_RDY << u8Shift, u32EraseTimeout)) {
         i32Ret = LL_ERR_NOT_RDY;
     }
     /* Clear the operation end flag */
-    EFM_ClearStatus(EFM_FLAG_OPTEND << u8Shift);
+    EFM_CLR_FLAG(EFM_FLAG_OPTEND << u8Shift);
 
     /* Set read only mode. */
     MODIFY_REG32(CM_EFM->FWMC, EFM_FWMC_PEMOD, EFM_MD_READONLY);
@@ -926,9 +945,10 @@ int32_t EFM_SectorErase(uint32_t u32Addr)
  *         - LL_ERR_NOT_RDY: EFM is not ready.
  * @note   Call EFM_REG_Unlock() unlock EFM register first.
  */
-int32_t EFM_ChipErase(uint8_t u8Chip)
+__EFM_FUNC int32_t EFM_ChipErase(uint8_t u8Chip)
 {
     int32_t i32Ret = LL_OK;
+    const uint32_t u32EraseTimeout = EFM_ERASE_TIMEOUT;
     uint32_t u32Tmp;
     uint32_t u32Addr = 0UL;
     uint8_t u8Shift;
@@ -940,7 +960,7 @@ int32_t EFM_ChipErase(uint8_t u8Chip)
     u8Shift = 0U;
 
     /* CLear the error flag. */
-    EFM_ClearStatus(EFM_FLAG_ALL);
+    EFM_CLR_FLAG(EFM_FLAG_ALL);
     /* Get CACHE status */
     u32Tmp = READ_REG32_BIT(CM_EFM->FRMC, EFM_CACHE_ALL);
     /* Disable CACHE */
@@ -954,11 +974,11 @@ int32_t EFM_ChipErase(uint8_t u8Chip)
     /* Erase */
     RW_MEM32(u32Addr) = 0UL;
     /* Wait for ready flag. */
-    if (LL_ERR_TIMEOUT == EFM_WaitFlag(EFM_FLAG_RDY << u8Shift, EFM_ERASE_TIMEOUT)) {
+    if (LL_ERR_TIMEOUT == EFM_WaitFlag(EFM_FLAG_RDY << u8Shift, u32EraseTimeout)) {
         i32Ret = LL_ERR_NOT_RDY;
     }
     /* CLear the operation end flag. */
-    EFM_ClearStatus(EFM_FLAG_OPTEND << u8Shift);
+    EFM_CLR_FLAG(EFM_FLAG_OPTEND << u8Shift);
     /* Set read only mode. */
     MODIFY_REG32(CM_EFM->FWMC, EFM_FWMC_PEMOD, EFM_MD_READONLY);
 
@@ -1033,20 +1053,21 @@ void EFM_Protect_Enable(uint8_t u8Level)
  * @param  [in] u32Len       Specified the length of the security code.
  * @retval int32_t
  */
-int32_t EFM_WriteSecurityCode(uint8_t *pu8Buf, uint32_t u32Len)
+__EFM_FUNC int32_t EFM_WriteSecurityCode(uint8_t *pu8Buf, uint32_t u32Len)
 {
     int32_t i32Ret = LL_OK;
+    const uint32_t u32PgmTimeout = EFM_PGM_TIMEOUT;
     uint32_t u32Tmp;
     uint32_t u32LoopWords = u32Len >> 2UL;
     uint32_t *u32pSource = (uint32_t *)(uint32_t)pu8Buf;
-    uint32_t *u32pDest = (uint32_t *)EFM_SECURITY_ADDR;
+    uint32_t u32DestAddr = EFM_SECURITY_ADDR;
 
     DDL_ASSERT(IS_EFM_REG_UNLOCK());
     DDL_ASSERT(IS_EFM_FWMC_UNLOCK());
     DDL_ASSERT(IS_EFM_SECRURITY_CODE_LEN(u32Len));
 
     /* CLear the error flag. */
-    EFM_ClearStatus(EFM_FLAG_ALL);
+    EFM_CLR_FLAG(EFM_FLAG_ALL);
     /* Get CACHE status */
     u32Tmp = READ_REG32_BIT(CM_EFM->FRMC, EFM_CACHE_ALL);
     /* Disable CACHE */
@@ -1056,24 +1077,25 @@ int32_t EFM_WriteSecurityCode(uint8_t *pu8Buf, uint32_t u32Len)
     MODIFY_REG32(CM_EFM->FWMC, EFM_FWMC_PEMOD, EFM_MD_ERASE_SECTOR);
     /* Erase */
     RW_MEM32(EFM_SECURITY_ADDR) = 0UL;
-    if (LL_ERR_TIMEOUT == EFM_WaitFlag(EFM_FLAG_RDY, EFM_PGM_TIMEOUT)) {
+    if (LL_ERR_TIMEOUT == EFM_WaitFlag(EFM_FLAG_RDY, u32PgmTimeout)) {
         i32Ret = LL_ERR_NOT_RDY;
     }
     /* CLear the operation end flag. */
-    EFM_ClearStatus(EFM_FLAG_OPTEND);
+    EFM_CLR_FLAG(EFM_FLAG_OPTEND);
 
     /* Set single program mode. */
     MODIFY_REG32(CM_EFM->FWMC, EFM_FWMC_PEMOD, EFM_MD_PGM_SINGLE);
 
     while (u32LoopWords-- > 0UL) {
         /* program data. */
-        *u32pDest++ = *u32pSource++;
+        RW_MEM32(u32DestAddr) = *u32pSource++;
+        u32DestAddr += 4UL;
         /* Wait for ready flag. */
-        if (LL_ERR_TIMEOUT == EFM_WaitFlag(EFM_FLAG_RDY, EFM_PGM_TIMEOUT)) {
+        if (LL_ERR_TIMEOUT == EFM_WaitFlag(EFM_FLAG_RDY, u32PgmTimeout)) {
             i32Ret = LL_ERR_NOT_RDY;
         }
         /* CLear the operation end flag. */
-        EFM_ClearStatus(EFM_FLAG_OPTEND);
+        EFM_CLR_FLAG(EFM_FLAG_OPTEND);
     }
     /* Recover CACHE function */
     MODIFY_REG32(CM_EFM->FRMC, EFM_CACHE_ALL, u32Tmp);
@@ -0,0 +1,882 @@
+/**
+ *******************************************************************************
+ * @file  hc32_ll_efm_kv.c
+ * @brief This file provides firmware functions to manage the EFM key/value
+ *        store (EEPROM emulation).
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-16       CDT             First version
+   2026-10-17       CDT             Check at build time that the index can hold the record addresses
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2022-2023, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_ll_efm_kv.h"
+#include "hc32_ll_efm.h"
+#include "hc32_ll_utility.h"
+
+/**
+ * @addtogroup LL_Driver
+ * @{
+ */
+
+/**
+ * @defgroup LL_EFM_KV EFM_KV
+ * @brief EFM Key/Value Store Driver Library
+ * @details The store is a log of records in a ring of flash sectors.
+ *          - Every used sector starts with a header word holding a 16-bit sequence number,
+ *            the sector with the highest number is the one being appended to.
+ *          - A record is a header word (key, value length, check byte), the value padded
+ *            to words and a commit word holding the CRC16 of the header and value. It is
+ *            programmed in one sequence program, the commit word last.
+ *          - The latest valid record of a key is its value, a record with no value deletes
+ *            the key. A RAM index holds the address of the latest record of each key.
+ *          - Compaction copies the live records of the oldest sector to the head of the log,
+ *            then erases that sector. At least one sector is kept erased for it.
+ *          A power loss leaves at worst a record without a valid commit word, a sector
+ *          without a valid header, or records present twice, all of which EFM_KV_Init()
+ *          recovers from.
+ * @{
+ */
+
+#if (LL_EFM_KV_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @defgroup EFM_KV_Local_Types EFM Key/Value Store Local Types
+ * @{
+ */
+
+/**
+ * @brief EFM key/value store control block definition
+ */
+typedef struct {
+    uint32_t u32StartAddr;              /*!< First sector */
+    uint32_t u32SectorNum;              /*!< Number of sectors, 0 if not initialized */
+    uint32_t u32ActiveAddr;             /*!< Sector being appended to */
+    uint32_t u32WriteAddr;              /*!< Next free address in the active sector */
+    uint16_t u16ActiveSeq;              /*!< Sequence number of the active sector */
+    uint32_t u32LiveSize;               /*!< Size of the latest records of all keys */
+    uint32_t u32CompactAddr;            /*!< Sector being compacted, EFM_KV_NONE if none */
+    uint32_t u32CompactPos;             /*!< Next record to check in the sector being compacted */
+    uint16_t au16Index[EFM_KV_KEY_NUM]; /*!< Latest record of each key, 0 if none */
+} stc_efm_kv_ctrl_t;
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup EFM_KV_Local_Macros EFM Key/Value Store Local Macros
+ * @{
+ */
+#define EFM_KV_NONE                     (0xFFFFFFFFUL)
+#define EFM_KV_ERASED_WORD              (0xFFFFFFFFUL)
+
+/* Record size of a value length: header, value in words and commit word */
+#define EFM_KV_REC_SIZE(len)            (8UL + (((uint32_t)(len) + 3UL) & ~3UL))
+#define EFM_KV_REC_SIZE_MAX             (EFM_KV_REC_SIZE(EFM_KV_VALUE_MAX))
+#define EFM_KV_REC_WORD_MAX             (EFM_KV_REC_SIZE_MAX / 4UL)
+/* Record space of a sector, and the part of it that always fills before the sector is left */
+#define EFM_KV_SECTOR_DATA              (SECTOR_SIZE - 4UL)
+#define EFM_KV_SECTOR_CAP               (EFM_KV_SECTOR_DATA - (EFM_KV_REC_SIZE_MAX - 4UL))
+
+#define EFM_KV_REC_KEY(hdr)             ((hdr) & 0xFFFFUL)
+#define EFM_KV_REC_LEN(hdr)             (((hdr) >> 16U) & 0xFFUL)
+
+#define EFM_KV_CRC16_INIT               (0xFFFFU)
+#define EFM_KV_CRC16_POLY               (0x1021U)
+
+/**
+ * @defgroup EFM_KV_Record_Status EFM Key/Value Store Record Status
+ * @{
+ */
+#define EFM_KV_REC_VALID                (0U)    /*!< Record complete */
+#define EFM_KV_REC_TORN                 (1U)    /*!< Header valid, commit word not, the record is skipped */
+#define EFM_KV_REC_END                  (2U)    /*!< Erased word, end of the log */
+#define EFM_KV_REC_BAD                  (3U)    /*!< Invalid header, the rest of the sector is skipped */
+/**
+ * @}
+ */
+
+#if ((EFM_KV_VALUE_MAX < 1U) || (EFM_KV_VALUE_MAX > 255U))
+#error "EFM_KV_VALUE_MAX must be 1 ~ 255."
+#endif
+
+/* The index holds record addresses in 16 bits, the store must end at or below 0xFFFF */
+#if (EFM_END_ADDR > 0xFFFFUL)
+#error "EFM_KV: the record index cannot hold flash addresses above 0xFFFF."
+#endif
+
+/**
+ * @defgroup EFM_KV_Check_Parameters_Validity EFM Key/Value Store Check Parameters Validity
+ * @{
+ */
+#define IS_EFM_KV_AREA(start, num)                                             \
+(   (0UL == ((start) % SECTOR_SIZE))                    &&                     \
+    ((num) >= 2UL)                                      &&                     \
+    ((num) <= ((EFM_END_ADDR + 1UL) / SECTOR_SIZE))     &&                     \
+    ((start) <= ((EFM_END_ADDR + 1UL) - ((num) * SECTOR_SIZE))))
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+/**
+ * @defgroup EFM_KV_Local_Variables EFM Key/Value Store Local Variables
+ * @{
+ */
+static stc_efm_kv_ctrl_t m_stcEfmKv;
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @defgroup EFM_KV_Local_Functions EFM Key/Value Store Local Functions
+ * @{
+ */
+
+/**
+ * @brief  CRC16-CCITT.
+ * @param  [in] pu8Data                 Data
+ * @param  [in] u32Len                  Length of data
+ * @retval CRC
+ */
+static uint16_t EFM_KV_Crc16(const uint8_t *pu8Data, uint32_t u32Len)
+{
+    uint16_t u16Crc = EFM_KV_CRC16_INIT;
+    uint32_t i;
+    uint32_t j;
+
+    for (i = 0UL; i < u32Len; i++) {
+        u16Crc ^= (uint16_t)((uint16_t)pu8Data[i] << 8U);
+        for (j = 0UL; j < 8UL; j++) {
+            if (0U != (u16Crc & 0x8000U)) {
+                u16Crc = (uint16_t)((uint16_t)(u16Crc << 1U) ^ EFM_KV_CRC16_POLY);
+            } else {
+                u16Crc = (uint16_t)(u16Crc << 1U);
+            }
+        }
+    }
+    return u16Crc;
+}
+
+/**
+ * @brief  Record header word.
+ * @param  [in] u32Key                  Key
+ * @param  [in] u32Len                  Value length, 0 for a delete record
+ * @retval Header word, the check byte is the inverted sum of the other three bytes
+ */
+static uint32_t EFM_KV_RecHeader(uint32_t u32Key, uint32_t u32Len)
+{
+    uint32_t u32Hdr = u32Key | (u32Len << 16U);
+    uint32_t u32Sum = (u32Hdr & 0xFFUL) + ((u32Hdr >> 8U) & 0xFFUL) + ((u32Hdr >> 16U) & 0xFFUL);
+
+    return u32Hdr | ((~u32Sum & 0xFFUL) << 24U);
+}
+
+/**
+ * @brief  Commit word of a record.
+ * @param  [in] pu32Rec                 Record, header and value
+ * @param  [in] u32Len                  Value length
+ * @retval Commit word, the CRC16 and its complement
+ */
+static uint32_t EFM_KV_RecCommit(const uint32_t *pu32Rec, uint32_t u32Len)
+{
+    uint32_t u32Crc = EFM_KV_Crc16((const uint8_t *)pu32Rec, 4UL + u32Len);
+
+    return u32Crc | ((~u32Crc & 0xFFFFUL) << 16U);
+}
+
+/**
+ * @brief  Check a record and copy it to RAM.
+ * @param  [in]  u32Addr                Record address
+ * @param  [in]  u32End                 End of the sector
+ * @param  [out] pu32Size               Record size, valid for EFM_KV_REC_VALID and EFM_KV_REC_TORN
+ * @param  [out] pu32Rec                Buffer of EFM_KV_REC_WORD_MAX words for the record
+ * @retval An @ref EFM_KV_Record_Status value
+ */
+static uint32_t EFM_KV_ReadRecord(uint32_t u32Addr, uint32_t u32End, uint32_t *pu32Size, uint32_t *pu32Rec)
+{
+    uint32_t u32Hdr = RW_MEM32(u32Addr);
+    uint32_t u32Len = EFM_KV_REC_LEN(u32Hdr);
+    uint32_t u32Words;
+    uint32_t i;
+    uint32_t u32Ret = EFM_KV_REC_BAD;
+
+    if (EFM_KV_ERASED_WORD == u32Hdr) {
+        u32Ret = EFM_KV_REC_END;
+    } else if ((EFM_KV_REC_KEY(u32Hdr) < EFM_KV_KEY_NUM) && (u32Len <= EFM_KV_VALUE_MAX) &&
+               (u32Hdr == EFM_KV_RecHeader(EFM_KV_REC_KEY(u32Hdr), u32Len)) &&
+               ((u32End - u32Addr) >= EFM_KV_REC_SIZE(u32Len))) {
+        *pu32Size = EFM_KV_REC_SIZE(u32Len);
+        u32Words = *pu32Size / 4UL;
+        for (i = 0UL; i < u32Words; i++) {
+            pu32Rec[i] = RW_MEM32(u32Addr + (i * 4UL));
+        }
+        u32Ret = (pu32Rec[u32Words - 1UL] == EFM_KV_RecCommit(pu32Rec, u32Len)) ? EFM_KV_REC_VALID : EFM_KV_REC_TORN;
+    } else {
+        /* Invalid header */
+    }
+    return u32Ret;
+}
+
+/**
+ * @brief  Size of the record at an address.
+ * @param  [in] u32Addr                 Record address, 0 for none
+ * @retval Record size
+ */
+static uint32_t EFM_KV_RecSize(uint32_t u32Addr)
+{
+    return (0UL == u32Addr) ? 0UL : EFM_KV_REC_SIZE(EFM_KV_REC_LEN(RW_MEM32(u32Addr)));
+}
+
+/**
+ * @brief  Get the sequence number of a sector.
+ * @param  [in]  u32Base                Sector address
+ * @param  [out] pu16Seq                Sequence number
+ * @retval An @ref en_flag_status_t enumeration value:
+ *           - SET:                     The sector has a valid header.
+ *           - RESET:                   The sector is erased or invalid.
+ */
+static en_flag_status_t EFM_KV_GetSectorSeq(uint32_t u32Base, uint16_t *pu16Seq)
+{
+    uint32_t u32Hdr = RW_MEM32(u32Base);
+
+    *pu16Seq = (uint16_t)u32Hdr;
+    return ((u32Hdr >> 16U) == (~u32Hdr & 0xFFFFUL)) ? SET : RESET;
+}
+
+/**
+ * @brief  Get the used sector with the lowest sequence number.
+ * @param  None
+ * @retval Sector address
+ */
+static uint32_t EFM_KV_GetOldestSector(void)
+{
+    uint32_t u32Oldest = m_stcEfmKv.u32ActiveAddr;
+    uint16_t u16OldestSeq = m_stcEfmKv.u16ActiveSeq;
+    uint32_t u32Base;
+    uint16_t u16Seq;
+    uint32_t i;
+
+    for (i = 0UL; i < m_stcEfmKv.u32SectorNum; i++) {
+        u32Base = m_stcEfmKv.u32StartAddr + (i * SECTOR_SIZE);
+        if ((SET == EFM_KV_GetSectorSeq(u32Base, &u16Seq)) && ((int16_t)(uint16_t)(u16Seq - u16OldestSeq) < 0)) {
+            u32Oldest = u32Base;
+            u16OldestSeq = u16Seq;
+        }
+    }
+    return u32Oldest;
+}
+
+/**
+ * @brief  Count the erased sectors.
+ * @param  None
+ * @retval Number of erased sectors
+ */
+static uint32_t EFM_KV_GetErasedNum(void)
+{
+    uint32_t u32Num = 0UL;
+    uint32_t i;
+
+    for (i = 0UL; i < m_stcEfmKv.u32SectorNum; i++) {
+        if (EFM_KV_ERASED_WORD == RW_MEM32(m_stcEfmKv.u32StartAddr + (i * SECTOR_SIZE))) {
+            u32Num++;
+        }
+    }
+    return u32Num;
+}
+
+/**
+ * @brief  Start a new active sector in the first erased sector after the active one.
+ * @param  None
+ * @retval int32_t:
+ *           - LL_OK:                   The new sector is active.
+ *           - LL_ERR_BUF_FULL:         No erased sector.
+ *           - Others:                  @ref EFM_ProgramWord
+ */
+static int32_t EFM_KV_OpenSector(void)
+{
+    uint32_t u32Index = 0UL;
+    uint32_t u32Base;
+    uint16_t u16Seq = 0U;
+    uint32_t i;
+    int32_t i32Ret = LL_ERR_BUF_FULL;
+
+    if (EFM_KV_NONE != m_stcEfmKv.u32ActiveAddr) {
+        u32Index = ((m_stcEfmKv.u32ActiveAddr - m_stcEfmKv.u32StartAddr) / SECTOR_SIZE) + 1UL;
+        u16Seq = m_stcEfmKv.u16ActiveSeq + 1U;
+    }
+    for (i = 0UL; i < m_stcEfmKv.u32SectorNum; i++) {
+        u32Base = m_stcEfmKv.u32StartAddr + (((u32Index + i) % m_stcEfmKv.u32SectorNum) * SECTOR_SIZE);
+        if (EFM_KV_ERASED_WORD == RW_MEM32(u32Base)) {
+            i32Ret = EFM_ProgramWord(u32Base, (uint32_t)u16Seq | ((uint32_t)(uint16_t)~u16Seq << 16U));
+            if (LL_OK == i32Ret) {
+                m_stcEfmKv.u32ActiveAddr = u32Base;
+                m_stcEfmKv.u32WriteAddr = u32Base + 4UL;
+                m_stcEfmKv.u16ActiveSeq = u16Seq;
+            }
+            break;
+        }
+    }
+    return i32Ret;
+}
+
+/**
+ * @brief  Append a record to the active sector, which must have room for it.
+ * @param  [in]  pu32Rec                Record
+ * @param  [in]  u32Size                Record size
+ * @param  [out] pu32Addr               Address of the record
+ * @retval int32_t:
+ *           - LL_OK:                   Programmed and verified.
+ *           - LL_ERR:                  Verification failed, the space is skipped.
+ */
+static int32_t EFM_KV_Append(uint32_t *pu32Rec, uint32_t u32Size, uint32_t *pu32Addr)
+{
+    uint32_t u32Addr = m_stcEfmKv.u32WriteAddr;
+    uint32_t i;
+    int32_t i32Ret;
+
+    i32Ret = EFM_SequenceProgram(u32Addr, (uint8_t *)pu32Rec, u32Size);
+    m_stcEfmKv.u32WriteAddr += u32Size;
+    for (i = 0UL; i < (u32Size / 4UL); i++) {
+        if (RW_MEM32(u32Addr + (i * 4UL)) != pu32Rec[i]) {
+            i32Ret = LL_ERR;
+        }
+    }
+    if (LL_OK != i32Ret) {
+        i32Ret = LL_ERR;
+    }
+    *pu32Addr = u32Addr;
+    return i32Ret;
+}
+
+/**
+ * @brief  One compaction step: copy the next live record of the oldest sector to the
+ *         head of the log, or erase the oldest sector once none is left.
+ * @param  None
+ * @retval int32_t:
+ *           - LL_OK:                   The sector is erased.
+ *           - LL_ERR_BUSY:             A record is copied, more steps follow.
+ *           - LL_ERR_BUF_FULL:         No erased sector to copy into.
+ *           - Others:                  Flash operation failed.
+ */
+static int32_t EFM_KV_CompactStep(void)
+{
+    uint32_t au32Rec[EFM_KV_REC_WORD_MAX];
+    uint32_t u32End;
+    uint32_t u32Size = 0UL;
+    uint32_t u32Status;
+    uint32_t u32Key;
+    uint32_t u32Addr;
+    int32_t i32Ret = LL_OK;
+
+    if (EFM_KV_NONE == m_stcEfmKv.u32CompactAddr) {
+        m_stcEfmKv.u32CompactAddr = EFM_KV_GetOldestSector();
+        m_stcEfmKv.u32CompactPos = m_stcEfmKv.u32CompactAddr + 4UL;
+        /* The records must not be copied into the sector itself */
+        if (m_stcEfmKv.u32CompactAddr == m_stcEfmKv.u32ActiveAddr) {
+            i32Ret = EFM_KV_OpenSector();
+        }
+    }
+
+    u32End = m_stcEfmKv.u32CompactAddr + SECTOR_SIZE;
+    while ((LL_OK == i32Ret) && (m_stcEfmKv.u32CompactPos < u32End)) {
+        u32Status = EFM_KV_ReadRecord(m_stcEfmKv.u32CompactPos, u32End, &u32Size, au32Rec);
+        if ((EFM_KV_REC_END == u32Status) || (EFM_KV_REC_BAD == u32Status)) {
+            m_stcEfmKv.u32CompactPos = u32End;
+        } else {
+            u32Key = EFM_KV_REC_KEY(au32Rec[0]);
+            if ((EFM_KV_REC_VALID == u32Status) && (m_stcEfmKv.u32CompactPos == m_stcEfmKv.au16Index[u32Key])) {
+                if ((m_stcEfmKv.u32ActiveAddr + SECTOR_SIZE - m_stcEfmKv.u32WriteAddr) < u32Size) {
+                    i32Ret = EFM_KV_OpenSector();
+                }
+                if (LL_OK == i32Ret) {
+                    i32Ret = EFM_KV_Append(au32Rec, u32Size, &u32Addr);
+                }
+                if (LL_OK == i32Ret) {
+                    m_stcEfmKv.au16Index[u32Key] = (uint16_t)u32Addr;
+                    m_stcEfmKv.u32CompactPos += u32Size;
+                    i32Ret = LL_ERR_BUSY;
+                }
+                break;
+            }
+            m_stcEfmKv.u32CompactPos += u32Size;
+        }
+    }
+
+    if ((LL_OK == i32Ret) && (m_stcEfmKv.u32CompactPos >= u32End)) {
+        i32Ret = EFM_SectorErase(m_stcEfmKv.u32CompactAddr);
+        m_stcEfmKv.u32CompactAddr = EFM_KV_NONE;
+    }
+    return i32Ret;
+}
+
+/**
+ * @brief  Run compaction until the oldest sector is erased.
+ * @param  None
+ * @retval int32_t:
+ *           - LL_OK:                   The sector is erased.
+ *           - Others:                  @ref EFM_KV_CompactStep
+ */
+static int32_t EFM_KV_CompactSector(void)
+{
+    int32_t i32Ret;
+
+    do {
+        i32Ret = EFM_KV_CompactStep();
+    } while (LL_ERR_BUSY == i32Ret);
+    return i32Ret;
+}
+
+/**
+ * @brief  Make room for a record in the active sector, moving to a new sector and
+ *         compacting as needed. One erased sector is always left for compaction.
+ * @param  [in] u32Size                 Record size
+ * @retval int32_t:
+ *           - LL_OK:                   The record fits.
+ *           - Others:                  No room or a flash operation failed.
+ */
+static int32_t EFM_KV_MakeRoom(uint32_t u32Size)
+{
+    uint32_t i;
+    int32_t i32Ret = LL_ERR_BUF_FULL;
+
+    for (i = 0UL; i <= (2UL * m_stcEfmKv.u32SectorNum); i++) {
+        if ((m_stcEfmKv.u32ActiveAddr + SECTOR_SIZE - m_stcEfmKv.u32WriteAddr) >= u32Size) {
+            i32Ret = LL_OK;
+        } else if (EFM_KV_GetErasedNum() >= 2UL) {
+            i32Ret = EFM_KV_OpenSector();
+        } else {
+            i32Ret = EFM_KV_CompactSector();
+        }
+        if ((LL_OK != i32Ret) || ((m_stcEfmKv.u32ActiveAddr + SECTOR_SIZE - m_stcEfmKv.u32WriteAddr) >= u32Size)) {
+            break;
+        }
+    }
+    return i32Ret;
+}
+
+/**
+ * @brief  Append a record of a key and index it.
+ * @param  [in] u32Key                  Key
+ * @param  [in] pu32Rec                 Record, header and value
+ * @param  [in] u32Len                  Value length, 0 for a delete record
+ * @retval int32_t:
+ *           - LL_OK:                   Written.
+ *           - LL_ERR_BUF_FULL:         Not enough free space.
+ *           - Others:                  A flash operation failed.
+ */
+static int32_t EFM_KV_Put(uint32_t u32Key, uint32_t *pu32Rec, uint32_t u32Len)
+{
+    uint32_t u32Size = EFM_KV_REC_SIZE(u32Len);
+    uint32_t u32Live = m_stcEfmKv.u32LiveSize - EFM_KV_RecSize(m_stcEfmKv.au16Index[u32Key]);
+    uint32_t u32Addr = 0UL;
+    int32_t i32Ret = LL_ERR_BUF_FULL;
+
+    pu32Rec[u32Size / 4UL - 1UL] = EFM_KV_RecCommit(pu32Rec, u32Len);
+    if ((u32Live + ((0UL == u32Len) ? 0UL : u32Size)) <= ((m_stcEfmKv.u32SectorNum - 1UL) * EFM_KV_SECTOR_CAP)) {
+        i32Ret = EFM_KV_MakeRoom(u32Size);
+        if (LL_OK == i32Ret) {
+            i32Ret = EFM_KV_Append(pu32Rec, u32Size, &u32Addr);
+        }
+        if (LL_OK == i32Ret) {
+            m_stcEfmKv.au16Index[u32Key] = (0UL == u32Len) ? 0U : (uint16_t)u32Addr;
+            m_stcEfmKv.u32LiveSize = u32Live + EFM_KV_RecSize(m_stcEfmKv.au16Index[u32Key]);
+        }
+    }
+    return i32Ret;
+}
+
+/**
+ * @brief  Index the valid records of a sector.
+ * @param  [in] u32Base                 Sector address
+ * @retval Address after the last record, the sector end if the log cannot be continued
+ */
+static uint32_t EFM_KV_ScanSector(uint32_t u32Base)
+{
+    uint32_t au32Rec[EFM_KV_REC_WORD_MAX];
+    uint32_t u32End = u32Base + SECTOR_SIZE;
+    uint32_t u32Addr = u32Base + 4UL;
+    uint32_t u32Size = 0UL;
+    uint32_t u32Status;
+
+    while (u32Addr < u32End) {
+        u32Status = EFM_KV_ReadRecord(u32Addr, u32End, &u32Size, au32Rec);
+        if (EFM_KV_REC_END == u32Status) {
+            break;
+        } else if (EFM_KV_REC_BAD == u32Status) {
+            u32Addr = u32End;
+        } else {
+            if (EFM_KV_REC_VALID == u32Status) {
+                m_stcEfmKv.au16Index[EFM_KV_REC_KEY(au32Rec[0])] =
+                    (0UL == EFM_KV_REC_LEN(au32Rec[0])) ? 0U : (uint16_t)u32Addr;
+            }
+            u32Addr += u32Size;
+        }
+    }
+    return u32Addr;
+}
+
+/**
+ * @brief  Erase a sector unless it is blank.
+ * @param  [in] u32Base                 Sector address
+ * @retval int32_t:
+ *           - LL_OK:                   The sector is blank.
+ *           - Others:                  @ref EFM_SectorErase
+ */
+static int32_t EFM_KV_EraseSector(uint32_t u32Base)
+{
+    uint32_t i;
+    int32_t i32Ret = LL_OK;
+
+    for (i = 0UL; i < SECTOR_SIZE; i += 4UL) {
+        if (EFM_KV_ERASED_WORD != RW_MEM32(u32Base + i)) {
+            i32Ret = EFM_SectorErase(u32Base);
+            break;
+        }
+    }
+    return i32Ret;
+}
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup EFM_KV_Global_Functions EFM Key/Value Store Global Functions
+ * @{
+ */
+
+/**
+ * @brief  Set the members of stc_efm_kv_init_t to default values, the last four sectors of the flash.
+ * @param  [out] pstcKvInit             Pointer to a @ref stc_efm_kv_init_t structure.
+ * @retval int32_t:
+ *           - LL_OK:                   No error occurred.
+ *           - LL_ERR_INVD_PARAM:       pstcKvInit == NULL.
+ */
+int32_t EFM_KV_StructInit(stc_efm_kv_init_t *pstcKvInit)
+{
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+
+    if (NULL != pstcKvInit) {
+        pstcKvInit->u32SectorNum = 4UL;
+        pstcKvInit->u32StartAddr = (EFM_END_ADDR + 1UL) - (pstcKvInit->u32SectorNum * SECTOR_SIZE);
+        i32Ret = LL_OK;
+    }
+    return i32Ret;
+}
+
+/**
+ * @brief  Mount the store: recover from an interrupted write or compaction and build the RAM index.
+ * @param  [in] pstcKvInit              Pointer to a @ref stc_efm_kv_init_t structure.
+ * @retval int32_t:
+ *           - LL_OK:                   The store is ready.
+ *           - LL_ERR_INVD_PARAM:       pstcKvInit == NULL or invalid area.
+ *           - Others:                  A flash operation failed.
+ * @note   The sectors must be erased or belong to the store, sectors with an invalid header are erased.
+ * @note   Call LL_PERIPH_WE(LL_PERIPH_EFM) and EFM_FWMC_Cmd(ENABLE) first, and keep them
+ *         while the store is used. The functions are not reentrant.
+ */
+int32_t EFM_KV_Init(const stc_efm_kv_init_t *pstcKvInit)
+{
+    uint32_t u32Base;
+    uint16_t u16Seq;
+    uint16_t u16OldestSeq;
+    int32_t i32Last = -1;
+    int32_t i32Rel;
+    int32_t i32Next;
+    uint32_t u32NextBase = 0UL;
+    uint32_t i;
+    uint32_t j;
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+
+    if ((NULL != pstcKvInit) && IS_EFM_KV_AREA(pstcKvInit->u32StartAddr, pstcKvInit->u32SectorNum)) {
+        m_stcEfmKv.u32StartAddr = pstcKvInit->u32StartAddr;
+        m_stcEfmKv.u32SectorNum = pstcKvInit->u32SectorNum;
+        m_stcEfmKv.u32ActiveAddr = EFM_KV_NONE;
+        m_stcEfmKv.u32WriteAddr = 0UL;
+        m_stcEfmKv.u16ActiveSeq = 0U;
+        m_stcEfmKv.u32LiveSize = 0UL;
+        m_stcEfmKv.u32CompactAddr = EFM_KV_NONE;
+        m_stcEfmKv.u32CompactPos = 0UL;
+        for (i = 0UL; i < EFM_KV_KEY_NUM; i++) {
+            m_stcEfmKv.au16Index[i] = 0U;
+        }
+        i32Ret = LL_OK;
+
+        /* Erase the invalid sectors, find the newest one */
+        for (i = 0UL; (i < m_stcEfmKv.u32SectorNum) && (LL_OK == i32Ret); i++) {
+            u32Base = m_stcEfmKv.u32StartAddr + (i * SECTOR_SIZE);
+            if (SET == EFM_KV_GetSectorSeq(u32Base, &u16Seq)) {
+                if ((EFM_KV_NONE == m_stcEfmKv.u32ActiveAddr) ||
+                    ((int16_t)(uint16_t)(u16Seq - m_stcEfmKv.u16ActiveSeq) > 0)) {
+                    m_stcEfmKv.u32ActiveAddr = u32Base;
+                    m_stcEfmKv.u16ActiveSeq = u16Seq;
+                }
+            } else {
+                i32Ret = EFM_KV_EraseSector(u32Base);
+            }
+        }
+
+        if (LL_OK == i32Ret) {
+            if (EFM_KV_NONE == m_stcEfmKv.u32ActiveAddr) {
+                i32Ret = EFM_KV_OpenSector();
+            } else {
+                /* Replay the sectors from the oldest one, later records win */
+                (void)EFM_KV_GetSectorSeq(EFM_KV_GetOldestSector(), &u16OldestSeq);
+                for (i = 0UL; i < m_stcEfmKv.u32SectorNum; i++) {
+                    i32Next = INT32_MAX;
+                    for (j = 0UL; j < m_stcEfmKv.u32SectorNum; j++) {
+                        u32Base = m_stcEfmKv.u32StartAddr + (j * SECTOR_SIZE);
+                        if (SET == EFM_KV_GetSectorSeq(u32Base, &u16Seq)) {
+                            i32Rel = (int32_t)(uint16_t)(u16Seq - u16OldestSeq);
+                            if ((i32Rel > i32Last) && (i32Rel < i32Next)) {
+                                i32Next = i32Rel;
+                                u32NextBase = u32Base;
+                            }
+                        }
+                    }
+                    if (INT32_MAX == i32Next) {
+                        break;
+                    }
+                    m_stcEfmKv.u32WriteAddr = EFM_KV_ScanSector(u32NextBase);
+                    i32Last = i32Next;
+                }
+                for (i = 0UL; i < EFM_KV_KEY_NUM; i++) {
+                    m_stcEfmKv.u32LiveSize += EFM_KV_RecSize(m_stcEfmKv.au16Index[i]);
+                }
+                /* Power lost while compacting with the last erased sector, finish it first */
+                if (0UL == EFM_KV_GetErasedNum()) {
+                    i32Ret = EFM_KV_CompactSector();
+                }
+            }
+        }
+        if (LL_OK != i32Ret) {
+            m_stcEfmKv.u32StartAddr = 0UL;
+            m_stcEfmKv.u32SectorNum = 0UL;
+        }
+    }
+    return i32Ret;
+}
+
+/**
+ * @brief  Read the value of a key.
+ * @param  [in]  u16Key                 Key, 0 ~ EFM_KV_KEY_NUM - 1
+ * @param  [out] pu8Buf                 Buffer for the value
+ * @param  [in]  u32Size                Size of the buffer, a longer value is truncated
+ * @param  [out] pu32Len                Length of the value, NULL if not needed
+ * @retval int32_t:
+ *           - LL_OK:                   The value is read.
+ *           - LL_ERR:                  The key has no value.
+ *           - LL_ERR_INVD_PARAM:       Invalid key or pu8Buf == NULL.
+ *           - LL_ERR_NOT_RDY:          The store is not initialized.
+ */
+int32_t EFM_KV_Read(uint16_t u16Key, uint8_t *pu8Buf, uint32_t u32Size, uint32_t *pu32Len)
+{
+    uint32_t u32Addr;
+    uint32_t u32Len;
+    uint32_t i;
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+
+    if (0UL == m_stcEfmKv.u32SectorNum) {
+        i32Ret = LL_ERR_NOT_RDY;
+    } else if ((u16Key < EFM_KV_KEY_NUM) && (NULL != pu8Buf)) {
+        u32Addr = m_stcEfmKv.au16Index[u16Key];
+        if (0UL == u32Addr) {
+            i32Ret = LL_ERR;
+        } else {
+            u32Len = EFM_KV_REC_LEN(RW_MEM32(u32Addr));
+            for (i = 0UL; (i < u32Len) && (i < u32Size); i++) {
+                pu8Buf[i] = RW_MEM8(u32Addr + 4UL + i);
+            }
+            if (NULL != pu32Len) {
+                *pu32Len = u32Len;
+            }
+            i32Ret = LL_OK;
+        }
+    } else {
+        /* Invalid parameter */
+    }
+    return i32Ret;
+}
+
+/**
+ * @brief  Write the value of a key, one record append if the active sector has room.
+ * @param  [in] u16Key                  Key, 0 ~ EFM_KV_KEY_NUM - 1
+ * @param  [in] pu8Data                 Value
+ * @param  [in] u32Len                  Value length, 1 ~ EFM_KV_VALUE_MAX
+ * @retval int32_t:
+ *           - LL_OK:                   Written, or the value is unchanged.
+ *           - LL_ERR_INVD_PARAM:       Invalid key or length, or pu8Data == NULL.
+ *           - LL_ERR_NOT_RDY:          The store is not initialized.
+ *           - LL_ERR_BUF_FULL:         Not enough free space.
+ *           - Others:                  A flash operation failed.
+ * @note   The sector erase of a compaction runs here if EFM_KV_Compact() did not keep up.
+ */
+int32_t EFM_KV_Write(uint16_t u16Key, const uint8_t *pu8Data, uint32_t u32Len)
+{
+    uint32_t au32Rec[EFM_KV_REC_WORD_MAX];
+    uint8_t *pu8Rec;
+    uint32_t u32Addr;
+    uint32_t i;
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+
+    if (0UL == m_stcEfmKv.u32SectorNum) {
+        i32Ret = LL_ERR_NOT_RDY;
+    } else if ((u16Key < EFM_KV_KEY_NUM) && (NULL != pu8Data) && (u32Len >= 1UL) && (u32Len <= EFM_KV_VALUE_MAX)) {
+        /* Unchanged value, nothing to program */
+        u32Addr = m_stcEfmKv.au16Index[u16Key];
+        if ((0UL != u32Addr) && (u32Len == EFM_KV_REC_LEN(RW_MEM32(u32Addr)))) {
+            for (i = 0UL; i < u32Len; i++) {
+                if (pu8Data[i] != RW_MEM8(u32Addr + 4UL + i)) {
+                    break;
+                }
+            }
+            if (i == u32Len) {
+                i32Ret = LL_OK;
+            }
+        }
+        if (LL_OK != i32Ret) {
+            au32Rec[0] = EFM_KV_RecHeader(u16Key, u32Len);
+            /* Pad the value with erased bytes */
+            for (i = 1UL; i < EFM_KV_REC_WORD_MAX; i++) {
+                au32Rec[i] = EFM_KV_ERASED_WORD;
+            }
+            pu8Rec = (uint8_t *)&au32Rec[1];
+            for (i = 0UL; i < u32Len; i++) {
+                pu8Rec[i] = pu8Data[i];
+            }
+            i32Ret = EFM_KV_Put(u16Key, au32Rec, u32Len);
+        }
+    } else {
+        /* Invalid parameter */
+    }
+    return i32Ret;
+}
+
+/**
+ * @brief  Delete a key.
+ * @param  [in] u16Key                  Key, 0 ~ EFM_KV_KEY_NUM - 1
+ * @retval int32_t:
+ *           - LL_OK:                   Deleted, or the key had no value.
+ *           - LL_ERR_INVD_PARAM:       Invalid key.
+ *           - LL_ERR_NOT_RDY:          The store is not initialized.
+ *           - Others:                  @ref EFM_KV_Write
+ */
+int32_t EFM_KV_Delete(uint16_t u16Key)
+{
+    uint32_t au32Rec[2];
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+
+    if (0UL == m_stcEfmKv.u32SectorNum) {
+        i32Ret = LL_ERR_NOT_RDY;
+    } else if (u16Key < EFM_KV_KEY_NUM) {
+        i32Ret = LL_OK;
+        if (0U != m_stcEfmKv.au16Index[u16Key]) {
+            au32Rec[0] = EFM_KV_RecHeader(u16Key, 0UL);
+            i32Ret = EFM_KV_Put(u16Key, au32Rec, 0UL);
+        }
+    } else {
+        /* Invalid parameter */
+    }
+    return i32Ret;
+}
+
+/**
+ * @brief  Background compaction, call from the idle loop.
+ * @param  None
+ * @retval int32_t:
+ *           - LL_OK:                   Nothing to compact.
+ *           - LL_ERR_BUSY:             One record copied or one sector erased, call again.
+ *           - LL_ERR_NOT_RDY:          The store is not initialized.
+ *           - Others:                  A flash operation failed.
+ * @note   Compaction starts once only one erased sector is left and the oldest sector is not
+ *         the active one, so with 2 sectors it only runs inside EFM_KV_Write().
+ */
+int32_t EFM_KV_Compact(void)
+{
+    int32_t i32Ret = LL_OK;
+
+    if (0UL == m_stcEfmKv.u32SectorNum) {
+        i32Ret = LL_ERR_NOT_RDY;
+    } else if ((EFM_KV_NONE != m_stcEfmKv.u32CompactAddr) ||
+               ((EFM_KV_GetErasedNum() < 2UL) && (EFM_KV_GetOldestSector() != m_stcEfmKv.u32ActiveAddr))) {
+        i32Ret = EFM_KV_CompactStep();
+        if (LL_OK == i32Ret) {
+            i32Ret = LL_ERR_BUSY;
+        }
+    } else {
+        /* Enough erased sectors */
+    }
+    return i32Ret;
+}
+
+/**
+ * @brief  Get the free space.
+ * @param  None
+ * @retval Free record space in bytes, a value of n bytes takes 8 + n rounded up to 4.
+ */
+uint32_t EFM_KV_GetFreeSize(void)
+{
+    uint32_t u32Cap = 0UL;
+
+    if (0UL != m_stcEfmKv.u32SectorNum) {
+        u32Cap = (m_stcEfmKv.u32SectorNum - 1UL) * EFM_KV_SECTOR_CAP;
+    }
+    return (u32Cap > m_stcEfmKv.u32LiveSize) ? (u32Cap - m_stcEfmKv.u32LiveSize) : 0UL;
+}
+
+/**
+ * @}
+ */
+
+#endif /* LL_EFM_KV_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/******************************************************************************
+ * EOF (not truncated)
+ *****************************************************************************/
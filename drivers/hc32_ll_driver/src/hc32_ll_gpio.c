@@ -8,6 +8,8 @@
    Date             Author          Notes
    2022-03-31       CDT             First version
    2022-06-30       CDT             Add API GPIO_ExIntCmd().
+   2026-10-17       CDT             Set, reset and toggle pins with a single store
+                                    Add API GPIO_InitTable()
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2022-2023, Xiaohua Semiconductor Co., Ltd. All rights reserved.
@@ -78,18 +80,12 @@ typedef struct {
 #define GPIO_REG_TYPE                   uint8_t
 #define GPIO_PIDR_BASE                  ((uint32_t)(&CM_GPIO->PIDR0))
 #define GPIO_PODR_BASE                  ((uint32_t)(&CM_GPIO->PODR0))
-#define GPIO_POSR_BASE                  ((uint32_t)(&CM_GPIO->POSR0))
-#define GPIO_PORR_BASE                  ((uint32_t)(&CM_GPIO->PORR0))
-#define GPIO_POTR_BASE                  ((uint32_t)(&CM_GPIO->POTR0))
 #define GPIO_POER_BASE                  ((uint32_t)(&CM_GPIO->POER0))
 #define GPIO_PCR_BASE                   ((uint32_t)(&CM_GPIO->PCR00))
 #define GPIO_PFSR_BASE                  ((uint32_t)(&CM_GPIO->PCR00))
 
 #define PIDR_REG(x)     (*(__IO GPIO_REG_TYPE *)(GPIO_PIDR_BASE + GPIO_REG_OFFSET * (x)))
 #define PODR_REG(x)     (*(__IO GPIO_REG_TYPE *)(GPIO_PODR_BASE + GPIO_REG_OFFSET * (x)))
-#define POSR_REG(x)     (*(__IO GPIO_REG_TYPE *)(GPIO_POSR_BASE + GPIO_REG_OFFSET * (x)))
-#define PORR_REG(x)     (*(__IO GPIO_REG_TYPE *)(GPIO_PORR_BASE + GPIO_REG_OFFSET * (x)))
-#define POTR_REG(x)     (*(__IO GPIO_REG_TYPE *)(GPIO_POTR_BASE + GPIO_REG_OFFSET * (x)))
 #define POER_REG(x)     (*(__IO GPIO_REG_TYPE *)(GPIO_POER_BASE + GPIO_REG_OFFSET * (x)))
 #define PCR_REG(x, y)   (*(__IO uint16_t *)(GPIO_PCR_BASE +  (uint32_t)((x) * GPIO_PORT_OFFSET) + (y) * GPIO_PIN_OFFSET))
 #define PFSR_REG(x, y)  (*(__IO uint16_t *)(GPIO_PFSR_BASE + (uint32_t)((x) * GPIO_PORT_OFFSET) + (y) * GPIO_PIN_OFFSET))
@@ -339,6 +335,41 @@ int32_t GPIO_StructInit(stc_gpio_init_t *pstcGpioInit)
     return i32Ret;
 }
 
+/**
+ * @brief  Initialize GPIO pins by a configuration table, one PCR write for each pin.
+ * @param  [in] pstcPinCfg: Pointer to the first of u32Num table entries, built by @ref GPIO_Pin_Config.
+ * @param  [in] u32Num: Number of the table entries.
+ * @retval int32_t:
+ *           - LL_OK: GPIO initialize successful
+ *           - LL_ERR_INVD_PARAM: NULL pointer
+ * @note   GPIO registers must be unlocked, @ref LL_PERIPH_WE for details.
+ * @note   PCR is written as a whole, function and output level included, so the fields
+ *         which are not in the entry get their reset value. The entries are not checked.
+ */
+int32_t GPIO_InitTable(const stc_gpio_pin_cfg_t *pstcPinCfg, uint32_t u32Num)
+{
+    uint32_t i;
+    uint32_t u32Pin;
+    __IO uint16_t *PCRx;
+    int32_t i32Ret = LL_OK;
+
+    if (NULL == pstcPinCfg) {
+        i32Ret = LL_ERR_INVD_PARAM;
+    } else {
+        DDL_ASSERT(IS_GPIO_UNLOCK());
+        for (i = 0UL; i < u32Num; i++) {
+            PCRx = &PCR_REG(pstcPinCfg[i].u8Port, 0U);
+            for (u32Pin = pstcPinCfg[i].u8Pin; u32Pin != 0UL; u32Pin >>= 1U) {
+                if ((u32Pin & 1UL) != 0UL) {
+                    WRITE_REG16(*PCRx, pstcPinCfg[i].u16Pcr);
+                }
+                PCRx++;
+            }
+        }
+    }
+    return i32Ret;
+}
+
 /**
  * @brief  GPIO debug port configure. Set debug pins to GPIO
  * @param  [in] u8DebugPort: @ref GPIO_DebugPin_Sel for each product
@@ -509,14 +540,11 @@ uint16_t GPIO_ReadOutputPort(uint8_t u8Port)
  */
 void GPIO_SetPins(uint8_t u8Port, uint16_t u16Pin)
 {
-    __IO GPIO_REG_TYPE *POSRx;
-
     /* Parameter validity checking */
     DDL_ASSERT(IS_GPIO_PORT(u8Port));
     DDL_ASSERT(IS_GPIO_PIN(u16Pin));
 
-    POSRx = &POSR_REG(u8Port);
-    SET_REG_BIT(*POSRx, (GPIO_REG_TYPE)u16Pin);
+    GPIO_FAST_SetPins(u8Port, u16Pin);
 }
 
 /**
@@ -527,14 +555,11 @@ void GPIO_SetPins(uint8_t u8Port, uint16_t u16Pin)
  */
 void GPIO_ResetPins(uint8_t u8Port, uint16_t u16Pin)
 {
-    __IO GPIO_REG_TYPE *PORRx;
-
     /* Parameter validity checking */
     DDL_ASSERT(IS_GPIO_PORT(u8Port));
     DDL_ASSERT(IS_GPIO_PIN(u16Pin));
 
-    PORRx = &PORR_REG(u8Port);
-    SET_REG_BIT(*PORRx, (GPIO_REG_TYPE)u16Pin);
+    GPIO_FAST_ResetPins(u8Port, u16Pin);
 }
 
 /**
@@ -562,14 +587,11 @@ void GPIO_WritePort(uint8_t u8Port, uint16_t u16PortVal)
  */
 void GPIO_TogglePins(uint8_t u8Port, uint16_t u16Pin)
 {
-    __IO GPIO_REG_TYPE *POTRx;
-
     /* Parameter validity checking */
     DDL_ASSERT(IS_GPIO_PORT(u8Port));
     DDL_ASSERT(IS_GPIO_PIN(u16Pin));
 
-    POTRx = &POTR_REG(u8Port);
-    SET_REG_BIT(*POTRx, (GPIO_REG_TYPE)u16Pin);
+    GPIO_FAST_TogglePins(u8Port, u16Pin);
 }
 
 /**
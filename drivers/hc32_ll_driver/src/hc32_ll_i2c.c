@@ -8,6 +8,8 @@
    Date             Author          Notes
    2022-03-31       CDT             First version
    2022-06-30       CDT             Add API I2C_SlaveAddrCmd(), modify API I2C_SlaveAddrConfig()
+   2026-10-17       CDT             Calculate the baudrate with integer arithmetic, add API I2C_BaudrateConfigPpm()
+                                    Set the baudrate of I2C_Init() by I2C_BaudrateConfigPpm()
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2022-2023, Xiaohua Semiconductor Co., Ltd. All rights reserved.
@@ -52,7 +54,7 @@
  */
 #define I2C_BAUDRATE_MAX                (400000UL)
 
-#define I2C_SCL_HIGHT_LOW_LVL_SUM_MAX   ((float32_t)0x3E)
+#define I2C_SCL_HIGHT_LOW_LVL_SUM_MAX   (0x3EUL)
 #define I2C_7BIT_MAX                    (0x7FUL)
 #define I2C_10BIT_MAX                   (0x3FFUL)
 
@@ -240,13 +242,14 @@ void I2C_GenerateStop(CM_I2C_TypeDef *I2Cx)
  *         @arg pstcI2cInit->u32Baudrate : Baudrate configuration
  *         @arg pstcI2cInit->u32SclTime : Indicate SCL pin rising and falling
  *              time, should be number of T(i2c clock period time)
- * @param [out] pf32Error           Baudrate error
+ * @param [out] pi32ErrorPpm        Baudrate error in ppm: (Baudrate / actual baudrate - 1) * 1000000,
+ *                                  NULL if not needed
  * @retval int32_t
  *         - LL_OK:                 Success
- *         - LL_ERR_TIMEOUT:        Failed
  *         - LL_ERR_INVD_PARAM:     Parameter error
+ * @note  Integer arithmetic only, the division and the CCR value are the ones of I2C_BaudrateConfig().
  */
-int32_t I2C_BaudrateConfig(CM_I2C_TypeDef *I2Cx, const stc_i2c_init_t *pstcI2cInit, float32_t *pf32Error)
+int32_t I2C_BaudrateConfigPpm(CM_I2C_TypeDef *I2Cx, const stc_i2c_init_t *pstcI2cInit, int32_t *pi32ErrorPpm)
 {
     int32_t i32Ret = LL_OK;
     uint32_t I2cSrcClk;
@@ -256,12 +259,14 @@ int32_t I2C_BaudrateConfig(CM_I2C_TypeDef *I2Cx, const stc_i2c_init_t *pstcI2cIn
     uint32_t Dnfsum = 0UL;
     uint32_t Divsum = 2UL;
     uint32_t TheoryBaudrate;
-    float32_t WidthTotal;
-    float32_t SumTotal;
-    float32_t WidthHL;
-    float32_t fErr = 0.0F;
+    uint32_t BitClk;
+    uint32_t WidthTotal;
+    uint32_t WidthRem;
+    uint32_t WidthRound;
+    uint32_t SumTotal;
+    uint32_t WidthHL;
 
-    if ((NULL == pstcI2cInit) || (NULL == pf32Error)) {
+    if (NULL == pstcI2cInit) {
         i32Ret = LL_ERR_INVD_PARAM;
     } else {
         /* Check parameters */
@@ -285,41 +290,83 @@ int32_t I2C_BaudrateConfig(CM_I2C_TypeDef *I2Cx, const stc_i2c_init_t *pstcI2cIn
             Divsum = 3UL;
         }
 
-        if (I2cDivClk != 0UL) {
-            WidthTotal = (float32_t)I2cSrcClk / (float32_t)Baudrate / (float32_t)I2cDivClk;
-            SumTotal = (2.0F * (float32_t)Divsum) + (2.0F * (float32_t)Dnfsum) + (float32_t)SclCnt;
-            WidthHL = WidthTotal - SumTotal;
+        if (Baudrate != 0UL) {
+            /* WidthTotal = I2cSrcClk / Baudrate / I2cDivClk: whole part and remainder */
+            BitClk = Baudrate * I2cDivClk;
+            WidthTotal = I2cSrcClk / BitClk;
+            WidthRem = I2cSrcClk - (WidthTotal * BitClk);
+            SumTotal = (2UL * Divsum) + (2UL * Dnfsum) + SclCnt;
 
             /* Integer for WidthTotal, rounding off */
-            if ((WidthTotal - (float32_t)((uint32_t)WidthTotal)) >= 0.5F) {
-                WidthTotal = (float32_t)((uint32_t)WidthTotal) + 1.0F;
-            } else {
-                WidthTotal = (float32_t)((uint32_t)WidthTotal);
+            WidthRound = WidthTotal;
+            if (WidthRem >= (BitClk - WidthRem)) {
+                WidthRound++;
             }
 
-            if (WidthTotal <= SumTotal) {
+            if (WidthRound <= SumTotal) {
                 /* Err, Should set a smaller division value for pstcI2cInit->u32ClockDiv */
                 i32Ret = LL_ERR_INVD_PARAM;
+            } else if ((WidthTotal > (SumTotal + I2C_SCL_HIGHT_LOW_LVL_SUM_MAX)) ||
+                       ((WidthTotal == (SumTotal + I2C_SCL_HIGHT_LOW_LVL_SUM_MAX)) && (0UL != WidthRem))) {
+                /* Err, Should set a bigger division value for pstcI2cInit->u32ClockDiv */
+                i32Ret = LL_ERR_INVD_PARAM;
             } else {
-                if (WidthHL > I2C_SCL_HIGHT_LOW_LVL_SUM_MAX) {
-                    /* Err, Should set a bigger division value for pstcI2cInit->u32ClockDiv */
-                    i32Ret = LL_ERR_INVD_PARAM;
-                } else {
-                    TheoryBaudrate = I2cSrcClk / (uint32_t)WidthTotal / I2cDivClk;
-                    fErr = ((float32_t)Baudrate - (float32_t)TheoryBaudrate) / (float32_t)TheoryBaudrate;
-                    WRITE_REG32(I2Cx->CCR,                                              \
-                                (pstcI2cInit->u32ClockDiv << I2C_CCR_FREQ_POS) |       \
-                                (((uint32_t)WidthHL / 2U) << I2C_CCR_SLOWW_POS) |       \
-                                (((uint32_t)WidthHL - (((uint32_t)WidthHL) / 2U)) << I2C_CCR_SHIGHW_POS));
+                /* Whole part of WidthTotal - SumTotal */
+                WidthHL = WidthTotal - SumTotal;
+                TheoryBaudrate = I2cSrcClk / WidthRound / I2cDivClk;
+                if (NULL != pi32ErrorPpm) {
+                    *pi32ErrorPpm = (int32_t)((((int64_t)Baudrate - (int64_t)TheoryBaudrate) * 1000000LL) /
+                                              (int64_t)TheoryBaudrate);
                 }
+                WRITE_REG32(I2Cx->CCR,                                              \
+                            (pstcI2cInit->u32ClockDiv << I2C_CCR_FREQ_POS) |       \
+                            ((WidthHL / 2U) << I2C_CCR_SLOWW_POS) |                 \
+                            ((WidthHL - (WidthHL / 2U)) << I2C_CCR_SHIGHW_POS));
             }
         } else {
             i32Ret = LL_ERR_INVD_PARAM;
         }
     }
 
-    if ((NULL != pf32Error) && (LL_OK == i32Ret)) {
-        *pf32Error = fErr;
+    return i32Ret;
+}
+
+/**
+ * @brief Set the baudrate for I2C peripheral.
+ * @param [in] I2Cx                 Pointer to I2C instance register base.
+ *                                  This parameter can be a value of the following:
+ *         @arg CM_I2C or CM_I2Cx:  I2C instance register base.
+ * @param [in] pstcI2cInit          Pointer to I2C config structure  @ref stc_i2c_init_t
+ *         @arg pstcI2cInit->u32ClockDiv: Division of i2c source clock, reference as:
+ *              step1: calculate div = (I2cSrcClk/Baudrate/(Imme+2*Dnfsum+SclTime)
+ *                     I2cSrcClk -- I2c source clock
+ *                     Baudrate -- baudrate of i2c
+ *                     SclTime  -- =(SCL rising time + SCL falling time)/period of i2c clock
+ *                                 according to i2c bus hardware parameter.
+ *                     Dnfsum   -- 0 if digital filter off;
+ *                                 Filter capacity if digital filter on(1 ~ 4)
+ *                     Imme     -- A Immediate data, 68
+ *              step2: chose a division item which is similar and bigger than div from @ref I2C_Clock_Division.
+ *         @arg pstcI2cInit->u32Baudrate : Baudrate configuration
+ *         @arg pstcI2cInit->u32SclTime : Indicate SCL pin rising and falling
+ *              time, should be number of T(i2c clock period time)
+ * @param [out] pf32Error           Baudrate error
+ * @retval int32_t
+ *         - LL_OK:                 Success
+ *         - LL_ERR_TIMEOUT:        Failed
+ *         - LL_ERR_INVD_PARAM:     Parameter error
+ * @note  I2C_BaudrateConfigPpm() does the same without floating point.
+ */
+int32_t I2C_BaudrateConfig(CM_I2C_TypeDef *I2Cx, const stc_i2c_init_t *pstcI2cInit, float32_t *pf32Error)
+{
+    int32_t i32ErrorPpm;
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+
+    if (NULL != pf32Error) {
+        i32Ret = I2C_BaudrateConfigPpm(I2Cx, pstcI2cInit, &i32ErrorPpm);
+        if (LL_OK == i32Ret) {
+            *pf32Error = (float32_t)i32ErrorPpm * 1.0E-6F;
+        }
     }
 
     return i32Ret;
@@ -362,7 +409,7 @@ void I2C_DeInit(CM_I2C_TypeDef *I2Cx)
  *         @arg pstcI2cInit->u32Baudrate : Baudrate configuration
  *         @arg pstcI2cInit->u32SclTime : Indicate SCL pin rising and falling
  *              time, should be number of T(i2c clock period time)
- * @param [out] pf32Error           Baudrate error
+ * @param [out] pf32Error           Baudrate error, NULL if not needed
  * @retval int32_t
  *         - LL_OK:                 Success
  *         - LL_ERR_TIMEOUT:        Failed
@@ -370,6 +417,7 @@ void I2C_DeInit(CM_I2C_TypeDef *I2Cx)
  */
 int32_t I2C_Init(CM_I2C_TypeDef *I2Cx, const stc_i2c_init_t *pstcI2cInit, float32_t *pf32Error)
 {
+    int32_t i32ErrorPpm;
     int32_t i32Ret;
 
     if (NULL == pstcI2cInit) {
@@ -385,8 +433,11 @@ int32_t I2C_Init(CM_I2C_TypeDef *I2Cx, const stc_i2c_init_t *pstcI2cInit, float3
         SET_REG32_BIT(I2Cx->CR1, I2C_CR1_SWRST);
         SET_REG32_BIT(I2Cx->CR1, I2C_CR1_PE);
 
-        /* I2C baudrate config */
-        i32Ret = I2C_BaudrateConfig(I2Cx, pstcI2cInit, pf32Error);
+        /* I2C baudrate config, floating point only for the error asked for */
+        i32Ret = I2C_BaudrateConfigPpm(I2Cx, pstcI2cInit, &i32ErrorPpm);
+        if ((LL_OK == i32Ret) && (NULL != pf32Error)) {
+            *pf32Error = (float32_t)i32ErrorPpm * 1.0E-6F;
+        }
 
         /* Disable global broadcast address function */
         CLR_REG32_BIT(I2Cx->CR1, I2C_CR1_GCEN);
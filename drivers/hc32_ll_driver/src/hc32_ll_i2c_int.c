@@ -0,0 +1,639 @@
+/**
+ *******************************************************************************
+ * @file  hc32_ll_i2c_int.c
+ * @brief This file provides firmware functions to manage the I2C master
+ *        transactions driven by the EEI/RXI/TXI/TEI interrupts.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-16       CDT             First version
+   2026-10-17       CDT             Use LL_ENTER_CRITICAL()/LL_EXIT_CRITICAL()
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2022-2023, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_ll_i2c_int.h"
+#include "hc32_ll_i2c.h"
+#include "hc32_ll_interrupts.h"
+#include "hc32_ll_utility.h"
+
+/**
+ * @addtogroup LL_Driver
+ * @{
+ */
+
+/**
+ * @defgroup LL_I2C_INT I2C_INT
+ * @brief I2C Interrupt-driven Master Transaction Driver Library
+ * @{
+ */
+
+#if (LL_I2C_INT_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @defgroup I2C_INT_Local_Types I2C Interrupt Local Types
+ * @{
+ */
+
+/**
+ * @brief I2C interrupt driver control block definition
+ * @note  The running transaction is the queue head.
+ */
+typedef struct {
+    stc_i2c_int_trans_t *pstcHead;
+    stc_i2c_int_trans_t *pstcTail;
+    uint32_t u32Phase;
+    uint32_t u32Index;
+    int32_t i32Result;
+} stc_i2c_int_ctrl_t;
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup I2C_INT_Local_Macros I2C Interrupt Local Macros
+ * @{
+ */
+
+/**
+ * @defgroup I2C_INT_Phase I2C Interrupt Transaction Phase
+ * @{
+ */
+#define I2C_INT_PHASE_IDLE              (0UL)   /*!< No transaction */
+#define I2C_INT_PHASE_START_TX          (1UL)   /*!< Start sent, address with write bit follows */
+#define I2C_INT_PHASE_TX                (2UL)   /*!< Writing data */
+#define I2C_INT_PHASE_START_RX          (3UL)   /*!< (Re)start sent, address with read bit follows */
+#define I2C_INT_PHASE_ADDR_RX           (4UL)   /*!< Address with read bit sent, waiting for the first data */
+#define I2C_INT_PHASE_RX                (5UL)   /*!< Reading data */
+#define I2C_INT_PHASE_STOP              (6UL)   /*!< Stop sent */
+/**
+ * @}
+ */
+
+#define I2C_INT_IRQ_NUM                 (4U)
+
+/* Interrupts owned by this driver in CR2 */
+#define I2C_INT_MASTER_ALL                                                     \
+(   I2C_INT_START | I2C_INT_TX_CPLT | I2C_INT_STOP | I2C_INT_RX_FULL |         \
+    I2C_INT_TX_EMPTY | I2C_INT_ARBITRATE_FAIL | I2C_INT_NACK)
+
+#define I2C_INT_SET(_UNITx_, ints)      MODIFY_REG32((_UNITx_)->CR2, I2C_INT_MASTER_ALL, (ints))
+
+/**
+ * @defgroup I2C_INT_Check_Parameters_Validity I2C Interrupt Check Parameters Validity
+ * @{
+ */
+#define IS_I2C_INT_UNIT(x)              ((x) == CM_I2C)
+
+#define IS_I2C_INT_7BIT_ADDR(x)         ((x) <= 0x7FU)
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+#if (LL_INTERRUPTS_ENABLE == DDL_ON)
+static void I2C_Int_Eei_IrqCallback(void);
+static void I2C_Int_Rxi_IrqCallback(void);
+static void I2C_Int_Txi_IrqCallback(void);
+static void I2C_Int_Tei_IrqCallback(void);
+#endif /* LL_INTERRUPTS_ENABLE */
+
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+/**
+ * @defgroup I2C_INT_Local_Variables I2C Interrupt Local Variables
+ * @{
+ */
+static stc_i2c_int_ctrl_t m_stcI2cIntCtrl;
+
+#if (LL_INTERRUPTS_ENABLE == DDL_ON)
+static const en_int_src_t m_aenI2cIntSrc[I2C_INT_IRQ_NUM] = {
+    INT_SRC_I2C_EEI, INT_SRC_I2C_RXI, INT_SRC_I2C_TXI, INT_SRC_I2C_TEI
+};
+
+static const func_ptr_t m_apfnI2cIntIrqCallback[I2C_INT_IRQ_NUM] = {
+    &I2C_Int_Eei_IrqCallback, &I2C_Int_Rxi_IrqCallback, &I2C_Int_Txi_IrqCallback, &I2C_Int_Tei_IrqCallback
+};
+#endif /* LL_INTERRUPTS_ENABLE */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @defgroup I2C_INT_Local_Functions I2C Interrupt Local Functions
+ * @{
+ */
+
+#if (LL_INTERRUPTS_ENABLE == DDL_ON)
+static void I2C_Int_Eei_IrqCallback(void)
+{
+    I2C_Int_EeiIrqHandler(CM_I2C);
+}
+
+static void I2C_Int_Rxi_IrqCallback(void)
+{
+    I2C_Int_RxiIrqHandler(CM_I2C);
+}
+
+static void I2C_Int_Txi_IrqCallback(void)
+{
+    I2C_Int_TxiIrqHandler(CM_I2C);
+}
+
+static void I2C_Int_Tei_IrqCallback(void)
+{
+    I2C_Int_TeiIrqHandler(CM_I2C);
+}
+#endif /* LL_INTERRUPTS_ENABLE */
+
+/**
+ * @brief  Configure the ACK bit for the read phase.
+ * @param  [in] I2Cx                Pointer to I2C instance register base.
+ * @param  [in] u32RxLen            Number of bytes to read.
+ * @retval None
+ * @note   With fast ACK (FACKEN = 0) the ACK bit is sampled when a byte is received,
+ *         so a single byte read must be NACKed before it arrives.
+ */
+static void I2C_Int_RxAckConfig(CM_I2C_TypeDef *I2Cx, uint32_t u32RxLen)
+{
+    if ((1UL == u32RxLen) && (0UL == READ_REG32_BIT(I2Cx->CR1, I2C_CR1_FACKEN))) {
+        I2C_AckConfig(I2Cx, I2C_NACK);
+    } else {
+        I2C_AckConfig(I2Cx, I2C_ACK);
+    }
+}
+
+/**
+ * @brief  Start the transaction at the queue head.
+ * @param  [in] I2Cx                Pointer to I2C instance register base.
+ * @retval None
+ */
+static void I2C_Int_StartHead(CM_I2C_TypeDef *I2Cx)
+{
+    const stc_i2c_int_trans_t *pstcTrans = m_stcI2cIntCtrl.pstcHead;
+
+    m_stcI2cIntCtrl.u32Index = 0UL;
+    m_stcI2cIntCtrl.i32Result = LL_OK;
+    if (0UL != pstcTrans->u32TxLen) {
+        m_stcI2cIntCtrl.u32Phase = I2C_INT_PHASE_START_TX;
+    } else {
+        m_stcI2cIntCtrl.u32Phase = I2C_INT_PHASE_START_RX;
+        I2C_Int_RxAckConfig(I2Cx, pstcTrans->u32RxLen);
+    }
+
+    I2C_ClearStatus(I2Cx, I2C_FLAG_CLR_ALL);
+    I2C_INT_SET(I2Cx, I2C_INT_START | I2C_INT_ARBITRATE_FAIL);
+    /* The start condition is held off by hardware until the bus is free */
+    I2C_GenerateStart(I2Cx);
+}
+
+/**
+ * @brief  Send a stop condition, the transaction ends on the stop flag.
+ * @param  [in] I2Cx                Pointer to I2C instance register base.
+ * @retval None
+ */
+static void I2C_Int_Stop(CM_I2C_TypeDef *I2Cx)
+{
+    m_stcI2cIntCtrl.u32Phase = I2C_INT_PHASE_STOP;
+    I2C_INT_SET(I2Cx, I2C_INT_STOP);
+    I2C_ClearStatus(I2Cx, I2C_FLAG_STOP);
+    I2C_GenerateStop(I2Cx);
+}
+
+/**
+ * @brief  Complete the transaction at the queue head and start the next one.
+ * @param  [in] I2Cx                Pointer to I2C instance register base.
+ * @param  [in] i32Result           Transaction result.
+ * @retval None
+ */
+static void I2C_Int_Finish(CM_I2C_TypeDef *I2Cx, int32_t i32Result)
+{
+    stc_i2c_int_trans_t *pstcTrans = m_stcI2cIntCtrl.pstcHead;
+
+    I2C_INT_SET(I2Cx, 0UL);
+    I2C_AckConfig(I2Cx, I2C_ACK);
+    m_stcI2cIntCtrl.u32Phase = I2C_INT_PHASE_IDLE;
+
+    if (NULL != pstcTrans) {
+        m_stcI2cIntCtrl.pstcHead = pstcTrans->pstcNext;
+        if (NULL == m_stcI2cIntCtrl.pstcHead) {
+            m_stcI2cIntCtrl.pstcTail = NULL;
+        } else {
+            /* Keep the bus busy before the callback runs */
+            I2C_Int_StartHead(I2Cx);
+        }
+
+        pstcTrans->pstcNext = NULL;
+        pstcTrans->i32Result = i32Result;
+        if (NULL != pstcTrans->pfnCallback) {
+            pstcTrans->pfnCallback(pstcTrans);
+        }
+    }
+}
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup I2C_INT_Global_Functions I2C Interrupt Global Functions
+ * @{
+ */
+
+/**
+ * @brief  Initialize the interrupt-driven master transaction driver.
+ * @param  [in] I2Cx                Pointer to I2C instance register base.
+ *                                  This parameter can be a value of the following:
+ *         @arg CM_I2C or CM_I2Cx:  I2C instance register base.
+ * @retval int32_t:
+ *         - LL_OK:                 Success
+ * @note   Call I2C_Init() first, this function enables the I2C peripheral.
+ */
+int32_t I2C_Int_Init(CM_I2C_TypeDef *I2Cx)
+{
+    DDL_ASSERT(IS_I2C_INT_UNIT(I2Cx));
+
+    I2C_INT_SET(I2Cx, 0UL);
+    m_stcI2cIntCtrl.pstcHead = NULL;
+    m_stcI2cIntCtrl.pstcTail = NULL;
+    m_stcI2cIntCtrl.u32Phase = I2C_INT_PHASE_IDLE;
+    m_stcI2cIntCtrl.u32Index = 0UL;
+    I2C_Cmd(I2Cx, ENABLE);
+
+    return LL_OK;
+}
+
+/**
+ * @brief  De-initialize the interrupt-driven master transaction driver.
+ * @param  [in] I2Cx                Pointer to I2C instance register base.
+ *                                  This parameter can be a value of the following:
+ *         @arg CM_I2C or CM_I2Cx:  I2C instance register base.
+ * @retval None
+ * @note   Queued transactions are dropped without callback.
+ */
+void I2C_Int_DeInit(CM_I2C_TypeDef *I2Cx)
+{
+    DDL_ASSERT(IS_I2C_INT_UNIT(I2Cx));
+
+    I2C_INT_SET(I2Cx, 0UL);
+    I2C_Cmd(I2Cx, DISABLE);
+    m_stcI2cIntCtrl.pstcHead = NULL;
+    m_stcI2cIntCtrl.pstcTail = NULL;
+    m_stcI2cIntCtrl.u32Phase = I2C_INT_PHASE_IDLE;
+}
+
+#if (LL_INTERRUPTS_ENABLE == DDL_ON)
+/**
+ * @brief  Register the EEI/RXI/TXI/TEI interrupt sources and enable the NVIC IRQs.
+ * @param  [in] I2Cx                Pointer to I2C instance register base.
+ *                                  This parameter can be a value of the following:
+ *         @arg CM_I2C or CM_I2Cx:  I2C instance register base.
+ * @param  [in] pstcIrq             Pointer to a @ref stc_i2c_int_irq_t structure.
+ * @retval int32_t:
+ *         - LL_OK:                 Success
+ *         - LL_ERR_INVD_PARAM:     pstcIrq is NULL or an IRQ number doesn't match the interrupt source.
+ * @note   INTC registers must be unlocked, @ref LL_PERIPH_WE for details.
+ * @note   To use the share IRQ handlers IRQ024~IRQ031 instead, enable the sources with
+ *         INTC_ShareIrqCmd() and call I2C_Int_xxxIrqHandler() from the I2C_xxx_IrqHandler() hooks.
+ */
+int32_t I2C_Int_IrqSignIn(CM_I2C_TypeDef *I2Cx, const stc_i2c_int_irq_t *pstcIrq)
+{
+    uint32_t i;
+    IRQn_Type aenIRQn[I2C_INT_IRQ_NUM];
+    stc_irq_signin_config_t stcIrqSignConfig;
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+
+    DDL_ASSERT(IS_I2C_INT_UNIT(I2Cx));
+    (void)I2Cx;
+
+    if (NULL != pstcIrq) {
+        aenIRQn[0] = pstcIrq->enEeiIRQn;
+        aenIRQn[1] = pstcIrq->enRxiIRQn;
+        aenIRQn[2] = pstcIrq->enTxiIRQn;
+        aenIRQn[3] = pstcIrq->enTeiIRQn;
+
+        for (i = 0UL; i < I2C_INT_IRQ_NUM; i++) {
+            stcIrqSignConfig.enIntSrc = m_aenI2cIntSrc[i];
+            stcIrqSignConfig.enIRQn = aenIRQn[i];
+            stcIrqSignConfig.pfnCallback = m_apfnI2cIntIrqCallback[i];
+            i32Ret = INTC_IrqSignIn(&stcIrqSignConfig);
+            if (LL_OK != i32Ret) {
+                break;
+            }
+            NVIC_ClearPendingIRQ(aenIRQn[i]);
+            NVIC_SetPriority(aenIRQn[i], pstcIrq->u32IrqPrio);
+            NVIC_EnableIRQ(aenIRQn[i]);
+        }
+    }
+
+    return i32Ret;
+}
+#endif /* LL_INTERRUPTS_ENABLE */
+
+/**
+ * @brief  Set the fields of structure stc_i2c_int_trans_t to default values.
+ * @param  [out] pstcTrans          Pointer to a @ref stc_i2c_int_trans_t structure.
+ * @retval int32_t:
+ *         - LL_OK:                 Success
+ *         - LL_ERR_INVD_PARAM:     pstcTrans is NULL.
+ */
+int32_t I2C_Int_TransStructInit(stc_i2c_int_trans_t *pstcTrans)
+{
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+
+    if (NULL != pstcTrans) {
+        pstcTrans->u16SlaveAddr = 0U;
+        pstcTrans->pu8TxBuf = NULL;
+        pstcTrans->u32TxLen = 0UL;
+        pstcTrans->pu8RxBuf = NULL;
+        pstcTrans->u32RxLen = 0UL;
+        pstcTrans->pfnCallback = NULL;
+        pstcTrans->pvUserData = NULL;
+        pstcTrans->i32Result = LL_OK;
+        pstcTrans->pstcNext = NULL;
+        i32Ret = LL_OK;
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Queue a master transaction, it is started at once if the driver is idle.
+ * @param  [in] I2Cx                Pointer to I2C instance register base.
+ *                                  This parameter can be a value of the following:
+ *         @arg CM_I2C or CM_I2Cx:  I2C instance register base.
+ * @param  [in] pstcTrans           Pointer to a @ref stc_i2c_int_trans_t structure.
+ * @retval int32_t:
+ *         - LL_OK:                 Transaction queued.
+ *         - LL_ERR_INVD_PARAM:     pstcTrans is NULL, has no data or a NULL buffer.
+ *         - LL_ERR_BUSY:           pstcTrans is already queued.
+ * @note   May be called from thread code, IRQ handlers and the completion callbacks.
+ */
+int32_t I2C_Int_Submit(CM_I2C_TypeDef *I2Cx, stc_i2c_int_trans_t *pstcTrans)
+{
+    uint32_t u32Primask;
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+
+    DDL_ASSERT(IS_I2C_INT_UNIT(I2Cx));
+
+    if ((NULL != pstcTrans) && ((0UL != pstcTrans->u32TxLen) || (0UL != pstcTrans->u32RxLen)) &&
+        ((0UL == pstcTrans->u32TxLen) || (NULL != pstcTrans->pu8TxBuf)) &&
+        ((0UL == pstcTrans->u32RxLen) || (NULL != pstcTrans->pu8RxBuf))) {
+        DDL_ASSERT(IS_I2C_INT_7BIT_ADDR(pstcTrans->u16SlaveAddr));
+
+        LL_ENTER_CRITICAL(u32Primask);
+        if (LL_ERR_BUSY == pstcTrans->i32Result) {
+            i32Ret = LL_ERR_BUSY;
+        } else {
+            pstcTrans->i32Result = LL_ERR_BUSY;
+            pstcTrans->pstcNext = NULL;
+            if (NULL == m_stcI2cIntCtrl.pstcHead) {
+                m_stcI2cIntCtrl.pstcHead = pstcTrans;
+                m_stcI2cIntCtrl.pstcTail = pstcTrans;
+                I2C_Int_StartHead(I2Cx);
+            } else {
+                m_stcI2cIntCtrl.pstcTail->pstcNext = pstcTrans;
+                m_stcI2cIntCtrl.pstcTail = pstcTrans;
+            }
+            i32Ret = LL_OK;
+        }
+        LL_EXIT_CRITICAL(u32Primask);
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Abort the running transaction with a stop condition.
+ * @param  [in] I2Cx                Pointer to I2C instance register base.
+ *                                  This parameter can be a value of the following:
+ *         @arg CM_I2C or CM_I2Cx:  I2C instance register base.
+ * @retval None
+ * @note   Intended for an application timeout, the transaction completes with LL_ERR_TIMEOUT
+ *         and the next queued one is started.
+ */
+void I2C_Int_Abort(CM_I2C_TypeDef *I2Cx)
+{
+    uint32_t u32Primask;
+
+    DDL_ASSERT(IS_I2C_INT_UNIT(I2Cx));
+
+    LL_ENTER_CRITICAL(u32Primask);
+    if (NULL != m_stcI2cIntCtrl.pstcHead) {
+        I2C_INT_SET(I2Cx, 0UL);
+        if (0UL != READ_REG32_BIT(I2Cx->SR, I2C_FLAG_MASTER)) {
+            I2C_GenerateStop(I2Cx);
+        }
+        I2C_Int_Finish(I2Cx, LL_ERR_TIMEOUT);
+    }
+    LL_EXIT_CRITICAL(u32Primask);
+}
+
+/**
+ * @brief  Get the driver state.
+ * @param  [in] I2Cx                Pointer to I2C instance register base.
+ *                                  This parameter can be a value of the following:
+ *         @arg CM_I2C or CM_I2Cx:  I2C instance register base.
+ * @retval An @ref en_flag_status_t enumeration value:
+ *           - SET:                 A transaction is running or queued.
+ *           - RESET:               Idle.
+ */
+en_flag_status_t I2C_Int_GetBusy(const CM_I2C_TypeDef *I2Cx)
+{
+    DDL_ASSERT(IS_I2C_INT_UNIT(I2Cx));
+    (void)I2Cx;
+
+    return (NULL == m_stcI2cIntCtrl.pstcHead) ? RESET : SET;
+}
+
+/**
+ * @brief  I2C event and error(INT_SRC_I2C_EEI) IRQ handler.
+ * @param  [in] I2Cx                Pointer to I2C instance register base.
+ *                                  This parameter can be a value of the following:
+ *         @arg CM_I2C or CM_I2Cx:  I2C instance register base.
+ * @retval None
+ * @note   Handles start, NACK, arbitration lost and stop.
+ */
+void I2C_Int_EeiIrqHandler(CM_I2C_TypeDef *I2Cx)
+{
+    uint32_t u32Status;
+    const stc_i2c_int_trans_t *pstcTrans = m_stcI2cIntCtrl.pstcHead;
+
+    /* The SR event flags and their CR2 interrupt enable bits share the same positions */
+    u32Status = READ_REG32(I2Cx->SR) & READ_REG32(I2Cx->CR2);
+
+    if (0UL != (u32Status & I2C_FLAG_ARBITRATE_FAIL)) {
+        /* The bus belongs to another master, no stop condition */
+        I2C_ClearStatus(I2Cx, I2C_FLAG_ARBITRATE_FAIL | I2C_FLAG_START | I2C_FLAG_NACKF);
+        I2C_Int_Finish(I2Cx, LL_ERR);
+    } else if (0UL != (u32Status & I2C_FLAG_NACKF)) {
+        I2C_ClearStatus(I2Cx, I2C_FLAG_NACKF);
+        if (I2C_INT_PHASE_RX != m_stcI2cIntCtrl.u32Phase) {
+            if (I2C_INT_PHASE_TX == m_stcI2cIntCtrl.u32Phase) {
+                /* Read DRR register to release SCL */
+                (void)I2C_ReadData(I2Cx);
+            }
+            m_stcI2cIntCtrl.i32Result = LL_ERR;
+            I2C_Int_Stop(I2Cx);
+        }
+        /* else: the NACK of the last read byte is generated by the master itself */
+    } else if (0UL != (u32Status & I2C_FLAG_START)) {
+        I2C_ClearStatus(I2Cx, I2C_FLAG_START);
+        if (I2C_INT_PHASE_START_TX == m_stcI2cIntCtrl.u32Phase) {
+            m_stcI2cIntCtrl.u32Phase = I2C_INT_PHASE_TX;
+            I2C_INT_SET(I2Cx, I2C_INT_TX_EMPTY | I2C_INT_NACK | I2C_INT_ARBITRATE_FAIL);
+            I2C_WriteData(I2Cx, (uint8_t)(pstcTrans->u16SlaveAddr << 1U) | I2C_DIR_TX);
+        } else {
+            m_stcI2cIntCtrl.u32Phase = I2C_INT_PHASE_ADDR_RX;
+            I2C_INT_SET(I2Cx, I2C_INT_RX_FULL | I2C_INT_NACK | I2C_INT_ARBITRATE_FAIL);
+            I2C_WriteData(I2Cx, (uint8_t)(pstcTrans->u16SlaveAddr << 1U) | I2C_DIR_RX);
+        }
+    } else if (0UL != (u32Status & I2C_FLAG_STOP)) {
+        I2C_ClearStatus(I2Cx, I2C_FLAG_STOP);
+        I2C_Int_Finish(I2Cx, m_stcI2cIntCtrl.i32Result);
+    } else {
+        /* reserved */
+    }
+}
+
+/**
+ * @brief  I2C receive buffer full(INT_SRC_I2C_RXI) IRQ handler.
+ * @param  [in] I2Cx                Pointer to I2C instance register base.
+ *                                  This parameter can be a value of the following:
+ *         @arg CM_I2C or CM_I2Cx:  I2C instance register base.
+ * @retval None
+ */
+void I2C_Int_RxiIrqHandler(CM_I2C_TypeDef *I2Cx)
+{
+    uint32_t u32Index = m_stcI2cIntCtrl.u32Index;
+    const stc_i2c_int_trans_t *pstcTrans = m_stcI2cIntCtrl.pstcHead;
+
+    if ((NULL != pstcTrans) && (u32Index < pstcTrans->u32RxLen)) {
+        m_stcI2cIntCtrl.u32Phase = I2C_INT_PHASE_RX;
+        /* Same ACK handling as I2C_MasterReceiveDataAndStop() */
+        if (0UL == READ_REG32_BIT(I2Cx->CR1, I2C_CR1_FACKEN)) {
+            if ((pstcTrans->u32RxLen >= 2UL) && (u32Index == (pstcTrans->u32RxLen - 2UL))) {
+                I2C_AckConfig(I2Cx, I2C_NACK);
+            }
+        } else {
+            if (u32Index != (pstcTrans->u32RxLen - 1UL)) {
+                I2C_AckConfig(I2Cx, I2C_ACK);
+            } else {
+                I2C_AckConfig(I2Cx, I2C_NACK);
+            }
+        }
+
+        if (u32Index == (pstcTrans->u32RxLen - 1UL)) {
+            /* Stop before read last data */
+            I2C_Int_Stop(I2Cx);
+        }
+        pstcTrans->pu8RxBuf[u32Index] = I2C_ReadData(I2Cx);
+        m_stcI2cIntCtrl.u32Index = u32Index + 1UL;
+    } else {
+        (void)I2C_ReadData(I2Cx);
+    }
+}
+
+/**
+ * @brief  I2C transmit buffer empty(INT_SRC_I2C_TXI) IRQ handler.
+ * @param  [in] I2Cx                Pointer to I2C instance register base.
+ *                                  This parameter can be a value of the following:
+ *         @arg CM_I2C or CM_I2Cx:  I2C instance register base.
+ * @retval None
+ */
+void I2C_Int_TxiIrqHandler(CM_I2C_TypeDef *I2Cx)
+{
+    uint32_t u32Index = m_stcI2cIntCtrl.u32Index;
+    const stc_i2c_int_trans_t *pstcTrans = m_stcI2cIntCtrl.pstcHead;
+
+    if ((NULL != pstcTrans) && (I2C_INT_PHASE_TX == m_stcI2cIntCtrl.u32Phase)) {
+        I2C_WriteData(I2Cx, pstcTrans->pu8TxBuf[u32Index]);
+        u32Index++;
+        m_stcI2cIntCtrl.u32Index = u32Index;
+        if (u32Index == pstcTrans->u32TxLen) {
+            /* Last byte written: wait for the transfer end, TENDF was cleared by the write */
+            I2C_INT_SET(I2Cx, I2C_INT_TX_CPLT | I2C_INT_NACK | I2C_INT_ARBITRATE_FAIL);
+        }
+    } else {
+        CLR_REG32_BIT(I2Cx->CR2, I2C_INT_TX_EMPTY);
+    }
+}
+
+/**
+ * @brief  I2C transfer end(INT_SRC_I2C_TEI) IRQ handler.
+ * @param  [in] I2Cx                Pointer to I2C instance register base.
+ *                                  This parameter can be a value of the following:
+ *         @arg CM_I2C or CM_I2Cx:  I2C instance register base.
+ * @retval None
+ */
+void I2C_Int_TeiIrqHandler(CM_I2C_TypeDef *I2Cx)
+{
+    const stc_i2c_int_trans_t *pstcTrans = m_stcI2cIntCtrl.pstcHead;
+
+    /* A NACK of the last byte is handled by the EEI handler */
+    if ((NULL != pstcTrans) && (I2C_INT_PHASE_TX == m_stcI2cIntCtrl.u32Phase) &&
+        (0UL == READ_REG32_BIT(I2Cx->SR, I2C_FLAG_NACKF | I2C_FLAG_ACKR))) {
+        if (0UL != pstcTrans->u32RxLen) {
+            /* Write then read: repeated start */
+            m_stcI2cIntCtrl.u32Phase = I2C_INT_PHASE_START_RX;
+            m_stcI2cIntCtrl.u32Index = 0UL;
+            I2C_Int_RxAckConfig(I2Cx, pstcTrans->u32RxLen);
+            I2C_INT_SET(I2Cx, I2C_INT_START | I2C_INT_ARBITRATE_FAIL);
+            I2C_ClearStatus(I2Cx, I2C_FLAG_START);
+            I2C_GenerateRestart(I2Cx);
+        } else {
+            I2C_Int_Stop(I2Cx);
+        }
+    }
+}
+
+/**
+ * @}
+ */
+
+#endif /* LL_I2C_INT_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
@@ -0,0 +1,625 @@
+/**
+ *******************************************************************************
+ * @file  hc32_ll_intc_stat.c
+ * @brief This file provides firmware functions of the interrupt timing
+ *        statistics.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-17       CDT             First version
+                                    Use LL_ENTER_CRITICAL()/LL_EXIT_CRITICAL()
+                                    Fast path for the handlers of unattached vectors
+                                    Count the IRQ entries without latency in u32Unseen
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2022-2023, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_ll_intc_stat.h"
+#include "hc32_ll_usart.h"
+#include "hc32_ll_utility.h"
+
+/**
+ * @addtogroup LL_Driver
+ * @{
+ */
+
+/**
+ * @defgroup LL_INTC_STAT INTC_STAT
+ * @brief Interrupt Timing Statistics
+ * @note  The handlers of IRQ008 ~ IRQ031 are instrumented by the driver, SysTick_Handler()
+ *        and EXTINTxx_Handler() by the application with INTC_STAT_IRQ_ENTER() and
+ *        INTC_STAT_IRQ_EXIT(). Only the vectors attached by INTC_STAT_Attach() are counted.
+ *        The handler of an unattached vector costs a table lookup and, while IRQs are
+ *        attached, an NVIC->ISPR read. It reads the time only when an attached IRQ is
+ *        newly pending.
+ * @note  The time base is SysTick: the tick count of SysTick_GetTick() and the cycles of
+ *        SysTick->VAL. SysTick_Init() must run at a rate which divides 1000, call
+ *        INTC_STAT_Init() again when HCLK changes.
+ * @{
+ */
+
+#if (LL_INTC_STAT_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup INTC_STAT_Local_Macros INTC_STAT Local Macros
+ * @{
+ */
+#define INTC_STAT_VECT_NUM              ((uint32_t)INT031_IRQn - (uint32_t)SysTick_IRQn + 1UL)
+#define INTC_STAT_VECT_IDX(irqn)        ((uint32_t)((int32_t)(irqn) - (int32_t)SysTick_IRQn))
+
+#define INTC_STAT_BIN_MAX               (0xFFFFU)
+#define INTC_STAT_LINE_LEN              (192U)
+
+/**
+ * @defgroup INTC_STAT_Check_Parameters_Validity INTC_STAT Check Parameters Validity
+ * @{
+ */
+#define IS_INTC_STAT_IRQN(x)            (((x) >= SysTick_IRQn) && ((x) <= INT031_IRQn))
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @defgroup INTC_STAT_Local_Types INTC_STAT Local Types
+ * @{
+ */
+
+/**
+ * @brief INTC_STAT handler in progress structure definition
+ */
+typedef struct {
+    IRQn_Type enIRQn;                   /*!< Vector. */
+    uint32_t u32Entry;                  /*!< Entry time. */
+    uint32_t u32Nested;                 /*!< Cycles of the nested instrumented handlers. */
+} stc_intc_stat_frame_t;
+
+/**
+ * @brief INTC_STAT control structure definition
+ */
+typedef struct {
+    stc_intc_stat_t *apstcStat[INTC_STAT_VECT_NUM];     /*!< Attached statistics by vector. */
+    uint32_t u32IrqMask;                /*!< Attached IRQ0 ~ IRQ31. */
+    uint32_t u32PendSeen;               /*!< Attached IRQs seen pending, u32PendTime is valid. */
+    uint32_t u32CyclePerMs;             /*!< SysTick cycles per tick count. */
+    uint32_t u32Depth;                  /*!< Handlers in progress. */
+    stc_intc_stat_frame_t astcFrame[INTC_STAT_NEST_MAX];    /*!< Handlers in progress. */
+} stc_intc_stat_ctrl_t;
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+/**
+ * @defgroup INTC_STAT_Local_Variables INTC_STAT Local Variables
+ * @{
+ */
+static stc_intc_stat_ctrl_t m_stcIntcStat;
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @defgroup INTC_STAT_Local_Functions INTC_STAT Local Functions
+ * @{
+ */
+
+/**
+ * @brief  Get the time in SysTick cycles.
+ * @param  None
+ * @retval Time, wraps around: compare times by difference.
+ * @note   Called with the interrupts masked, so the tick count is stable. A reload whose
+ *         interrupt is pending is counted.
+ */
+static uint32_t INTC_STAT_Now(void)
+{
+    const uint32_t u32Load = SysTick->LOAD;
+    const uint32_t u32Tick = SysTick_GetTick();
+    uint32_t u32Val = SysTick->VAL;
+    uint32_t u32Pending = 0UL;
+
+    if (0UL != (SCB->ICSR & SCB_ICSR_PENDSTSET_Msk)) {
+        /* The counter reloaded: read VAL again, after the reload */
+        u32Val = SysTick->VAL;
+        u32Pending = u32Load + 1UL;
+    }
+    return (u32Tick * m_stcIntcStat.u32CyclePerMs) + u32Pending + (u32Load - u32Val);
+}
+
+/**
+ * @brief  Get the attached IRQs pending and not seen yet.
+ * @param  None
+ * @retval IRQ0 ~ IRQ31 bit mask
+ */
+static uint32_t INTC_STAT_NewPending(void)
+{
+    uint32_t u32New = 0UL;
+
+    if (0UL != m_stcIntcStat.u32IrqMask) {
+        u32New = NVIC->ISPR[0U] & m_stcIntcStat.u32IrqMask & ~m_stcIntcStat.u32PendSeen;
+    }
+    return u32New;
+}
+
+/**
+ * @brief  Note the time the attached IRQs are first seen pending.
+ * @param  [in] u32Now                  Time
+ * @retval None
+ */
+static void INTC_STAT_ScanPending(uint32_t u32Now)
+{
+    uint32_t u32New = INTC_STAT_NewPending();
+    uint32_t i;
+
+    m_stcIntcStat.u32PendSeen |= u32New;
+    for (i = 0UL; 0UL != u32New; i++) {
+        if (0UL != (u32New & (1UL << i))) {
+            u32New &= ~(1UL << i);
+            m_stcIntcStat.apstcStat[INTC_STAT_VECT_IDX(i)]->u32PendTime = u32Now;
+        }
+    }
+}
+
+/**
+ * @brief  Count a time.
+ * @param  [in] pstcTime                Pointer to the statistics
+ * @param  [in] u32Cycle                Time
+ * @retval None
+ */
+static void INTC_STAT_Record(stc_intc_stat_time_t *pstcTime, uint32_t u32Cycle)
+{
+    uint32_t u32Bin = 0UL;
+
+    while (((u32Cycle >> (u32Bin + 1UL)) != 0UL) && (u32Bin < (INTC_STAT_HIST_NUM - 1UL))) {
+        u32Bin++;
+    }
+    if (INTC_STAT_BIN_MAX != pstcTime->au16Hist[u32Bin]) {
+        pstcTime->au16Hist[u32Bin]++;
+    }
+    pstcTime->u32Count++;
+    pstcTime->u64Sum += u32Cycle;
+    if (u32Cycle < pstcTime->u32Min) {
+        pstcTime->u32Min = u32Cycle;
+    }
+    if (u32Cycle > pstcTime->u32Max) {
+        pstcTime->u32Max = u32Cycle;
+    }
+}
+
+/**
+ * @brief  Reset time statistics.
+ * @param  [out] pstcTime               Pointer to the statistics
+ * @retval None
+ */
+static void INTC_STAT_ResetTime(stc_intc_stat_time_t *pstcTime)
+{
+    uint32_t i;
+
+    pstcTime->u32Count = 0UL;
+    pstcTime->u32Min = 0xFFFFFFFFUL;
+    pstcTime->u32Max = 0UL;
+    pstcTime->u64Sum = 0ULL;
+    for (i = 0UL; i < INTC_STAT_HIST_NUM; i++) {
+        pstcTime->au16Hist[i] = 0U;
+    }
+}
+
+#if (LL_USART_ENABLE == DDL_ON)
+/**
+ * @brief  Append text to a dump line.
+ * @param  [out] pcLine                 Line
+ * @param  [in] u32Len                  Characters in the line
+ * @param  [in] pcStr                   Text
+ * @retval Characters in the line
+ */
+static uint32_t INTC_STAT_PutStr(char *pcLine, uint32_t u32Len, const char *pcStr)
+{
+    while ('\0' != *pcStr) {
+        pcLine[u32Len++] = *pcStr++;
+    }
+    return u32Len;
+}
+
+/**
+ * @brief  Append a space and a decimal number to a dump line.
+ * @param  [out] pcLine                 Line
+ * @param  [in] u32Len                  Characters in the line
+ * @param  [in] u32Val                  Number
+ * @retval Characters in the line
+ */
+static uint32_t INTC_STAT_PutDec(char *pcLine, uint32_t u32Len, uint32_t u32Val)
+{
+    char acDigit[10U];
+    uint32_t u32Num = 0UL;
+
+    do {
+        acDigit[u32Num++] = (char)('0' + (u32Val % 10UL));
+        u32Val /= 10UL;
+    } while (0UL != u32Val);
+    pcLine[u32Len++] = ' ';
+    while (0UL != u32Num) {
+        pcLine[u32Len++] = acDigit[--u32Num];
+    }
+    return u32Len;
+}
+
+/**
+ * @brief  Start a dump line with time statistics.
+ * @param  [out] pcLine                 Line
+ * @param  [in] enIRQn                  Vector
+ * @param  [in] pcKind                  "exec" or "lat"
+ * @param  [in] pstcTime                Pointer to the statistics
+ * @retval Characters in the line
+ */
+static uint32_t INTC_STAT_PutTime(char *pcLine, IRQn_Type enIRQn, const char *pcKind,
+                                  const stc_intc_stat_time_t *pstcTime)
+{
+    uint32_t u32Len;
+    uint32_t i;
+
+    if (enIRQn < 0) {
+        u32Len = INTC_STAT_PutStr(pcLine, 0UL, "irq -1 ");
+    } else {
+        u32Len = INTC_STAT_PutStr(pcLine, 0UL, "irq");
+        u32Len = INTC_STAT_PutDec(pcLine, u32Len, (uint32_t)enIRQn);
+        pcLine[u32Len++] = ' ';
+    }
+    u32Len = INTC_STAT_PutStr(pcLine, u32Len, pcKind);
+    u32Len = INTC_STAT_PutDec(pcLine, u32Len, pstcTime->u32Count);
+    u32Len = INTC_STAT_PutDec(pcLine, u32Len, (0UL != pstcTime->u32Count) ? pstcTime->u32Min : 0UL);
+    u32Len = INTC_STAT_PutDec(pcLine, u32Len, INTC_STAT_GetMean(pstcTime));
+    u32Len = INTC_STAT_PutDec(pcLine, u32Len, pstcTime->u32Max);
+    u32Len = INTC_STAT_PutStr(pcLine, u32Len, " |");
+    for (i = 0UL; i < INTC_STAT_HIST_NUM; i++) {
+        u32Len = INTC_STAT_PutDec(pcLine, u32Len, pstcTime->au16Hist[i]);
+    }
+    return u32Len;
+}
+
+/**
+ * @brief  End a dump line and send it.
+ * @param  [in] USARTx                  Pointer to USART instance register base
+ * @param  [in] pcLine                  Line
+ * @param  [in] u32Len                  Characters in the line
+ * @param  [in] u32Timeout              Timeout of the transmission
+ * @retval int32_t:
+ *           - LL_OK:                   Sent.
+ *           - LL_ERR_TIMEOUT:          Timeout.
+ */
+static int32_t INTC_STAT_PutLine(CM_USART_TypeDef *USARTx, char *pcLine, uint32_t u32Len, uint32_t u32Timeout)
+{
+    pcLine[u32Len++] = '\r';
+    pcLine[u32Len++] = '\n';
+    return USART_UART_Trans(USARTx, pcLine, u32Len, u32Timeout);
+}
+#endif /* LL_USART_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup INTC_STAT_Global_Functions INTC_STAT Global Functions
+ * @{
+ */
+
+/**
+ * @brief  Initialize the statistics, all vectors detached.
+ * @param  None
+ * @retval int32_t:
+ *           - LL_OK:                   Initialize successfully.
+ *           - LL_ERR_NOT_RDY:          SysTick is not counting, SysTick_Init() first.
+ */
+int32_t INTC_STAT_Init(void)
+{
+    uint32_t u32Primask;
+    uint32_t i;
+    int32_t i32Ret = LL_ERR_NOT_RDY;
+
+    if (0UL != (SysTick->CTRL & SysTick_CTRL_ENABLE_Msk)) {
+        LL_ENTER_CRITICAL(u32Primask);
+        for (i = 0UL; i < INTC_STAT_VECT_NUM; i++) {
+            m_stcIntcStat.apstcStat[i] = NULL;
+        }
+        m_stcIntcStat.u32IrqMask = 0UL;
+        m_stcIntcStat.u32PendSeen = 0UL;
+        m_stcIntcStat.u32Depth = 0UL;
+        m_stcIntcStat.u32CyclePerMs = HCLK_VALUE / 1000UL;
+        LL_EXIT_CRITICAL(u32Primask);
+        i32Ret = LL_OK;
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Start counting a vector.
+ * @param  [in] enIRQn                  Vector, SysTick_IRQn ~ INT031_IRQn.
+ * @param  [in] pstcStat                Pointer to a @ref stc_intc_stat_t structure, cleared.
+ * @retval int32_t:
+ *           - LL_OK:                   Attached.
+ *           - LL_ERR_INVD_PARAM:       pstcStat is NULL or enIRQn out of range.
+ */
+int32_t INTC_STAT_Attach(IRQn_Type enIRQn, stc_intc_stat_t *pstcStat)
+{
+    uint32_t u32Primask;
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+
+    if ((NULL != pstcStat) && IS_INTC_STAT_IRQN(enIRQn)) {
+        INTC_STAT_ResetTime(&pstcStat->stcExec);
+        INTC_STAT_ResetTime(&pstcStat->stcLatency);
+        pstcStat->u32Unseen = 0UL;
+        pstcStat->u32PendTime = 0UL;
+        LL_ENTER_CRITICAL(u32Primask);
+        m_stcIntcStat.apstcStat[INTC_STAT_VECT_IDX(enIRQn)] = pstcStat;
+        if (enIRQn >= 0) {
+            m_stcIntcStat.u32IrqMask |= (1UL << (uint32_t)enIRQn);
+            m_stcIntcStat.u32PendSeen &= ~(1UL << (uint32_t)enIRQn);
+        }
+        LL_EXIT_CRITICAL(u32Primask);
+        i32Ret = LL_OK;
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Stop counting a vector, its statistics are kept.
+ * @param  [in] enIRQn                  Vector, SysTick_IRQn ~ INT031_IRQn.
+ * @retval None
+ */
+void INTC_STAT_Detach(IRQn_Type enIRQn)
+{
+    uint32_t u32Primask;
+
+    if (IS_INTC_STAT_IRQN(enIRQn)) {
+        LL_ENTER_CRITICAL(u32Primask);
+        m_stcIntcStat.apstcStat[INTC_STAT_VECT_IDX(enIRQn)] = NULL;
+        if (enIRQn >= 0) {
+            m_stcIntcStat.u32IrqMask &= ~(1UL << (uint32_t)enIRQn);
+        }
+        LL_EXIT_CRITICAL(u32Primask);
+    }
+}
+
+/**
+ * @brief  Handler entry, use INTC_STAT_IRQ_ENTER() instead.
+ * @param  [in] enIRQn                  Vector of the handler
+ * @retval None
+ * @note   The latency of SysTick is exact: the cycles since the counter reloaded. The
+ *         latency of an IRQ is the time since it was first seen pending at an entry or
+ *         exit of an instrumented handler: the time spent waiting behind the instrumented
+ *         handlers. An IRQ not seen pending adds no latency, it is counted in u32Unseen.
+ */
+void INTC_STAT_Enter(IRQn_Type enIRQn)
+{
+    stc_intc_stat_t *pstcStat;
+    stc_intc_stat_frame_t *pstcFrame;
+    uint32_t u32Primask;
+    uint32_t u32Now;
+
+    if (IS_INTC_STAT_IRQN(enIRQn) && (0UL != m_stcIntcStat.u32CyclePerMs)) {
+        /* Nothing to do for an unattached vector unless an attached IRQ is newly pending */
+        if ((NULL != m_stcIntcStat.apstcStat[INTC_STAT_VECT_IDX(enIRQn)]) || (0UL != INTC_STAT_NewPending())) {
+            LL_ENTER_CRITICAL(u32Primask);
+            u32Now = INTC_STAT_Now();
+            INTC_STAT_ScanPending(u32Now);
+            pstcStat = m_stcIntcStat.apstcStat[INTC_STAT_VECT_IDX(enIRQn)];
+            if ((NULL != pstcStat) && (m_stcIntcStat.u32Depth < INTC_STAT_NEST_MAX)) {
+                if (SysTick_IRQn == enIRQn) {
+                    INTC_STAT_Record(&pstcStat->stcLatency, SysTick->LOAD - SysTick->VAL);
+                } else if (0UL != (m_stcIntcStat.u32PendSeen & (1UL << (uint32_t)enIRQn))) {
+                    m_stcIntcStat.u32PendSeen &= ~(1UL << (uint32_t)enIRQn);
+                    INTC_STAT_Record(&pstcStat->stcLatency, u32Now - pstcStat->u32PendTime);
+                } else {
+                    /* Taken before any instrumented code saw it pending */
+                    pstcStat->u32Unseen++;
+                }
+
+                pstcFrame = &m_stcIntcStat.astcFrame[m_stcIntcStat.u32Depth++];
+                pstcFrame->enIRQn = enIRQn;
+                pstcFrame->u32Entry = u32Now;
+                pstcFrame->u32Nested = 0UL;
+            }
+            LL_EXIT_CRITICAL(u32Primask);
+        }
+    }
+}
+
+/**
+ * @brief  Handler exit, use INTC_STAT_IRQ_EXIT() instead.
+ * @param  [in] enIRQn                  Vector of the handler
+ * @retval None
+ */
+void INTC_STAT_Exit(IRQn_Type enIRQn)
+{
+    stc_intc_stat_t *pstcStat;
+    stc_intc_stat_frame_t *pstcFrame;
+    uint32_t u32Primask;
+    uint32_t u32Now;
+    uint32_t u32Total;
+    uint32_t u32Entered = 0UL;
+
+    if (IS_INTC_STAT_IRQN(enIRQn) && (0UL != m_stcIntcStat.u32CyclePerMs)) {
+        /* The nested handlers are done: the frame of this one, if any, is on top */
+        if ((0UL != m_stcIntcStat.u32Depth) &&
+            (enIRQn == m_stcIntcStat.astcFrame[m_stcIntcStat.u32Depth - 1UL].enIRQn)) {
+            u32Entered = 1UL;
+        }
+        /* Not entered when attached in the middle of the handler or unattached */
+        if ((0UL != u32Entered) || (0UL != INTC_STAT_NewPending())) {
+            LL_ENTER_CRITICAL(u32Primask);
+            u32Now = INTC_STAT_Now();
+            INTC_STAT_ScanPending(u32Now);
+            if (0UL != u32Entered) {
+                pstcFrame = &m_stcIntcStat.astcFrame[m_stcIntcStat.u32Depth - 1UL];
+                m_stcIntcStat.u32Depth--;
+                u32Total = u32Now - pstcFrame->u32Entry;
+                pstcStat = m_stcIntcStat.apstcStat[INTC_STAT_VECT_IDX(enIRQn)];
+                if (NULL != pstcStat) {
+                    INTC_STAT_Record(&pstcStat->stcExec, u32Total - pstcFrame->u32Nested);
+                }
+                if (0UL != m_stcIntcStat.u32Depth) {
+                    m_stcIntcStat.astcFrame[m_stcIntcStat.u32Depth - 1UL].u32Nested += u32Total;
+                }
+            }
+            LL_EXIT_CRITICAL(u32Primask);
+        }
+    }
+}
+
+/**
+ * @brief  Get a consistent copy of the statistics of a vector.
+ * @param  [in] enIRQn                  Vector, SysTick_IRQn ~ INT031_IRQn.
+ * @param  [out] pstcStat               Pointer to a @ref stc_intc_stat_t structure.
+ * @retval int32_t:
+ *           - LL_OK:                   Copied.
+ *           - LL_ERR_INVD_PARAM:       pstcStat is NULL, enIRQn out of range or not attached.
+ */
+int32_t INTC_STAT_Get(IRQn_Type enIRQn, stc_intc_stat_t *pstcStat)
+{
+    uint32_t u32Primask;
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+
+    if ((NULL != pstcStat) && IS_INTC_STAT_IRQN(enIRQn)) {
+        LL_ENTER_CRITICAL(u32Primask);
+        if (NULL != m_stcIntcStat.apstcStat[INTC_STAT_VECT_IDX(enIRQn)]) {
+            *pstcStat = *m_stcIntcStat.apstcStat[INTC_STAT_VECT_IDX(enIRQn)];
+            i32Ret = LL_OK;
+        }
+        LL_EXIT_CRITICAL(u32Primask);
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Get the mean of time statistics.
+ * @param  [in] pstcTime                Pointer to a @ref stc_intc_stat_time_t structure.
+ * @retval Mean in cycles, 0 if nothing was counted.
+ */
+uint32_t INTC_STAT_GetMean(const stc_intc_stat_time_t *pstcTime)
+{
+    uint32_t u32Mean = 0UL;
+
+    if ((NULL != pstcTime) && (0UL != pstcTime->u32Count)) {
+        u32Mean = (uint32_t)(pstcTime->u64Sum / pstcTime->u32Count);
+    }
+
+    return u32Mean;
+}
+
+/**
+ * @brief  Clear the statistics of a vector.
+ * @param  [in] enIRQn                  Vector, SysTick_IRQn ~ INT031_IRQn.
+ * @retval None
+ */
+void INTC_STAT_Clear(IRQn_Type enIRQn)
+{
+    stc_intc_stat_t *pstcStat;
+    uint32_t u32Primask;
+
+    if (IS_INTC_STAT_IRQN(enIRQn)) {
+        LL_ENTER_CRITICAL(u32Primask);
+        pstcStat = m_stcIntcStat.apstcStat[INTC_STAT_VECT_IDX(enIRQn)];
+        if (NULL != pstcStat) {
+            INTC_STAT_ResetTime(&pstcStat->stcExec);
+            INTC_STAT_ResetTime(&pstcStat->stcLatency);
+            pstcStat->u32Unseen = 0UL;
+        }
+        LL_EXIT_CRITICAL(u32Primask);
+    }
+}
+
+#if (LL_USART_ENABLE == DDL_ON)
+/**
+ * @brief  Send the statistics of the attached vectors as text, polling.
+ * @param  [in] USARTx                  Pointer to USART instance register base, in UART mode
+ *                                      with TX enabled, not in asynchronous mode.
+ * @param  [in] u32Timeout              Timeout of each line, as USART_UART_Trans().
+ * @retval int32_t:
+ *           - LL_OK:                   Sent.
+ *           - LL_ERR_TIMEOUT:          Timeout.
+ * @note   Two lines per vector, in HCLK cycles:
+ *         "irq <n> exec <count> <min> <mean> <max> | <histogram bin 0> ... <bin 15>" and
+ *         "irq <n> lat <count> <min> <mean> <max> | <histogram bin 0> ... <bin 15> | unseen <count>".
+ */
+int32_t INTC_STAT_Dump(CM_USART_TypeDef *USARTx, uint32_t u32Timeout)
+{
+    char acLine[INTC_STAT_LINE_LEN];
+    stc_intc_stat_t stcStat;
+    IRQn_Type enIRQn;
+    uint32_t u32Len;
+    int32_t i;
+    int32_t i32Ret = LL_OK;
+
+    for (i = (int32_t)SysTick_IRQn; (LL_OK == i32Ret) && (i <= (int32_t)INT031_IRQn); i++) {
+        enIRQn = (IRQn_Type)i;
+        if (LL_OK == INTC_STAT_Get(enIRQn, &stcStat)) {
+            u32Len = INTC_STAT_PutTime(acLine, enIRQn, "exec", &stcStat.stcExec);
+            i32Ret = INTC_STAT_PutLine(USARTx, acLine, u32Len, u32Timeout);
+            if (LL_OK == i32Ret) {
+                u32Len = INTC_STAT_PutTime(acLine, enIRQn, "lat", &stcStat.stcLatency);
+                u32Len = INTC_STAT_PutStr(acLine, u32Len, " | unseen");
+                u32Len = INTC_STAT_PutDec(acLine, u32Len, stcStat.u32Unseen);
+                i32Ret = INTC_STAT_PutLine(USARTx, acLine, u32Len, u32Timeout);
+            }
+        }
+    }
+
+    return i32Ret;
+}
+#endif /* LL_USART_ENABLE */
+
+/**
+ * @}
+ */
+
+#endif /* LL_INTC_STAT_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/******************************************************************************
+ * EOF (not truncated)
+ *****************************************************************************/
@@ -8,6 +8,7 @@
    Date             Author          Notes
    2022-03-31       CDT             First version
    2023-01-15       CDT             Add macro-definition: EIRQFR_REG/NMIENR_REG/INTWKEN_REG.
+   2026-10-17       CDT             Add INTC_STAT instrumentation to IRQ008~023 handlers
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2022-2023, Xiaohua Semiconductor Co., Ltd. All rights reserved.
@@ -500,7 +501,9 @@ en_flag_status_t EXTINT_GetExtIntStatus(uint32_t u32ExtIntCh)
  */
 void IRQ008_Handler(void)
 {
+    INTC_STAT_IRQ_ENTER(INT008_IRQn);
     m_apfnIrqHandler[(uint32_t)INT008_IRQn - IRQn_OFFSET]();
+    INTC_STAT_IRQ_EXIT(INT008_IRQn);
 }
 
 /**
@@ -510,7 +513,9 @@ void IRQ008_Handler(void)
  */
 void IRQ009_Handler(void)
 {
+    INTC_STAT_IRQ_ENTER(INT009_IRQn);
     m_apfnIrqHandler[(uint32_t)INT009_IRQn - IRQn_OFFSET]();
+    INTC_STAT_IRQ_EXIT(INT009_IRQn);
 }
 
 /**
@@ -520,7 +525,9 @@ void IRQ009_Handler(void)
  */
 void IRQ010_Handler(void)
 {
+    INTC_STAT_IRQ_ENTER(INT010_IRQn);
     m_apfnIrqHandler[(uint32_t)INT010_IRQn - IRQn_OFFSET]();
+    INTC_STAT_IRQ_EXIT(INT010_IRQn);
 }
 
 /**
@@ -530,7 +537,9 @@ void IRQ010_Handler(void)
  */
 void IRQ011_Handler(void)
 {
+    INTC_STAT_IRQ_ENTER(INT011_IRQn);
     m_apfnIrqHandler[(uint32_t)INT011_IRQn - IRQn_OFFSET]();
+    INTC_STAT_IRQ_EXIT(INT011_IRQn);
 }
 
 /**
@@ -540,7 +549,9 @@ void IRQ011_Handler(void)
  */
 void IRQ012_Handler(void)
 {
+    INTC_STAT_IRQ_ENTER(INT012_IRQn);
     m_apfnIrqHandler[(uint32_t)INT012_IRQn - IRQn_OFFSET]();
+    INTC_STAT_IRQ_EXIT(INT012_IRQn);
 }
 
 /**
@@ -550,7 +561,9 @@ void IRQ012_Handler(void)
  */
 void IRQ013_Handler(void)
 {
+    INTC_STAT_IRQ_ENTER(INT013_IRQn);
     m_apfnIrqHandler[(uint32_t)INT013_IRQn - IRQn_OFFSET]();
+    INTC_STAT_IRQ_EXIT(INT013_IRQn);
 }
 
 /**
@@ -560,7 +573,9 @@ void IRQ013_Handler(void)
  */
 void IRQ014_Handler(void)
 {
+    INTC_STAT_IRQ_ENTER(INT014_IRQn);
     m_apfnIrqHandler[(uint32_t)INT014_IRQn - IRQn_OFFSET]();
+    INTC_STAT_IRQ_EXIT(INT014_IRQn);
 }
 
 /**
@@ -570,7 +585,9 @@ void IRQ014_Handler(void)
  */
 void IRQ015_Handler(void)
 {
+    INTC_STAT_IRQ_ENTER(INT015_IRQn);
     m_apfnIrqHandler[(uint32_t)INT015_IRQn - IRQn_OFFSET]();
+    INTC_STAT_IRQ_EXIT(INT015_IRQn);
 }
 
 /**
@@ -580,7 +597,9 @@ void IRQ015_Handler(void)
  */
 void IRQ016_Handler(void)
 {
+    INTC_STAT_IRQ_ENTER(INT016_IRQn);
     m_apfnIrqHandler[(uint32_t)INT016_IRQn - IRQn_OFFSET]();
+    INTC_STAT_IRQ_EXIT(INT016_IRQn);
 }
 
 /**
@@ -590,7 +609,9 @@ void IRQ016_Handler(void)
  */
 void IRQ017_Handler(void)
 {
+    INTC_STAT_IRQ_ENTER(INT017_IRQn);
     m_apfnIrqHandler[(uint32_t)INT017_IRQn - IRQn_OFFSET]();
+    INTC_STAT_IRQ_EXIT(INT017_IRQn);
 }
 
 /**
@@ -600,7 +621,9 @@ void IRQ017_Handler(void)
  */
 void IRQ018_Handler(void)
 {
+    INTC_STAT_IRQ_ENTER(INT018_IRQn);
     m_apfnIrqHandler[(uint32_t)INT018_IRQn - IRQn_OFFSET]();
+    INTC_STAT_IRQ_EXIT(INT018_IRQn);
 }
 
 /**
@@ -610,7 +633,9 @@ void IRQ018_Handler(void)
  */
 void IRQ019_Handler(void)
 {
+    INTC_STAT_IRQ_ENTER(INT019_IRQn);
     m_apfnIrqHandler[(uint32_t)INT019_IRQn - IRQn_OFFSET]();
+    INTC_STAT_IRQ_EXIT(INT019_IRQn);
 }
 
 /**
@@ -620,7 +645,9 @@ void IRQ019_Handler(void)
  */
 void IRQ020_Handler(void)
 {
+    INTC_STAT_IRQ_ENTER(INT020_IRQn);
     m_apfnIrqHandler[(uint32_t)INT020_IRQn - IRQn_OFFSET]();
+    INTC_STAT_IRQ_EXIT(INT020_IRQn);
 }
 
 /**
@@ -630,7 +657,9 @@ void IRQ020_Handler(void)
  */
 void IRQ021_Handler(void)
 {
+    INTC_STAT_IRQ_ENTER(INT021_IRQn);
     m_apfnIrqHandler[(uint32_t)INT021_IRQn - IRQn_OFFSET]();
+    INTC_STAT_IRQ_EXIT(INT021_IRQn);
 }
 
 /**
@@ -640,7 +669,9 @@ void IRQ021_Handler(void)
  */
 void IRQ022_Handler(void)
 {
+    INTC_STAT_IRQ_ENTER(INT022_IRQn);
     m_apfnIrqHandler[(uint32_t)INT022_IRQn - IRQn_OFFSET]();
+    INTC_STAT_IRQ_EXIT(INT022_IRQn);
 }
 
 /**
@@ -650,7 +681,9 @@ void IRQ022_Handler(void)
  */
 void IRQ023_Handler(void)
 {
+    INTC_STAT_IRQ_ENTER(INT023_IRQn);
     m_apfnIrqHandler[(uint32_t)INT023_IRQn - IRQn_OFFSET]();
+    INTC_STAT_IRQ_EXIT(INT023_IRQn);
 }
 
 /**
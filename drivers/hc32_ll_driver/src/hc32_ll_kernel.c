@@ -0,0 +1,799 @@
+/**
+ *******************************************************************************
+ * @file  hc32_ll_kernel.c
+ * @brief This file provides firmware functions of a preemptive micro-kernel:
+ *        fixed-priority threads switched by PendSV, SysTick time slicing,
+ *        semaphores and message queues.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-16       CDT             First version
+   2026-10-17       CDT             No PendSV_Handler in the host build, host/kernel switches the contexts
+                                    Use LL_ENTER_CRITICAL()/LL_EXIT_CRITICAL()
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2022-2023, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_ll_kernel.h"
+#include "hc32_ll_utility.h"
+
+/**
+ * @addtogroup LL_Driver
+ * @{
+ */
+
+/**
+ * @defgroup LL_KERNEL KERNEL
+ * @brief Preemptive Micro-kernel
+ * @{
+ */
+
+#if (LL_KERNEL_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @defgroup KERNEL_Local_Types KERNEL Local Types
+ * @{
+ */
+
+/**
+ * @brief Thread control block definition
+ * @note  u32Sp must stay the first member.
+ */
+typedef struct {
+    uint32_t u32Sp;                     /*!< Saved process stack pointer, below the saved R4 ~ R11. */
+    uint32_t *pu32StackBottom;          /*!< Lowest stack word, holds KERNEL_STACK_MAGIC. */
+    uint8_t u8State;                    /*!< @ref KERNEL_Thread_State */
+    uint8_t u8Prio;                     /*!< Priority, KERNEL_PRIO_NUM for the idle thread. */
+    uint8_t u8Timed;                    /*!< 1U if the wait ends at u32WakeTick. */
+    const void *pvWaitObj;              /*!< Object waited for, NULL for a delay. */
+    uint32_t u32WakeTick;               /*!< Tick ending a timed wait. */
+    int32_t i32WaitRet;                 /*!< LL_OK if woken by the object, LL_ERR_TIMEOUT otherwise. */
+} stc_kernel_tcb_t;
+
+/**
+ * @brief Kernel control block definition
+ */
+typedef struct {
+    stc_kernel_tcb_t *pstcCurrent;      /*!< Running thread, NULL before KERNEL_Start(). */
+    stc_kernel_tcb_t *pstcNext;         /*!< Thread to run after the pending PendSV. */
+    __IO uint32_t u32Tick;              /*!< Ticks since KERNEL_Start(). */
+    uint32_t u32SliceCount;             /*!< Ticks of the running thread since it was switched in. */
+    uint8_t u8Started;                  /*!< 1U after KERNEL_Start(). */
+} stc_kernel_ctrl_t;
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup KERNEL_Local_Macros KERNEL Local Macros
+ * @{
+ */
+#if ((KERNEL_STACK_SIZE % 8U) != 0U) || ((KERNEL_IDLE_STACK_SIZE % 8U) != 0U)
+#error "KERNEL_STACK_SIZE and KERNEL_IDLE_STACK_SIZE must be multiples of 8."
+#endif
+
+/**
+ * @defgroup KERNEL_Thread_State KERNEL Thread State
+ * @{
+ */
+#define KERNEL_THREAD_FREE              (0U)
+#define KERNEL_THREAD_READY             (1U)
+#define KERNEL_THREAD_WAIT              (2U)
+/**
+ * @}
+ */
+
+#define KERNEL_TCB_NUM                  (KERNEL_THREAD_NUM + 1U)
+#define KERNEL_IDLE_TCB                 (&m_astcTcb[KERNEL_THREAD_NUM])
+
+/* Saved context: R4 ~ R11 by PendSV_Handler, then R0 ~ R3, R12, LR, PC, xPSR by the core */
+#define KERNEL_CONTEXT_WORDS            (16U)
+#define KERNEL_CONTEXT_R0               (8U)
+#define KERNEL_CONTEXT_LR               (13U)
+#define KERNEL_CONTEXT_PC               (14U)
+#define KERNEL_CONTEXT_XPSR             (15U)
+#define KERNEL_XPSR_THUMB               (0x01000000UL)
+#define KERNEL_STACK_MAGIC              (0x5A5AA5A5UL)
+
+/* In an IRQ handler, the services never wait */
+#define KERNEL_IN_IRQ()                 (0UL != __get_IPSR())
+
+/**
+ * @defgroup KERNEL_Check_Parameters_Validity KERNEL Check Parameters Validity
+ * @{
+ */
+#define IS_KERNEL_PRIO(x)               ((x) < KERNEL_PRIO_NUM)
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+/* Called by PendSV_Handler only: not static, so that the assembly can reach it */
+uint32_t KERNEL_SwitchContext(uint32_t u32Sp);
+void PendSV_Handler(void);
+
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+/**
+ * @defgroup KERNEL_Local_Variables KERNEL Local Variables
+ * @{
+ */
+static stc_kernel_ctrl_t m_stcKernel;
+static stc_kernel_tcb_t m_astcTcb[KERNEL_TCB_NUM];
+static uint64_t m_au64Stack[KERNEL_THREAD_NUM][KERNEL_STACK_SIZE / 8U];
+static uint64_t m_au64IdleStack[KERNEL_IDLE_STACK_SIZE / 8U];
+/* Process stack of the first PendSV_Handler, which saves a context that is never resumed */
+static uint64_t m_au64StartStack[4U];
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @defgroup KERNEL_Local_Functions KERNEL Local Functions
+ * @{
+ */
+
+/**
+ * @brief  Select the thread to run and pend PendSV if it is not the running one.
+ * @param  [in] u8Rotate                1U to pass the processor to the next ready thread of the
+ *                                      same priority, 0U to keep the running thread if it can.
+ * @retval None
+ * @note   Called with the interrupts masked. The highest priority ready thread found first after
+ *         the running one in the TCB order wins, so equal priorities run round robin.
+ */
+static void KERNEL_Schedule(uint8_t u8Rotate)
+{
+    stc_kernel_tcb_t *pstcCur = m_stcKernel.pstcCurrent;
+    stc_kernel_tcb_t *pstcBest = NULL;
+    stc_kernel_tcb_t *pstcTcb;
+    uint32_t u32Start = 0UL;
+    uint32_t i;
+
+    if (0U != m_stcKernel.u8Started) {
+        if (NULL != pstcCur) {
+            u32Start = (uint32_t)(pstcCur - m_astcTcb) + 1UL;
+            if ((0U == u8Rotate) && (KERNEL_THREAD_READY == pstcCur->u8State)) {
+                pstcBest = pstcCur;
+            }
+        }
+        for (i = 0UL; i < KERNEL_TCB_NUM; i++) {
+            pstcTcb = &m_astcTcb[(u32Start + i) % KERNEL_TCB_NUM];
+            if ((KERNEL_THREAD_READY == pstcTcb->u8State) &&
+                ((NULL == pstcBest) || (pstcTcb->u8Prio < pstcBest->u8Prio))) {
+                pstcBest = pstcTcb;
+            }
+        }
+
+        /* The idle thread is always ready */
+        m_stcKernel.pstcNext = pstcBest;
+        if (pstcBest != pstcCur) {
+            SCB->ICSR = SCB_ICSR_PENDSVSET_Msk;
+        }
+    }
+}
+
+/**
+ * @brief  Make the highest priority thread waiting for an object ready.
+ * @param  [in] pvWaitObj               Object
+ * @retval An @ref en_flag_status_t enumeration type value, SET if a thread was woken.
+ * @note   Called with the interrupts masked.
+ */
+static en_flag_status_t KERNEL_Wake(const void *pvWaitObj)
+{
+    stc_kernel_tcb_t *pstcBest = NULL;
+    uint32_t i;
+    en_flag_status_t enWoken = RESET;
+
+    for (i = 0UL; i < KERNEL_THREAD_NUM; i++) {
+        if ((KERNEL_THREAD_WAIT == m_astcTcb[i].u8State) && (pvWaitObj == m_astcTcb[i].pvWaitObj) &&
+            ((NULL == pstcBest) || (m_astcTcb[i].u8Prio < pstcBest->u8Prio))) {
+            pstcBest = &m_astcTcb[i];
+        }
+    }
+    if (NULL != pstcBest) {
+        pstcBest->u8State = KERNEL_THREAD_READY;
+        pstcBest->pvWaitObj = NULL;
+        pstcBest->i32WaitRet = LL_OK;
+        KERNEL_Schedule(0U);
+        enWoken = SET;
+    }
+
+    return enWoken;
+}
+
+/**
+ * @brief  Block the running thread until an object wakes it up or the timeout ends.
+ * @param  [in] pvWaitObj               Object, NULL for a delay.
+ * @param  [in] u32Timeout              Ticks, 1 ~ KERNEL_WAIT_FOREVER.
+ * @retval int32_t:
+ *         - LL_OK:                     Woken by the object.
+ *         - LL_ERR_TIMEOUT:            The timeout ended.
+ * @note   Called from a thread with the interrupts masked, they are unmasked while blocked.
+ */
+static int32_t KERNEL_Wait(const void *pvWaitObj, uint32_t u32Timeout)
+{
+    stc_kernel_tcb_t *pstcCur = m_stcKernel.pstcCurrent;
+
+    pstcCur->u8State = KERNEL_THREAD_WAIT;
+    pstcCur->pvWaitObj = pvWaitObj;
+    pstcCur->i32WaitRet = LL_ERR_TIMEOUT;
+    pstcCur->u8Timed = (KERNEL_WAIT_FOREVER != u32Timeout) ? 1U : 0U;
+    pstcCur->u32WakeTick = m_stcKernel.u32Tick + u32Timeout;
+    KERNEL_Schedule(0U);
+
+    /* PendSV switches out here, the thread resumes once ready again */
+    __enable_irq();
+    __disable_irq();
+
+    return pstcCur->i32WaitRet;
+}
+
+/**
+ * @brief  Ticks left to a deadline.
+ * @param  [in] u32Deadline             Tick
+ * @param  [in] u32Timeout              The timeout the deadline was computed from.
+ * @retval uint32_t                     0 once passed, KERNEL_WAIT_FOREVER for an endless timeout.
+ */
+static uint32_t KERNEL_Remain(uint32_t u32Deadline, uint32_t u32Timeout)
+{
+    uint32_t u32Remain = KERNEL_WAIT_FOREVER;
+
+    if (KERNEL_WAIT_FOREVER != u32Timeout) {
+        u32Remain = u32Deadline - m_stcKernel.u32Tick;
+        if ((int32_t)u32Remain < 0) {
+            u32Remain = 0UL;
+        }
+    }
+
+    return u32Remain;
+}
+
+/**
+ * @brief  Thread function return address: the thread ends and its slot is freed.
+ * @param  None
+ * @retval None
+ */
+static void KERNEL_ThreadExit(void)
+{
+    __disable_irq();
+    m_stcKernel.pstcCurrent->u8State = KERNEL_THREAD_FREE;
+    KERNEL_Schedule(0U);
+    __enable_irq();
+
+    for (;;) {
+    }
+}
+
+/**
+ * @brief  Idle thread.
+ * @param  [in] pvArg                   Not used.
+ * @retval None
+ */
+static void KERNEL_IdleThread(void *pvArg)
+{
+    (void)pvArg;
+
+    for (;;) {
+        KERNEL_Idle();
+    }
+}
+
+/**
+ * @brief  Set up a thread control block and the initial context on its stack.
+ * @param  [in] pstcTcb                 Thread control block
+ * @param  [in] pu64Stack               Stack
+ * @param  [in] u32StackSize            Stack bytes
+ * @param  [in] pfnEntry                Thread function
+ * @param  [in] pvArg                   Thread function argument
+ * @param  [in] u8Prio                  Priority
+ * @retval None
+ */
+static void KERNEL_TcbInit(stc_kernel_tcb_t *pstcTcb, uint64_t *pu64Stack, uint32_t u32StackSize,
+                           void (*pfnEntry)(void *pvArg), void *pvArg, uint8_t u8Prio)
+{
+    uint32_t *pu32Frame = (uint32_t *)&pu64Stack[u32StackSize / 8U] - KERNEL_CONTEXT_WORDS;
+    uint32_t i;
+
+    for (i = 0UL; i < KERNEL_CONTEXT_WORDS; i++) {
+        pu32Frame[i] = 0UL;
+    }
+    pu32Frame[KERNEL_CONTEXT_R0] = (uint32_t)pvArg;
+    pu32Frame[KERNEL_CONTEXT_LR] = (uint32_t)&KERNEL_ThreadExit;
+    pu32Frame[KERNEL_CONTEXT_PC] = (uint32_t)pfnEntry & ~1UL;
+    pu32Frame[KERNEL_CONTEXT_XPSR] = KERNEL_XPSR_THUMB;
+
+    pstcTcb->u32Sp = (uint32_t)pu32Frame;
+    pstcTcb->pu32StackBottom = (uint32_t *)pu64Stack;
+    *pstcTcb->pu32StackBottom = KERNEL_STACK_MAGIC;
+    pstcTcb->u8Prio = u8Prio;
+    pstcTcb->u8Timed = 0U;
+    pstcTcb->pvWaitObj = NULL;
+    pstcTcb->i32WaitRet = LL_OK;
+    pstcTcb->u8State = KERNEL_THREAD_READY;
+}
+
+/**
+ * @brief  Save the stack pointer of the running thread and switch to the next one.
+ * @param  [in] u32Sp                   Process stack pointer below the saved R4 ~ R11.
+ * @retval uint32_t                     Stack pointer of the next thread.
+ * @note   Called from PendSV_Handler with the interrupts masked.
+ */
+__attribute__((used)) uint32_t KERNEL_SwitchContext(uint32_t u32Sp)
+{
+    if (NULL != m_stcKernel.pstcCurrent) {
+        m_stcKernel.pstcCurrent->u32Sp = u32Sp;
+        /* Stack overflow of the thread switched out */
+        DDL_ASSERT(KERNEL_STACK_MAGIC == *m_stcKernel.pstcCurrent->pu32StackBottom);
+    }
+    m_stcKernel.pstcCurrent = m_stcKernel.pstcNext;
+    m_stcKernel.u32SliceCount = 0UL;
+
+    return m_stcKernel.pstcCurrent->u32Sp;
+}
+
+/**
+ * @brief  PendSV exception handler: context switch.
+ * @param  None
+ * @retval None
+ * @note   ARMv6-M has no STMDB and no high register LDM/STM: R4 ~ R7 are stored first,
+ *         then R8 ~ R11 through R4 ~ R7. Returns to thread mode on the process stack.
+ */
+#if defined (__CMSIS_HOST_H__)
+/* Host build (host/sim/cmsis_host.h): the test harness calls KERNEL_SwitchContext() */
+#elif defined (__GNUC__) && !defined (__CC_ARM)
+__attribute__((naked)) void PendSV_Handler(void)
+{
+    __ASM volatile(
+        "   cpsid   i                   \n"
+        "   mrs     r0, psp             \n"
+        "   subs    r0, #32             \n"
+        "   mov     r1, r0              \n"
+        "   stmia   r1!, {r4-r7}        \n"
+        "   mov     r4, r8              \n"
+        "   mov     r5, r9              \n"
+        "   mov     r6, r10             \n"
+        "   mov     r7, r11             \n"
+        "   stmia   r1!, {r4-r7}        \n"
+        "   bl      KERNEL_SwitchContext\n"
+        "   adds    r0, #16             \n"
+        "   ldmia   r0!, {r4-r7}        \n"
+        "   mov     r8, r4              \n"
+        "   mov     r9, r5              \n"
+        "   mov     r10, r6             \n"
+        "   mov     r11, r7             \n"
+        "   msr     psp, r0             \n"
+        "   subs    r0, #32             \n"
+        "   ldmia   r0!, {r4-r7}        \n"
+        "   movs    r0, #2              \n"
+        "   mvns    r0, r0              \n" /* EXC_RETURN 0xFFFFFFFD: thread mode, process stack */
+        "   cpsie   i                   \n"
+        "   bx      r0                  \n"
+    );
+}
+#else
+#error "KERNEL: PendSV_Handler is provided for the GNU compiler and Arm Compiler 6 only."
+#endif
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup KERNEL_Global_Functions KERNEL Global Functions
+ * @{
+ */
+
+/**
+ * @brief  Initialize the kernel: all thread slots are freed and the idle thread is created.
+ * @param  None
+ * @retval None
+ */
+void KERNEL_Init(void)
+{
+    uint32_t i;
+
+    for (i = 0UL; i < KERNEL_THREAD_NUM; i++) {
+        m_astcTcb[i].u8State = KERNEL_THREAD_FREE;
+    }
+    KERNEL_TcbInit(KERNEL_IDLE_TCB, m_au64IdleStack, KERNEL_IDLE_STACK_SIZE, &KERNEL_IdleThread, NULL,
+                   (uint8_t)KERNEL_PRIO_NUM);
+    m_stcKernel.pstcCurrent = NULL;
+    m_stcKernel.pstcNext = NULL;
+    m_stcKernel.u32Tick = 0UL;
+    m_stcKernel.u32SliceCount = 0UL;
+    m_stcKernel.u8Started = 0U;
+}
+
+/**
+ * @brief  Create a thread on a free stack of KERNEL_STACK_SIZE bytes.
+ * @param  [in] pfnEntry            Thread function, the thread ends when it returns.
+ * @param  [in] pvArg               Thread function argument.
+ * @param  [in] u8Prio              Priority, 0 (highest) ~ KERNEL_PRIO_NUM - 1.
+ * @retval int32_t:
+ *         - LL_OK:                 Success
+ *         - LL_ERR_INVD_PARAM:     pfnEntry is NULL or u8Prio is out of range.
+ *         - LL_ERR_BUF_FULL:       All KERNEL_THREAD_NUM threads exist.
+ * @note   Can be called before and after KERNEL_Start(), not from IRQ handlers.
+ */
+int32_t KERNEL_ThreadCreate(void (*pfnEntry)(void *pvArg), void *pvArg, uint8_t u8Prio)
+{
+    uint32_t u32Primask;
+    uint32_t i;
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+
+    if ((NULL != pfnEntry) && IS_KERNEL_PRIO(u8Prio)) {
+        i32Ret = LL_ERR_BUF_FULL;
+        LL_ENTER_CRITICAL(u32Primask);
+        for (i = 0UL; i < KERNEL_THREAD_NUM; i++) {
+            if (KERNEL_THREAD_FREE == m_astcTcb[i].u8State) {
+                KERNEL_TcbInit(&m_astcTcb[i], m_au64Stack[i], KERNEL_STACK_SIZE, pfnEntry, pvArg, u8Prio);
+                KERNEL_Schedule(0U);
+                i32Ret = LL_OK;
+                break;
+            }
+        }
+        LL_EXIT_CRITICAL(u32Primask);
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Start the SysTick at KERNEL_TICK_FREQ and switch to the highest priority thread.
+ * @param  None
+ * @retval None
+ * @note   Never returns, the main stack is then used by the IRQ handlers only.
+ * @note   SysTick_Handler() must call KERNEL_TickHandler(), and SysTick_IncTick() for the
+ *         SysTick_GetTick() users.
+ */
+void KERNEL_Start(void)
+{
+    __disable_irq();
+    NVIC_SetPriority(PendSV_IRQn, (1UL << __NVIC_PRIO_BITS) - 1UL);
+    (void)SysTick_Init(KERNEL_TICK_FREQ);
+    __set_PSP((uint32_t)&m_au64StartStack[4U]);
+    m_stcKernel.u8Started = 1U;
+    KERNEL_Schedule(0U);
+    __enable_irq();
+
+    for (;;) {
+    }
+}
+
+/**
+ * @brief  Kernel tick: ends the timed waits and the time slice.
+ * @param  None
+ * @retval None
+ * @note   Call it from SysTick_Handler().
+ */
+void KERNEL_TickHandler(void)
+{
+    uint32_t u32Primask;
+    uint32_t i;
+    uint8_t u8Rotate = 0U;
+
+    LL_ENTER_CRITICAL(u32Primask);
+    m_stcKernel.u32Tick++;
+    for (i = 0UL; i < KERNEL_THREAD_NUM; i++) {
+        if ((KERNEL_THREAD_WAIT == m_astcTcb[i].u8State) && (0U != m_astcTcb[i].u8Timed) &&
+            (m_astcTcb[i].u32WakeTick == m_stcKernel.u32Tick)) {
+            m_astcTcb[i].u8State = KERNEL_THREAD_READY;
+            m_astcTcb[i].pvWaitObj = NULL;
+        }
+    }
+    if (++m_stcKernel.u32SliceCount >= KERNEL_TIME_SLICE) {
+        m_stcKernel.u32SliceCount = 0UL;
+        u8Rotate = 1U;
+    }
+    KERNEL_Schedule(u8Rotate);
+    LL_EXIT_CRITICAL(u32Primask);
+}
+
+/**
+ * @brief  Run by the idle thread while no other thread is ready.
+ * @param  None
+ * @retval None
+ * @note   This function may be overridden by the application, it must not block.
+ */
+__WEAKDEF void KERNEL_Idle(void)
+{
+    __WFI();
+}
+
+/**
+ * @brief  Get the ticks since KERNEL_Start().
+ * @param  None
+ * @retval uint32_t                 Tick
+ */
+uint32_t KERNEL_GetTick(void)
+{
+    return m_stcKernel.u32Tick;
+}
+
+/**
+ * @brief  Block the calling thread for a number of ticks.
+ * @param  [in] u32Ticks            Ticks, 0 yields only.
+ * @retval None
+ * @note   Returns at once in IRQ handlers and before KERNEL_Start().
+ */
+void KERNEL_Delay(uint32_t u32Ticks)
+{
+    uint32_t u32Primask;
+
+    if (KERNEL_IN_IRQ() || (0U == m_stcKernel.u8Started)) {
+        /* No thread to block */
+    } else if (0UL == u32Ticks) {
+        KERNEL_Yield();
+    } else {
+        LL_ENTER_CRITICAL(u32Primask);
+        (void)KERNEL_Wait(NULL, u32Ticks);
+        LL_EXIT_CRITICAL(u32Primask);
+    }
+}
+
+/**
+ * @brief  Pass the processor to the next ready thread of the same priority, if any.
+ * @param  None
+ * @retval None
+ */
+void KERNEL_Yield(void)
+{
+    uint32_t u32Primask;
+
+    LL_ENTER_CRITICAL(u32Primask);
+    KERNEL_Schedule(1U);
+    LL_EXIT_CRITICAL(u32Primask);
+}
+
+/**
+ * @brief  Initialize a counting semaphore.
+ * @param  [out] pstcSem            Pointer to a @ref stc_kernel_sem_t structure.
+ * @param  [in] u32InitCount        Initial count.
+ * @param  [in] u32MaxCount         Maximum count, 1 for a binary semaphore.
+ * @retval int32_t:
+ *         - LL_OK:                 Success
+ *         - LL_ERR_INVD_PARAM:     pstcSem is NULL, u32MaxCount is 0 or below u32InitCount.
+ */
+int32_t KERNEL_SemInit(stc_kernel_sem_t *pstcSem, uint32_t u32InitCount, uint32_t u32MaxCount)
+{
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+
+    if ((NULL != pstcSem) && (0UL != u32MaxCount) && (u32InitCount <= u32MaxCount)) {
+        pstcSem->u32Count = u32InitCount;
+        pstcSem->u32MaxCount = u32MaxCount;
+        i32Ret = LL_OK;
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Take a semaphore, waiting for it if the count is 0.
+ * @param  [in] pstcSem             Pointer to an initialized @ref stc_kernel_sem_t structure.
+ * @param  [in] u32Timeout          Ticks to wait, @ref KERNEL_Timeout. Always KERNEL_NO_WAIT in
+ *                                  IRQ handlers and before KERNEL_Start().
+ * @retval int32_t:
+ *         - LL_OK:                 Taken.
+ *         - LL_ERR_TIMEOUT:        Not available within the timeout.
+ *         - LL_ERR_INVD_PARAM:     pstcSem is NULL.
+ */
+int32_t KERNEL_SemTake(stc_kernel_sem_t *pstcSem, uint32_t u32Timeout)
+{
+    uint32_t u32Primask;
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+
+    if (NULL != pstcSem) {
+        LL_ENTER_CRITICAL(u32Primask);
+        if (0UL != pstcSem->u32Count) {
+            pstcSem->u32Count--;
+            i32Ret = LL_OK;
+        } else if ((KERNEL_NO_WAIT == u32Timeout) || KERNEL_IN_IRQ() || (0U == m_stcKernel.u8Started)) {
+            i32Ret = LL_ERR_TIMEOUT;
+        } else {
+            /* KERNEL_SemGive() hands the count over to the woken thread */
+            i32Ret = KERNEL_Wait(pstcSem, u32Timeout);
+        }
+        LL_EXIT_CRITICAL(u32Primask);
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Give a semaphore, to the highest priority waiting thread if any.
+ * @param  [in] pstcSem             Pointer to an initialized @ref stc_kernel_sem_t structure.
+ * @retval int32_t:
+ *         - LL_OK:                 Given.
+ *         - LL_ERR_BUF_FULL:       The count is at its maximum already.
+ *         - LL_ERR_INVD_PARAM:     pstcSem is NULL.
+ * @note   Can be called from IRQ handlers: a woken thread of higher priority runs when the
+ *         handler returns.
+ */
+int32_t KERNEL_SemGive(stc_kernel_sem_t *pstcSem)
+{
+    uint32_t u32Primask;
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+
+    if (NULL != pstcSem) {
+        i32Ret = LL_OK;
+        LL_ENTER_CRITICAL(u32Primask);
+        if (RESET == KERNEL_Wake(pstcSem)) {
+            if (pstcSem->u32Count < pstcSem->u32MaxCount) {
+                pstcSem->u32Count++;
+            } else {
+                i32Ret = LL_ERR_BUF_FULL;
+            }
+        }
+        LL_EXIT_CRITICAL(u32Primask);
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Initialize a message queue.
+ * @param  [out] pstcQueue          Pointer to a @ref stc_kernel_queue_t structure.
+ * @param  [in] pvBuf               Buffer of u32ItemSize * u32Capacity bytes.
+ * @param  [in] u32ItemSize         Item size in bytes.
+ * @param  [in] u32Capacity         Number of items.
+ * @retval int32_t:
+ *         - LL_OK:                 Success
+ *         - LL_ERR_INVD_PARAM:     A pointer is NULL or a size is 0.
+ */
+int32_t KERNEL_QueueInit(stc_kernel_queue_t *pstcQueue, void *pvBuf, uint32_t u32ItemSize, uint32_t u32Capacity)
+{
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+
+    if ((NULL != pstcQueue) && (NULL != pvBuf) && (0UL != u32ItemSize) && (0UL != u32Capacity)) {
+        pstcQueue->pu8Buf = (uint8_t *)pvBuf;
+        pstcQueue->u32ItemSize = u32ItemSize;
+        pstcQueue->u32Capacity = u32Capacity;
+        pstcQueue->u32Head = 0UL;
+        pstcQueue->u32Count = 0UL;
+        i32Ret = LL_OK;
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Copy an item to the tail of a queue, waiting for room if it is full.
+ * @param  [in] pstcQueue           Pointer to an initialized @ref stc_kernel_queue_t structure.
+ * @param  [in] pvItem              Item of u32ItemSize bytes.
+ * @param  [in] u32Timeout          Ticks to wait, @ref KERNEL_Timeout. Always KERNEL_NO_WAIT in
+ *                                  IRQ handlers and before KERNEL_Start().
+ * @retval int32_t:
+ *         - LL_OK:                 Sent.
+ *         - LL_ERR_TIMEOUT:        No room within the timeout.
+ *         - LL_ERR_INVD_PARAM:     A pointer is NULL.
+ * @note   Can be called from IRQ handlers.
+ */
+int32_t KERNEL_QueueSend(stc_kernel_queue_t *pstcQueue, const void *pvItem, uint32_t u32Timeout)
+{
+    uint32_t u32Primask;
+    uint32_t u32Deadline;
+    uint32_t u32Pos;
+    uint32_t i;
+    const uint8_t *pu8Src = (const uint8_t *)pvItem;
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+
+    if ((NULL != pstcQueue) && (NULL != pvItem)) {
+        i32Ret = LL_OK;
+        LL_ENTER_CRITICAL(u32Primask);
+        if (KERNEL_IN_IRQ() || (0U == m_stcKernel.u8Started)) {
+            u32Timeout = KERNEL_NO_WAIT;
+        }
+        u32Deadline = m_stcKernel.u32Tick + u32Timeout;
+        while ((LL_OK == i32Ret) && (pstcQueue->u32Count >= pstcQueue->u32Capacity)) {
+            u32Timeout = KERNEL_Remain(u32Deadline, u32Timeout);
+            i32Ret = (0UL == u32Timeout) ? LL_ERR_TIMEOUT : KERNEL_Wait(&pstcQueue->u8SendWait, u32Timeout);
+        }
+        if (LL_OK == i32Ret) {
+            u32Pos = (pstcQueue->u32Head + pstcQueue->u32Count) % pstcQueue->u32Capacity;
+            for (i = 0UL; i < pstcQueue->u32ItemSize; i++) {
+                pstcQueue->pu8Buf[(u32Pos * pstcQueue->u32ItemSize) + i] = pu8Src[i];
+            }
+            pstcQueue->u32Count++;
+            (void)KERNEL_Wake(&pstcQueue->u8RecvWait);
+        }
+        LL_EXIT_CRITICAL(u32Primask);
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Copy the item at the head of a queue out, waiting for one if it is empty.
+ * @param  [in] pstcQueue           Pointer to an initialized @ref stc_kernel_queue_t structure.
+ * @param  [out] pvItem             Buffer of u32ItemSize bytes.
+ * @param  [in] u32Timeout          Ticks to wait, @ref KERNEL_Timeout. Always KERNEL_NO_WAIT in
+ *                                  IRQ handlers and before KERNEL_Start().
+ * @retval int32_t:
+ *         - LL_OK:                 Received.
+ *         - LL_ERR_TIMEOUT:        No item within the timeout.
+ *         - LL_ERR_INVD_PARAM:     A pointer is NULL.
+ * @note   Can be called from IRQ handlers.
+ */
+int32_t KERNEL_QueueReceive(stc_kernel_queue_t *pstcQueue, void *pvItem, uint32_t u32Timeout)
+{
+    uint32_t u32Primask;
+    uint32_t u32Deadline;
+    uint32_t i;
+    uint8_t *pu8Dest = (uint8_t *)pvItem;
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+
+    if ((NULL != pstcQueue) && (NULL != pvItem)) {
+        i32Ret = LL_OK;
+        LL_ENTER_CRITICAL(u32Primask);
+        if (KERNEL_IN_IRQ() || (0U == m_stcKernel.u8Started)) {
+            u32Timeout = KERNEL_NO_WAIT;
+        }
+        u32Deadline = m_stcKernel.u32Tick + u32Timeout;
+        while ((LL_OK == i32Ret) && (0UL == pstcQueue->u32Count)) {
+            u32Timeout = KERNEL_Remain(u32Deadline, u32Timeout);
+            i32Ret = (0UL == u32Timeout) ? LL_ERR_TIMEOUT : KERNEL_Wait(&pstcQueue->u8RecvWait, u32Timeout);
+        }
+        if (LL_OK == i32Ret) {
+            for (i = 0UL; i < pstcQueue->u32ItemSize; i++) {
+                pu8Dest[i] = pstcQueue->pu8Buf[(pstcQueue->u32Head * pstcQueue->u32ItemSize) + i];
+            }
+            pstcQueue->u32Head = (pstcQueue->u32Head + 1UL) % pstcQueue->u32Capacity;
+            pstcQueue->u32Count--;
+            (void)KERNEL_Wake(&pstcQueue->u8SendWait);
+        }
+        LL_EXIT_CRITICAL(u32Primask);
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @}
+ */
+
+#endif /* LL_KERNEL_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/******************************************************************************
+ * EOF (not truncated)
+ *****************************************************************************/
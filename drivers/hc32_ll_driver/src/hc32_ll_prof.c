@@ -0,0 +1,524 @@
+/**
+ *******************************************************************************
+ * @file  hc32_ll_prof.c
+ * @brief This file provides firmware functions of the sampling profiler.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-17       CDT             First version
+                                    Use LL_ENTER_CRITICAL()/LL_EXIT_CRITICAL()
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2022-2023, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_ll_prof.h"
+#include "hc32_ll_interrupts.h"
+#include "hc32_ll_tmrb.h"
+#include "hc32_ll_usart.h"
+#include "hc32_ll_utility.h"
+
+/**
+ * @addtogroup LL_Driver
+ * @{
+ */
+
+/**
+ * @defgroup LL_PROF PROF
+ * @brief Sampling Profiler
+ * @note  The core has no DWT cycle counter: a TMRB overflow interrupt of the highest
+ *        priority takes the PC stacked by the core on exception entry and counts it in a
+ *        histogram of the code range. PROF_Dump() sends the histogram as text, host/prof
+ *        attributes the bins to the functions of the ELF file.
+ * @note  A sample takes about 150 cycles, sampling at 1kHz costs 0.3% of a 48MHz core.
+ * @{
+ */
+
+#if (LL_PROF_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @defgroup PROF_Local_Types PROF Local Types
+ * @{
+ */
+
+/**
+ * @brief PROF control structure definition
+ */
+typedef struct {
+    CM_TMRB_TypeDef *TMRBx;             /*!< Sampling timer, NULL until PROF_Init(). */
+    uint16_t *pu16Bin;                  /*!< Histogram. */
+    uint32_t u32BinNum;                 /*!< Number of bins. */
+    uint32_t u32Start;                  /*!< Address of bin 0. */
+    uint32_t u32End;                    /*!< End of the sampled range. */
+    uint32_t u32Shift;                  /*!< log2 of the bin size. */
+    uint32_t u32Samples;                /*!< Samples taken. */
+    uint32_t u32Outside;                /*!< Samples outside the range: RAM functions, ROM. */
+} stc_prof_ctrl_t;
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup PROF_Local_Macros PROF Local Macros
+ * @{
+ */
+#define PROF_BIN_MAX                    (0xFFFFU)
+
+/* EXC_RETURN values: return to handler mode, thread mode on MSP, thread mode on PSP */
+#define PROF_EXC_RETURN_HANDLER         (0xFFFFFFF1UL)
+#define PROF_EXC_RETURN_THREAD_MSP      (0xFFFFFFF9UL)
+#define PROF_EXC_RETURN_THREAD_PSP      (0xFFFFFFFDUL)
+
+/* Exception frame: R0 ~ R3, R12, LR, PC, xPSR */
+#define PROF_FRAME_PC                   (6U)
+#define PROF_FRAME_XPSR                 (7U)
+#define PROF_XPSR_T                     (1UL << 24U)
+
+/* Dump line: the tag, 5 words of 8 hex digits with a separator each, the line break */
+#define PROF_LINE_LEN                   (4U + (5U * 9U) + 2U)
+
+/**
+ * @defgroup PROF_Check_Parameters_Validity PROF Check Parameters Validity
+ * @{
+ */
+#define IS_PROF_TMRB_UNIT(x)                                                   \
+(   ((x) == CM_TMRB_1)                          ||                             \
+    ((x) == CM_TMRB_2)                          ||                             \
+    ((x) == CM_TMRB_3)                          ||                             \
+    ((x) == CM_TMRB_4)                          ||                             \
+    ((x) == CM_TMRB_5)                          ||                             \
+    ((x) == CM_TMRB_6)                          ||                             \
+    ((x) == CM_TMRB_7)                          ||                             \
+    ((x) == CM_TMRB_8))
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+/**
+ * @defgroup PROF_Local_Variables PROF Local Variables
+ * @{
+ */
+static stc_prof_ctrl_t m_stcProf;
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @defgroup PROF_Local_Functions PROF Local Functions
+ * @{
+ */
+
+/**
+ * @brief  Find the exception frame of the interrupted code.
+ * @param  None
+ * @retval Pointer to the frame, NULL if not found.
+ * @note   The exception entry loads LR with EXC_RETURN, which the IRQ handler pushes
+ *         right below the frame before it calls the dispatch functions. Candidates
+ *         are checked for the Thumb bit of the stacked xPSR.
+ */
+static const uint32_t *PROF_GetFrame(void)
+{
+    const uint32_t *pu32Sp = (const uint32_t *)__get_MSP();
+    const uint32_t *pu32Frame;
+    uint32_t i;
+
+    for (i = 0UL; i < PROF_FRAME_SCAN_MAX; i++) {
+        if (PROF_EXC_RETURN_THREAD_PSP == pu32Sp[i]) {
+            pu32Frame = (const uint32_t *)__get_PSP();
+        } else if ((PROF_EXC_RETURN_THREAD_MSP == pu32Sp[i]) || (PROF_EXC_RETURN_HANDLER == pu32Sp[i])) {
+            pu32Frame = &pu32Sp[i + 1UL];
+        } else {
+            continue;
+        }
+        if (0UL != (pu32Frame[PROF_FRAME_XPSR] & PROF_XPSR_T)) {
+            return pu32Frame;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief  Append a word in hexadecimal to a dump line.
+ * @param  [out] pcLine                 Line
+ * @param  [in] u32Len                  Characters in the line
+ * @param  [in] u32Val                  Word
+ * @retval Characters in the line
+ */
+static uint32_t PROF_PutHex(char *pcLine, uint32_t u32Len, uint32_t u32Val)
+{
+    static const char acHex[] = "0123456789abcdef";
+    uint32_t i;
+
+    if (0UL != u32Len) {
+        pcLine[u32Len++] = ' ';
+    }
+    for (i = 0UL; i < 8UL; i++) {
+        pcLine[u32Len++] = acHex[(u32Val >> (28UL - (4UL * i))) & 0xFUL];
+    }
+    return u32Len;
+}
+
+/**
+ * @brief  Send a dump line.
+ * @param  [in] USARTx                  Pointer to USART instance register base
+ * @param  [in] pcLine                  Line, room for the line break included
+ * @param  [in] u32Len                  Characters in the line
+ * @param  [in] u32Timeout              Timeout of the transmission
+ * @retval int32_t:
+ *           - LL_OK:                   Sent.
+ *           - LL_ERR_TIMEOUT:          Timeout.
+ */
+static int32_t PROF_PutLine(CM_USART_TypeDef *USARTx, char *pcLine, uint32_t u32Len, uint32_t u32Timeout)
+{
+    pcLine[u32Len++] = '\r';
+    pcLine[u32Len++] = '\n';
+    return USART_UART_Trans(USARTx, pcLine, u32Len, u32Timeout);
+}
+
+#if (LL_INTERRUPTS_ENABLE == DDL_ON)
+/**
+ * @brief  TMRB overflow IRQ callback.
+ * @param  None
+ * @retval None
+ */
+static void PROF_TmrbOvf_IrqCallback(void)
+{
+    PROF_TimerIrqHandler(m_stcProf.TMRBx);
+}
+#endif /* LL_INTERRUPTS_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup PROF_Global_Functions PROF Global Functions
+ * @{
+ */
+
+/**
+ * @brief  Set the members of the structure stc_prof_init_t to default values.
+ * @param  [out] pstcProfInit           Pointer to a @ref stc_prof_init_t structure.
+ * @retval int32_t:
+ *           - LL_OK:                   Initialize successfully.
+ *           - LL_ERR_INVD_PARAM:       pstcProfInit is NULL.
+ * @note   u32TextEnd, pu16Bin and u32BinNum have no default.
+ */
+int32_t PROF_StructInit(stc_prof_init_t *pstcProfInit)
+{
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+
+    if (NULL != pstcProfInit) {
+        pstcProfInit->u32TextStart = 0UL;
+        pstcProfInit->u32TextEnd = 0UL;
+        pstcProfInit->pu16Bin = NULL;
+        pstcProfInit->u32BinNum = 0UL;
+        pstcProfInit->u16ClockDiv = TMRB_CLK_DIV1;
+        pstcProfInit->u16Period = 0xFFFFU;
+        i32Ret = LL_OK;
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Initialize the profiler, stopped.
+ * @param  [in] TMRBx                   Pointer to TMRB instance register base, the sampling timer.
+ *         This parameter can be one of the following values:
+ *           @arg CM_TMRB_x:            TMRB unit instance register base
+ * @param  [in] pstcProfInit            Pointer to a @ref stc_prof_init_t structure.
+ * @retval int32_t:
+ *           - LL_OK:                   Initialize successfully.
+ *           - LL_ERR_INVD_PARAM:       pstcProfInit is NULL, the range is empty or there is no bin.
+ * @note   The TMRB peripheral clock must be enabled. Sample at a rate which is not a
+ *         multiple of the periodic work of the application, or the samples alias.
+ */
+int32_t PROF_Init(CM_TMRB_TypeDef *TMRBx, const stc_prof_init_t *pstcProfInit)
+{
+    stc_tmrb_init_t stcTmrbInit;
+    uint32_t u32Primask;
+    uint32_t u32Shift = 1UL;
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+
+    DDL_ASSERT(IS_PROF_TMRB_UNIT(TMRBx));
+
+    if ((NULL != pstcProfInit) && (NULL != pstcProfInit->pu16Bin) && (0UL != pstcProfInit->u32BinNum) &&
+        (pstcProfInit->u32TextEnd > pstcProfInit->u32TextStart)) {
+        /* Thumb instructions are halfword aligned: 2 bytes per bin at least */
+        while (((pstcProfInit->u32TextEnd - pstcProfInit->u32TextStart - 1UL) >> u32Shift) >= pstcProfInit->u32BinNum) {
+            u32Shift++;
+        }
+
+        TMRB_Stop(TMRBx);
+        TMRB_IntCmd(TMRBx, TMRB_INT_OVF, DISABLE);
+        LL_ENTER_CRITICAL(u32Primask);
+        m_stcProf.TMRBx = TMRBx;
+        m_stcProf.pu16Bin = pstcProfInit->pu16Bin;
+        m_stcProf.u32BinNum = pstcProfInit->u32BinNum;
+        m_stcProf.u32Start = pstcProfInit->u32TextStart;
+        m_stcProf.u32End = pstcProfInit->u32TextEnd;
+        m_stcProf.u32Shift = u32Shift;
+        LL_EXIT_CRITICAL(u32Primask);
+        PROF_Clear();
+
+        (void)TMRB_StructInit(&stcTmrbInit);
+        stcTmrbInit.sw_count.u16ClockDiv = pstcProfInit->u16ClockDiv;
+        stcTmrbInit.sw_count.u16CountMode = TMRB_MD_SAWTOOTH;
+        stcTmrbInit.sw_count.u16CountDir = TMRB_DIR_UP;
+        stcTmrbInit.u16PeriodValue = pstcProfInit->u16Period;
+        i32Ret = TMRB_Init(TMRBx, &stcTmrbInit);
+        if (LL_OK == i32Ret) {
+            TMRB_ClearStatus(TMRBx, TMRB_FLAG_OVF);
+            TMRB_IntCmd(TMRBx, TMRB_INT_OVF, ENABLE);
+        }
+    }
+
+    return i32Ret;
+}
+
+#if (LL_INTERRUPTS_ENABLE == DDL_ON)
+/**
+ * @brief  Register the TMRB overflow interrupt source and enable the NVIC IRQ.
+ * @param  [in] TMRBx                   Pointer to TMRB instance register base, as passed to PROF_Init().
+ * @param  [in] enIRQn                  IRQ number for INT_SRC_TMRB_x_OVF, @ref INTC_IrqSignIn for details.
+ * @param  [in] u32IrqPrio              IRQ priority, @ref INTC_Priority_Sel for details. Use the highest
+ *                                      one, or the code of the higher priority ISRs is never sampled.
+ * @retval int32_t:
+ *           - LL_OK:                   Success
+ *           - LL_ERR_INVD_PARAM:       The IRQ number doesn't match the interrupt source.
+ * @note   INTC registers must be unlocked, @ref LL_PERIPH_WE for details.
+ */
+int32_t PROF_IrqSignIn(CM_TMRB_TypeDef *TMRBx, IRQn_Type enIRQn, uint32_t u32IrqPrio)
+{
+    static const CM_TMRB_TypeDef *const apstcUnit[] = {
+        CM_TMRB_1, CM_TMRB_2, CM_TMRB_3, CM_TMRB_4, CM_TMRB_5, CM_TMRB_6, CM_TMRB_7, CM_TMRB_8
+    };
+    static const en_int_src_t aenIntSrc[] = {
+        INT_SRC_TMRB_1_OVF, INT_SRC_TMRB_2_OVF, INT_SRC_TMRB_3_OVF, INT_SRC_TMRB_4_OVF,
+        INT_SRC_TMRB_5_OVF, INT_SRC_TMRB_6_OVF, INT_SRC_TMRB_7_OVF, INT_SRC_TMRB_8_OVF
+    };
+    stc_irq_signin_config_t stcIrqSignConfig;
+    uint32_t i;
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+
+    DDL_ASSERT(IS_PROF_TMRB_UNIT(TMRBx));
+
+    for (i = 0UL; i < ARRAY_SZ(apstcUnit); i++) {
+        if (TMRBx == apstcUnit[i]) {
+            stcIrqSignConfig.enIntSrc = aenIntSrc[i];
+            stcIrqSignConfig.enIRQn = enIRQn;
+            stcIrqSignConfig.pfnCallback = &PROF_TmrbOvf_IrqCallback;
+            i32Ret = INTC_IrqSignIn(&stcIrqSignConfig);
+            break;
+        }
+    }
+    if (LL_OK == i32Ret) {
+        NVIC_ClearPendingIRQ(enIRQn);
+        NVIC_SetPriority(enIRQn, u32IrqPrio);
+        NVIC_EnableIRQ(enIRQn);
+    }
+
+    return i32Ret;
+}
+#endif /* LL_INTERRUPTS_ENABLE */
+
+/**
+ * @brief  Start sampling.
+ * @param  None
+ * @retval None
+ */
+void PROF_Start(void)
+{
+    if (NULL != m_stcProf.TMRBx) {
+        TMRB_Start(m_stcProf.TMRBx);
+    }
+}
+
+/**
+ * @brief  Stop sampling, the histogram is kept.
+ * @param  None
+ * @retval None
+ */
+void PROF_Stop(void)
+{
+    if (NULL != m_stcProf.TMRBx) {
+        TMRB_Stop(m_stcProf.TMRBx);
+    }
+}
+
+/**
+ * @brief  Clear the histogram and the sample counts.
+ * @param  None
+ * @retval None
+ */
+void PROF_Clear(void)
+{
+    uint32_t u32Primask;
+    uint32_t i;
+
+    LL_ENTER_CRITICAL(u32Primask);
+    for (i = 0UL; i < m_stcProf.u32BinNum; i++) {
+        m_stcProf.pu16Bin[i] = 0U;
+    }
+    m_stcProf.u32Samples = 0UL;
+    m_stcProf.u32Outside = 0UL;
+    LL_EXIT_CRITICAL(u32Primask);
+}
+
+/**
+ * @brief  Count a sample.
+ * @param  [in] u32Pc                   Sampled address
+ * @retval None
+ * @note   Called by PROF_TimerIrqHandler(), or by any code which has a PC to count.
+ */
+void PROF_AddSample(uint32_t u32Pc)
+{
+    uint16_t *pu16Bin;
+
+    if (0UL == m_stcProf.u32BinNum) {
+        return;
+    }
+    m_stcProf.u32Samples++;
+    if ((u32Pc >= m_stcProf.u32Start) && (u32Pc < m_stcProf.u32End)) {
+        pu16Bin = &m_stcProf.pu16Bin[(u32Pc - m_stcProf.u32Start) >> m_stcProf.u32Shift];
+        if (PROF_BIN_MAX != *pu16Bin) {
+            (*pu16Bin)++;
+        }
+    } else {
+        m_stcProf.u32Outside++;
+    }
+}
+
+/**
+ * @brief  Get the number of samples taken since the last clear.
+ * @param  None
+ * @retval Samples, including those outside the range
+ */
+uint32_t PROF_GetSampleCount(void)
+{
+    return m_stcProf.u32Samples;
+}
+
+/**
+ * @brief  Send the histogram as text, polling.
+ * @param  [in] USARTx                  Pointer to USART instance register base, in UART mode
+ *                                      with TX enabled, not in asynchronous mode.
+ * @param  [in] u32Timeout              Timeout of each line, as USART_UART_Trans().
+ * @retval int32_t:
+ *           - LL_OK:                   Sent.
+ *           - LL_ERR_UNINIT:           PROF_Init() was not called.
+ *           - LL_ERR_TIMEOUT:          Timeout.
+ * @note   The lines, hexadecimal words:
+ *         "PROF <start> <log2 bin size> <bins> <samples> <samples outside>",
+ *         then "<bin> <count>" for every bin which counted, then "END".
+ * @note   Stop the profiler first for a consistent snapshot.
+ */
+int32_t PROF_Dump(CM_USART_TypeDef *USARTx, uint32_t u32Timeout)
+{
+    char acLine[PROF_LINE_LEN];
+    uint32_t u32Len;
+    uint32_t i;
+    int32_t i32Ret = LL_ERR_UNINIT;
+
+    if (0UL != m_stcProf.u32BinNum) {
+        acLine[0] = 'P';
+        acLine[1] = 'R';
+        acLine[2] = 'O';
+        acLine[3] = 'F';
+        u32Len = PROF_PutHex(acLine, 4UL, m_stcProf.u32Start);
+        u32Len = PROF_PutHex(acLine, u32Len, m_stcProf.u32Shift);
+        u32Len = PROF_PutHex(acLine, u32Len, m_stcProf.u32BinNum);
+        u32Len = PROF_PutHex(acLine, u32Len, m_stcProf.u32Samples);
+        u32Len = PROF_PutHex(acLine, u32Len, m_stcProf.u32Outside);
+        i32Ret = PROF_PutLine(USARTx, acLine, u32Len, u32Timeout);
+
+        for (i = 0UL; (LL_OK == i32Ret) && (i < m_stcProf.u32BinNum); i++) {
+            if (0U != m_stcProf.pu16Bin[i]) {
+                u32Len = PROF_PutHex(acLine, 0UL, i);
+                u32Len = PROF_PutHex(acLine, u32Len, m_stcProf.pu16Bin[i]);
+                i32Ret = PROF_PutLine(USARTx, acLine, u32Len, u32Timeout);
+            }
+        }
+        if (LL_OK == i32Ret) {
+            acLine[0] = 'E';
+            acLine[1] = 'N';
+            acLine[2] = 'D';
+            i32Ret = PROF_PutLine(USARTx, acLine, 3UL, u32Timeout);
+        }
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  TMRB overflow IRQ handler: takes a sample.
+ * @param  [in] TMRBx                   Pointer to TMRB instance register base, as passed to PROF_Init().
+ * @retval None
+ * @note   Registered by PROF_IrqSignIn(). When the interrupt is shared, call it from the
+ *         TMRB_x_Ovf_IrqHandler() override, within PROF_FRAME_SCAN_MAX stack words of the
+ *         exception entry.
+ */
+void PROF_TimerIrqHandler(CM_TMRB_TypeDef *TMRBx)
+{
+    const uint32_t *pu32Frame;
+
+    TMRB_ClearStatus(TMRBx, TMRB_FLAG_OVF);
+    pu32Frame = PROF_GetFrame();
+    if (NULL != pu32Frame) {
+        PROF_AddSample(pu32Frame[PROF_FRAME_PC]);
+    }
+}
+
+/**
+ * @}
+ */
+
+#endif /* LL_PROF_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/******************************************************************************
+ * EOF (not truncated)
+ *****************************************************************************/
@@ -0,0 +1,440 @@
+/**
+ *******************************************************************************
+ * @file  hc32_ll_pwc_idle.c
+ * @brief This file provides firmware functions of the low-power idle governor:
+ *        sleep or stop mode from the next deadline, wakeup sources and clock
+ *        restore around stop mode, and residency statistics.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-16       CDT             First version
+   2026-10-17       CDT             Wake up on HRC only if HRC with the saved divider fits the flash wait
+                                    cycles and the power mode
+                                    Start HRC before stop mode also when the core wakes up on its own clock
+                                    Use LL_ENTER_CRITICAL()/LL_EXIT_CRITICAL()
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2022-2023, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_ll_pwc_idle.h"
+#include "hc32_ll_pwc.h"
+#include "hc32_ll_clk.h"
+#include "hc32_ll_efm.h"
+#include "hc32_ll_interrupts.h"
+#include "hc32_ll_tmr0_wheel.h"
+#include "hc32_ll_utility.h"
+
+/**
+ * @addtogroup LL_Driver
+ * @{
+ */
+
+/**
+ * @defgroup LL_PWC_IDLE PWC_IDLE
+ * @brief Low-power Idle Governor
+ * @{
+ */
+
+#if (LL_PWC_IDLE_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @defgroup PWC_IDLE_Local_Types PWC Idle Governor Local Types
+ * @{
+ */
+
+/**
+ * @brief Clock state saved before stop mode
+ */
+typedef struct {
+    uint8_t u8SysClkSrc;                /*!< CMU_CKSWR */
+    uint8_t u8SysClkDiv;                /*!< CMU_SCKDIVR */
+    uint8_t u8HrcCr;                    /*!< CMU_HRCCR */
+} stc_pwc_idle_clk_t;
+
+/**
+ * @brief Governor control block definition
+ */
+typedef struct {
+    stc_pwc_idle_init_t stcInit;
+    __IO uint32_t u32Inhibit;           /*!< Stop mode inhibit sources */
+    uint32_t u32StatStart;              /*!< Tick of the statistics start */
+    stc_pwc_idle_stat_t stcStat;
+} stc_pwc_idle_ctrl_t;
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup PWC_IDLE_Local_Macros PWC Idle Governor Local Macros
+ * @{
+ */
+#define PWC_IDLE_DEFAULT_STOP_MIN       (32UL)  /*!< 1ms of a 32.768kHz LRC tick */
+
+/**
+ * @defgroup PWC_IDLE_Check_Parameters_Validity PWC Idle Governor Check Parameters Validity
+ * @{
+ */
+#define IS_PWC_IDLE_WKUP_SRC(x)         (((x) & (~INTC_WUPEN_ALL)) == 0UL)
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+/**
+ * @defgroup PWC_IDLE_Local_Variables PWC Idle Governor Local Variables
+ * @{
+ */
+static stc_pwc_idle_ctrl_t m_stcPwcIdle;
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @defgroup PWC_IDLE_Local_Functions PWC Idle Governor Local Functions
+ * @{
+ */
+
+/**
+ * @brief  Get the statistics tick.
+ * @param  None
+ * @retval uint32_t                     Tick, 0 without a time base.
+ */
+static uint32_t PWC_Idle_GetTick(void)
+{
+    uint32_t u32Tick = 0UL;
+
+    if (NULL != m_stcPwcIdle.stcInit.pfnGetTick) {
+        u32Tick = m_stcPwcIdle.stcInit.pfnGetTick();
+    }
+
+    return u32Tick;
+}
+
+/**
+ * @brief  Check whether HRC may clock the core with the current divider.
+ * @param  [in] u8SysClkDiv             CMU_SCKDIVR value kept through the wakeup.
+ * @retval uint8_t                      1U if HCLK from HRC fits the flash wait cycles and the power mode.
+ */
+static uint8_t PWC_Idle_HrcAllowed(uint8_t u8SysClkDiv)
+{
+    uint32_t u32Hclk = HRC_VALUE >> (u8SysClkDiv & CMU_SCKDIVR_SCKDIV);
+    uint8_t u8Allowed = 1U;
+
+    if (PWC_PWRC_PWDRV != READ_REG8_BIT(CM_PWC->PWRC, PWC_PWRC_PWDRV)) {
+        if (u32Hclk > PWC_IDLE_LOW_SPEED_MAX_FREQ) {
+            u8Allowed = 0U;
+        }
+    }
+    if (0UL == READ_REG32_BIT(CM_EFM->FRMC, EFM_FRMC_FLWT)) {
+        if (u32Hclk > PWC_IDLE_WAIT_CYCLE0_MAX_FREQ) {
+            u8Allowed = 0U;
+        }
+    }
+
+    return u8Allowed;
+}
+
+/**
+ * @brief  Save the system clock and make the core wake up from stop mode on HRC if allowed.
+ * @param  [out] pstcClk                Clock state
+ * @retval None
+ * @note   Waking up on HRC avoids waiting for XTAL in the wakeup sequence, the
+ *         system clock is switched back by PWC_Idle_ClockRestore().
+ * @note   The divider is kept through the wakeup. If HRC with it would be too fast for the
+ *         flash wait cycles or the ultra low speed mode, the core wakes up on its own clock.
+ * @note   HRC runs before stop mode in any case, as PWC_STOP_Enter() ensures.
+ */
+static void PWC_Idle_ClockSave(stc_pwc_idle_clk_t *pstcClk)
+{
+    pstcClk->u8SysClkSrc = READ_REG8_BIT(CM_CMU->CKSWR, CMU_CKSWR_CKSW);
+    pstcClk->u8SysClkDiv = READ_REG8(CM_CMU->SCKDIVR);
+    pstcClk->u8HrcCr = READ_REG8(CM_CMU->HRCCR);
+
+    /* Ensure HRC is enabled before enter stop mode, restored by PWC_Idle_ClockRestore() */
+    CLR_REG8_BIT(CM_CMU->HRCCR, CMU_HRCCR_HRCSTP);
+    if ((CLK_SYSCLK_SRC_HRC == pstcClk->u8SysClkSrc) || (0U == PWC_Idle_HrcAllowed(pstcClk->u8SysClkDiv))) {
+        MODIFY_REG8(CM_PWC->STPMCR, PWC_STPMCR_CKSHRC, PWC_STOP_CLK_KEEP);
+    } else {
+        MODIFY_REG8(CM_PWC->STPMCR, PWC_STPMCR_CKSHRC, PWC_STOP_CLK_HRC);
+    }
+}
+
+/**
+ * @brief  Restore the system clock saved by PWC_Idle_ClockSave().
+ * @param  [in] pstcClk                 Clock state
+ * @retval int32_t:
+ *           - LL_OK:                   Restored.
+ *           - LL_ERR_TIMEOUT:          XTAL did not stabilize, the core stays on HRC.
+ * @note   Registers are written directly: no settling delays of the CLK driver, and
+ *         SystemCoreClock is only updated if the clock differs from the one before stop mode.
+ */
+static int32_t PWC_Idle_ClockRestore(const stc_pwc_idle_clk_t *pstcClk)
+{
+    uint32_t u32Timeout = 0UL;
+    int32_t i32Ret = LL_OK;
+
+    if (pstcClk->u8SysClkSrc != READ_REG8_BIT(CM_CMU->CKSWR, CMU_CKSWR_CKSW)) {
+        if (CLK_SYSCLK_SRC_XTAL == pstcClk->u8SysClkSrc) {
+            while (0U == READ_REG8_BIT(CM_CMU->OSCSTBSR, CMU_OSCSTBSR_XTALSTBF)) {
+                if (u32Timeout++ >= PWC_IDLE_XTAL_TIMEOUT) {
+                    i32Ret = LL_ERR_TIMEOUT;
+                    break;
+                }
+            }
+        }
+        if (LL_OK == i32Ret) {
+            WRITE_REG8(CM_CMU->CKSWR, pstcClk->u8SysClkSrc);
+        }
+    }
+    if (LL_OK == i32Ret) {
+        /* Source first: the divider was set up for it */
+        if (pstcClk->u8SysClkDiv != READ_REG8(CM_CMU->SCKDIVR)) {
+            WRITE_REG8(CM_CMU->SCKDIVR, pstcClk->u8SysClkDiv);
+        }
+        WRITE_REG8(CM_CMU->HRCCR, pstcClk->u8HrcCr);
+    } else {
+        /* HRC keeps running with the divider of the wakeup */
+        SystemCoreClockUpdate();
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup PWC_IDLE_Global_Functions PWC Idle Governor Global Functions
+ * @{
+ */
+
+/**
+ * @brief  Set the fields of structure stc_pwc_idle_init_t to default values.
+ * @param  [out] pstcIdleInit           Pointer to a @ref stc_pwc_idle_init_t structure.
+ * @retval int32_t:
+ *           - LL_OK:                   Initialize successfully.
+ *           - LL_ERR_INVD_PARAM:       pstcIdleInit is NULL.
+ * @note   With LL_TMR0_WHEEL_ENABLE, the deadlines and the ticks come from the TMR0 timer wheel,
+ *         which wakes the core up with its compare match.
+ */
+int32_t PWC_Idle_StructInit(stc_pwc_idle_init_t *pstcIdleInit)
+{
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+
+    if (NULL != pstcIdleInit) {
+        pstcIdleInit->u32StopMinTicks = PWC_IDLE_DEFAULT_STOP_MIN;
+#if (LL_TMR0_WHEEL_ENABLE == DDL_ON)
+        pstcIdleInit->u32WakeupSrc = INTC_STOP_WKUP_TMR0_CMP;
+        pstcIdleInit->pfnGetIdleTicks = &TMR0_Wheel_GetIdleTicks;
+        pstcIdleInit->pfnGetTick = &TMR0_Wheel_GetTick;
+#else
+        pstcIdleInit->u32WakeupSrc = 0UL;
+        pstcIdleInit->pfnGetIdleTicks = NULL;
+        pstcIdleInit->pfnGetTick = NULL;
+#endif
+        i32Ret = LL_OK;
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Initialize the idle governor and clear the statistics and the stop inhibits.
+ * @param  [in] pstcIdleInit            Pointer to a @ref stc_pwc_idle_init_t structure.
+ * @retval int32_t:
+ *           - LL_OK:                   Initialize successfully.
+ *           - LL_ERR_INVD_PARAM:       pstcIdleInit is NULL.
+ */
+int32_t PWC_Idle_Init(const stc_pwc_idle_init_t *pstcIdleInit)
+{
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+
+    if (NULL != pstcIdleInit) {
+        DDL_ASSERT(IS_PWC_IDLE_WKUP_SRC(pstcIdleInit->u32WakeupSrc));
+
+        m_stcPwcIdle.stcInit = *pstcIdleInit;
+        m_stcPwcIdle.u32Inhibit = 0UL;
+        PWC_Idle_ClearStat();
+        i32Ret = LL_OK;
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Set or clear stop mode inhibits, while any is set the governor uses sleep mode only.
+ * @param  [in] u32Inhibit              Inhibit bits, their meaning is up to the application:
+ *                                      typically one per peripheral whose clock must keep running,
+ *                                      such as a USART shifting out data.
+ * @param  [in] enNewState              An @ref en_functional_state_t enumeration value.
+ * @retval None
+ * @note   Can be called from IRQ handlers.
+ */
+void PWC_Idle_StopInhibitCmd(uint32_t u32Inhibit, en_functional_state_t enNewState)
+{
+    uint32_t u32Primask;
+
+    DDL_ASSERT(IS_FUNCTIONAL_STATE(enNewState));
+
+    LL_ENTER_CRITICAL(u32Primask);
+    if (ENABLE == enNewState) {
+        m_stcPwcIdle.u32Inhibit |= u32Inhibit;
+    } else {
+        m_stcPwcIdle.u32Inhibit &= ~u32Inhibit;
+    }
+    LL_EXIT_CRITICAL(u32Primask);
+}
+
+/**
+ * @brief  Enter the deepest low-power mode the next deadline and the inhibits allow.
+ * @param  None
+ * @retval uint8_t                      Mode used, @ref PWC_IDLE_Mode.
+ * @note   Call it from the idle loop. The interrupts are masked from the decision until the
+ *         clock is restored, so the handler of the wakeup interrupt runs on the original clock,
+ *         when this function returns.
+ * @note   PWC, CLK and INTC registers must be unlocked, @ref LL_PERIPH_WE for details.
+ * @note   HCLK, thus SysTick, stops in stop mode.
+ */
+uint8_t PWC_Idle_Enter(void)
+{
+    uint32_t u32Primask;
+    uint32_t u32Idle = 0xFFFFFFFFUL;
+    uint32_t u32Start;
+    uint32_t u32WakeupSrc;
+    stc_pwc_idle_clk_t stcClk;
+    stc_pwc_idle_ctrl_t *pstcCtrl = &m_stcPwcIdle;
+    uint8_t u8Mode = PWC_IDLE_MD_NONE;
+
+    LL_ENTER_CRITICAL(u32Primask);
+    if (NULL != pstcCtrl->stcInit.pfnGetIdleTicks) {
+        u32Idle = pstcCtrl->stcInit.pfnGetIdleTicks();
+    }
+    if (0UL != u32Idle) {
+        u32Start = PWC_Idle_GetTick();
+        if ((0UL != pstcCtrl->u32Inhibit) || (u32Idle < pstcCtrl->stcInit.u32StopMinTicks)) {
+            u8Mode = PWC_IDLE_MD_SLEEP;
+            PWC_SLEEP_Enter();
+            pstcCtrl->stcStat.u32SleepCount++;
+            pstcCtrl->stcStat.u32SleepTicks += PWC_Idle_GetTick() - u32Start;
+        } else {
+            u8Mode = PWC_IDLE_MD_STOP;
+            u32WakeupSrc = READ_REG32(CM_INTC->WUPEN);
+            WRITE_REG32(CM_INTC->WUPEN, u32WakeupSrc | pstcCtrl->stcInit.u32WakeupSrc);
+            PWC_Idle_ClockSave(&stcClk);
+
+            SET_REG8_BIT(CM_PWC->STPMCR, PWC_STPMCR_STOP);
+            __WFI();
+            /* A later WFI must not enter stop mode */
+            CLR_REG8_BIT(CM_PWC->STPMCR, PWC_STPMCR_STOP);
+
+            if (LL_OK != PWC_Idle_ClockRestore(&stcClk)) {
+                pstcCtrl->stcStat.u32XtalTimeout++;
+            }
+            WRITE_REG32(CM_INTC->WUPEN, u32WakeupSrc);
+            pstcCtrl->stcStat.u32StopCount++;
+            pstcCtrl->stcStat.u32StopTicks += PWC_Idle_GetTick() - u32Start;
+        }
+    }
+    LL_EXIT_CRITICAL(u32Primask);
+
+    return u8Mode;
+}
+
+/**
+ * @brief  Get the residency statistics.
+ * @param  [out] pstcStat               Pointer to a @ref stc_pwc_idle_stat_t structure.
+ * @retval int32_t:
+ *           - LL_OK:                   Success
+ *           - LL_ERR_INVD_PARAM:       pstcStat is NULL.
+ * @note   The run time is u32TotalTicks - u32SleepTicks - u32StopTicks.
+ */
+int32_t PWC_Idle_GetStat(stc_pwc_idle_stat_t *pstcStat)
+{
+    uint32_t u32Primask;
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+
+    if (NULL != pstcStat) {
+        LL_ENTER_CRITICAL(u32Primask);
+        *pstcStat = m_stcPwcIdle.stcStat;
+        pstcStat->u32TotalTicks = PWC_Idle_GetTick() - m_stcPwcIdle.u32StatStart;
+        LL_EXIT_CRITICAL(u32Primask);
+        i32Ret = LL_OK;
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Clear the residency statistics.
+ * @param  None
+ * @retval None
+ */
+void PWC_Idle_ClearStat(void)
+{
+    uint32_t u32Primask;
+
+    LL_ENTER_CRITICAL(u32Primask);
+    m_stcPwcIdle.stcStat.u32SleepCount = 0UL;
+    m_stcPwcIdle.stcStat.u32SleepTicks = 0UL;
+    m_stcPwcIdle.stcStat.u32StopCount = 0UL;
+    m_stcPwcIdle.stcStat.u32StopTicks = 0UL;
+    m_stcPwcIdle.stcStat.u32TotalTicks = 0UL;
+    m_stcPwcIdle.stcStat.u32XtalTimeout = 0UL;
+    m_stcPwcIdle.u32StatStart = PWC_Idle_GetTick();
+    LL_EXIT_CRITICAL(u32Primask);
+}
+
+/**
+ * @}
+ */
+
+#endif /* LL_PWC_IDLE_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/******************************************************************************
+ * EOF (not truncated)
+ *****************************************************************************/
@@ -0,0 +1,378 @@
+/**
+ *******************************************************************************
+ * @file  hc32_ll_sched.c
+ * @brief This file provides firmware functions to run event-driven tasks to
+ *        completion on a single stack, in priority order.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-16       CDT             First version
+   2026-10-17       CDT             Use LL_ENTER_CRITICAL()/LL_EXIT_CRITICAL()
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2022-2023, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_ll_sched.h"
+#include "hc32_ll_pwc.h"
+#include "hc32_ll_utility.h"
+
+/**
+ * @addtogroup LL_Driver
+ * @{
+ */
+
+/**
+ * @defgroup LL_SCHED SCHED
+ * @brief Cooperative Event Scheduler
+ * @{
+ */
+
+#if (LL_SCHED_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @defgroup SCHED_Local_Types SCHED Local Types
+ * @{
+ */
+
+/**
+ * @brief Scheduler ready queues definition
+ */
+typedef struct {
+    stc_sched_task_t *apstcHead[SCHED_PRIO_NUM];
+    stc_sched_task_t *apstcTail[SCHED_PRIO_NUM];
+    __IO uint32_t u32ReadyMask;         /*!< Bit n set while the queue of priority n is not empty. */
+} stc_sched_ctrl_t;
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup SCHED_Local_Macros SCHED Local Macros
+ * @{
+ */
+#if (SCHED_PRIO_NUM < 1U) || (SCHED_PRIO_NUM > 32U)
+#error "SCHED_PRIO_NUM must be 1 ~ 32."
+#endif
+
+/**
+ * @defgroup SCHED_Check_Parameters_Validity SCHED Check Parameters Validity
+ * @{
+ */
+#define IS_SCHED_PRIO(x)                ((x) < SCHED_PRIO_NUM)
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+/**
+ * @defgroup SCHED_Local_Variables SCHED Local Variables
+ * @{
+ */
+static stc_sched_ctrl_t m_stcSched;
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @defgroup SCHED_Local_Functions SCHED Local Functions
+ * @{
+ */
+
+/**
+ * @brief  Position of the lowest set bit, the highest ready priority.
+ * @param  [in] u32Bits                 Non-zero value.
+ * @retval uint32_t                     0 ~ 31
+ */
+static uint32_t SCHED_FirstSet(uint32_t u32Bits)
+{
+    uint32_t u32Pos = 0UL;
+
+    while (0UL == (u32Bits & 0xFFUL)) {
+        u32Pos += 8UL;
+        u32Bits >>= 8U;
+    }
+    while (0UL == (u32Bits & 0x1UL)) {
+        u32Pos++;
+        u32Bits >>= 1U;
+    }
+
+    return u32Pos;
+}
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup SCHED_Global_Functions SCHED Global Functions
+ * @{
+ */
+
+/**
+ * @brief  Initialize the scheduler, the ready queues are emptied.
+ * @param  None
+ * @retval None
+ * @note   Call it before any post, and before enabling the interrupts that post.
+ */
+void SCHED_Init(void)
+{
+    uint32_t i;
+
+    for (i = 0UL; i < SCHED_PRIO_NUM; i++) {
+        m_stcSched.apstcHead[i] = NULL;
+        m_stcSched.apstcTail[i] = NULL;
+    }
+    m_stcSched.u32ReadyMask = 0UL;
+}
+
+/**
+ * @brief  Initialize a task.
+ * @param  [out] pstcTask           Pointer to a @ref stc_sched_task_t structure.
+ * @param  [in] pfnRun              Task function, run to completion with the posted events.
+ * @param  [in] u8Prio              Priority, 0 (highest) ~ SCHED_PRIO_NUM - 1.
+ * @param  [in] pvUserData          User context, stored in the task.
+ * @retval int32_t:
+ *         - LL_OK:                 Success
+ *         - LL_ERR_INVD_PARAM:     pstcTask or pfnRun is NULL, or u8Prio is out of range.
+ * @note   Must not be called while the task can be posted.
+ */
+int32_t SCHED_TaskInit(stc_sched_task_t *pstcTask, void (*pfnRun)(stc_sched_task_t *pstcTask, uint32_t u32Events),
+                       uint8_t u8Prio, void *pvUserData)
+{
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+
+    if ((NULL != pstcTask) && (NULL != pfnRun) && IS_SCHED_PRIO(u8Prio)) {
+        pstcTask->pfnRun = pfnRun;
+        pstcTask->pvUserData = pvUserData;
+        pstcTask->u8Prio = u8Prio;
+        pstcTask->u8Queued = 0U;
+        pstcTask->u32Events = 0UL;
+        pstcTask->u32PostTime = 0UL;
+        pstcTask->pstcNext = NULL;
+        SCHED_ClearStat(pstcTask);
+        i32Ret = LL_OK;
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Post events to a task and make it ready.
+ * @param  [in] pstcTask            Pointer to an initialized @ref stc_sched_task_t structure.
+ * @param  [in] u32Events           Event bits, OR-ed into the pending events of the task.
+ * @retval int32_t:
+ *         - LL_OK:                 Success
+ *         - LL_ERR_INVD_PARAM:     pstcTask is NULL or u32Events is 0.
+ * @note   Can be called from IRQ handlers and tasks. Posts to a task that is ready already
+ *         are merged into its next run, a task is never queued twice.
+ */
+int32_t SCHED_Post(stc_sched_task_t *pstcTask, uint32_t u32Events)
+{
+    uint32_t u32Primask;
+    uint32_t u32Prio;
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+
+    if ((NULL != pstcTask) && (0UL != u32Events)) {
+        u32Prio = pstcTask->u8Prio;
+        LL_ENTER_CRITICAL(u32Primask);
+        pstcTask->u32Events |= u32Events;
+        if (0U == pstcTask->u8Queued) {
+            pstcTask->u8Queued = 1U;
+            pstcTask->u32PostTime = SysTick_GetMicros();
+            pstcTask->pstcNext = NULL;
+            if (NULL == m_stcSched.apstcTail[u32Prio]) {
+                m_stcSched.apstcHead[u32Prio] = pstcTask;
+            } else {
+                m_stcSched.apstcTail[u32Prio]->pstcNext = pstcTask;
+            }
+            m_stcSched.apstcTail[u32Prio] = pstcTask;
+            m_stcSched.u32ReadyMask |= 1UL << u32Prio;
+        }
+        LL_EXIT_CRITICAL(u32Primask);
+        i32Ret = LL_OK;
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Run the first task of the highest ready priority once.
+ * @param  None
+ * @retval int32_t:
+ *         - LL_OK:                 A task ran.
+ *         - LL_ERR_BUF_EMPTY:      No task is ready.
+ * @note   Tasks of the same priority run round robin. Call it from the main loop only.
+ */
+int32_t SCHED_RunOnce(void)
+{
+    uint32_t u32Primask;
+    uint32_t u32Prio;
+    uint32_t u32Events = 0UL;
+    uint32_t u32Start;
+    uint32_t u32Time;
+    stc_sched_task_t *pstcTask = NULL;
+    int32_t i32Ret = LL_ERR_BUF_EMPTY;
+
+    LL_ENTER_CRITICAL(u32Primask);
+    if (0UL != m_stcSched.u32ReadyMask) {
+        u32Prio = SCHED_FirstSet(m_stcSched.u32ReadyMask);
+        pstcTask = m_stcSched.apstcHead[u32Prio];
+        m_stcSched.apstcHead[u32Prio] = pstcTask->pstcNext;
+        if (NULL == pstcTask->pstcNext) {
+            m_stcSched.apstcTail[u32Prio] = NULL;
+            m_stcSched.u32ReadyMask &= ~(1UL << u32Prio);
+        }
+        u32Events = pstcTask->u32Events;
+        pstcTask->u32Events = 0UL;
+        pstcTask->u8Queued = 0U;
+    }
+    LL_EXIT_CRITICAL(u32Primask);
+
+    if (NULL != pstcTask) {
+        u32Start = SysTick_GetMicros();
+        u32Time = u32Start - pstcTask->u32PostTime;
+        if (u32Time > pstcTask->stcStat.u32LatencyMax) {
+            pstcTask->stcStat.u32LatencyMax = u32Time;
+        }
+
+        pstcTask->pfnRun(pstcTask, u32Events);
+
+        u32Time = SysTick_GetMicros() - u32Start;
+        pstcTask->stcStat.u32RunCount++;
+        pstcTask->stcStat.u32RunTime += u32Time;
+        if (u32Time > pstcTask->stcStat.u32RunTimeMax) {
+            pstcTask->stcStat.u32RunTimeMax = u32Time;
+        }
+        i32Ret = LL_OK;
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Scheduler main loop: runs the ready tasks and calls SCHED_Idle() when there is none.
+ * @param  None
+ * @retval None
+ * @note   Never returns. The ready check and SCHED_Idle() run with the interrupts masked, so a
+ *         post from an IRQ handler in between still wakes the core up.
+ */
+void SCHED_Run(void)
+{
+    uint32_t u32Primask;
+
+    for (;;) {
+        if (LL_ERR_BUF_EMPTY == SCHED_RunOnce()) {
+            LL_ENTER_CRITICAL(u32Primask);
+            if (0UL == m_stcSched.u32ReadyMask) {
+                SCHED_Idle();
+            }
+            LL_EXIT_CRITICAL(u32Primask);
+        }
+    }
+}
+
+/**
+ * @brief  Called by SCHED_Run() with the interrupts masked when no task is ready.
+ * @param  None
+ * @retval None
+ * @note   Enters sleep mode (PWC registers must be unlocked, @ref LL_PERIPH_WE for details),
+ *         or WFI without the PWC driver. The interrupt that wakes the core up runs after return.
+ * @note   This function may be overridden by the application, e.g. to enter stop mode.
+ */
+__WEAKDEF void SCHED_Idle(void)
+{
+#if (LL_PWC_ENABLE == DDL_ON)
+    PWC_SLEEP_Enter();
+#else
+    __WFI();
+#endif
+}
+
+/**
+ * @brief  Get the statistics of a task.
+ * @param  [in] pstcTask            Pointer to an initialized @ref stc_sched_task_t structure.
+ * @param  [out] pstcStat           Pointer to a @ref stc_sched_stat_t structure.
+ * @retval int32_t:
+ *         - LL_OK:                 Success
+ *         - LL_ERR_INVD_PARAM:     pstcTask or pstcStat is NULL.
+ */
+int32_t SCHED_GetStat(const stc_sched_task_t *pstcTask, stc_sched_stat_t *pstcStat)
+{
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+
+    if ((NULL != pstcTask) && (NULL != pstcStat)) {
+        *pstcStat = pstcTask->stcStat;
+        i32Ret = LL_OK;
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Clear the statistics of a task.
+ * @param  [in] pstcTask            Pointer to an initialized @ref stc_sched_task_t structure.
+ * @retval None
+ */
+void SCHED_ClearStat(stc_sched_task_t *pstcTask)
+{
+    if (NULL != pstcTask) {
+        pstcTask->stcStat.u32RunCount = 0UL;
+        pstcTask->stcStat.u32RunTime = 0UL;
+        pstcTask->stcStat.u32RunTimeMax = 0UL;
+        pstcTask->stcStat.u32LatencyMax = 0UL;
+    }
+}
+
+/**
+ * @}
+ */
+
+#endif /* LL_SCHED_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/******************************************************************************
+ * EOF (not truncated)
+ *****************************************************************************/
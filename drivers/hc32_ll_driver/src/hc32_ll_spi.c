@@ -8,6 +8,7 @@
    Date             Author          Notes
    2022-03-31       CDT             First version
    2022-06-30       CDT             Modify API SPI_TxRx(),SPI_Tx()
+   2026-10-16       CDT             Add API SPI_PipelineTransReceive()
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2022-2023, Xiaohua Semiconductor Co., Ltd. All rights reserved.
@@ -312,6 +313,112 @@ static int32_t SPI_Tx(CM_SPI_TypeDef *SPIx, const void *pvTxBuf, uint32_t u32Len
     return i32Ret;
 }
 
+/**
+ * @brief  SPI full duplex transfer of 8-bit frames with the TX buffer kept primed.
+ * @param  [in]  SPIx               SPI unit
+ *   @arg CM_SPIx or CM_SPI
+ * @param  [in]  pu8TxBuf           The pointer to the data to be sent.
+ * @param  [in]  u32TxStep          TX pointer increment, 0 to repeat the same frame.
+ * @param  [out] pu8RxBuf           The pointer to the buffer which the received data will be stored.
+ * @param  [in]  u32RxStep          RX pointer increment, 0 to discard the received frames.
+ * @param  [in]  u32Len             The length of the data in byte.
+ * @param  [in]  u32Timeout         Timeout value.
+ * @retval int32_t:
+ *         - LL_OK:                 No errors occurred
+ *         - LL_ERR:                SPI overload error.
+ *         - LL_ERR_TIMEOUT:        SPI transmit and receive timeout.
+ * @note   Frame N+1 is written as soon as the TX buffer is empty while frame N is shifted out,
+ *         so at most two frames are in flight and the receive buffer never overflows unless
+ *         the loop is stalled for more than one frame time.
+ */
+static int32_t SPI_TxRxPipeline8(CM_SPI_TypeDef *SPIx, const uint8_t *pu8TxBuf, uint32_t u32TxStep,
+                                 uint8_t *pu8RxBuf, uint32_t u32RxStep, uint32_t u32Len, uint32_t u32Timeout)
+{
+    uint32_t u32Status;
+    uint32_t u32TxRemain = u32Len;
+    uint32_t u32RxRemain = u32Len;
+    uint32_t u32Wait = u32Timeout;
+    int32_t i32Ret = LL_OK;
+
+    while (u32RxRemain != 0UL) {
+        u32Status = READ_REG32(SPIx->SR);
+        if ((u32TxRemain != 0UL) && ((u32RxRemain - u32TxRemain) < 2UL) &&
+            ((u32Status & SPI_FLAG_TX_BUF_EMPTY) != 0UL)) {
+            WRITE_REG32(SPIx->DR, *pu8TxBuf);
+            pu8TxBuf += u32TxStep;
+            u32TxRemain--;
+        }
+        if ((u32Status & SPI_FLAG_RX_BUF_FULL) != 0UL) {
+            *pu8RxBuf = (uint8_t)READ_REG32(SPIx->DR);
+            pu8RxBuf += u32RxStep;
+            u32RxRemain--;
+            u32Wait = u32Timeout;
+        } else if ((u32Status & SPI_FLAG_OVERLOAD) != 0UL) {
+            i32Ret = LL_ERR;
+            break;
+        } else if (u32Wait == 0UL) {
+            i32Ret = LL_ERR_TIMEOUT;
+            break;
+        } else {
+            u32Wait--;
+        }
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  SPI full duplex transfer of 16-bit frames with the TX buffer kept primed.
+ * @param  [in]  SPIx               SPI unit
+ *   @arg CM_SPIx or CM_SPI
+ * @param  [in]  pu16TxBuf          The pointer to the data to be sent.
+ * @param  [in]  u32TxStep          TX pointer increment, 0 to repeat the same frame.
+ * @param  [out] pu16RxBuf          The pointer to the buffer which the received data will be stored.
+ * @param  [in]  u32RxStep          RX pointer increment, 0 to discard the received frames.
+ * @param  [in]  u32Len             The length of the data in half word.
+ * @param  [in]  u32Timeout         Timeout value.
+ * @retval int32_t:
+ *         - LL_OK:                 No errors occurred
+ *         - LL_ERR:                SPI overload error.
+ *         - LL_ERR_TIMEOUT:        SPI transmit and receive timeout.
+ * @note   Same scheme as SPI_TxRxPipeline8().
+ */
+static int32_t SPI_TxRxPipeline16(CM_SPI_TypeDef *SPIx, const uint16_t *pu16TxBuf, uint32_t u32TxStep,
+                                  uint16_t *pu16RxBuf, uint32_t u32RxStep, uint32_t u32Len, uint32_t u32Timeout)
+{
+    uint32_t u32Status;
+    uint32_t u32TxRemain = u32Len;
+    uint32_t u32RxRemain = u32Len;
+    uint32_t u32Wait = u32Timeout;
+    int32_t i32Ret = LL_OK;
+
+    while (u32RxRemain != 0UL) {
+        u32Status = READ_REG32(SPIx->SR);
+        if ((u32TxRemain != 0UL) && ((u32RxRemain - u32TxRemain) < 2UL) &&
+            ((u32Status & SPI_FLAG_TX_BUF_EMPTY) != 0UL)) {
+            WRITE_REG32(SPIx->DR, *pu16TxBuf);
+            pu16TxBuf += u32TxStep;
+            u32TxRemain--;
+        }
+        if ((u32Status & SPI_FLAG_RX_BUF_FULL) != 0UL) {
+            *pu16RxBuf = (uint16_t)READ_REG32(SPIx->DR);
+            pu16RxBuf += u32RxStep;
+            u32RxRemain--;
+            u32Wait = u32Timeout;
+        } else if ((u32Status & SPI_FLAG_OVERLOAD) != 0UL) {
+            i32Ret = LL_ERR;
+            break;
+        } else if (u32Wait == 0UL) {
+            i32Ret = LL_ERR_TIMEOUT;
+            break;
+        } else {
+            u32Wait--;
+        }
+    }
+
+    return i32Ret;
+}
+
 /**
  * @}
  */
@@ -658,6 +765,64 @@ int32_t SPI_TransReceive(CM_SPI_TypeDef *SPIx, const void *pvTxBuf, void *pvRxBu
     }
     return i32Ret;
 }
+
+/**
+ * @brief  SPI transmit and receive data in pipelined mode.
+ * @param  [in]  SPIx               SPI unit
+ *   @arg CM_SPIx or CM_SPI
+ * @param  [in]  pvTxBuf            The pointer to the buffer which contains the data to be sent.
+ *                                  If this pointer is NULL, the MOSI output high.
+ * @param  [out] pvRxBuf            The pointer to the buffer which the received data will be stored.
+ *                                  If this pointer is NULL, the received data is discarded.
+ * @param  [in]  u32Len             The length of the data(in byte or half word) to be sent and received.
+ * @param  [in]  u32Timeout         Timeout value.
+ * @retval int32_t:
+ *         - LL_OK:                 No errors occurred
+ *         - LL_ERR:                SPI overload error, the data was not read within one frame time.
+ *         - LL_ERR_TIMEOUT:        SPI transmit and receive timeout.
+ *         - LL_ERR_INVD_PARAM:     pvTxBuf == NULL and pvRxBuf == NULL, or u32Len == 0U
+ * @note   -Unlike SPI_TransReceive(), the next frame is written while the current one is shifted out,
+ *          so there is no gap between frames on the bus. Only works in full duplex mode.
+ *         -An interrupt longer than one frame time during the transfer causes an overload error,
+ *          clear it by SPI_ClearStatus() before the next transfer.
+ */
+int32_t SPI_PipelineTransReceive(CM_SPI_TypeDef *SPIx, const void *pvTxBuf, void *pvRxBuf, uint32_t u32Len,
+                                 uint32_t u32Timeout)
+{
+    static const uint16_t u16TxDummy = 0xFFFFU;
+    uint16_t u16RxDummy;
+    const void *pvTx = pvTxBuf;
+    void *pvRx = pvRxBuf;
+    uint32_t u32TxStep = 1UL;
+    uint32_t u32RxStep = 1UL;
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+
+    DDL_ASSERT(IS_VALID_SPI_UNIT(SPIx));
+
+    if (((pvTxBuf != NULL) || (pvRxBuf != NULL)) && (u32Len != 0U)) {
+        /* A NULL buffer is replaced by a single dummy frame with zero step */
+        if (pvTx == NULL) {
+            pvTx = &u16TxDummy;
+            u32TxStep = 0UL;
+        }
+        if (pvRx == NULL) {
+            pvRx = &u16RxDummy;
+            u32RxStep = 0UL;
+        }
+
+        if (READ_REG32_BIT(SPIx->CFG2, SPI_CFG2_DSIZE) == SPI_DATA_SIZE_8BIT) {
+            i32Ret = SPI_TxRxPipeline8(SPIx, (const uint8_t *)pvTx, u32TxStep, (uint8_t *)pvRx, u32RxStep,
+                                       u32Len, u32Timeout);
+        } else {
+            i32Ret = SPI_TxRxPipeline16(SPIx, (const uint16_t *)pvTx, u32TxStep, (uint16_t *)pvRx, u32RxStep,
+                                        u32Len, u32Timeout);
+        }
+        if (i32Ret == LL_OK) {
+            i32Ret = SPI_WaitStatus(SPIx, SPI_FLAG_IDLE, 0UL, u32Timeout);
+        }
+    }
+    return i32Ret;
+}
 /**
  * @}
  */
@@ -0,0 +1,574 @@
+/**
+ *******************************************************************************
+ * @file  hc32_ll_spi_int.c
+ * @brief This file provides firmware functions to manage a queue of SPI master
+ *        transactions driven by the SPRI/SPEI interrupts.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-17       CDT             First version
+                                    Use LL_ENTER_CRITICAL()/LL_EXIT_CRITICAL()
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2022-2023, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_ll_spi_int.h"
+#include "hc32_ll_gpio.h"
+#include "hc32_ll_interrupts.h"
+#include "hc32_ll_spi.h"
+#include "hc32_ll_utility.h"
+
+/**
+ * @addtogroup LL_Driver
+ * @{
+ */
+
+/**
+ * @defgroup LL_SPI_INT SPI_INT
+ * @brief SPI Interrupt-driven Master Transaction Queue Driver Library
+ * @{
+ */
+
+#if (LL_SPI_INT_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @defgroup SPI_INT_Local_Types SPI Interrupt Local Types
+ * @{
+ */
+
+/**
+ * @brief SPI interrupt driver control block definition
+ * @note  The running transaction is the queue head, pstcPhase the running phase of it.
+ */
+typedef struct {
+    stc_spi_int_trans_t *pstcHead;
+    stc_spi_int_trans_t *pstcTail;
+    stc_spi_int_trans_t *pstcPhase;
+    const stc_spi_int_dev_t *pstcDev;   /*!< Device the bus is configured for. */
+    uint32_t u32Index;                  /*!< Word in flight. */
+    uint32_t u32Word16;                 /*!< 1UL for 16-bit words. */
+} stc_spi_int_ctrl_t;
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup SPI_INT_Local_Macros SPI Interrupt Local Macros
+ * @{
+ */
+#define SPI_INT_IRQ_NUM                 (2U)
+
+#define SPI_INT_DUMMY                   (0xFFFFUL)
+
+/* Device settings in CFG2 */
+#define SPI_INT_CFG2_MASK               (SPI_CFG2_CPHA | SPI_CFG2_CPOL | SPI_CFG2_MBR | SPI_CFG2_DSIZE | SPI_CFG2_LSBF)
+
+/* Interrupts owned by this driver in CR1 */
+#define SPI_INT_SET(_UNITx_, ints)                                             \
+    MODIFY_REG32((_UNITx_)->CR1, SPI_INT_ERR | SPI_INT_RX_BUF_FULL, (ints))
+
+/**
+ * @defgroup SPI_INT_Check_Parameters_Validity SPI Interrupt Check Parameters Validity
+ * @{
+ */
+#define IS_SPI_INT_UNIT(x)              ((x) == CM_SPI)
+
+#define IS_SPI_INT_DEV_CFG(x)           (((x) | SPI_INT_CFG2_MASK) == SPI_INT_CFG2_MASK)
+
+#define IS_SPI_INT_CS_PIN(x)            ((((x) & ((x) - 1U)) == 0U) && (((x) | GPIO_PIN_ALL) == GPIO_PIN_ALL))
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+#if (LL_INTERRUPTS_ENABLE == DDL_ON)
+static void SPI_Int_Err_IrqCallback(void);
+static void SPI_Int_Rx_IrqCallback(void);
+#endif /* LL_INTERRUPTS_ENABLE */
+
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+/**
+ * @defgroup SPI_INT_Local_Variables SPI Interrupt Local Variables
+ * @{
+ */
+static stc_spi_int_ctrl_t m_stcSpiIntCtrl;
+
+#if (LL_INTERRUPTS_ENABLE == DDL_ON)
+static const en_int_src_t m_aenSpiIntSrc[SPI_INT_IRQ_NUM] = {
+    INT_SRC_SPI_SPEI, INT_SRC_SPI_SPRI
+};
+
+static const func_ptr_t m_apfnSpiIntIrqCallback[SPI_INT_IRQ_NUM] = {
+    &SPI_Int_Err_IrqCallback, &SPI_Int_Rx_IrqCallback
+};
+#endif /* LL_INTERRUPTS_ENABLE */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @defgroup SPI_INT_Local_Functions SPI Interrupt Local Functions
+ * @{
+ */
+
+#if (LL_INTERRUPTS_ENABLE == DDL_ON)
+static void SPI_Int_Err_IrqCallback(void)
+{
+    SPI_Int_ErrIrqHandler(CM_SPI);
+}
+
+static void SPI_Int_Rx_IrqCallback(void)
+{
+    SPI_Int_RxIrqHandler(CM_SPI);
+}
+#endif /* LL_INTERRUPTS_ENABLE */
+
+/**
+ * @brief  Drive the chip select of a device.
+ * @param  [in] pstcDev             Pointer to a @ref stc_spi_int_dev_t structure.
+ * @param  [in] enState             PIN_RESET to select the device, PIN_SET to release it.
+ * @retval None
+ */
+static void SPI_Int_CsWrite(const stc_spi_int_dev_t *pstcDev, en_pin_state_t enState)
+{
+    if (0U != pstcDev->u16CsPin) {
+        GPIO_FAST_WritePin(pstcDev->u8CsPort, pstcDev->u16CsPin, enState);
+    }
+}
+
+/**
+ * @brief  Write the word at the index of the running phase.
+ * @param  [in] SPIx                Pointer to SPI instance register base.
+ * @retval None
+ */
+static void SPI_Int_WriteWord(CM_SPI_TypeDef *SPIx)
+{
+    const stc_spi_int_trans_t *pstcPhase = m_stcSpiIntCtrl.pstcPhase;
+    uint32_t u32Data = SPI_INT_DUMMY;
+
+    if (NULL != pstcPhase->pvTxBuf) {
+        if (0UL != m_stcSpiIntCtrl.u32Word16) {
+            u32Data = ((const uint16_t *)pstcPhase->pvTxBuf)[m_stcSpiIntCtrl.u32Index];
+        } else {
+            u32Data = ((const uint8_t *)pstcPhase->pvTxBuf)[m_stcSpiIntCtrl.u32Index];
+        }
+    }
+    WRITE_REG32(SPIx->DR, u32Data);
+}
+
+/**
+ * @brief  Start the transaction at the queue head.
+ * @param  [in] SPIx                Pointer to SPI instance register base.
+ * @retval None
+ */
+static void SPI_Int_StartHead(CM_SPI_TypeDef *SPIx)
+{
+    const stc_spi_int_dev_t *pstcDev = m_stcSpiIntCtrl.pstcHead->pstcDev;
+
+    if (pstcDev != m_stcSpiIntCtrl.pstcDev) {
+        /* CFG2 is written with the SPI disabled */
+        CLR_REG32_BIT(SPIx->CR1, SPI_CR1_SPE);
+        MODIFY_REG32(SPIx->CFG2, SPI_INT_CFG2_MASK, pstcDev->u32SpiMode | pstcDev->u32BaudRatePrescaler |
+                     pstcDev->u32DataBits | pstcDev->u32FirstBit);
+        SET_REG32_BIT(SPIx->CR1, SPI_CR1_SPE);
+        m_stcSpiIntCtrl.pstcDev = pstcDev;
+        m_stcSpiIntCtrl.u32Word16 = (SPI_DATA_SIZE_16BIT == pstcDev->u32DataBits) ? 1UL : 0UL;
+    }
+
+    SPI_Int_CsWrite(pstcDev, PIN_RESET);
+    m_stcSpiIntCtrl.pstcPhase = m_stcSpiIntCtrl.pstcHead;
+    m_stcSpiIntCtrl.u32Index = 0UL;
+    SPI_INT_SET(SPIx, SPI_INT_ERR | SPI_INT_RX_BUF_FULL);
+    SPI_Int_WriteWord(SPIx);
+}
+
+/**
+ * @brief  End the running phase: start the next phase of the transaction, or release the
+ *         chip select, start the next transaction and complete the phases left.
+ * @param  [in] SPIx                Pointer to SPI instance register base.
+ * @param  [in] i32Result           Phase result.
+ * @retval None
+ */
+static void SPI_Int_PhaseEnd(CM_SPI_TypeDef *SPIx, int32_t i32Result)
+{
+    stc_spi_int_trans_t *pstcPhase = m_stcSpiIntCtrl.pstcPhase;
+    stc_spi_int_trans_t *pstcHead = m_stcSpiIntCtrl.pstcHead;
+    stc_spi_int_trans_t *pstcChain;
+
+    if ((LL_OK == i32Result) && (NULL != pstcPhase->pstcChain)) {
+        /* Chip select held */
+        m_stcSpiIntCtrl.pstcPhase = pstcPhase->pstcChain;
+        m_stcSpiIntCtrl.u32Index = 0UL;
+        SPI_Int_WriteWord(SPIx);
+
+        pstcPhase->i32Result = LL_OK;
+        if (NULL != pstcPhase->pfnCallback) {
+            pstcPhase->pfnCallback(pstcPhase);
+        }
+    } else {
+        SPI_Int_CsWrite(pstcHead->pstcDev, PIN_SET);
+        m_stcSpiIntCtrl.pstcHead = pstcHead->pstcNext;
+        pstcHead->pstcNext = NULL;
+        if (NULL == m_stcSpiIntCtrl.pstcHead) {
+            m_stcSpiIntCtrl.pstcTail = NULL;
+            m_stcSpiIntCtrl.pstcPhase = NULL;
+            SPI_INT_SET(SPIx, 0UL);
+        } else {
+            /* Keep the bus busy before the callbacks run */
+            SPI_Int_StartHead(SPIx);
+        }
+
+        /* The phases not run get the result too */
+        while (NULL != pstcPhase) {
+            pstcChain = pstcPhase->pstcChain;
+            pstcPhase->i32Result = i32Result;
+            if (NULL != pstcPhase->pfnCallback) {
+                pstcPhase->pfnCallback(pstcPhase);
+            }
+            pstcPhase = pstcChain;
+        }
+    }
+}
+
+/**
+ * @brief  Drop the frames in flight.
+ * @param  [in] SPIx                Pointer to SPI instance register base.
+ * @retval None
+ */
+static void SPI_Int_Flush(CM_SPI_TypeDef *SPIx)
+{
+    CLR_REG32_BIT(SPIx->CR1, SPI_CR1_SPE);
+    SPI_ClearStatus(SPIx, SPI_FLAG_CLR_ALL);
+    SET_REG32_BIT(SPIx->CR1, SPI_CR1_SPE);
+}
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup SPI_INT_Global_Functions SPI Interrupt Global Functions
+ * @{
+ */
+
+/**
+ * @brief  Initialize the interrupt-driven master transaction queue.
+ * @param  [in] SPIx                Pointer to SPI instance register base.
+ *                                  This parameter can be a value of the following:
+ *         @arg CM_SPI or CM_SPIx:  SPI instance register base.
+ * @retval int32_t:
+ *         - LL_OK:                 Success
+ * @note   Call SPI_Init() first with SPI_MASTER and SPI_FULL_DUPLEX, this function enables the SPI
+ *         peripheral. The chip selects are GPIO outputs initialized high by the application.
+ */
+int32_t SPI_Int_Init(CM_SPI_TypeDef *SPIx)
+{
+    DDL_ASSERT(IS_SPI_INT_UNIT(SPIx));
+
+    SPI_INT_SET(SPIx, 0UL);
+    m_stcSpiIntCtrl.pstcHead = NULL;
+    m_stcSpiIntCtrl.pstcTail = NULL;
+    m_stcSpiIntCtrl.pstcPhase = NULL;
+    m_stcSpiIntCtrl.pstcDev = NULL;
+    m_stcSpiIntCtrl.u32Index = 0UL;
+    SPI_ClearStatus(SPIx, SPI_FLAG_CLR_ALL);
+    SPI_Cmd(SPIx, ENABLE);
+
+    return LL_OK;
+}
+
+/**
+ * @brief  De-initialize the interrupt-driven master transaction queue.
+ * @param  [in] SPIx                Pointer to SPI instance register base.
+ *                                  This parameter can be a value of the following:
+ *         @arg CM_SPI or CM_SPIx:  SPI instance register base.
+ * @retval None
+ * @note   Queued transactions are dropped without callback, the chip select of the running one
+ *         is left low.
+ */
+void SPI_Int_DeInit(CM_SPI_TypeDef *SPIx)
+{
+    DDL_ASSERT(IS_SPI_INT_UNIT(SPIx));
+
+    SPI_INT_SET(SPIx, 0UL);
+    SPI_Cmd(SPIx, DISABLE);
+    m_stcSpiIntCtrl.pstcHead = NULL;
+    m_stcSpiIntCtrl.pstcTail = NULL;
+    m_stcSpiIntCtrl.pstcPhase = NULL;
+    m_stcSpiIntCtrl.pstcDev = NULL;
+}
+
+#if (LL_INTERRUPTS_ENABLE == DDL_ON)
+/**
+ * @brief  Register the SPEI/SPRI interrupt sources and enable the NVIC IRQs.
+ * @param  [in] SPIx                Pointer to SPI instance register base.
+ *                                  This parameter can be a value of the following:
+ *         @arg CM_SPI or CM_SPIx:  SPI instance register base.
+ * @param  [in] pstcIrq             Pointer to a @ref stc_spi_int_irq_t structure.
+ * @retval int32_t:
+ *         - LL_OK:                 Success
+ *         - LL_ERR_INVD_PARAM:     pstcIrq is NULL or an IRQ number doesn't match the interrupt source.
+ * @note   INTC registers must be unlocked, @ref LL_PERIPH_WE for details.
+ * @note   To use the share IRQ handlers IRQ024~IRQ031 instead, enable the sources with
+ *         INTC_ShareIrqCmd() and call SPI_Int_xxxIrqHandler() from SPI_Error_IrqHandler()
+ *         and SPI_RxFull_IrqHandler().
+ */
+int32_t SPI_Int_IrqSignIn(CM_SPI_TypeDef *SPIx, const stc_spi_int_irq_t *pstcIrq)
+{
+    uint32_t i;
+    IRQn_Type aenIRQn[SPI_INT_IRQ_NUM];
+    stc_irq_signin_config_t stcIrqSignConfig;
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+
+    DDL_ASSERT(IS_SPI_INT_UNIT(SPIx));
+    (void)SPIx;
+
+    if (NULL != pstcIrq) {
+        aenIRQn[0] = pstcIrq->enErrIRQn;
+        aenIRQn[1] = pstcIrq->enRxIRQn;
+
+        for (i = 0UL; i < SPI_INT_IRQ_NUM; i++) {
+            stcIrqSignConfig.enIntSrc = m_aenSpiIntSrc[i];
+            stcIrqSignConfig.enIRQn = aenIRQn[i];
+            stcIrqSignConfig.pfnCallback = m_apfnSpiIntIrqCallback[i];
+            i32Ret = INTC_IrqSignIn(&stcIrqSignConfig);
+            if (LL_OK != i32Ret) {
+                break;
+            }
+            NVIC_ClearPendingIRQ(aenIRQn[i]);
+            NVIC_SetPriority(aenIRQn[i], pstcIrq->u32IrqPrio);
+            NVIC_EnableIRQ(aenIRQn[i]);
+        }
+    }
+
+    return i32Ret;
+}
+#endif /* LL_INTERRUPTS_ENABLE */
+
+/**
+ * @brief  Set the fields of structure stc_spi_int_trans_t to default values.
+ * @param  [out] pstcTrans          Pointer to a @ref stc_spi_int_trans_t structure.
+ * @retval int32_t:
+ *         - LL_OK:                 Success
+ *         - LL_ERR_INVD_PARAM:     pstcTrans is NULL.
+ */
+int32_t SPI_Int_TransStructInit(stc_spi_int_trans_t *pstcTrans)
+{
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+
+    if (NULL != pstcTrans) {
+        pstcTrans->pstcDev = NULL;
+        pstcTrans->pvTxBuf = NULL;
+        pstcTrans->pvRxBuf = NULL;
+        pstcTrans->u32Len = 0UL;
+        pstcTrans->pstcChain = NULL;
+        pstcTrans->pfnCallback = NULL;
+        pstcTrans->pvUserData = NULL;
+        pstcTrans->i32Result = LL_OK;
+        pstcTrans->pstcNext = NULL;
+        i32Ret = LL_OK;
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Queue a transaction, it is started at once if the driver is idle.
+ * @param  [in] SPIx                Pointer to SPI instance register base.
+ *                                  This parameter can be a value of the following:
+ *         @arg CM_SPI or CM_SPIx:  SPI instance register base.
+ * @param  [in] pstcTrans           Pointer to the first phase, a @ref stc_spi_int_trans_t structure.
+ * @retval int32_t:
+ *         - LL_OK:                 Transaction queued.
+ *         - LL_ERR_INVD_PARAM:     pstcTrans is NULL, has no device or a phase has no data.
+ *         - LL_ERR_BUSY:           A phase is already queued.
+ * @note   May be called from thread code, IRQ handlers and the completion callbacks.
+ */
+int32_t SPI_Int_Submit(CM_SPI_TypeDef *SPIx, stc_spi_int_trans_t *pstcTrans)
+{
+    uint32_t u32Primask;
+    stc_spi_int_trans_t *pstcPhase;
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+
+    DDL_ASSERT(IS_SPI_INT_UNIT(SPIx));
+
+    if ((NULL != pstcTrans) && (NULL != pstcTrans->pstcDev)) {
+        DDL_ASSERT(IS_SPI_INT_DEV_CFG(pstcTrans->pstcDev->u32SpiMode | pstcTrans->pstcDev->u32BaudRatePrescaler |
+                                      pstcTrans->pstcDev->u32DataBits | pstcTrans->pstcDev->u32FirstBit));
+        DDL_ASSERT(IS_SPI_INT_CS_PIN(pstcTrans->pstcDev->u16CsPin));
+
+        LL_ENTER_CRITICAL(u32Primask);
+        i32Ret = LL_OK;
+        for (pstcPhase = pstcTrans; NULL != pstcPhase; pstcPhase = pstcPhase->pstcChain) {
+            if (LL_ERR_BUSY == pstcPhase->i32Result) {
+                i32Ret = LL_ERR_BUSY;
+                break;
+            }
+            if (0UL == pstcPhase->u32Len) {
+                i32Ret = LL_ERR_INVD_PARAM;
+                break;
+            }
+        }
+        if (LL_OK == i32Ret) {
+            for (pstcPhase = pstcTrans; NULL != pstcPhase; pstcPhase = pstcPhase->pstcChain) {
+                pstcPhase->i32Result = LL_ERR_BUSY;
+            }
+            pstcTrans->pstcNext = NULL;
+            if (NULL == m_stcSpiIntCtrl.pstcHead) {
+                m_stcSpiIntCtrl.pstcHead = pstcTrans;
+                m_stcSpiIntCtrl.pstcTail = pstcTrans;
+                SPI_Int_StartHead(SPIx);
+            } else {
+                m_stcSpiIntCtrl.pstcTail->pstcNext = pstcTrans;
+                m_stcSpiIntCtrl.pstcTail = pstcTrans;
+            }
+        }
+        LL_EXIT_CRITICAL(u32Primask);
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Abort the running transaction.
+ * @param  [in] SPIx                Pointer to SPI instance register base.
+ *                                  This parameter can be a value of the following:
+ *         @arg CM_SPI or CM_SPIx:  SPI instance register base.
+ * @retval None
+ * @note   Intended for an application timeout, the phases left complete with LL_ERR_TIMEOUT
+ *         and the next queued transaction is started.
+ */
+void SPI_Int_Abort(CM_SPI_TypeDef *SPIx)
+{
+    uint32_t u32Primask;
+
+    DDL_ASSERT(IS_SPI_INT_UNIT(SPIx));
+
+    LL_ENTER_CRITICAL(u32Primask);
+    if (NULL != m_stcSpiIntCtrl.pstcHead) {
+        SPI_INT_SET(SPIx, 0UL);
+        SPI_Int_Flush(SPIx);
+        SPI_Int_PhaseEnd(SPIx, LL_ERR_TIMEOUT);
+    }
+    LL_EXIT_CRITICAL(u32Primask);
+}
+
+/**
+ * @brief  Get the driver state.
+ * @param  [in] SPIx                Pointer to SPI instance register base.
+ *                                  This parameter can be a value of the following:
+ *         @arg CM_SPI or CM_SPIx:  SPI instance register base.
+ * @retval An @ref en_flag_status_t enumeration value:
+ *           - SET:                 A transaction is running or queued.
+ *           - RESET:               Idle.
+ */
+en_flag_status_t SPI_Int_GetBusy(const CM_SPI_TypeDef *SPIx)
+{
+    DDL_ASSERT(IS_SPI_INT_UNIT(SPIx));
+    (void)SPIx;
+
+    return (NULL == m_stcSpiIntCtrl.pstcHead) ? RESET : SET;
+}
+
+/**
+ * @brief  SPI error(INT_SRC_SPI_SPEI) IRQ handler.
+ * @param  [in] SPIx                Pointer to SPI instance register base.
+ *                                  This parameter can be a value of the following:
+ *         @arg CM_SPI or CM_SPIx:  SPI instance register base.
+ * @retval None
+ * @note   Overload, mode fault, parity and underload errors end the transaction with LL_ERR.
+ */
+void SPI_Int_ErrIrqHandler(CM_SPI_TypeDef *SPIx)
+{
+    if (0UL != READ_REG32_BIT(SPIx->SR, SPI_FLAG_CLR_ALL)) {
+        SPI_Int_Flush(SPIx);
+        if (NULL != m_stcSpiIntCtrl.pstcPhase) {
+            SPI_Int_PhaseEnd(SPIx, LL_ERR);
+        }
+    }
+}
+
+/**
+ * @brief  SPI receive buffer full(INT_SRC_SPI_SPRI) IRQ handler.
+ * @param  [in] SPIx                Pointer to SPI instance register base.
+ *                                  This parameter can be a value of the following:
+ *         @arg CM_SPI or CM_SPIx:  SPI instance register base.
+ * @retval None
+ * @note   One word is in flight: the next one is written when the previous one is received,
+ *         so the receive buffer can't overload however late the handler runs.
+ */
+void SPI_Int_RxIrqHandler(CM_SPI_TypeDef *SPIx)
+{
+    uint32_t u32Data = READ_REG32(SPIx->DR);
+    uint32_t u32Index = m_stcSpiIntCtrl.u32Index;
+    const stc_spi_int_trans_t *pstcPhase = m_stcSpiIntCtrl.pstcPhase;
+
+    if (NULL != pstcPhase) {
+        if (NULL != pstcPhase->pvRxBuf) {
+            if (0UL != m_stcSpiIntCtrl.u32Word16) {
+                ((uint16_t *)pstcPhase->pvRxBuf)[u32Index] = (uint16_t)u32Data;
+            } else {
+                ((uint8_t *)pstcPhase->pvRxBuf)[u32Index] = (uint8_t)u32Data;
+            }
+        }
+        u32Index++;
+        m_stcSpiIntCtrl.u32Index = u32Index;
+        if (u32Index < pstcPhase->u32Len) {
+            SPI_Int_WriteWord(SPIx);
+        } else {
+            SPI_Int_PhaseEnd(SPIx, LL_OK);
+        }
+    }
+}
+
+/**
+ * @}
+ */
+
+#endif /* LL_SPI_INT_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
@@ -0,0 +1,353 @@
+/**
+ *******************************************************************************
+ * @file  hc32_ll_spsc.c
+ * @brief This file provides firmware functions of the lock-free
+ *        single-producer/single-consumer byte queue.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-16       CDT             First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2022-2023, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_ll_spsc.h"
+#include "hc32_ll_utility.h"
+
+/**
+ * @addtogroup LL_Driver
+ * @{
+ */
+
+/**
+ * @defgroup LL_SPSC SPSC
+ * @brief Lock-free Single-producer/Single-consumer Queue
+ * @note  Cortex-M0+ has no exclusive access instructions: the queue only relies on aligned
+ *        word loads and stores being atomic, each index having a single writer, and __DMB()
+ *        ordering the data accesses against the index accesses.
+ * @{
+ */
+
+#if (LL_SPSC_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup SPSC_Local_Macros SPSC Local Macros
+ * @{
+ */
+
+/**
+ * @defgroup SPSC_Check_Parameters_Validity SPSC Check Parameters Validity
+ * @{
+ */
+#define IS_SPSC_SIZE(x)                                                        \
+(   ((x) != 0UL)                        &&                                     \
+    (((x) & ((x) - 1UL)) == 0UL))
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @defgroup SPSC_Local_Functions SPSC Local Functions
+ * @{
+ */
+
+/**
+ * @brief  Copy bytes, by blocks of 4 words when both ends are word aligned.
+ * @param  [out] pu8Dest                Destination
+ * @param  [in] pu8Src                  Source
+ * @param  [in] u32Len                  Number of bytes
+ * @retval None
+ * @note   The 4 word blocks compile to LDM/STM pairs.
+ */
+static void SPSC_Copy(uint8_t *pu8Dest, const uint8_t *pu8Src, uint32_t u32Len)
+{
+    uint32_t *pu32Dest;
+    const uint32_t *pu32Src;
+    uint32_t u32W0;
+    uint32_t u32W1;
+    uint32_t u32W2;
+    uint32_t u32W3;
+
+    if ((u32Len >= 4UL) && (0UL == (((uint32_t)pu8Dest | (uint32_t)pu8Src) & 3UL))) {
+        pu32Dest = (uint32_t *)(void *)pu8Dest;
+        pu32Src = (const uint32_t *)(const void *)pu8Src;
+        while (u32Len >= 16UL) {
+            u32W0 = pu32Src[0];
+            u32W1 = pu32Src[1];
+            u32W2 = pu32Src[2];
+            u32W3 = pu32Src[3];
+            pu32Dest[0] = u32W0;
+            pu32Dest[1] = u32W1;
+            pu32Dest[2] = u32W2;
+            pu32Dest[3] = u32W3;
+            pu32Src += 4U;
+            pu32Dest += 4U;
+            u32Len -= 16UL;
+        }
+        while (u32Len >= 4UL) {
+            *pu32Dest++ = *pu32Src++;
+            u32Len -= 4UL;
+        }
+        pu8Dest = (uint8_t *)(void *)pu32Dest;
+        pu8Src = (const uint8_t *)(const void *)pu32Src;
+    }
+
+    while (u32Len > 0UL) {
+        *pu8Dest++ = *pu8Src++;
+        u32Len--;
+    }
+}
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup SPSC_Global_Functions SPSC Global Functions
+ * @{
+ */
+
+/**
+ * @brief  Initialize an empty queue.
+ * @param  [out] pstcQueue              Pointer to a @ref stc_spsc_t structure.
+ * @param  [in] pvBuf                   Storage, word aligned for the word copies of the bulk functions.
+ * @param  [in] u32Size                 Storage size in bytes, a power of 2.
+ * @retval int32_t:
+ *           - LL_OK:                   Initialize successfully.
+ *           - LL_ERR_INVD_PARAM:       A pointer is NULL or u32Size is not a power of 2.
+ * @note   Must not run while the queue is used, as the indexes are reset.
+ */
+int32_t SPSC_Init(stc_spsc_t *pstcQueue, void *pvBuf, uint32_t u32Size)
+{
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+
+    if ((NULL != pstcQueue) && (NULL != pvBuf) && IS_SPSC_SIZE(u32Size)) {
+        pstcQueue->pu8Buf = (uint8_t *)pvBuf;
+        pstcQueue->u32Mask = u32Size - 1UL;
+        pstcQueue->u32In = 0UL;
+        pstcQueue->u32Out = 0UL;
+        i32Ret = LL_OK;
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Get the number of bytes in the queue.
+ * @param  [in] pstcQueue               Pointer to an initialized @ref stc_spsc_t structure.
+ * @retval Number of bytes, exact for the consumer and a lower bound for the producer.
+ */
+uint32_t SPSC_GetCount(const stc_spsc_t *pstcQueue)
+{
+    DDL_ASSERT(NULL != pstcQueue);
+
+    return pstcQueue->u32In - pstcQueue->u32Out;
+}
+
+/**
+ * @brief  Get the free space of the queue.
+ * @param  [in] pstcQueue               Pointer to an initialized @ref stc_spsc_t structure.
+ * @retval Number of bytes, exact for the producer and a lower bound for the consumer.
+ */
+uint32_t SPSC_GetSpace(const stc_spsc_t *pstcQueue)
+{
+    DDL_ASSERT(NULL != pstcQueue);
+
+    return (pstcQueue->u32Mask + 1UL) - (pstcQueue->u32In - pstcQueue->u32Out);
+}
+
+/**
+ * @brief  Push one byte, producer side.
+ * @param  [in] pstcQueue               Pointer to an initialized @ref stc_spsc_t structure.
+ * @param  [in] u8Data                  Byte
+ * @retval int32_t:
+ *           - LL_OK:                   Pushed.
+ *           - LL_ERR_BUF_FULL:         The queue is full.
+ */
+int32_t SPSC_PushByte(stc_spsc_t *pstcQueue, uint8_t u8Data)
+{
+    uint32_t u32In;
+    int32_t i32Ret = LL_ERR_BUF_FULL;
+
+    DDL_ASSERT(NULL != pstcQueue);
+
+    u32In = pstcQueue->u32In;
+    if ((u32In - pstcQueue->u32Out) <= pstcQueue->u32Mask) {
+        /* The slot is free once u32Out is read */
+        __DMB();
+        pstcQueue->pu8Buf[u32In & pstcQueue->u32Mask] = u8Data;
+        /* Publish the data before the index */
+        __DMB();
+        pstcQueue->u32In = u32In + 1UL;
+        i32Ret = LL_OK;
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Push as many bytes as fit, producer side.
+ * @param  [in] pstcQueue               Pointer to an initialized @ref stc_spsc_t structure.
+ * @param  [in] au8Data                 Bytes
+ * @param  [in] u32Len                  Number of bytes
+ * @retval Number of bytes pushed, less than u32Len if the queue became full.
+ * @note   The consumer sees all the bytes at once.
+ */
+uint32_t SPSC_Push(stc_spsc_t *pstcQueue, const uint8_t au8Data[], uint32_t u32Len)
+{
+    uint32_t u32In;
+    uint32_t u32Pos;
+    uint32_t u32First;
+    uint32_t u32Count = 0UL;
+
+    DDL_ASSERT(NULL != pstcQueue);
+
+    if (NULL != au8Data) {
+        u32In = pstcQueue->u32In;
+        u32Count = (pstcQueue->u32Mask + 1UL) - (u32In - pstcQueue->u32Out);
+        u32Count = LL_MIN(u32Len, u32Count);
+        if (u32Count > 0UL) {
+            __DMB();
+            /* At most two chunks: up to the end of the storage, then from its start */
+            u32Pos = u32In & pstcQueue->u32Mask;
+            u32First = LL_MIN(u32Count, (pstcQueue->u32Mask + 1UL) - u32Pos);
+            SPSC_Copy(&pstcQueue->pu8Buf[u32Pos], au8Data, u32First);
+            SPSC_Copy(pstcQueue->pu8Buf, &au8Data[u32First], u32Count - u32First);
+            __DMB();
+            pstcQueue->u32In = u32In + u32Count;
+        }
+    }
+
+    return u32Count;
+}
+
+/**
+ * @brief  Pop one byte, consumer side.
+ * @param  [in] pstcQueue               Pointer to an initialized @ref stc_spsc_t structure.
+ * @param  [out] pu8Data                Byte
+ * @retval int32_t:
+ *           - LL_OK:                   Popped.
+ *           - LL_ERR_BUF_EMPTY:        The queue is empty.
+ */
+int32_t SPSC_PopByte(stc_spsc_t *pstcQueue, uint8_t *pu8Data)
+{
+    uint32_t u32Out;
+    int32_t i32Ret = LL_ERR_BUF_EMPTY;
+
+    DDL_ASSERT(NULL != pstcQueue);
+    DDL_ASSERT(NULL != pu8Data);
+
+    u32Out = pstcQueue->u32Out;
+    if (u32Out != pstcQueue->u32In) {
+        /* Read the index before the data */
+        __DMB();
+        *pu8Data = pstcQueue->pu8Buf[u32Out & pstcQueue->u32Mask];
+        /* Release the slot after the data is read */
+        __DMB();
+        pstcQueue->u32Out = u32Out + 1UL;
+        i32Ret = LL_OK;
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Pop up to u32Len bytes, consumer side.
+ * @param  [in] pstcQueue               Pointer to an initialized @ref stc_spsc_t structure.
+ * @param  [out] au8Data                Buffer
+ * @param  [in] u32Len                  Buffer size
+ * @retval Number of bytes popped, 0 if the queue is empty.
+ */
+uint32_t SPSC_Pop(stc_spsc_t *pstcQueue, uint8_t au8Data[], uint32_t u32Len)
+{
+    uint32_t u32Out;
+    uint32_t u32Pos;
+    uint32_t u32First;
+    uint32_t u32Count = 0UL;
+
+    DDL_ASSERT(NULL != pstcQueue);
+
+    if (NULL != au8Data) {
+        u32Out = pstcQueue->u32Out;
+        u32Count = pstcQueue->u32In - u32Out;
+        u32Count = LL_MIN(u32Len, u32Count);
+        if (u32Count > 0UL) {
+            __DMB();
+            u32Pos = u32Out & pstcQueue->u32Mask;
+            u32First = LL_MIN(u32Count, (pstcQueue->u32Mask + 1UL) - u32Pos);
+            SPSC_Copy(au8Data, &pstcQueue->pu8Buf[u32Pos], u32First);
+            SPSC_Copy(&au8Data[u32First], pstcQueue->pu8Buf, u32Count - u32First);
+            __DMB();
+            pstcQueue->u32Out = u32Out + u32Count;
+        }
+    }
+
+    return u32Count;
+}
+
+/**
+ * @brief  Discard the bytes in the queue, consumer side.
+ * @param  [in] pstcQueue               Pointer to an initialized @ref stc_spsc_t structure.
+ * @retval None
+ */
+void SPSC_Flush(stc_spsc_t *pstcQueue)
+{
+    DDL_ASSERT(NULL != pstcQueue);
+
+    pstcQueue->u32Out = pstcQueue->u32In;
+}
+
+/**
+ * @}
+ */
+
+#endif /* LL_SPSC_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/******************************************************************************
+ * EOF (not truncated)
+ *****************************************************************************/
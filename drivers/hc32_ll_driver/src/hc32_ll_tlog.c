@@ -0,0 +1,215 @@
+/**
+ *******************************************************************************
+ * @file  hc32_ll_tlog.c
+ * @brief This file provides firmware functions of the deferred, tokenized
+ *        logging.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-16       CDT             First version
+   2026-10-17       CDT             Allow a NULL argument array for records without arguments
+                                    Use LL_ENTER_CRITICAL()/LL_EXIT_CRITICAL()
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2022-2023, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_ll_tlog.h"
+#include "hc32_ll_usart_async.h"
+#include "hc32_ll_utility.h"
+
+/**
+ * @addtogroup LL_Driver
+ * @{
+ */
+
+/**
+ * @defgroup LL_TLOG TLOG
+ * @brief Deferred Tokenized Logging
+ * @note  TLOG() queues the ID of its format string and its raw arguments on the TX ring
+ *        buffer of a USART in asynchronous mode, whose interrupts send them. Nothing is
+ *        formatted on the device: host/tlog decodes the stream with the ELF file.
+ * @note  The GCC linker scripts place the format strings in the ".tlog 0 (INFO)" section,
+ *        which is not loaded: the IDs are offsets in that section and the strings take
+ *        no flash.
+ * @{
+ */
+
+#if (LL_TLOG_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup TLOG_Local_Macros TLOG Local Macros
+ * @{
+ */
+#define TLOG_HDR(id, argn)              (TLOG_HDR_MARK | ((uint32_t)(argn) << TLOG_HDR_ARGN_POS) | (id))
+
+/**
+ * @defgroup TLOG_Check_Parameters_Validity TLOG Check Parameters Validity
+ * @{
+ */
+#define IS_TLOG_ARGN(x)                 ((x) <= TLOG_ARG_MAX)
+#define IS_TLOG_ID(x)                   ((x) < TLOG_ID_DROP)
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+/**
+ * @defgroup TLOG_Local_Variables TLOG Local Variables
+ * @{
+ */
+static CM_USART_TypeDef *m_pstcTlogUsart = NULL;
+/* Records dropped since the last drop record, and since TLOG_Init() */
+static uint32_t m_u32TlogDropPending = 0UL;
+static uint32_t m_u32TlogDropTotal = 0UL;
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @defgroup TLOG_Global_Functions TLOG Global Functions
+ * @{
+ */
+
+/**
+ * @brief  Send the records on a USART.
+ * @param  [in] USARTx                  Pointer to USART instance register base,
+ *                                      initialized by USART_Async_Init() with a TX ring buffer.
+ * @retval int32_t:
+ *           - LL_OK:                   Initialize successfully.
+ *           - LL_ERR_INVD_PARAM:       USARTx is NULL.
+ * @note   Every record must fit the TX ring buffer, TLOG_Write() is its only producer.
+ */
+int32_t TLOG_Init(CM_USART_TypeDef *USARTx)
+{
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+
+    if (NULL != USARTx) {
+        m_u32TlogDropPending = 0UL;
+        m_u32TlogDropTotal = 0UL;
+        m_pstcTlogUsart = USARTx;
+        i32Ret = LL_OK;
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Queue a record, use TLOG() instead.
+ * @param  [in] u32Id                   Format string ID, TLOG_ID().
+ * @param  [in] u32ArgNum               Number of arguments, up to TLOG_ARG_MAX.
+ * @param  [in] au32Arg                 Arguments, NULL if u32ArgNum is 0.
+ * @retval int32_t:
+ *           - LL_OK:                   Queued.
+ *           - LL_ERR_UNINIT:           TLOG_Init() was not called.
+ *           - LL_ERR_BUF_FULL:         Dropped, counted in the next drop record.
+ * @note   Interrupts are masked while the record is copied, so any context may log.
+ */
+int32_t TLOG_Write(uint32_t u32Id, uint32_t u32ArgNum, const uint32_t au32Arg[])
+{
+    uint32_t au32Rec[1U + TLOG_ARG_MAX];
+    uint32_t au32Drop[2U];
+    uint32_t u32Len;
+    uint32_t u32Space;
+    uint32_t u32Primask;
+    uint32_t i;
+    int32_t i32Ret = LL_ERR_UNINIT;
+
+    DDL_ASSERT(IS_TLOG_ID(u32Id));
+    DDL_ASSERT(IS_TLOG_ARGN(u32ArgNum));
+
+    if (NULL != m_pstcTlogUsart) {
+        au32Rec[0] = TLOG_HDR(u32Id, u32ArgNum);
+        for (i = 0UL; i < u32ArgNum; i++) {
+            au32Rec[1UL + i] = au32Arg[i];
+        }
+        u32Len = (1UL + u32ArgNum) * 4UL;
+
+        i32Ret = LL_ERR_BUF_FULL;
+        LL_ENTER_CRITICAL(u32Primask);
+        u32Space = USART_Async_GetTxSpace(m_pstcTlogUsart);
+        if (0UL != m_u32TlogDropPending) {
+            /* Report the gap first, the record needs room behind it */
+            if (u32Space >= (sizeof(au32Drop) + u32Len)) {
+                au32Drop[0] = TLOG_HDR(TLOG_ID_DROP, 1UL);
+                au32Drop[1] = m_u32TlogDropPending;
+                (void)USART_Async_Write(m_pstcTlogUsart, (const uint8_t *)au32Drop, sizeof(au32Drop));
+                m_u32TlogDropPending = 0UL;
+                u32Space -= sizeof(au32Drop);
+            }
+        }
+        if ((0UL == m_u32TlogDropPending) && (u32Space >= u32Len)) {
+            (void)USART_Async_Write(m_pstcTlogUsart, (const uint8_t *)au32Rec, u32Len);
+            i32Ret = LL_OK;
+        } else {
+            m_u32TlogDropPending++;
+            m_u32TlogDropTotal++;
+        }
+        LL_EXIT_CRITICAL(u32Primask);
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Get the number of records dropped because the TX ring buffer was full.
+ * @param  None
+ * @retval Records dropped since TLOG_Init()
+ */
+uint32_t TLOG_GetDropCount(void)
+{
+    return m_u32TlogDropTotal;
+}
+
+/**
+ * @}
+ */
+
+#endif /* LL_TLOG_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/******************************************************************************
+ * EOF (not truncated)
+ *****************************************************************************/
@@ -0,0 +1,698 @@
+/**
+ *******************************************************************************
+ * @file  hc32_ll_tmr0_wheel.c
+ * @brief This file provides firmware functions to run many software timers on
+ *        one TMR0 compare channel with a tickless hierarchical timer wheel.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-16       CDT             First version
+                                    Add TMR0_Wheel_GetIdleTicks()
+   2026-10-17       CDT             Use LL_ENTER_CRITICAL()/LL_EXIT_CRITICAL()
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2022-2023, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_ll_tmr0_wheel.h"
+#include "hc32_ll_tmr0.h"
+#include "hc32_ll_interrupts.h"
+#include "hc32_ll_utility.h"
+
+/**
+ * @addtogroup LL_Driver
+ * @{
+ */
+
+/**
+ * @defgroup LL_TMR0_WHEEL TMR0_WHEEL
+ * @brief TMR0 Software Timer Wheel Driver Library
+ * @{
+ */
+
+#if (LL_TMR0_WHEEL_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @defgroup TMR0_WHEEL_Local_Types TMR0 Timer Wheel Local Types
+ * @{
+ */
+
+/**
+ * @brief TMR0 timer wheel control block definition
+ * @note  A timer of level n expires 32^n ~ 32^(n+1) - 1 ticks after u32Now, and sits in the
+ *        slot of bits [5n+4:5n] of its expiry tick. When u32Now reaches the start of a slot
+ *        of level n >= 1, the slot is cascaded: its timers move to lower levels.
+ */
+typedef struct {
+    CM_TMR0_TypeDef *TMR0x;
+    uint32_t u32Base;                   /*!< Tick at which the counter restarted from 0. */
+    uint32_t u32Now;                    /*!< Last tick processed by the wheel, at most the current tick. */
+    uint32_t au32Bitmap[TMR0_WHEEL_LVL_NUM];        /*!< Non-empty slots of each level. */
+    stc_tmr0_wheel_timer_t *apstcSlot[TMR0_WHEEL_LVL_NUM * 32U];
+} stc_tmr0_wheel_ctrl_t;
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup TMR0_WHEEL_Local_Macros TMR0 Timer Wheel Local Macros
+ * @{
+ */
+#if (TMR0_WHEEL_LVL_NUM < 2U) || (TMR0_WHEEL_LVL_NUM > 6U)
+#error "TMR0_WHEEL_LVL_NUM must be 2 ~ 6."
+#endif
+
+#define TMR0_WHEEL_SLOT_BITS            (5U)
+#define TMR0_WHEEL_SLOT_NUM             (1UL << TMR0_WHEEL_SLOT_BITS)
+#define TMR0_WHEEL_SLOT_MASK            (TMR0_WHEEL_SLOT_NUM - 1UL)
+#define TMR0_WHEEL_SHIFT(lvl)           ((lvl) * TMR0_WHEEL_SLOT_BITS)
+#define TMR0_WHEEL_RANGE                (1UL << TMR0_WHEEL_SHIFT(TMR0_WHEEL_LVL_NUM))
+#define TMR0_WHEEL_SLOT_IDLE            (0xFFFFU)
+
+#define TMR0_WHEEL_CMP_MAX              (0xFFFFUL)
+/* The compare value is only moved while the counter is at least this far below it and
+   is never set closer than this above the counter: no match is lost or taken twice. */
+#define TMR0_WHEEL_CMP_GUARD            (2UL)
+
+#define TMR0_WHEEL_TICKS_MAX            (0x7FFFFFFFUL)
+
+/**
+ * @defgroup TMR0_WHEEL_Check_Parameters_Validity TMR0 Timer Wheel Check Parameters Validity
+ * @{
+ */
+#define IS_TMR0_WHEEL_UNIT(x)           ((x) == CM_TMR0)
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+#if (LL_INTERRUPTS_ENABLE == DDL_ON)
+static void TMR0_Wheel_Cmp_IrqCallback(void);
+#endif /* LL_INTERRUPTS_ENABLE */
+
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+/**
+ * @defgroup TMR0_WHEEL_Local_Variables TMR0 Timer Wheel Local Variables
+ * @{
+ */
+static stc_tmr0_wheel_ctrl_t m_stcTmr0Wheel;
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @defgroup TMR0_WHEEL_Local_Functions TMR0 Timer Wheel Local Functions
+ * @{
+ */
+
+#if (LL_INTERRUPTS_ENABLE == DDL_ON)
+static void TMR0_Wheel_Cmp_IrqCallback(void)
+{
+    TMR0_Wheel_CmpIrqHandler(CM_TMR0);
+}
+#endif /* LL_INTERRUPTS_ENABLE */
+
+/**
+ * @brief  Position of the lowest set bit.
+ * @param  [in] u32Bits                 Non-zero value.
+ * @retval uint32_t                     0 ~ 31
+ */
+static uint32_t TMR0_Wheel_FirstSet(uint32_t u32Bits)
+{
+    uint32_t u32Pos = 0UL;
+
+    if (0UL == (u32Bits & 0xFFFFUL)) {
+        u32Pos += 16UL;
+        u32Bits >>= 16U;
+    }
+    if (0UL == (u32Bits & 0xFFUL)) {
+        u32Pos += 8UL;
+        u32Bits >>= 8U;
+    }
+    if (0UL == (u32Bits & 0xFUL)) {
+        u32Pos += 4UL;
+        u32Bits >>= 4U;
+    }
+    if (0UL == (u32Bits & 0x3UL)) {
+        u32Pos += 2UL;
+        u32Bits >>= 2U;
+    }
+    if (0UL == (u32Bits & 0x1UL)) {
+        u32Pos += 1UL;
+    }
+
+    return u32Pos;
+}
+
+/**
+ * @brief  Link a timer into the slot of its expiry tick.
+ * @param  [in] pstcTimer               Timer, u32Expire is at or after u32Now.
+ * @retval None
+ */
+static void TMR0_Wheel_Insert(stc_tmr0_wheel_timer_t *pstcTimer)
+{
+    stc_tmr0_wheel_ctrl_t *pstcCtrl = &m_stcTmr0Wheel;
+    const uint32_t u32Delta = pstcTimer->u32Expire - pstcCtrl->u32Now;
+    uint32_t u32Expire = pstcTimer->u32Expire;
+    uint32_t u32Lvl = 0UL;
+    uint32_t u32Slot;
+
+    while ((u32Lvl < (TMR0_WHEEL_LVL_NUM - 1UL)) && (u32Delta >= (1UL << TMR0_WHEEL_SHIFT(u32Lvl + 1UL)))) {
+        u32Lvl++;
+    }
+    if (u32Delta >= TMR0_WHEEL_RANGE) {
+        /* Beyond the top level: parked in its last slot, cascaded again from there */
+        u32Expire = pstcCtrl->u32Now + TMR0_WHEEL_RANGE - 1UL;
+    }
+
+    u32Slot = (u32Lvl << TMR0_WHEEL_SLOT_BITS) + ((u32Expire >> TMR0_WHEEL_SHIFT(u32Lvl)) & TMR0_WHEEL_SLOT_MASK);
+    pstcTimer->u16Slot = (uint16_t)u32Slot;
+    pstcTimer->pstcPrev = NULL;
+    pstcTimer->pstcNext = pstcCtrl->apstcSlot[u32Slot];
+    if (NULL != pstcTimer->pstcNext) {
+        pstcTimer->pstcNext->pstcPrev = pstcTimer;
+    }
+    pstcCtrl->apstcSlot[u32Slot] = pstcTimer;
+    pstcCtrl->au32Bitmap[u32Lvl] |= 1UL << (u32Slot & TMR0_WHEEL_SLOT_MASK);
+}
+
+/**
+ * @brief  Unlink a running timer from its slot.
+ * @param  [in] pstcTimer               Timer
+ * @retval None
+ */
+static void TMR0_Wheel_Remove(stc_tmr0_wheel_timer_t *pstcTimer)
+{
+    stc_tmr0_wheel_ctrl_t *pstcCtrl = &m_stcTmr0Wheel;
+    const uint32_t u32Slot = pstcTimer->u16Slot;
+
+    if (NULL != pstcTimer->pstcNext) {
+        pstcTimer->pstcNext->pstcPrev = pstcTimer->pstcPrev;
+    }
+    if (NULL != pstcTimer->pstcPrev) {
+        pstcTimer->pstcPrev->pstcNext = pstcTimer->pstcNext;
+    } else {
+        pstcCtrl->apstcSlot[u32Slot] = pstcTimer->pstcNext;
+        if (NULL == pstcTimer->pstcNext) {
+            pstcCtrl->au32Bitmap[u32Slot >> TMR0_WHEEL_SLOT_BITS] &= ~(1UL << (u32Slot & TMR0_WHEEL_SLOT_MASK));
+        }
+    }
+    pstcTimer->u16Slot = TMR0_WHEEL_SLOT_IDLE;
+    pstcTimer->pstcNext = NULL;
+    pstcTimer->pstcPrev = NULL;
+}
+
+/**
+ * @brief  Get the next tick after u32Now at which a slot must be processed.
+ * @param  [out] pu32Tick               The tick.
+ * @retval An @ref en_flag_status_t enumeration type value, RESET if the wheel is empty.
+ * @note   For each level, the first non-empty slot after the current one is found in the
+ *         bitmap rotated to start there, the result is the earliest of the levels.
+ */
+static en_flag_status_t TMR0_Wheel_NextEvent(uint32_t *pu32Tick)
+{
+    const stc_tmr0_wheel_ctrl_t *pstcCtrl = &m_stcTmr0Wheel;
+    uint32_t u32Lvl;
+    uint32_t u32Bits;
+    uint32_t u32Shift;
+    uint32_t u32Tick;
+    uint32_t u32MinDelta = 0xFFFFFFFFUL;
+    en_flag_status_t enFound = RESET;
+
+    for (u32Lvl = 0UL; u32Lvl < TMR0_WHEEL_LVL_NUM; u32Lvl++) {
+        u32Bits = pstcCtrl->au32Bitmap[u32Lvl];
+        if (0UL != u32Bits) {
+            u32Tick = pstcCtrl->u32Now >> TMR0_WHEEL_SHIFT(u32Lvl);
+            u32Shift = (u32Tick + 1UL) & TMR0_WHEEL_SLOT_MASK;
+            if (0UL != u32Shift) {
+                u32Bits = (u32Bits >> u32Shift) | (u32Bits << (TMR0_WHEEL_SLOT_NUM - u32Shift));
+            }
+            u32Tick = (u32Tick + 1UL + TMR0_Wheel_FirstSet(u32Bits)) << TMR0_WHEEL_SHIFT(u32Lvl);
+            if ((u32Tick - pstcCtrl->u32Now) < u32MinDelta) {
+                u32MinDelta = u32Tick - pstcCtrl->u32Now;
+                *pu32Tick = u32Tick;
+                enFound = SET;
+            }
+        }
+    }
+
+    return enFound;
+}
+
+/**
+ * @brief  Process the wheel up to a tick: cascade the higher levels and run the callbacks
+ *         of the expired timers.
+ * @param  [in] u32Target               Tick, at or after u32Now.
+ * @retval None
+ * @note   Only the ticks given by TMR0_Wheel_NextEvent() are visited, the empty ones between
+ *         them are skipped.
+ */
+static void TMR0_Wheel_Advance(uint32_t u32Target)
+{
+    stc_tmr0_wheel_ctrl_t *pstcCtrl = &m_stcTmr0Wheel;
+    stc_tmr0_wheel_timer_t *pstcTimer;
+    uint32_t u32Tick;
+    uint32_t u32Lvl;
+    uint32_t u32Slot;
+
+    while ((SET == TMR0_Wheel_NextEvent(&u32Tick)) &&
+           ((u32Tick - pstcCtrl->u32Now) <= (u32Target - pstcCtrl->u32Now))) {
+        pstcCtrl->u32Now = u32Tick;
+
+        /* Higher levels first, so that a timer cascaded down to a slot starting at this tick
+           is processed in the same pass */
+        for (u32Lvl = TMR0_WHEEL_LVL_NUM - 1UL; u32Lvl > 0UL; u32Lvl--) {
+            if (0UL == (u32Tick & ((1UL << TMR0_WHEEL_SHIFT(u32Lvl)) - 1UL))) {
+                u32Slot = (u32Lvl << TMR0_WHEEL_SLOT_BITS) + ((u32Tick >> TMR0_WHEEL_SHIFT(u32Lvl)) & TMR0_WHEEL_SLOT_MASK);
+                while (NULL != pstcCtrl->apstcSlot[u32Slot]) {
+                    pstcTimer = pstcCtrl->apstcSlot[u32Slot];
+                    TMR0_Wheel_Remove(pstcTimer);
+                    TMR0_Wheel_Insert(pstcTimer);
+                }
+            }
+        }
+
+        /* One at a time: a callback may stop or restart any timer */
+        u32Slot = u32Tick & TMR0_WHEEL_SLOT_MASK;
+        while (NULL != pstcCtrl->apstcSlot[u32Slot]) {
+            pstcTimer = pstcCtrl->apstcSlot[u32Slot];
+            TMR0_Wheel_Remove(pstcTimer);
+            if (0UL != pstcTimer->u32Period) {
+                pstcTimer->u32Expire += pstcTimer->u32Period;
+                TMR0_Wheel_Insert(pstcTimer);
+            }
+            pstcTimer->pfnCallback(pstcTimer);
+        }
+    }
+    pstcCtrl->u32Now = u32Target;
+}
+
+/**
+ * @brief  Get the current tick, the interrupts must be disabled.
+ * @param  None
+ * @retval uint32_t                     Tick
+ */
+static uint32_t TMR0_Wheel_GetTickLocked(void)
+{
+    const stc_tmr0_wheel_ctrl_t *pstcCtrl = &m_stcTmr0Wheel;
+    const uint32_t u32Cmp = TMR0_GetCompareValue(pstcCtrl->TMR0x, TMR0_CH_A);
+    const uint32_t u32Cnt = TMR0_GetCountValue(pstcCtrl->TMR0x, TMR0_CH_A);
+    uint32_t u32Tick = pstcCtrl->u32Base + u32Cnt;
+
+    /* Matched and restarted, the IRQ handler has not updated u32Base yet */
+    if ((SET == TMR0_GetStatus(pstcCtrl->TMR0x, TMR0_FLAG_CMP_A)) && (u32Cnt < u32Cmp)) {
+        u32Tick += u32Cmp + 1UL;
+    }
+
+    return u32Tick;
+}
+
+/**
+ * @brief  Set the compare value to the next wheel event, at most TMR0_WHEEL_CMP_MAX ticks
+ *         after u32Base and at least TMR0_WHEEL_CMP_GUARD ticks after the counter.
+ * @param  [in] u32Cnt                  Counter value.
+ * @retval None
+ */
+static void TMR0_Wheel_SetCompare(uint32_t u32Cnt)
+{
+    const stc_tmr0_wheel_ctrl_t *pstcCtrl = &m_stcTmr0Wheel;
+    uint32_t u32Tick;
+    uint32_t u32Cmp = TMR0_WHEEL_CMP_MAX;
+
+    if (SET == TMR0_Wheel_NextEvent(&u32Tick)) {
+        if ((int32_t)(u32Tick - pstcCtrl->u32Base) < 0) {
+            u32Cmp = 0UL;
+        } else if ((u32Tick - pstcCtrl->u32Base) < TMR0_WHEEL_CMP_MAX) {
+            u32Cmp = u32Tick - pstcCtrl->u32Base;
+        } else {
+            /* Keep TMR0_WHEEL_CMP_MAX */
+        }
+    }
+    if (u32Cmp < (u32Cnt + TMR0_WHEEL_CMP_GUARD)) {
+        u32Cmp = u32Cnt + TMR0_WHEEL_CMP_GUARD;
+    }
+    if (u32Cmp > TMR0_WHEEL_CMP_MAX) {
+        u32Cmp = TMR0_WHEEL_CMP_MAX;
+    }
+    TMR0_SetCompareValue(pstcCtrl->TMR0x, TMR0_CH_A, (uint16_t)u32Cmp);
+}
+
+/**
+ * @brief  Move the compare value to the next wheel event outside of the IRQ handler,
+ *         the interrupts must be disabled.
+ * @param  None
+ * @retval None
+ * @note   Left as is while a match is pending or close, the IRQ handler sets it then.
+ */
+static void TMR0_Wheel_Reschedule(void)
+{
+    const stc_tmr0_wheel_ctrl_t *pstcCtrl = &m_stcTmr0Wheel;
+    const uint32_t u32Cmp = TMR0_GetCompareValue(pstcCtrl->TMR0x, TMR0_CH_A);
+    const uint32_t u32Cnt = TMR0_GetCountValue(pstcCtrl->TMR0x, TMR0_CH_A);
+
+    if ((RESET == TMR0_GetStatus(pstcCtrl->TMR0x, TMR0_FLAG_CMP_A)) &&
+        ((u32Cnt + TMR0_WHEEL_CMP_GUARD) <= u32Cmp)) {
+        TMR0_Wheel_SetCompare(u32Cnt);
+    }
+}
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup TMR0_WHEEL_Global_Functions TMR0 Timer Wheel Global Functions
+ * @{
+ */
+
+/**
+ * @brief  Set the fields of structure stc_tmr0_wheel_init_t to default values.
+ * @param  [out] pstcWheelInit      Pointer to a @ref stc_tmr0_wheel_init_t structure.
+ * @retval int32_t:
+ *         - LL_OK:                 Success
+ *         - LL_ERR_INVD_PARAM:     pstcWheelInit is NULL.
+ */
+int32_t TMR0_Wheel_StructInit(stc_tmr0_wheel_init_t *pstcWheelInit)
+{
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+
+    if (NULL != pstcWheelInit) {
+        pstcWheelInit->u32ClockSrc = TMR0_CLK_SRC_LRC;
+        pstcWheelInit->u32ClockDiv = TMR0_CLK_DIV1;
+        i32Ret = LL_OK;
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Initialize the timer wheel and start TMR0 channel A as its tick counter.
+ * @param  [in] TMR0x               Pointer to TMR0 unit instance.
+ *                                  This parameter can be a value of the following:
+ *         @arg CM_TMR0:            TMR0 unit instance.
+ * @param  [in] pstcWheelInit       Pointer to a @ref stc_tmr0_wheel_init_t structure.
+ * @retval int32_t:
+ *         - LL_OK:                 Success
+ *         - LL_ERR_INVD_PARAM:     pstcWheelInit is NULL.
+ * @note   The TMR0 function clock must be enabled, @ref FCG_Fcg0PeriphClockCmd, and the LRC
+ *         must run for TMR0_CLK_SRC_LRC. Running timers are dropped.
+ * @note   The IRQ handler waits for the counter to restart after a match, up to one tick:
+ *         keep the tick short, e.g. LRC undivided.
+ * @note   To wake up from stop mode, enable INTC_STOP_WKUP_TMR0_CMP, @ref INTC_WakeupSrcCmd.
+ */
+int32_t TMR0_Wheel_Init(CM_TMR0_TypeDef *TMR0x, const stc_tmr0_wheel_init_t *pstcWheelInit)
+{
+    stc_tmr0_init_t stcTmr0Init;
+    stc_tmr0_wheel_ctrl_t *pstcCtrl = &m_stcTmr0Wheel;
+    uint32_t i;
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+
+    DDL_ASSERT(IS_TMR0_WHEEL_UNIT(TMR0x));
+
+    if (NULL != pstcWheelInit) {
+        TMR0_Stop(TMR0x, TMR0_CH_A);
+        TMR0_IntCmd(TMR0x, TMR0_INT_CMP_A, DISABLE);
+
+        for (i = 0UL; i < (TMR0_WHEEL_LVL_NUM * TMR0_WHEEL_SLOT_NUM); i++) {
+            while (NULL != pstcCtrl->apstcSlot[i]) {
+                TMR0_Wheel_Remove(pstcCtrl->apstcSlot[i]);
+            }
+        }
+        pstcCtrl->TMR0x = TMR0x;
+        pstcCtrl->u32Base = 0UL;
+        pstcCtrl->u32Now = 0UL;
+
+        (void)TMR0_StructInit(&stcTmr0Init);
+        stcTmr0Init.u32ClockSrc = pstcWheelInit->u32ClockSrc;
+        stcTmr0Init.u32ClockDiv = pstcWheelInit->u32ClockDiv;
+        stcTmr0Init.u32Func = TMR0_FUNC_CMP;
+        stcTmr0Init.u16CompareValue = (uint16_t)TMR0_WHEEL_CMP_MAX;
+        i32Ret = TMR0_Init(TMR0x, TMR0_CH_A, &stcTmr0Init);
+        if (LL_OK == i32Ret) {
+            TMR0_ClearStatus(TMR0x, TMR0_FLAG_CMP_A);
+            TMR0_IntCmd(TMR0x, TMR0_INT_CMP_A, ENABLE);
+            TMR0_Start(TMR0x, TMR0_CH_A);
+        }
+    }
+
+    return i32Ret;
+}
+
+#if (LL_INTERRUPTS_ENABLE == DDL_ON)
+/**
+ * @brief  Register the TMR0 compare interrupt source and enable the NVIC IRQ.
+ * @param  [in] TMR0x               Pointer to TMR0 unit instance.
+ *                                  This parameter can be a value of the following:
+ *         @arg CM_TMR0:            TMR0 unit instance.
+ * @param  [in] enIRQn              IRQ number for INT_SRC_TMR0_CMP_A, @ref INTC_IrqSignIn for details.
+ * @param  [in] u32IrqPrio          IRQ priority, @ref INTC_Priority_Sel for details.
+ * @retval int32_t:
+ *         - LL_OK:                 Success
+ *         - LL_ERR_INVD_PARAM:     The IRQ number doesn't match the interrupt source.
+ * @note   INTC registers must be unlocked, @ref LL_PERIPH_WE for details.
+ */
+int32_t TMR0_Wheel_IrqSignIn(CM_TMR0_TypeDef *TMR0x, IRQn_Type enIRQn, uint32_t u32IrqPrio)
+{
+    stc_irq_signin_config_t stcIrqSignConfig;
+    int32_t i32Ret;
+
+    DDL_ASSERT(IS_TMR0_WHEEL_UNIT(TMR0x));
+    (void)TMR0x;
+
+    stcIrqSignConfig.enIntSrc = INT_SRC_TMR0_CMP_A;
+    stcIrqSignConfig.enIRQn = enIRQn;
+    stcIrqSignConfig.pfnCallback = &TMR0_Wheel_Cmp_IrqCallback;
+    i32Ret = INTC_IrqSignIn(&stcIrqSignConfig);
+    if (LL_OK == i32Ret) {
+        NVIC_ClearPendingIRQ(enIRQn);
+        NVIC_SetPriority(enIRQn, u32IrqPrio);
+        NVIC_EnableIRQ(enIRQn);
+    }
+
+    return i32Ret;
+}
+#endif /* LL_INTERRUPTS_ENABLE */
+
+/**
+ * @brief  Initialize a timer.
+ * @param  [out] pstcTimer          Pointer to a @ref stc_tmr0_wheel_timer_t structure.
+ * @param  [in] pfnCallback         Called from the TMR0 IRQ handler when the timer expires.
+ * @param  [in] pvUserData          User context, stored in the timer.
+ * @retval int32_t:
+ *         - LL_OK:                 Success
+ *         - LL_ERR_INVD_PARAM:     pstcTimer or pfnCallback is NULL.
+ * @note   Must not be called while the timer runs.
+ */
+int32_t TMR0_Wheel_TimerInit(stc_tmr0_wheel_timer_t *pstcTimer,
+                             void (*pfnCallback)(stc_tmr0_wheel_timer_t *pstcTimer), void *pvUserData)
+{
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+
+    if ((NULL != pstcTimer) && (NULL != pfnCallback)) {
+        pstcTimer->pfnCallback = pfnCallback;
+        pstcTimer->pvUserData = pvUserData;
+        pstcTimer->u32Expire = 0UL;
+        pstcTimer->u32Period = 0UL;
+        pstcTimer->u16Slot = TMR0_WHEEL_SLOT_IDLE;
+        pstcTimer->pstcNext = NULL;
+        pstcTimer->pstcPrev = NULL;
+        i32Ret = LL_OK;
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Start or restart a timer, in O(1).
+ * @param  [in] pstcTimer           Pointer to an initialized @ref stc_tmr0_wheel_timer_t structure.
+ * @param  [in] u32Ticks            Ticks to the first expiry, 1 ~ 0x7FFFFFFF.
+ * @param  [in] u32Period           Ticks between the following expiries, 0 for one-shot.
+ *                                  Counted from the expiry, so the period does not drift.
+ * @retval int32_t:
+ *         - LL_OK:                 Success
+ *         - LL_ERR_INVD_PARAM:     pstcTimer is NULL or a tick count is out of range.
+ * @note   Can be called from the timer callbacks and other IRQ handlers.
+ * @note   A timer expiring less than TMR0_WHEEL_CMP_GUARD(2) ticks after the previous compare
+ *         match, or after the call, runs late by up to that many ticks.
+ */
+int32_t TMR0_Wheel_TimerStart(stc_tmr0_wheel_timer_t *pstcTimer, uint32_t u32Ticks, uint32_t u32Period)
+{
+    uint32_t u32Primask;
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+
+    DDL_ASSERT(NULL != m_stcTmr0Wheel.TMR0x);
+
+    if ((NULL != pstcTimer) && (0UL != u32Ticks) && (u32Ticks <= TMR0_WHEEL_TICKS_MAX) &&
+        (u32Period <= TMR0_WHEEL_TICKS_MAX)) {
+        LL_ENTER_CRITICAL(u32Primask);
+        if (TMR0_WHEEL_SLOT_IDLE != pstcTimer->u16Slot) {
+            TMR0_Wheel_Remove(pstcTimer);
+        }
+        pstcTimer->u32Expire = TMR0_Wheel_GetTickLocked() + u32Ticks;
+        pstcTimer->u32Period = u32Period;
+        TMR0_Wheel_Insert(pstcTimer);
+        TMR0_Wheel_Reschedule();
+        LL_EXIT_CRITICAL(u32Primask);
+        i32Ret = LL_OK;
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Stop a timer, in O(1). Nothing is done if it does not run.
+ * @param  [in] pstcTimer           Pointer to an initialized @ref stc_tmr0_wheel_timer_t structure.
+ * @retval None
+ * @note   The compare value is left as is, a match with nothing to expire is ignored.
+ */
+void TMR0_Wheel_TimerStop(stc_tmr0_wheel_timer_t *pstcTimer)
+{
+    uint32_t u32Primask;
+
+    if (NULL != pstcTimer) {
+        LL_ENTER_CRITICAL(u32Primask);
+        if (TMR0_WHEEL_SLOT_IDLE != pstcTimer->u16Slot) {
+            TMR0_Wheel_Remove(pstcTimer);
+        }
+        LL_EXIT_CRITICAL(u32Primask);
+    }
+}
+
+/**
+ * @brief  Check whether a timer runs.
+ * @param  [in] pstcTimer           Pointer to an initialized @ref stc_tmr0_wheel_timer_t structure.
+ * @retval An @ref en_flag_status_t enumeration type value.
+ */
+en_flag_status_t TMR0_Wheel_TimerIsRunning(const stc_tmr0_wheel_timer_t *pstcTimer)
+{
+    en_flag_status_t enStatus = RESET;
+
+    if ((NULL != pstcTimer) && (TMR0_WHEEL_SLOT_IDLE != pstcTimer->u16Slot)) {
+        enStatus = SET;
+    }
+
+    return enStatus;
+}
+
+/**
+ * @brief  Get the ticks counted since TMR0_Wheel_Init().
+ * @param  None
+ * @retval uint32_t                 Tick, wraps around after 2^32 ticks.
+ */
+uint32_t TMR0_Wheel_GetTick(void)
+{
+    uint32_t u32Primask;
+    uint32_t u32Tick;
+
+    LL_ENTER_CRITICAL(u32Primask);
+    u32Tick = TMR0_Wheel_GetTickLocked();
+    LL_EXIT_CRITICAL(u32Primask);
+
+    return u32Tick;
+}
+
+/**
+ * @brief  Get the ticks left until the wheel needs the CPU.
+ * @param  None
+ * @retval uint32_t                 Ticks, 0 if an expiry is due, 0xFFFFFFFF if no timer runs.
+ * @note   The next event may be a cascade of a higher level ahead of the expiry itself,
+ *         so the result never exceeds the time to the next callback. For idle governors.
+ */
+uint32_t TMR0_Wheel_GetIdleTicks(void)
+{
+    uint32_t u32Primask;
+    uint32_t u32Tick;
+    uint32_t u32Idle = 0xFFFFFFFFUL;
+
+    LL_ENTER_CRITICAL(u32Primask);
+    if (SET == TMR0_Wheel_NextEvent(&u32Tick)) {
+        u32Idle = u32Tick - TMR0_Wheel_GetTickLocked();
+        if ((int32_t)u32Idle < 0) {
+            u32Idle = 0UL;
+        }
+    }
+    LL_EXIT_CRITICAL(u32Primask);
+
+    return u32Idle;
+}
+
+/**
+ * @brief  TMR0 compare match(INT_SRC_TMR0_CMP_A) IRQ handler.
+ * @param  [in] TMR0x               Pointer to TMR0 unit instance.
+ *                                  This parameter can be a value of the following:
+ *         @arg CM_TMR0:            TMR0 unit instance.
+ * @retval None
+ * @note   Accounts the elapsed period, runs the callbacks of the expired timers and sets the
+ *         compare value to the next wheel event: without pending timers, the IRQ comes once
+ *         every 65536 ticks.
+ */
+void TMR0_Wheel_CmpIrqHandler(CM_TMR0_TypeDef *TMR0x)
+{
+    stc_tmr0_wheel_ctrl_t *pstcCtrl = &m_stcTmr0Wheel;
+    uint32_t u32Cmp;
+    uint32_t u32Match;
+
+    if (SET == TMR0_GetStatus(TMR0x, TMR0_FLAG_CMP_A)) {
+        u32Cmp = TMR0_GetCompareValue(TMR0x, TMR0_CH_A);
+        /* The counter restarts from 0 on the tick after the match */
+        while (TMR0_GetCountValue(TMR0x, TMR0_CH_A) == u32Cmp) {
+        }
+        TMR0_ClearStatus(TMR0x, TMR0_FLAG_CMP_A);
+
+        u32Match = pstcCtrl->u32Base + u32Cmp;
+        pstcCtrl->u32Base = u32Match + 1UL;
+        TMR0_Wheel_Advance(u32Match);
+        TMR0_Wheel_SetCompare(TMR0_GetCountValue(TMR0x, TMR0_CH_A));
+    }
+}
+
+/**
+ * @}
+ */
+
+#endif /* LL_TMR0_WHEEL_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/******************************************************************************
+ * EOF (not truncated)
+ *****************************************************************************/
@@ -8,6 +8,9 @@
    Date             Author          Notes
    2022-03-31       CDT             First version
    2022-06-30       CDT             Optimize UART DIV_Fraction calculation time
+   2026-10-17       CDT             Calculate the baudrate division with integer arithmetic
+                                    Add API USART_CalculateBrr(), USART_SetBrr() and USART_SetBaudratePpm()
+                                    Set the baudrate of the XXX_Init() functions by USART_SetBaudratePpm()
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2022-2023, Xiaohua Semiconductor Co., Ltd. All rights reserved.
@@ -287,326 +290,99 @@ static int32_t USART_WaitStatus(const CM_USART_TypeDef *USARTx,
 }
 
 /**
- * @brief  Calculate baudrate integer division for UART mode.
- * @param  [in] USARTx                  Pointer to USART instance register base
- *         This parameter can be one of the following values:
- *           @arg CM_USARTx:            USART unit instance register base
- * @param  [in] u32UsartClk             USART clock
- * @param  [in] u32Baudrate             UART baudrate
- * @param  [out] pu32DivInteger         Pointer to BRR integer divsion value
- * @param  [out] pf32Error              E(%) baudrate error rate
- * @retval int32_t:
- *           - LL_OK:                   Set successfully.
- *           - LL_ERR_INVD_PARAM:       Set unsuccessfully.
+ * @brief  Calculate the baudrate error of a division.
+ * @param  [in] u64Actual               USART clock, scaled as u64Expect
+ * @param  [in] u64Expect               Baudrate times the division
+ * @retval Error in ppm: (u64Actual / u64Expect - 1) * 1000000, rounded.
  */
-static int32_t UART_CalculateDivInteger(const CM_USART_TypeDef *USARTx,
-                                        uint32_t u32UsartClk, uint32_t u32Baudrate,
-                                        uint32_t *pu32DivInteger, float32_t *pf32Error)
+static int32_t USART_CalculateErrorPpm(uint64_t u64Actual, uint64_t u64Expect)
 {
-    uint32_t B;
-    uint32_t C;
-    uint32_t OVER8;
-    uint64_t u64Temp;
-    uint32_t DIV_Integer;
-    float32_t f32Err;
-    int32_t i32Ret = LL_ERR_INVD_PARAM;
-
-    DDL_ASSERT(IS_USART_UNIT(USARTx));
-
-    C = u32UsartClk;
-    B = u32Baudrate;
-
-    if ((NULL != pu32DivInteger) && (C > 0UL) && (B > 0UL)) {
-        OVER8 = (0UL == READ_REG32_BIT(USARTx->CR1, USART_CR1_OVER8)) ? 0UL : 1UL;
-
-        /* UART mode baudrate integer calculation formula:      */
-        /*      B = C / (8 * (2 - OVER8) * (DIV_Integer + 1))   */
-        /*      DIV_Integer = (C / (B * 8 * (2 - OVER8))) - 1   */
-        DIV_Integer = ((((C * 10UL) / (B * 8UL * (2UL - OVER8))) + 5UL) / 10UL) - 1UL; /*  +5UL for rounding off */
-
-        if (DIV_Integer <= USART_BRR_DIV_INTEGER_MAX) {
-            *pu32DivInteger = DIV_Integer;
-
-            if (NULL != pf32Error) {
-                /* E(%) = C / (8 * (2 - OVER8) * (DIV_Integer + 1) * B) - 1 */
-
-                /* u64Temp = (8 * (2 - OVER8) * (DIV_Integer + 1) * B)  */
-                u64Temp = (uint64_t)((uint64_t)8UL * ((uint64_t)2UL - (uint64_t)OVER8) * ((uint64_t)DIV_Integer + \
-                                     (uint64_t)1UL) * (uint64_t)B);
-                f32Err = (float32_t)((float64_t)C / (float64_t)u64Temp) - 1.0F;
-
-                *pf32Error = f32Err;
-            }
-
-            i32Ret = LL_OK;
-        }
-    }
-
-    return i32Ret;
+    return (int32_t)((((u64Actual * 2000000ULL) / u64Expect) + 1ULL) / 2ULL) - 1000000L;
 }
 
 /**
- * @brief  Calculate baudrate integer division for clock synchronization mode.
- * @param  [in] USARTx                  Pointer to USART instance register base
- *         This parameter can be one of the following values:
- *           @arg CM_USARTx:            USART unit instance register base
- * @param  [in] u32UsartClk             USART clock
- * @param  [in] u32Baudrate             UART baudrate
- * @param  [out] pu32DivInteger         Pointer to BRR integer divsion value
- * @param  [out] pf32Error              E(%) baudrate error rate
- * @retval int32_t:
- *           - LL_OK:                   Set successfully.
- *           - LL_ERR_INVD_PARAM:       Set unsuccessfully.
+ * @brief  Convert the baudrate error for the float API.
+ * @param  [in] i32ErrorPpm             Error in ppm
+ * @param  [out] pf32Error              E(%) baudrate error rate, NULL if not needed
+ * @retval None
+ * @note   The only floating point operation of the baudrate path, done only if the caller asks for it.
  */
-static int32_t ClockSync_CalculateDivInteger(const CM_USART_TypeDef *USARTx,
-        uint32_t u32UsartClk, uint32_t u32Baudrate,
-        uint32_t *pu32DivInteger, float32_t *pf32Error)
+static void USART_ErrorPpmToFloat(int32_t i32ErrorPpm, float32_t *pf32Error)
 {
-    uint32_t B;
-    uint32_t C;
-    float32_t f32Err;
-    uint64_t u64Temp;
-    uint32_t DIV_Integer;
-    int32_t i32Ret = LL_ERR_INVD_PARAM;
-
-    DDL_ASSERT(IS_USART_UNIT(USARTx));
-
-    C = u32UsartClk;
-    B = u32Baudrate;
-
-    if ((NULL != pu32DivInteger) && (C > 0UL) && (B > 0UL)) {
-        /* Clock sync mode baudrate integer calculation formula:    */
-        /*          B = C / (4 * (DIV_Integer + 1))                 */
-        /*          DIV_Integer = (C / (B * 4)) - 1                 */
-        DIV_Integer = ((((C * 10UL) / (B * 4UL)) + 5UL) / 10UL) - 1UL; /*  +5UL for rounding off */
-
-        if ((DIV_Integer > 0UL) && (DIV_Integer <= USART_BRR_DIV_INTEGER_MAX)) {
-            *pu32DivInteger = DIV_Integer;
-
-            if (NULL != pf32Error) {
-                /* E(%) = C / (4 * (DIV_Integer + 1) * B) - 1 */
-
-                /* u64Temp = 4 * (DIV_Integer + 1) * B */
-                u64Temp = (uint64_t)((uint64_t)4U * ((uint64_t)DIV_Integer + (uint64_t)1UL) * (uint64_t)B);
-                f32Err = (float32_t)((float64_t)C / (float64_t)u64Temp) - 1.0F;
-
-                *pf32Error = f32Err;
-            }
-
-            i32Ret = LL_OK;
-        }
+    if (NULL != pf32Error) {
+        *pf32Error = (float32_t)i32ErrorPpm * 1.0E-6F;
     }
-
-    return i32Ret;
 }
 
 /**
- * @brief  Calculate baudrate fraction division for UART mode.
- * @param  [in] USARTx                  Pointer to USART instance register base
- *         This parameter can be one of the following values:
- *           @arg CM_USARTx:            USART unit instance register base
+ * @brief  Calculate baudrate integer division.
  * @param  [in] u32UsartClk             USART clock
- * @param  [in] u32Baudrate             UART baudrate
- * @param  [out] pu32DivInteger         Pointer to BRR integer divsion value
- * @param  [out] pu32DivFraction        Pointer to BRR fraction divsion value
- * @param  [out] pf32Error              E(%) baudrate error rate
+ * @param  [in] u32Baudrate             Baudrate
+ * @param  [in] u32Scale                Clocks per bit for DIV_Integer 0: 8 * (2 - OVER8) for UART mode,
+ *                                      4 for clock synchronization mode
+ * @param  [in] u32DivMin               Lowest DIV_Integer + 1, 1 at least
+ * @param  [out] pstcBrr                Pointer to a @ref stc_usart_brr_t structure
  * @retval int32_t:
- *           - LL_OK:                   Set successfully.
- *           - LL_ERR_INVD_PARAM:       Set unsuccessfully.
+ *           - LL_OK:                   Calculate successfully.
+ *           - LL_ERR_INVD_PARAM:       The division is out of range.
  */
-static int32_t UART_CalculateDivFraction(const CM_USART_TypeDef *USARTx, uint32_t u32UsartClk,
-        uint32_t u32Baudrate, uint32_t *pu32DivInteger,
-        uint32_t *pu32DivFraction, float32_t *pf32Error)
+static int32_t USART_CalculateDivInteger(uint32_t u32UsartClk, uint32_t u32Baudrate, uint32_t u32Scale,
+                                         uint32_t u32DivMin, stc_usart_brr_t *pstcBrr)
 {
-    uint32_t B;
-    uint32_t C;
-    uint32_t OVER8;
-    float32_t f32Err;
-    uint64_t u64Temp;
-    uint64_t u64Dividend;
-    uint32_t DIV_Integer;
-    uint32_t DIV_Fraction;
+    const uint32_t u32Unit = u32Scale * u32Baudrate;
+    uint32_t u32Div;
     int32_t i32Ret = LL_ERR_INVD_PARAM;
 
-    /* Check parameter */
-    DDL_ASSERT(IS_USART_UNIT(USARTx));
-
-    C = u32UsartClk;
-    B = u32Baudrate;
-
-    if ((NULL != pu32DivInteger) && (NULL != pu32DivFraction) && (C > 0UL) && (B > 0UL)) {
-        OVER8 = (0UL == READ_REG32_BIT(USARTx->CR1, USART_CR1_OVER8)) ? 0UL : 1UL;
-
-        /* UART mode baudrate integer calculation formula:      */
-        /*      B = C / (8 * (2 - OVER8) * (DIV_Integer + 1))   */
-        /*      DIV_Integer = (C / (B * 8 * (2 - OVER8))) - 1   */
-        DIV_Integer = (C / (B * 8UL * (2UL - OVER8))) - 1UL;
-
-        if (DIV_Integer <= USART_BRR_DIV_INTEGER_MAX) {
-            /* UART mode baudrate fraction calculation formula:                                 */
-            /*      B = C * (128 + DIV_Fraction) / (8 * (2 - OVER8) * (DIV_Integer + 1) * 256)  */
-            /*      DIV_Fraction = (256 * (8 * (2 - OVER8) * (DIV_Integer + 1) * B) / C) - 128  */
-
-            /* u64Temp = (8 * (2 - OVER8) * (DIV_Integer + 1) * B)  */
-            u64Temp = (uint64_t)((uint64_t)8UL * ((uint64_t)2UL - (uint64_t)OVER8) * ((uint64_t)DIV_Integer + \
-                                 (uint64_t)1UL) * (uint64_t)B);
-
-            if ((u64Temp << 8) > (uint64_t)(UINT32_MAX)) {
-                DIV_Fraction = (uint32_t)(256UL * u64Temp / C - 128UL);
-            } else {
-                DIV_Fraction = (uint32_t)(256UL * (uint32_t)u64Temp / C - 128UL);
-            }
-
-            if (DIV_Fraction <= USART_BRR_DIV_FRACTION_MAX) {
-                *pu32DivInteger = DIV_Integer;
-                *pu32DivFraction = DIV_Fraction;
-
-                if (NULL != pf32Error) {
-                    /* E(%) = C * (128 + DIV_Fraction) / (256 * (8 * (2 - OVER8) * (DIV_Integer + 1) * B)) - 1 */
-                    u64Temp *= (uint64_t)256UL;
-                    u64Dividend = (uint64_t)C * ((uint64_t)128UL + (uint64_t)DIV_Fraction);
-                    f32Err = (float32_t)((float64_t)(u64Dividend) / (float64_t)(u64Temp)) - 1.0F;
-
-                    *pf32Error = f32Err;
-                }
-
-                i32Ret = LL_OK;
-            }
-        }
+    /* B = C / (Scale * (DIV_Integer + 1)), DIV_Integer + 1 rounded to nearest */
+    u32Div = (u32UsartClk + (u32Unit / 2UL)) / u32Unit;
+    if ((u32Div >= u32DivMin) && ((u32Div - 1UL) <= USART_BRR_DIV_INTEGER_MAX)) {
+        pstcBrr->u32DivInteger = u32Div - 1UL;
+        pstcBrr->u32DivFraction = USART_BRR_DIV_FRACTION_OFF;
+        pstcBrr->i32ErrorPpm = USART_CalculateErrorPpm((uint64_t)u32UsartClk, (uint64_t)u32Unit * u32Div);
+        i32Ret = LL_OK;
     }
 
     return i32Ret;
 }
 
 /**
- * @brief  Calculate baudrate fraction division for clock synchronization mode.
- * @param  [in] USARTx                  Pointer to USART instance register base
- *         This parameter can be one of the following values:
- *           @arg CM_USARTx:            USART unit instance register base
+ * @brief  Calculate baudrate integer and fraction division.
  * @param  [in] u32UsartClk             USART clock
- * @param  [in] u32Baudrate             UART baudrate
- * @param  [out] pu32DivInteger         Pointer to BRR integer divsion value
- * @param  [out] pu32DivFraction        Pointer to BRR fraction divsion value
- * @param  [out] pf32Error              E(%) baudrate error rate
+ * @param  [in] u32Baudrate             Baudrate
+ * @param  [in] u32Scale                Clocks per bit for DIV_Integer 0: 8 * (2 - OVER8) for UART mode,
+ *                                      4 for clock synchronization mode
+ * @param  [in] u32DivMin               Lowest DIV_Integer + 1, 1 at least
+ * @param  [out] pstcBrr                Pointer to a @ref stc_usart_brr_t structure
  * @retval int32_t:
- *           - LL_OK:                   Set successfully.
- *           - LL_ERR_INVD_PARAM:       Set unsuccessfully.
+ *           - LL_OK:                   Calculate successfully.
+ *           - LL_ERR_INVD_PARAM:       The division is out of range.
  */
-static int32_t ClockSync_CalculateDivFraction(const CM_USART_TypeDef *USARTx, uint32_t u32UsartClk,
-        uint32_t u32Baudrate, uint32_t *pu32DivInteger,
-        uint32_t *pu32DivFraction, float32_t *pf32Error)
+static int32_t USART_CalculateDivFraction(uint32_t u32UsartClk, uint32_t u32Baudrate, uint32_t u32Scale,
+                                          uint32_t u32DivMin, stc_usart_brr_t *pstcBrr)
 {
-    uint32_t B;
-    uint32_t C;
-    float32_t f32Err;
-    uint64_t u64Temp;
-    uint64_t u64Dividend;
-    uint32_t DIV_Integer;
-    uint32_t DIV_Fraction;
+    const uint32_t u32Unit = u32Scale * u32Baudrate;
+    uint32_t u32Div;
+    uint32_t u32Fraction;
+    uint64_t u64Expect;
     int32_t i32Ret = LL_ERR_INVD_PARAM;
 
-    /* Check parameter */
-    DDL_ASSERT(IS_USART_UNIT(USARTx));
-
-    C = u32UsartClk;
-    B = u32Baudrate;
-
-    if ((NULL != pu32DivInteger) && (NULL != pu32DivFraction) && (C > 0UL) && (B > 0UL)) {
-        /* Clock sync mode baudrate integer calculation formula:    */
-        /*          B = C / (4 * (DIV_Integer + 1))                 */
-        /*          DIV_Integer = (C / (B * 4)) - 1                 */
-        DIV_Integer = (C / (B * 4UL)) - 1UL;
-
-        if ((DIV_Integer > 0UL) && (DIV_Integer <= USART_BRR_DIV_INTEGER_MAX)) {
-            /* Clock sync mode baudrate fraction calculation formula:               */
-            /*      B = C * (128 + DIV_Fraction) / (4 * (DIV_Integer + 1) * 256)    */
-            /*      DIV_Fraction = 256 * (4 * (DIV_Integer + 1) * B) / C - 128       */
-
-            /* u64Temp = (4 * (DIV_Integer + 1) * B)  */
-            u64Temp = (uint64_t)((uint64_t)4U * ((uint64_t)DIV_Integer + (uint64_t)1UL) * (uint64_t)B);
-
-            DIV_Fraction = (uint32_t)(256UL * u64Temp / C - 128UL);
-
-            if (DIV_Fraction <= USART_BRR_DIV_FRACTION_MAX) {
-                *pu32DivInteger = DIV_Integer;
-                *pu32DivFraction = DIV_Fraction;
-
-                if (NULL != pf32Error) {
-                    /* E(%) = C * (128 + DIV_Fraction) / (4 * (DIV_Integer + 1) * B * 256) - 1 */
-                    u64Temp *= (uint64_t)256UL;
-                    u64Dividend = (uint64_t)C * ((uint64_t)128UL + (uint64_t)DIV_Fraction);
-                    f32Err = (float32_t)((float64_t)(u64Dividend) / (float64_t)(u64Temp)) - 1.0F;
-
-                    *pf32Error = f32Err;
-                }
-
-                i32Ret = LL_OK;
-            }
+    /* The largest DIV_Integer, the fraction steps are the finest */
+    u32Div = u32UsartClk / u32Unit;
+    if ((u32Div >= u32DivMin) && ((u32Div - 1UL) <= USART_BRR_DIV_INTEGER_MAX)) {
+        /* B = C * (128 + DIV_Fraction) / (Scale * (DIV_Integer + 1) * 256), 128 + DIV_Fraction rounded */
+        u64Expect = (uint64_t)u32Unit * u32Div;
+        u32Fraction = (uint32_t)((((u64Expect << 9U) / u32UsartClk) + 1ULL) >> 1U);
+
+        pstcBrr->u32DivInteger = u32Div - 1UL;
+        if (u32Fraction > (128UL + USART_BRR_DIV_FRACTION_MAX)) {
+            /* Rounded to 256: the integer division alone is closer */
+            pstcBrr->u32DivFraction = USART_BRR_DIV_FRACTION_OFF;
+            pstcBrr->i32ErrorPpm = USART_CalculateErrorPpm((uint64_t)u32UsartClk, u64Expect);
+        } else {
+            pstcBrr->u32DivFraction = u32Fraction - 128UL;
+            pstcBrr->i32ErrorPpm = USART_CalculateErrorPpm((uint64_t)u32UsartClk * u32Fraction, u64Expect << 8U);
         }
-    }
-
-    return i32Ret;
-}
-
-/**
- * @brief  Calculate baudrate fraction division for UART mode.
- * @param  [in] USARTx                  Pointer to USART instance register base
- *         This parameter can be one of the following values:
- *           @arg CM_USARTx:            USART unit instance register base
- * @param  [in] u32UsartClk             USART clock
- * @param  [in] u32Baudrate             UART baudrate
- * @param  [out] pu32DivInteger         Pointer to BRR integer divsion value
- * @param  [out] pu32DivFraction        Pointer to BRR fraction divsion value
- * @param  [out] pf32Error              E(%) baudrate error rate
- * @retval int32_t:
- *           - LL_OK:                   Set successfully.
- *           - LL_ERR:                  Set unsuccessfully.
- *           - LL_ERR_INVD_PARAM:       The parameters invalid.
- */
-static int32_t UART_CalculateDiv(const CM_USART_TypeDef *USARTx, uint32_t u32UsartClk,
-                                 uint32_t u32Baudrate, uint32_t *pu32DivInteger,
-                                 uint32_t *pu32DivFraction, float32_t *pf32Error)
-{
-    int32_t i32Ret = LL_ERR;
-
-    if (!IS_USART_INTEGER_UNIT(USARTx)) {
-        i32Ret = UART_CalculateDivFraction(USARTx, u32UsartClk, u32Baudrate, pu32DivInteger, pu32DivFraction, pf32Error);
-    }
-
-    if (LL_OK != i32Ret) {
-        i32Ret = UART_CalculateDivInteger(USARTx, u32UsartClk, u32Baudrate, pu32DivInteger, pf32Error);
-    }
-
-    return i32Ret;
-}
-
-/**
- * @brief  Calculate baudrate fraction division for UART mode.
- * @param  [in] USARTx                  Pointer to USART instance register base
- *         This parameter can be one of the following values:
- *           @arg CM_USARTx:            USART unit instance register base
- * @param  [in] u32UsartClk             USART clock
- * @param  [in] u32Baudrate             UART baudrate
- * @param  [out] pu32DivInteger         Pointer to BRR integer divsion value
- * @param  [out] pu32DivFraction        Pointer to BRR fraction divsion value
- * @param  [out] pf32Error              E(%) baudrate error rate
- * @retval int32_t:
- *           - LL_OK:                   Set successfully.
- *           - LL_ERR:                  Set unsuccessfully.
- *           - LL_ERR_INVD_PARAM:       The parameters invalid.
- */
-static int32_t ClockSync_CalculateDiv(const CM_USART_TypeDef *USARTx, uint32_t u32UsartClk,
-                                      uint32_t u32Baudrate, uint32_t *pu32DivInteger,
-                                      uint32_t *pu32DivFraction, float32_t *pf32Error)
-{
-    int32_t i32Ret = LL_ERR;
-
-    if (!IS_USART_INTEGER_UNIT(USARTx)) {
-        i32Ret = ClockSync_CalculateDivFraction(USARTx, u32UsartClk, u32Baudrate, pu32DivInteger, pu32DivFraction, pf32Error);
-    }
-
-    if (LL_OK != i32Ret) {
-        i32Ret = ClockSync_CalculateDivInteger(USARTx, u32UsartClk, u32Baudrate, pu32DivInteger, pf32Error);
+        i32Ret = LL_OK;
     }
 
     return i32Ret;
@@ -717,6 +493,7 @@ int32_t USART_ClockSync_Init(CM_USART_TypeDef *USARTx,
     uint32_t u32CR1Value;
     uint32_t u32CR2Value;
     uint32_t u32CR3Value;
+    int32_t i32ErrorPpm;
     int32_t i32Ret = LL_ERR_INVD_PARAM;
 
     if (NULL != pstcClockSyncInit) {
@@ -744,7 +521,10 @@ int32_t USART_ClockSync_Init(CM_USART_TypeDef *USARTx,
             WRITE_REG32(USARTx->PR, pstcClockSyncInit->u32ClockDiv);
 
             /* Set baudrate */
-            i32Ret = USART_SetBaudrate(USARTx, pstcClockSyncInit->u32Baudrate, pf32Error);
+            i32Ret = USART_SetBaudratePpm(USARTx, pstcClockSyncInit->u32Baudrate, &i32ErrorPpm);
+            if (LL_OK == i32Ret) {
+                USART_ErrorPpmToFloat(i32ErrorPpm, pf32Error);
+            }
         } else {
             i32Ret = LL_OK;
         }
@@ -798,6 +578,7 @@ int32_t USART_MultiProcessor_Init(CM_USART_TypeDef *USARTx,
     uint32_t u32CR1Value;
     uint32_t u32CR2Value;
     uint32_t u32CR3Value;
+    int32_t i32ErrorPpm;
     int32_t i32Ret = LL_ERR_INVD_PARAM;
 
     if (NULL != pstcMultiProcessorInit) {
@@ -829,7 +610,10 @@ int32_t USART_MultiProcessor_Init(CM_USART_TypeDef *USARTx,
             WRITE_REG32(USARTx->PR, pstcMultiProcessorInit->u32ClockDiv);
 
             /* Set baudrate */
-            i32Ret = USART_SetBaudrate(USARTx, pstcMultiProcessorInit->u32Baudrate, pf32Error);
+            i32Ret = USART_SetBaudratePpm(USARTx, pstcMultiProcessorInit->u32Baudrate, &i32ErrorPpm);
+            if (LL_OK == i32Ret) {
+                USART_ErrorPpmToFloat(i32ErrorPpm, pf32Error);
+            }
         } else {
             i32Ret = LL_OK;
         }
@@ -883,6 +667,7 @@ int32_t USART_UART_Init(CM_USART_TypeDef *USARTx, const stc_usart_uart_init_t *p
     uint32_t u32CR1Value;
     uint32_t u32CR2Value;
     uint32_t u32CR3Value;
+    int32_t i32ErrorPpm;
     int32_t i32Ret = LL_ERR_INVD_PARAM;
 
     if (NULL != pstcUartInit) {
@@ -915,7 +700,10 @@ int32_t USART_UART_Init(CM_USART_TypeDef *USARTx, const stc_usart_uart_init_t *p
             WRITE_REG32(USARTx->PR, pstcUartInit->u32ClockDiv);
 
             /* Set baudrate */
-            i32Ret = USART_SetBaudrate(USARTx, pstcUartInit->u32Baudrate, pf32Error);
+            i32Ret = USART_SetBaudratePpm(USARTx, pstcUartInit->u32Baudrate, &i32ErrorPpm);
+            if (LL_OK == i32Ret) {
+                USART_ErrorPpmToFloat(i32ErrorPpm, pf32Error);
+            }
         } else {
             i32Ret = LL_OK;
         }
@@ -988,6 +776,7 @@ int32_t USART_LIN_Init(CM_USART_TypeDef *USARTx, const stc_usart_lin_init_t *pst
     uint32_t u32CR1Value;
     uint32_t u32CR2Value;
     uint32_t u32PRValue;
+    int32_t i32ErrorPpm;
     int32_t i32Ret = LL_ERR_INVD_PARAM;
 
     if (NULL != pstcLinInit) {
@@ -1013,7 +802,10 @@ int32_t USART_LIN_Init(CM_USART_TypeDef *USARTx, const stc_usart_lin_init_t *pst
             WRITE_REG32(USARTx->PR, u32PRValue);
 
             /* Set baudrate */
-            i32Ret = USART_SetBaudrate(USARTx, pstcLinInit->u32Baudrate, pf32Error);
+            i32Ret = USART_SetBaudratePpm(USARTx, pstcLinInit->u32Baudrate, &i32ErrorPpm);
+            if (LL_OK == i32Ret) {
+                USART_ErrorPpmToFloat(i32ErrorPpm, pf32Error);
+            }
         } else {
             i32Ret = LL_OK;
         }
@@ -1420,51 +1212,138 @@ void USART_WriteID(CM_USART_TypeDef *USARTx, uint16_t u16ID)
 }
 
 /**
- * @brief  Set USART baudrate.
+ * @brief  Calculate the BRR division of a baudrate, integer arithmetic only.
+ * @param  [in] USARTx                  Pointer to USART instance register base
+ *         This parameter can be one of the following values:
+ *           @arg CM_USARTx:            USART unit instance register base
+ * @param  [in] u32UsartClk             USART clock: the bus clock divided by USART_CLK_DIVx, it may be
+ *                                      another clock than the current one.
+ * @param  [in] u32Baudrate             Baudrate
+ * @param  [out] pstcBrr                Pointer to a @ref stc_usart_brr_t structure
+ * @retval int32_t:
+ *           - LL_OK:                   Calculate successfully.
+ *           - LL_ERR_INVD_PARAM:       pstcBrr is NULL, u32UsartClk or u32Baudrate is 0 or the division
+ *                                      is out of range.
+ *           - LL_ERR_INVD_MD:          The unit is in smart card mode.
+ * @note   The mode (UART or clock synchronization) and the oversampling are read from USARTx.
+ *         The fraction division is used if the unit supports it, with the closest fraction to
+ *         the largest integer division. The result is the one of @ref USART_BRR_Constant
+ *         for the same clock and baudrate on units without the fraction division.
+ */
+int32_t USART_CalculateBrr(const CM_USART_TypeDef *USARTx, uint32_t u32UsartClk, uint32_t u32Baudrate,
+                           stc_usart_brr_t *pstcBrr)
+{
+    uint32_t u32Scale;
+    uint32_t u32DivMin;
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+
+    DDL_ASSERT(IS_USART_UNIT(USARTx));
+
+    if (0UL != READ_REG32_BIT(USARTx->CR1, USART_CR1_MS)) {
+        /* Clock sync mode: B = C / (4 * (DIV_Integer + 1)), DIV_Integer > 0 */
+        u32Scale = 4UL;
+        u32DivMin = 2UL;
+    } else if (0UL == READ_REG32_BIT(USARTx->CR3, USART_CR_SCEN)) {
+        /* UART mode: B = C / (8 * (2 - OVER8) * (DIV_Integer + 1)) */
+        u32Scale = (0UL == READ_REG32_BIT(USARTx->CR1, USART_CR1_OVER8)) ? 16UL : 8UL;
+        u32DivMin = 1UL;
+    } else {
+        u32Scale = 0UL;
+        u32DivMin = 0UL;
+        i32Ret = LL_ERR_INVD_MD;
+    }
+
+    if ((0UL != u32Scale) && (NULL != pstcBrr) && (u32UsartClk > 0UL) && (u32Baudrate > 0UL)) {
+        if (!IS_USART_INTEGER_UNIT(USARTx)) {
+            i32Ret = USART_CalculateDivFraction(u32UsartClk, u32Baudrate, u32Scale, u32DivMin, pstcBrr);
+        }
+
+        if (LL_OK != i32Ret) {
+            i32Ret = USART_CalculateDivInteger(u32UsartClk, u32Baudrate, u32Scale, u32DivMin, pstcBrr);
+        }
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Set USART BRR division.
+ * @param  [in] USARTx                  Pointer to USART instance register base
+ *         This parameter can be one of the following values:
+ *           @arg CM_USARTx:            USART unit instance register base
+ * @param  [in] pstcBrr                 Pointer to a @ref stc_usart_brr_t structure, from
+ *                                      USART_CalculateBrr() or @ref USART_BRR_Constant.
+ * @retval None
+ */
+void USART_SetBrr(CM_USART_TypeDef *USARTx, const stc_usart_brr_t *pstcBrr)
+{
+    DDL_ASSERT(IS_USART_UNIT(USARTx));
+    DDL_ASSERT(NULL != pstcBrr);
+    DDL_ASSERT(pstcBrr->u32DivInteger <= USART_BRR_DIV_INTEGER_MAX);
+
+    MODIFY_REG32(USARTx->BRR, USART_BRR_DIV_INTEGER, (pstcBrr->u32DivInteger << USART_BRR_DIV_INTEGER_POS));
+
+    if (pstcBrr->u32DivFraction <= USART_BRR_DIV_FRACTION_MASK) {
+        SET_REG32_BIT(USARTx->CR1, USART_CR_FBME);
+        MODIFY_REG32(USARTx->BRR, USART_BRR_DIV_FRACTION_MASK, pstcBrr->u32DivFraction);
+    } else {
+        CLR_REG32_BIT(USARTx->CR1, USART_CR_FBME);
+    }
+}
+
+/**
+ * @brief  Set USART baudrate, integer arithmetic only.
  * @param  [in] USARTx                  Pointer to USART instance register base
  *         This parameter can be one of the following values:
  *           @arg CM_USARTx:            USART unit instance register base
  * @param  [in] u32Baudrate             UART baudrate
- * @param  [out] pf32Error              E(%) baudrate error rate
+ * @param  [out] pi32ErrorPpm           Baudrate error in ppm, NULL if not needed
  * @retval int32_t:
  *           - LL_OK:                   Set successfully.
  *           - LL_ERR_INVD_PARAM:       Set unsuccessfully.
- * @note The function uses fraction division to ensure baudrate accuracy if USART unit supports baudrate fraction division.
+ *           - LL_ERR_INVD_MD:          The unit is in smart card mode.
  */
-int32_t USART_SetBaudrate(CM_USART_TypeDef *USARTx, uint32_t u32Baudrate, float32_t *pf32Error)
+int32_t USART_SetBaudratePpm(CM_USART_TypeDef *USARTx, uint32_t u32Baudrate, int32_t *pi32ErrorPpm)
 {
-    uint32_t u32Mode;
-    uint32_t u32UsartClock;
-    uint32_t u32Integer = 0UL;
-    uint32_t u32Fraction = 0xFFFFUL;
+    stc_usart_brr_t stcBrr;
     int32_t i32Ret;
 
     DDL_ASSERT(u32Baudrate > 0UL);
     DDL_ASSERT(IS_USART_UNIT(USARTx));
 
-    /* Get USART clock frequency */
-    u32UsartClock = USART_GetUsartClockFreq(USARTx);
+    i32Ret = USART_CalculateBrr(USARTx, USART_GetUsartClockFreq(USARTx), u32Baudrate, &stcBrr);
+    if (LL_OK == i32Ret) {
+        USART_SetBrr(USARTx, &stcBrr);
 
-    /* Calculate baudrate for BRR */
-    u32Mode = READ_REG32_BIT(USARTx->CR1, USART_CR1_MS);
-    if (0UL == u32Mode) {
-        u32Mode = READ_REG32_BIT(USARTx->CR3, USART_CR_SCEN);
-        if (0UL == u32Mode) {
-            i32Ret = UART_CalculateDiv(USARTx, u32UsartClock, u32Baudrate, &u32Integer, &u32Fraction, pf32Error);
-        } else {
-            i32Ret = LL_ERR_INVD_MD;
+        if (NULL != pi32ErrorPpm) {
+            *pi32ErrorPpm = stcBrr.i32ErrorPpm;
         }
-    } else {
-        i32Ret = ClockSync_CalculateDiv(USARTx, u32UsartClock, u32Baudrate, &u32Integer, &u32Fraction, pf32Error);
     }
 
-    if (LL_OK == i32Ret) {
-        MODIFY_REG32(USARTx->BRR, USART_BRR_DIV_INTEGER, (u32Integer << USART_BRR_DIV_INTEGER_POS));
+    return i32Ret;
+}
 
-        if (u32Fraction <= USART_BRR_DIV_FRACTION_MASK) {
-            SET_REG32_BIT(USARTx->CR1, USART_CR_FBME);
-            MODIFY_REG32(USARTx->BRR, USART_BRR_DIV_FRACTION_MASK, u32Fraction);
-        }
+/**
+ * @brief  Set USART baudrate.
+ * @param  [in] USARTx                  Pointer to USART instance register base
+ *         This parameter can be one of the following values:
+ *           @arg CM_USARTx:            USART unit instance register base
+ * @param  [in] u32Baudrate             UART baudrate
+ * @param  [out] pf32Error              E(%) baudrate error rate
+ * @retval int32_t:
+ *           - LL_OK:                   Set successfully.
+ *           - LL_ERR_INVD_PARAM:       Set unsuccessfully.
+ * @note The function uses fraction division to ensure baudrate accuracy if USART unit supports baudrate fraction division.
+ * @note USART_SetBaudratePpm() does the same without floating point.
+ */
+int32_t USART_SetBaudrate(CM_USART_TypeDef *USARTx, uint32_t u32Baudrate, float32_t *pf32Error)
+{
+    int32_t i32ErrorPpm;
+    int32_t i32Ret;
+
+    i32Ret = USART_SetBaudratePpm(USARTx, u32Baudrate, &i32ErrorPpm);
+    if (LL_OK == i32Ret) {
+        USART_ErrorPpmToFloat(i32ErrorPpm, pf32Error);
     }
 
     return i32Ret;
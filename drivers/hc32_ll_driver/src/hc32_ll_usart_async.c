@@ -0,0 +1,726 @@
+/**
+ *******************************************************************************
+ * @file  hc32_ll_usart_async.c
+ * @brief This file provides firmware functions to manage the USART in
+ *        interrupt-driven asynchronous UART mode with TX/RX ring buffers.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-16       CDT             First version
+                                    Move the ring buffers onto the SPSC queue
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2022-2023, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_ll_usart_async.h"
+#include "hc32_ll_usart.h"
+#include "hc32_ll_spsc.h"
+#include "hc32_ll_interrupts.h"
+#include "hc32_ll_utility.h"
+
+/**
+ * @addtogroup LL_Driver
+ * @{
+ */
+
+/**
+ * @defgroup LL_USART_ASYNC USART_ASYNC
+ * @brief USART Interrupt-driven Asynchronous UART Driver Library
+ * @{
+ */
+
+#if (LL_USART_ASYNC_ENABLE == DDL_ON)
+
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @defgroup USART_ASYNC_Local_Types USART Async Local Types
+ * @{
+ */
+
+/**
+ * @brief USART asynchronous mode control block definition
+ * @note  TX: thread code produces and the TI handler consumes.
+ *        RX: the RI handler produces and thread code consumes.
+ *        A direction is unused while the pu8Buf of its queue is NULL.
+ */
+typedef struct {
+    stc_spsc_t stcTx;
+    __IO uint32_t u32TxBusy;
+    stc_spsc_t stcRx;
+    void (*pfnTxCpltCallback)(CM_USART_TypeDef *USARTx);
+    void (*pfnRxCallback)(CM_USART_TypeDef *USARTx, uint32_t u32RxCount);
+    void (*pfnErrorCallback)(CM_USART_TypeDef *USARTx, uint32_t u32Error);
+} stc_usart_async_ctrl_t;
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup USART_ASYNC_Local_Macros USART Async Local Macros
+ * @{
+ */
+#define USART_ASYNC_UNIT_NUM            (4U)
+#define USART_ASYNC_IRQ_NUM             (4U)
+
+/**
+ * @defgroup USART_ASYNC_Check_Parameters_Validity USART Async Check Parameters Validity
+ * @{
+ */
+#define IS_USART_ASYNC_UNIT(x)                                                 \
+(   ((x) == CM_USART1)                  ||                                     \
+    ((x) == CM_USART2)                  ||                                     \
+    ((x) == CM_USART3)                  ||                                     \
+    ((x) == CM_USART4))
+
+#define IS_USART_ASYNC_BUF_SIZE(x)                                             \
+(   ((x) != 0UL)                        &&                                     \
+    (((x) & ((x) - 1UL)) == 0UL))
+/**
+ * @}
+ */
+
+/**
+ * @defgroup USART_ASYNC_Register_Access USART Async Register Access
+ * @note CR1 bits are written through the bit-band alias, so thread code and the
+ *       handlers of the same unit never lose each other's read-modify-write.
+ * @{
+ */
+#define USART_ASYNC_CR1_BIT(_UNITx_, pos)   PERIPH_BIT_BAND((uint32_t)&(_UNITx_)->CR1, (pos))
+#define USART_ASYNC_TXD(_UNITx_)            (*(__IO uint16_t *)((uint32_t)&(_UNITx_)->DR))
+#define USART_ASYNC_RXD(_UNITx_)            (*(__IO uint16_t *)((uint32_t)&(_UNITx_)->DR + 2UL))
+
+#define USART_ASYNC_ERR_MASK                (USART_SR_PE | USART_SR_FE | USART_SR_ORE)
+/* SR.PE/FE/ORE are cleared by CR1.CPE/CFE/CORE which sit 16 bits higher */
+#define USART_ASYNC_ERR_CLR_OFFSET          (USART_CR1_CPE_POS - USART_SR_PE_POS)
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+#if (LL_INTERRUPTS_ENABLE == DDL_ON)
+static void USART1_Async_RxError_IrqCallback(void);
+static void USART1_Async_RxFull_IrqCallback(void);
+static void USART1_Async_TxEmpty_IrqCallback(void);
+static void USART1_Async_TxCplt_IrqCallback(void);
+static void USART2_Async_RxError_IrqCallback(void);
+static void USART2_Async_RxFull_IrqCallback(void);
+static void USART2_Async_TxEmpty_IrqCallback(void);
+static void USART2_Async_TxCplt_IrqCallback(void);
+static void USART3_Async_RxError_IrqCallback(void);
+static void USART3_Async_RxFull_IrqCallback(void);
+static void USART3_Async_TxEmpty_IrqCallback(void);
+static void USART3_Async_TxCplt_IrqCallback(void);
+static void USART4_Async_RxError_IrqCallback(void);
+static void USART4_Async_RxFull_IrqCallback(void);
+static void USART4_Async_TxEmpty_IrqCallback(void);
+static void USART4_Async_TxCplt_IrqCallback(void);
+#endif /* LL_INTERRUPTS_ENABLE */
+
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+/**
+ * @defgroup USART_ASYNC_Local_Variables USART Async Local Variables
+ * @{
+ */
+static stc_usart_async_ctrl_t m_astcUsartAsyncCtrl[USART_ASYNC_UNIT_NUM];
+
+#if (LL_INTERRUPTS_ENABLE == DDL_ON)
+static const en_int_src_t m_aenUsartAsyncIntSrc[USART_ASYNC_UNIT_NUM][USART_ASYNC_IRQ_NUM] = {
+    {INT_SRC_USART1_EI, INT_SRC_USART1_RI, INT_SRC_USART1_TI, INT_SRC_USART1_TCI},
+    {INT_SRC_USART2_EI, INT_SRC_USART2_RI, INT_SRC_USART2_TI, INT_SRC_USART2_TCI},
+    {INT_SRC_USART3_EI, INT_SRC_USART3_RI, INT_SRC_USART3_TI, INT_SRC_USART3_TCI},
+    {INT_SRC_USART4_EI, INT_SRC_USART4_RI, INT_SRC_USART4_TI, INT_SRC_USART4_TCI},
+};
+
+static const func_ptr_t m_apfnUsartAsyncIrqCallback[USART_ASYNC_UNIT_NUM][USART_ASYNC_IRQ_NUM] = {
+    {
+        &USART1_Async_RxError_IrqCallback, &USART1_Async_RxFull_IrqCallback,
+        &USART1_Async_TxEmpty_IrqCallback, &USART1_Async_TxCplt_IrqCallback
+    },
+    {
+        &USART2_Async_RxError_IrqCallback, &USART2_Async_RxFull_IrqCallback,
+        &USART2_Async_TxEmpty_IrqCallback, &USART2_Async_TxCplt_IrqCallback
+    },
+    {
+        &USART3_Async_RxError_IrqCallback, &USART3_Async_RxFull_IrqCallback,
+        &USART3_Async_TxEmpty_IrqCallback, &USART3_Async_TxCplt_IrqCallback
+    },
+    {
+        &USART4_Async_RxError_IrqCallback, &USART4_Async_RxFull_IrqCallback,
+        &USART4_Async_TxEmpty_IrqCallback, &USART4_Async_TxCplt_IrqCallback
+    },
+};
+#endif /* LL_INTERRUPTS_ENABLE */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @defgroup USART_ASYNC_Local_Functions USART Async Local Functions
+ * @{
+ */
+
+/**
+ * @brief  Get the unit index of the USART instance.
+ * @param  [in] USARTx                  Pointer to USART instance register base
+ * @retval Unit index 0 ~ 3
+ */
+static uint32_t USART_Async_GetUnitIndex(const CM_USART_TypeDef *USARTx)
+{
+    uint32_t u32Index;
+
+    if (CM_USART1 == USARTx) {
+        u32Index = 0UL;
+    } else if (CM_USART2 == USARTx) {
+        u32Index = 1UL;
+    } else if (CM_USART3 == USARTx) {
+        u32Index = 2UL;
+    } else {
+        u32Index = 3UL;
+    }
+
+    return u32Index;
+}
+
+/**
+ * @brief  Get the control block of the USART instance.
+ * @param  [in] USARTx                  Pointer to USART instance register base
+ * @retval Pointer to the control block
+ */
+static stc_usart_async_ctrl_t *USART_Async_GetCtrl(const CM_USART_TypeDef *USARTx)
+{
+    return &m_astcUsartAsyncCtrl[USART_Async_GetUnitIndex(USARTx)];
+}
+
+#if (LL_INTERRUPTS_ENABLE == DDL_ON)
+static void USART1_Async_RxError_IrqCallback(void)
+{
+    USART_Async_RxErrorIrqHandler(CM_USART1);
+}
+
+static void USART1_Async_RxFull_IrqCallback(void)
+{
+    USART_Async_RxFullIrqHandler(CM_USART1);
+}
+
+static void USART1_Async_TxEmpty_IrqCallback(void)
+{
+    USART_Async_TxEmptyIrqHandler(CM_USART1);
+}
+
+static void USART1_Async_TxCplt_IrqCallback(void)
+{
+    USART_Async_TxCpltIrqHandler(CM_USART1);
+}
+
+static void USART2_Async_RxError_IrqCallback(void)
+{
+    USART_Async_RxErrorIrqHandler(CM_USART2);
+}
+
+static void USART2_Async_RxFull_IrqCallback(void)
+{
+    USART_Async_RxFullIrqHandler(CM_USART2);
+}
+
+static void USART2_Async_TxEmpty_IrqCallback(void)
+{
+    USART_Async_TxEmptyIrqHandler(CM_USART2);
+}
+
+static void USART2_Async_TxCplt_IrqCallback(void)
+{
+    USART_Async_TxCpltIrqHandler(CM_USART2);
+}
+
+static void USART3_Async_RxError_IrqCallback(void)
+{
+    USART_Async_RxErrorIrqHandler(CM_USART3);
+}
+
+static void USART3_Async_RxFull_IrqCallback(void)
+{
+    USART_Async_RxFullIrqHandler(CM_USART3);
+}
+
+static void USART3_Async_TxEmpty_IrqCallback(void)
+{
+    USART_Async_TxEmptyIrqHandler(CM_USART3);
+}
+
+static void USART3_Async_TxCplt_IrqCallback(void)
+{
+    USART_Async_TxCpltIrqHandler(CM_USART3);
+}
+
+static void USART4_Async_RxError_IrqCallback(void)
+{
+    USART_Async_RxErrorIrqHandler(CM_USART4);
+}
+
+static void USART4_Async_RxFull_IrqCallback(void)
+{
+    USART_Async_RxFullIrqHandler(CM_USART4);
+}
+
+static void USART4_Async_TxEmpty_IrqCallback(void)
+{
+    USART_Async_TxEmptyIrqHandler(CM_USART4);
+}
+
+static void USART4_Async_TxCplt_IrqCallback(void)
+{
+    USART_Async_TxCpltIrqHandler(CM_USART4);
+}
+#endif /* LL_INTERRUPTS_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup USART_ASYNC_Global_Functions USART Async Global Functions
+ * @{
+ */
+
+/**
+ * @brief  Set the fields of structure stc_usart_async_init_t to default values.
+ * @param  [out] pstcAsyncInit          Pointer to a @ref stc_usart_async_init_t structure.
+ * @retval int32_t:
+ *           - LL_OK:                   Initialize successfully.
+ *           - LL_ERR_INVD_PARAM:       pstcAsyncInit is NULL.
+ */
+int32_t USART_Async_StructInit(stc_usart_async_init_t *pstcAsyncInit)
+{
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+
+    if (NULL != pstcAsyncInit) {
+        pstcAsyncInit->pu8TxBuf = NULL;
+        pstcAsyncInit->u32TxBufSize = 0UL;
+        pstcAsyncInit->pu8RxBuf = NULL;
+        pstcAsyncInit->u32RxBufSize = 0UL;
+        pstcAsyncInit->pfnTxCpltCallback = NULL;
+        pstcAsyncInit->pfnRxCallback = NULL;
+        pstcAsyncInit->pfnErrorCallback = NULL;
+        i32Ret = LL_OK;
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  Initialize the asynchronous UART mode of the USART unit.
+ * @param  [in] USARTx                  Pointer to USART instance register base
+ *         This parameter can be one of the following values:
+ *           @arg CM_USARTx:            USART unit instance register base
+ * @param  [in] pstcAsyncInit           Pointer to a @ref stc_usart_async_init_t structure.
+ * @retval int32_t:
+ *           - LL_OK:                   Initialize successfully.
+ *           - LL_ERR_INVD_PARAM:       pstcAsyncInit is NULL or a buffer size is not a power of 2.
+ * @note   Call USART_UART_Init() with 8-bit data width first. This function enables
+ *         the RX/TX function and the RX interrupt; the TX interrupts are managed internally.
+ *         A direction whose buffer pointer is NULL is left unused.
+ */
+int32_t USART_Async_Init(CM_USART_TypeDef *USARTx, const stc_usart_async_init_t *pstcAsyncInit)
+{
+    uint32_t u32Func = 0UL;
+    stc_usart_async_ctrl_t *pstcCtrl;
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+
+    DDL_ASSERT(IS_USART_ASYNC_UNIT(USARTx));
+
+    if (NULL != pstcAsyncInit) {
+        if (((NULL == pstcAsyncInit->pu8TxBuf) || IS_USART_ASYNC_BUF_SIZE(pstcAsyncInit->u32TxBufSize)) &&
+            ((NULL == pstcAsyncInit->pu8RxBuf) || IS_USART_ASYNC_BUF_SIZE(pstcAsyncInit->u32RxBufSize))) {
+            USART_FuncCmd(USARTx, USART_FUNC_ALL, DISABLE);
+
+            pstcCtrl = USART_Async_GetCtrl(USARTx);
+            pstcCtrl->stcTx.pu8Buf = NULL;
+            pstcCtrl->stcRx.pu8Buf = NULL;
+            if (NULL != pstcAsyncInit->pu8TxBuf) {
+                (void)SPSC_Init(&pstcCtrl->stcTx, pstcAsyncInit->pu8TxBuf, pstcAsyncInit->u32TxBufSize);
+            }
+            if (NULL != pstcAsyncInit->pu8RxBuf) {
+                (void)SPSC_Init(&pstcCtrl->stcRx, pstcAsyncInit->pu8RxBuf, pstcAsyncInit->u32RxBufSize);
+            }
+            pstcCtrl->u32TxBusy = 0UL;
+            pstcCtrl->pfnTxCpltCallback = pstcAsyncInit->pfnTxCpltCallback;
+            pstcCtrl->pfnRxCallback = pstcAsyncInit->pfnRxCallback;
+            pstcCtrl->pfnErrorCallback = pstcAsyncInit->pfnErrorCallback;
+
+            USART_ClearStatus(USARTx, USART_FLAG_FRAME_ERR | USART_FLAG_PARITY_ERR | USART_FLAG_OVERRUN);
+            if (NULL != pstcCtrl->stcTx.pu8Buf) {
+                u32Func |= USART_TX;
+            }
+            if (NULL != pstcCtrl->stcRx.pu8Buf) {
+                u32Func |= (USART_RX | USART_INT_RX);
+            }
+            if (0UL != u32Func) {
+                USART_FuncCmd(USARTx, u32Func, ENABLE);
+            }
+            i32Ret = LL_OK;
+        }
+    }
+
+    return i32Ret;
+}
+
+/**
+ * @brief  De-initialize the asynchronous UART mode of the USART unit.
+ * @param  [in] USARTx                  Pointer to USART instance register base
+ *         This parameter can be one of the following values:
+ *           @arg CM_USARTx:            USART unit instance register base
+ * @retval None
+ * @note   Pending TX data is discarded.
+ */
+void USART_Async_DeInit(CM_USART_TypeDef *USARTx)
+{
+    stc_usart_async_ctrl_t *pstcCtrl;
+
+    DDL_ASSERT(IS_USART_ASYNC_UNIT(USARTx));
+
+    USART_FuncCmd(USARTx, USART_FUNC_ALL, DISABLE);
+
+    pstcCtrl = USART_Async_GetCtrl(USARTx);
+    pstcCtrl->stcTx.pu8Buf = NULL;
+    pstcCtrl->stcRx.pu8Buf = NULL;
+    pstcCtrl->u32TxBusy = 0UL;
+    pstcCtrl->pfnTxCpltCallback = NULL;
+    pstcCtrl->pfnRxCallback = NULL;
+    pstcCtrl->pfnErrorCallback = NULL;
+}
+
+#if (LL_INTERRUPTS_ENABLE == DDL_ON)
+/**
+ * @brief  Register the EI/RI/TI/TCI interrupt sources of the USART unit and enable the NVIC IRQs.
+ * @param  [in] USARTx                  Pointer to USART instance register base
+ *         This parameter can be one of the following values:
+ *           @arg CM_USARTx:            USART unit instance register base
+ * @param  [in] pstcIrq                 Pointer to a @ref stc_usart_async_irq_t structure.
+ * @retval int32_t:
+ *           - LL_OK:                   Register successfully.
+ *           - LL_ERR_INVD_PARAM:       pstcIrq is NULL or an IRQ number doesn't match the interrupt source.
+ * @note   INTC registers must be unlocked, @ref LL_PERIPH_WE for details.
+ * @note   To use the share IRQ handlers IRQ024~IRQ031 instead, enable the sources with
+ *         INTC_ShareIrqCmd() and call USART_Async_xxxIrqHandler() from the
+ *         USARTx_RxError/RxFull/TxEmpty/TxComplete_IrqHandler() hooks.
+ */
+int32_t USART_Async_IrqSignIn(CM_USART_TypeDef *USARTx, const stc_usart_async_irq_t *pstcIrq)
+{
+    uint32_t i;
+    uint32_t u32Index;
+    IRQn_Type aenIRQn[USART_ASYNC_IRQ_NUM];
+    stc_irq_signin_config_t stcIrqSignConfig;
+    int32_t i32Ret = LL_ERR_INVD_PARAM;
+
+    DDL_ASSERT(IS_USART_ASYNC_UNIT(USARTx));
+
+    if (NULL != pstcIrq) {
+        u32Index = USART_Async_GetUnitIndex(USARTx);
+        aenIRQn[0] = pstcIrq->enRxErrIRQn;
+        aenIRQn[1] = pstcIrq->enRxFullIRQn;
+        aenIRQn[2] = pstcIrq->enTxEmptyIRQn;
+        aenIRQn[3] = pstcIrq->enTxCpltIRQn;
+
+        for (i = 0UL; i < USART_ASYNC_IRQ_NUM; i++) {
+            stcIrqSignConfig.enIntSrc = m_aenUsartAsyncIntSrc[u32Index][i];
+            stcIrqSignConfig.enIRQn = aenIRQn[i];
+            stcIrqSignConfig.pfnCallback = m_apfnUsartAsyncIrqCallback[u32Index][i];
+            i32Ret = INTC_IrqSignIn(&stcIrqSignConfig);
+            if (LL_OK != i32Ret) {
+                break;
+            }
+            NVIC_ClearPendingIRQ(aenIRQn[i]);
+            NVIC_SetPriority(aenIRQn[i], pstcIrq->u32IrqPrio);
+            NVIC_EnableIRQ(aenIRQn[i]);
+        }
+    }
+
+    return i32Ret;
+}
+#endif /* LL_INTERRUPTS_ENABLE */
+
+/**
+ * @brief  Queue data for transmission without blocking.
+ * @param  [in] USARTx                  Pointer to USART instance register base
+ *         This parameter can be one of the following values:
+ *           @arg CM_USARTx:            USART unit instance register base
+ * @param  [in] au8Buf                  Pointer to the data to be sent.
+ * @param  [in] u32Len                  Data length.
+ * @retval Number of bytes queued, less than u32Len if the TX ring buffer is full.
+ * @note   Must be called from one context only (thread code or one ISR priority).
+ */
+uint32_t USART_Async_Write(CM_USART_TypeDef *USARTx, const uint8_t au8Buf[], uint32_t u32Len)
+{
+    uint32_t u32Count = 0UL;
+    stc_usart_async_ctrl_t *pstcCtrl;
+
+    DDL_ASSERT(IS_USART_ASYNC_UNIT(USARTx));
+
+    pstcCtrl = USART_Async_GetCtrl(USARTx);
+    if (NULL != pstcCtrl->stcTx.pu8Buf) {
+        u32Count = SPSC_Push(&pstcCtrl->stcTx, au8Buf, u32Len);
+        if (u32Count > 0UL) {
+            pstcCtrl->u32TxBusy = 1UL;
+            /* TXE is set while the transmitter is idle, so this raises the TI request at once */
+            WRITE_REG32(USART_ASYNC_CR1_BIT(USARTx, USART_CR1_TXEIE_POS), 1UL);
+        }
+    }
+
+    return u32Count;
+}
+
+/**
+ * @brief  Fetch received data without blocking.
+ * @param  [in] USARTx                  Pointer to USART instance register base
+ *         This parameter can be one of the following values:
+ *           @arg CM_USARTx:            USART unit instance register base
+ * @param  [out] au8Buf                 Pointer to the buffer which stores the received data.
+ * @param  [in] u32Len                  Maximum number of bytes to read.
+ * @retval Number of bytes read, 0 if the RX ring buffer is empty.
+ * @note   Must be called from one context only (thread code or one ISR priority).
+ */
+uint32_t USART_Async_Read(CM_USART_TypeDef *USARTx, uint8_t au8Buf[], uint32_t u32Len)
+{
+    uint32_t u32Count = 0UL;
+    stc_usart_async_ctrl_t *pstcCtrl;
+
+    DDL_ASSERT(IS_USART_ASYNC_UNIT(USARTx));
+
+    pstcCtrl = USART_Async_GetCtrl(USARTx);
+    if (NULL != pstcCtrl->stcRx.pu8Buf) {
+        u32Count = SPSC_Pop(&pstcCtrl->stcRx, au8Buf, u32Len);
+    }
+
+    return u32Count;
+}
+
+/**
+ * @brief  Get the number of bytes pending in the RX ring buffer.
+ * @param  [in] USARTx                  Pointer to USART instance register base
+ *         This parameter can be one of the following values:
+ *           @arg CM_USARTx:            USART unit instance register base
+ * @retval Number of received bytes not read yet
+ */
+uint32_t USART_Async_GetRxCount(const CM_USART_TypeDef *USARTx)
+{
+    uint32_t u32Count = 0UL;
+    const stc_usart_async_ctrl_t *pstcCtrl;
+
+    DDL_ASSERT(IS_USART_ASYNC_UNIT(USARTx));
+
+    pstcCtrl = USART_Async_GetCtrl(USARTx);
+    if (NULL != pstcCtrl->stcRx.pu8Buf) {
+        u32Count = SPSC_GetCount(&pstcCtrl->stcRx);
+    }
+
+    return u32Count;
+}
+
+/**
+ * @brief  Get the free space of the TX ring buffer.
+ * @param  [in] USARTx                  Pointer to USART instance register base
+ *         This parameter can be one of the following values:
+ *           @arg CM_USARTx:            USART unit instance register base
+ * @retval Number of bytes which can be queued by USART_Async_Write()
+ */
+uint32_t USART_Async_GetTxSpace(const CM_USART_TypeDef *USARTx)
+{
+    uint32_t u32Space = 0UL;
+    const stc_usart_async_ctrl_t *pstcCtrl;
+
+    DDL_ASSERT(IS_USART_ASYNC_UNIT(USARTx));
+
+    pstcCtrl = USART_Async_GetCtrl(USARTx);
+    if (NULL != pstcCtrl->stcTx.pu8Buf) {
+        u32Space = SPSC_GetSpace(&pstcCtrl->stcTx);
+    }
+
+    return u32Space;
+}
+
+/**
+ * @brief  Get the transmission state.
+ * @param  [in] USARTx                  Pointer to USART instance register base
+ *         This parameter can be one of the following values:
+ *           @arg CM_USARTx:            USART unit instance register base
+ * @retval An @ref en_flag_status_t enumeration value:
+ *           - SET:                     Data is queued or still being shifted out.
+ *           - RESET:                   Transmission complete.
+ */
+en_flag_status_t USART_Async_GetTxBusy(const CM_USART_TypeDef *USARTx)
+{
+    DDL_ASSERT(IS_USART_ASYNC_UNIT(USARTx));
+
+    return (0UL == USART_Async_GetCtrl(USARTx)->u32TxBusy) ? RESET : SET;
+}
+
+/**
+ * @brief  Discard the data pending in the RX ring buffer.
+ * @param  [in] USARTx                  Pointer to USART instance register base
+ *         This parameter can be one of the following values:
+ *           @arg CM_USARTx:            USART unit instance register base
+ * @retval None
+ */
+void USART_Async_FlushRx(CM_USART_TypeDef *USARTx)
+{
+    stc_usart_async_ctrl_t *pstcCtrl;
+
+    DDL_ASSERT(IS_USART_ASYNC_UNIT(USARTx));
+
+    pstcCtrl = USART_Async_GetCtrl(USARTx);
+    if (NULL != pstcCtrl->stcRx.pu8Buf) {
+        SPSC_Flush(&pstcCtrl->stcRx);
+    }
+}
+
+/**
+ * @brief  USART receive error(INT_SRC_USARTx_EI) IRQ handler.
+ * @param  [in] USARTx                  Pointer to USART instance register base
+ *         This parameter can be one of the following values:
+ *           @arg CM_USARTx:            USART unit instance register base
+ * @retval None
+ */
+void USART_Async_RxErrorIrqHandler(CM_USART_TypeDef *USARTx)
+{
+    uint32_t u32Error;
+    const stc_usart_async_ctrl_t *pstcCtrl = USART_Async_GetCtrl(USARTx);
+
+    u32Error = READ_REG32_BIT(USARTx->SR, USART_ASYNC_ERR_MASK);
+    if (0UL != READ_REG32_BIT(u32Error, (USART_SR_PE | USART_SR_FE))) {
+        /* Discard the corrupted frame */
+        (void)USART_ASYNC_RXD(USARTx);
+    }
+
+    if (0UL != READ_REG32_BIT(u32Error, USART_SR_PE)) {
+        WRITE_REG32(USART_ASYNC_CR1_BIT(USARTx, USART_SR_PE_POS + USART_ASYNC_ERR_CLR_OFFSET), 1UL);
+    }
+    if (0UL != READ_REG32_BIT(u32Error, USART_SR_FE)) {
+        WRITE_REG32(USART_ASYNC_CR1_BIT(USARTx, USART_SR_FE_POS + USART_ASYNC_ERR_CLR_OFFSET), 1UL);
+    }
+    if (0UL != READ_REG32_BIT(u32Error, USART_SR_ORE)) {
+        WRITE_REG32(USART_ASYNC_CR1_BIT(USARTx, USART_SR_ORE_POS + USART_ASYNC_ERR_CLR_OFFSET), 1UL);
+    }
+
+    if ((0UL != u32Error) && (NULL != pstcCtrl->pfnErrorCallback)) {
+        pstcCtrl->pfnErrorCallback(USARTx, u32Error);
+    }
+}
+
+/**
+ * @brief  USART receive data register full(INT_SRC_USARTx_RI) IRQ handler.
+ * @param  [in] USARTx                  Pointer to USART instance register base
+ *         This parameter can be one of the following values:
+ *           @arg CM_USARTx:            USART unit instance register base
+ * @retval None
+ */
+void USART_Async_RxFullIrqHandler(CM_USART_TypeDef *USARTx)
+{
+    uint8_t u8Data;
+    stc_usart_async_ctrl_t *pstcCtrl = USART_Async_GetCtrl(USARTx);
+
+    u8Data = (uint8_t)USART_ASYNC_RXD(USARTx);
+    if (NULL != pstcCtrl->stcRx.pu8Buf) {
+        if (LL_OK == SPSC_PushByte(&pstcCtrl->stcRx, u8Data)) {
+            if (NULL != pstcCtrl->pfnRxCallback) {
+                pstcCtrl->pfnRxCallback(USARTx, SPSC_GetCount(&pstcCtrl->stcRx));
+            }
+        } else if (NULL != pstcCtrl->pfnErrorCallback) {
+            pstcCtrl->pfnErrorCallback(USARTx, USART_ASYNC_ERR_RX_BUF_FULL);
+        } else {
+            /* Frame dropped */
+        }
+    }
+}
+
+/**
+ * @brief  USART transmit data register empty(INT_SRC_USARTx_TI) IRQ handler.
+ * @param  [in] USARTx                  Pointer to USART instance register base
+ *         This parameter can be one of the following values:
+ *           @arg CM_USARTx:            USART unit instance register base
+ * @retval None
+ */
+void USART_Async_TxEmptyIrqHandler(CM_USART_TypeDef *USARTx)
+{
+    uint8_t u8Data;
+    stc_usart_async_ctrl_t *pstcCtrl = USART_Async_GetCtrl(USARTx);
+
+    if (LL_OK == SPSC_PopByte(&pstcCtrl->stcTx, &u8Data)) {
+        USART_ASYNC_TXD(USARTx) = u8Data;
+    } else {
+        /* Ring buffer drained: wait for the last frame to leave the shift register */
+        WRITE_REG32(USART_ASYNC_CR1_BIT(USARTx, USART_CR1_TXEIE_POS), 0UL);
+        WRITE_REG32(USART_ASYNC_CR1_BIT(USARTx, USART_CR1_TCIE_POS), 1UL);
+    }
+}
+
+/**
+ * @brief  USART transmission complete(INT_SRC_USARTx_TCI) IRQ handler.
+ * @param  [in] USARTx                  Pointer to USART instance register base
+ *         This parameter can be one of the following values:
+ *           @arg CM_USARTx:            USART unit instance register base
+ * @retval None
+ */
+void USART_Async_TxCpltIrqHandler(CM_USART_TypeDef *USARTx)
+{
+    stc_usart_async_ctrl_t *pstcCtrl = USART_Async_GetCtrl(USARTx);
+
+    WRITE_REG32(USART_ASYNC_CR1_BIT(USARTx, USART_CR1_TCIE_POS), 0UL);
+    /* New data may have been queued after the TI handler drained the ring buffer */
+    if (0UL == SPSC_GetCount(&pstcCtrl->stcTx)) {
+        pstcCtrl->u32TxBusy = 0UL;
+        if (NULL != pstcCtrl->pfnTxCpltCallback) {
+            pstcCtrl->pfnTxCpltCallback(USARTx);
+        }
+    }
+}
+
+/**
+ * @}
+ */
+
+#endif /* LL_USART_ASYNC_ENABLE */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
@@ -7,6 +7,8 @@
    Date             Author          Notes
    2022-03-31       CDT             First version
    2022-06-30       CDT             Support re-target printf for IAR EW version 9 or later
+   2026-10-16       CDT             Add SysTick_GetMicros & SysTick_SleepUntil, count delays on SysTick when running
+   2026-10-17       CDT             SysTick_SleepUntil returns at once with interrupts disabled
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2022-2023, Xiaohua Semiconductor Co., Ltd. All rights reserved.
@@ -44,6 +46,14 @@
 /*******************************************************************************
  * Local pre-processor symbols/macros ('#define')
  ******************************************************************************/
+/**
+ * @defgroup UTILITY_Local_Macros UTILITY Local Macros
+ * @{
+ */
+#define UTILITY_US_PER_MS               (1000UL)
+/**
+ * @}
+ */
 
 /*******************************************************************************
  * Global variable definitions (declared in header file with 'extern')
@@ -63,6 +73,8 @@
 
 static uint32_t m_u32TickStep = 0UL;
 static __IO uint32_t m_u32TickCount = 0UL;
+/* HCLK cycles per microsecond, set by SysTick_Init(): HCLK_VALUE is not read at run time */
+static uint32_t m_u32TickCyclePerUs = 0UL;
 
 #if (LL_PRINT_ENABLE == DDL_ON)
 static void *m_pvPrintDevice = NULL;
@@ -81,6 +93,43 @@ static uint32_t m_u32PrintTimeout = 0UL;
  * @defgroup UTILITY_Local_Functions UTILITY Local Functions
  * @{
  */
+
+/**
+ * @brief  Check whether the delays can count SysTick cycles.
+ * @param  None
+ * @retval An @ref en_flag_status_t enumeration type value.
+ */
+static en_flag_status_t SysTick_IsCounting(void)
+{
+    return ((0UL != m_u32TickCyclePerUs) && (0UL != (SysTick->CTRL & SysTick_CTRL_ENABLE_Msk))) ? SET : RESET;
+}
+
+/**
+ * @brief  Wait for a number of HCLK cycles counted on SysTick->VAL.
+ * @param  [in] u32Cycle                HCLK cycles, the error is one loop pass.
+ * @retval None
+ * @note   Independent of the compiler optimization, flash wait states and interrupts,
+ *         as long as one loop pass is shorter than the SysTick period.
+ */
+static void SysTick_WaitCycle(uint32_t u32Cycle)
+{
+    const uint32_t u32Period = SysTick->LOAD + 1UL;
+    uint32_t u32Prev = SysTick->VAL;
+    uint32_t u32Now;
+    uint32_t u32Elapsed = 0UL;
+
+    while (u32Elapsed < u32Cycle) {
+        u32Now = SysTick->VAL;
+        /* Down counter, reloaded with LOAD after 0 */
+        if (u32Now <= u32Prev) {
+            u32Elapsed += u32Prev - u32Now;
+        } else {
+            u32Elapsed += u32Prev + u32Period - u32Now;
+        }
+        u32Prev = u32Now;
+    }
+}
+
 #if (LL_PRINT_ENABLE == DDL_ON)
 
 /**
@@ -137,15 +186,24 @@ __STATIC_INLINE uint32_t LL_GetPrintTimeout(void)
  * @brief Delay function, delay ms approximately
  * @param [in] u32Count                   ms
  * @retval None
+ * @note  Exact while SysTick runs as set by SysTick_Init(), see DDL_DelayUS().
  */
 void DDL_DelayMS(uint32_t u32Count)
 {
     __IO uint32_t i;
-    const uint32_t u32Cyc = (HCLK_VALUE + 10000UL - 1UL) / 10000UL;
+    uint32_t u32Cyc;
 
-    while (u32Count-- > 0UL) {
-        i = u32Cyc;
-        while (i-- > 0UL) {
+    if (SET == SysTick_IsCounting()) {
+        u32Cyc = m_u32TickCyclePerUs * UTILITY_US_PER_MS;
+        while (u32Count-- > 0UL) {
+            SysTick_WaitCycle(u32Cyc);
+        }
+    } else {
+        u32Cyc = (HCLK_VALUE + 10000UL - 1UL) / 10000UL;
+        while (u32Count-- > 0UL) {
+            i = u32Cyc;
+            while (i-- > 0UL) {
+            }
         }
     }
 }
@@ -154,15 +212,29 @@ void DDL_DelayMS(uint32_t u32Count)
  * @brief Delay function, delay us approximately
  * @param [in] u32Count                   us
  * @retval None
+ * @note  While SysTick runs as set by SysTick_Init(), the delay counts SysTick cycles
+ *        and is exact (HCLK a whole number of MHz), otherwise it is a loop calibrated
+ *        with HCLK_VALUE that depends on the compiler and the flash wait states.
+ *        After an HCLK change, call SysTick_Init() again.
  */
 void DDL_DelayUS(uint32_t u32Count)
 {
     __IO uint32_t i;
-    const uint32_t u32Cyc = (HCLK_VALUE + 10000000UL - 1UL) / 10000000UL;
+    uint32_t u32Cyc;
 
-    while (u32Count-- > 0UL) {
-        i = u32Cyc;
-        while (i-- > 0UL) {
+    if (SET == SysTick_IsCounting()) {
+        /* Per millisecond, so the cycle count never overflows */
+        while (u32Count > UTILITY_US_PER_MS) {
+            SysTick_WaitCycle(m_u32TickCyclePerUs * UTILITY_US_PER_MS);
+            u32Count -= UTILITY_US_PER_MS;
+        }
+        SysTick_WaitCycle(m_u32TickCyclePerUs * u32Count);
+    } else {
+        u32Cyc = (HCLK_VALUE + 10000000UL - 1UL) / 10000000UL;
+        while (u32Count-- > 0UL) {
+            i = u32Cyc;
+            while (i-- > 0UL) {
+            }
         }
     }
 }
@@ -180,6 +252,7 @@ __WEAKDEF int32_t SysTick_Init(uint32_t u32Freq)
 
     if ((0UL != u32Freq) && (u32Freq <= 1000UL)) {
         m_u32TickStep = 1000UL / u32Freq;
+        m_u32TickCyclePerUs = HCLK_VALUE / 1000000UL;
         /* Configure the SysTick interrupt */
         if (0UL == SysTick_Config(HCLK_VALUE / u32Freq)) {
             i32Ret = LL_OK;
@@ -232,6 +305,69 @@ __WEAKDEF uint32_t SysTick_GetTick(void)
     return m_u32TickCount;
 }
 
+/**
+ * @brief Provides a timestamp in microsecond.
+ * @param None
+ * @retval Timestamp, the tick value in microsecond plus the SysTick cycles elapsed
+ *         since the last tick. Wraps around after 2^32 us, compare timestamps by difference.
+ * @note  Exact when u32Freq of SysTick_Init() divides 1000 and HCLK is a whole number
+ *        of MHz. Also counts a tick whose interrupt is pending, so it can be called
+ *        with interrupts disabled for up to one tick.
+ */
+__WEAKDEF uint32_t SysTick_GetMicros(void)
+{
+    uint32_t u32Tick;
+    uint32_t u32Val;
+    uint32_t u32Pending;
+    uint32_t u32Micros = 0UL;
+
+    if (0UL != m_u32TickCyclePerUs) {
+        do {
+            u32Tick = m_u32TickCount;
+            u32Val = SysTick->VAL;
+            u32Pending = SCB->ICSR & SCB_ICSR_PENDSTSET_Msk;
+            if (0UL != u32Pending) {
+                /* The counter reloaded: read VAL again, after the reload */
+                u32Val = SysTick->VAL;
+            }
+        } while (u32Tick != m_u32TickCount);
+
+        if (0UL != u32Pending) {
+            u32Tick += m_u32TickStep;
+        }
+        u32Micros = (u32Tick * UTILITY_US_PER_MS) + ((SysTick->LOAD - u32Val) / m_u32TickCyclePerUs);
+    }
+
+    return u32Micros;
+}
+
+/**
+ * @brief Sleep until a timestamp of SysTick_GetMicros().
+ * @param [in] u32Deadline              The timestamp to wake up at, at most 2^31 us ahead.
+ * @retval None
+ * @note  Executes WFI while at least one tick is left, woken by every SysTick or other
+ *        interrupt, then waits the rest out on the SysTick counter. Returns at once if
+ *        the deadline passed, the SysTick interrupt is disabled (SysTick_Suspend()) or
+ *        PRIMASK is set, as no tick would be counted while it sleeps.
+ */
+__WEAKDEF void SysTick_SleepUntil(uint32_t u32Deadline)
+{
+    int32_t i32Remain;
+    const uint32_t u32TickUs = m_u32TickStep * UTILITY_US_PER_MS;
+
+    if ((SET == SysTick_IsCounting()) && (0UL != (SysTick->CTRL & SysTick_CTRL_TICKINT_Msk)) &&
+        (0UL == __get_PRIMASK())) {
+        i32Remain = (int32_t)(u32Deadline - SysTick_GetMicros());
+        while (i32Remain > (int32_t)u32TickUs) {
+            __WFI();
+            i32Remain = (int32_t)(u32Deadline - SysTick_GetMicros());
+        }
+        if (i32Remain > 0) {
+            DDL_DelayUS((uint32_t)i32Remain);
+        }
+    }
+}
+
 /**
  * @brief Suspend SysTick increment.
  * @param None
@@ -7,6 +7,9 @@
    Change Logs:
    Date             Author          Notes
    2022-03-31       CDT             First version
+   2026-10-16       CDT             Dispatch IRQ024~031 sources through constant tables
+                                    Fix I2C Tx buffer empty checked with ISELBR28 in IRQ030_Handler
+   2026-10-17       CDT             Add INTC_STAT instrumentation to IRQ024~031 handlers
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2022-2023, Xiaohua Semiconductor Co., Ltd. All rights reserved.
@@ -23,6 +26,7 @@
  * Include files
  ******************************************************************************/
 #include "hc32f120_ll_interrupts_share.h"
+#include "hc32_ll_intc_stat.h"
 #include "hc32_ll_utility.h"
 
 /**
@@ -41,6 +45,27 @@
 /*******************************************************************************
  * Local type definitions ('typedef')
  ******************************************************************************/
+/**
+ * @defgroup Share_Interrupts_Local_Types Share Interrupts Local Types
+ * @{
+ */
+/**
+ * @brief Share interrupt source entry
+ * @note  The source is pending while (*pu32Flag & u32FlagMask) is not zero, or zero if u8FlagInv is 1.
+ */
+typedef struct {
+    __I uint32_t *pu32Ie;       /*!< Bit-band alias of the interrupt enable bit, NULL if always enabled */
+    __I uint32_t *pu32Flag;     /*!< Flag register, or bit-band alias of the flag bit */
+    uint32_t u32FlagMask;       /*!< Flag bits of pu32Flag */
+    func_ptr_t pfnIrqHandler;   /*!< Callback of the source */
+    uint8_t u8Sel;              /*!< Bit position of the source in ISELBRxx */
+    uint8_t u8FlagInv;          /*!< 1: pending while the flag bits are cleared */
+} stc_intc_share_src_t;
+
+/**
+ * @}
+ */
+
 
 /*******************************************************************************
  * Local pre-processor symbols/macros ('#define')
@@ -74,6 +99,31 @@
 /**
  * @}
  */
+
+/**
+ * @defgroup Share_Interrupts_Special_Source Share Interrupts Special Source
+ * @brief ISELBRxx bits of the sources which are not in the dispatch tables.
+ * @{
+ */
+#define INTC_SHARE_SEL_I2C_EE           (1UL << ((uint32_t)INT_SRC_I2C_EEI % 0x10UL))
+#define INTC_SHARE_SEL_EKEY             (1UL << ((uint32_t)INT_SRC_PORT_EKEY % 0x10UL))
+#define INTC_SHARE_SEL_LVD              (1UL << ((uint32_t)INT_SRC_LVD % 0x10UL))
+#define INTC_SHARE_SEL_ADC_CMP1         (1UL << ((uint32_t)INT_SRC_ADC_CMP1 % 0x10UL))
+/**
+ * @}
+ */
+
+/* I2C event and error flags, the interrupt enable bits of CR2 are at the same positions */
+#define INTC_SHARE_I2C_EE_FLAG          (I2C_SR_STARTF   | I2C_SR_SLADDR0F    | I2C_SR_SLADDR1F | \
+                                         I2C_SR_STOPF    | I2C_SR_ARLOF       | I2C_SR_NACKF    | \
+                                         I2C_SR_GENCALLF | I2C_SR_SMBDEFAULTF | I2C_SR_SMBHOSTF | \
+                                         I2C_SR_SMBALRTF)
+
+/* Dispatch table entry of source enIntSrc */
+#define INTC_SHARE_SRC(enIntSrc, pu32Ie, pu32Flag, u32FlagMask, pfnIrqHandler)              \
+    {(pu32Ie), (pu32Flag), (u32FlagMask), (pfnIrqHandler), (uint8_t)((uint32_t)(enIntSrc) % 0x10UL), 0U}
+#define INTC_SHARE_SRC_INV(enIntSrc, pu32Ie, pu32Flag, u32FlagMask, pfnIrqHandler)          \
+    {(pu32Ie), (pu32Flag), (u32FlagMask), (pfnIrqHandler), (uint8_t)((uint32_t)(enIntSrc) % 0x10UL), 1U}
 /**
  * @}
  */
@@ -85,14 +135,203 @@
 /*******************************************************************************
  * Local function prototypes ('static')
  ******************************************************************************/
+static void INTC_ShareIrqDispatch(uint32_t u32Sel, const stc_intc_share_src_t *pstcSrc, uint32_t u32Num);
 
 /*******************************************************************************
  * Local variable definitions ('static')
  ******************************************************************************/
+/**
+ * @defgroup Share_Interrupts_Local_Variables Share Interrupts Local Variables
+ * @brief Dispatch table of each share IRQ, sorted by the bit position in ISELBRxx.
+ * @{
+ */
+static const stc_intc_share_src_t m_astcIrq024Src[] = {
+    INTC_SHARE_SRC(INT_SRC_PORT_EIRQ8, NULL,
+                   &bCM_INTC->EIRQFR_b.EIRQF8, 1UL, &EXTINT08_IrqHandler),
+    INTC_SHARE_SRC(INT_SRC_EFM_PEERR, &bCM_EFM->FITE_b.PEERRITE,
+                   &CM_EFM->FSR, (EFM_FSR_PEWERR | EFM_FSR_PEPRTERR | EFM_FSR_PGMISMTCH), &EFM_ProgramEraseError_IrqHandler),
+    INTC_SHARE_SRC(INT_SRC_EFM_RDCOL, &bCM_EFM->FITE_b.COLERRITE,
+                   &bCM_EFM->FSR_b.COLERR, 1UL, &EFM_ColError_IrqHandler),
+    INTC_SHARE_SRC(INT_SRC_XTAL_STOP, &bCM_CMU->XTALSTDCR_b.XTALSTDIE,
+                   &bCM_CMU->XTALSTDSR_b.XTALSTDF, 1UL, &CLK_XtalStop_IrqHandler),
+    INTC_SHARE_SRC(INT_SRC_SWDT_NMIUNDF, NULL,
+                   &CM_SWDT->SR, (SWDT_SR_UDF | SWDT_SR_REF), &SWDT_IrqHandler),
+    INTC_SHARE_SRC(INT_SRC_TMRB_7_OVF, &bCM_TMRB_7->BCSTR_b.ITENOVF,
+                   &bCM_TMRB_7->BCSTR_b.OVFF, 1UL, &TMRB_7_Ovf_IrqHandler),
+    INTC_SHARE_SRC(INT_SRC_TMRB_7_UDF, &bCM_TMRB_7->BCSTR_b.ITENUDF,
+                   &bCM_TMRB_7->BCSTR_b.UDFF, 1UL, &TMRB_7_Udf_IrqHandler),
+    INTC_SHARE_SRC(INT_SRC_TMRB_8_CMP, &bCM_TMRB_8->ICONR_b.ITEN1,
+                   &bCM_TMRB_8->STFLR_b.CMPF1, 1UL, &TMRB_8_Cmp_IrqHandler),
+    INTC_SHARE_SRC(INT_SRC_USART1_EI, &bCM_USART1->CR1_b.RIE,
+                   &CM_USART1->SR, (USART_SR_PE | USART_SR_FE | USART_SR_ORE), &USART1_RxError_IrqHandler),
+    INTC_SHARE_SRC(INT_SRC_SPI_SPEI, &bCM_SPI->CR1_b.EIE,
+                   &CM_SPI->SR, (SPI_SR_UDRERF | SPI_SR_PERF | SPI_SR_MODFERF | SPI_SR_OVRERF), &SPI_Error_IrqHandler),
+    INTC_SHARE_SRC(INT_SRC_USART4_EI, &bCM_USART4->CR1_b.RIE,
+                   &CM_USART4->SR, (USART_SR_PE | USART_SR_FE | USART_SR_ORE), &USART4_RxError_IrqHandler),
+};
+
+static const stc_intc_share_src_t m_astcIrq025Src[] = {
+    INTC_SHARE_SRC(INT_SRC_PORT_EIRQ9, NULL,
+                   &bCM_INTC->EIRQFR_b.EIRQF9, 1UL, &EXTINT09_IrqHandler),
+    INTC_SHARE_SRC(INT_SRC_CTC_ERR, &bCM_CTC->CR1_b.ERRIE,
+                   &CM_CTC->STR, (CTC_STR_TRMOVF | CTC_STR_TRMUDF), &CTC_IrqHandler),
+    INTC_SHARE_SRC(INT_SRC_TMRB_8_OVF, &bCM_TMRB_8->BCSTR_b.ITENOVF,
+                   &bCM_TMRB_8->BCSTR_b.OVFF, 1UL, &TMRB_8_Ovf_IrqHandler),
+    INTC_SHARE_SRC(INT_SRC_TMRB_8_UDF, &bCM_TMRB_8->BCSTR_b.ITENUDF,
+                   &bCM_TMRB_8->BCSTR_b.UDFF, 1UL, &TMRB_8_Udf_IrqHandler),
+    INTC_SHARE_SRC(INT_SRC_TMRB_7_CMP, &bCM_TMRB_7->ICONR_b.ITEN1,
+                   &bCM_TMRB_7->STFLR_b.CMPF1, 1UL, &TMRB_7_Cmp_IrqHandler),
+    INTC_SHARE_SRC(INT_SRC_USART1_RI, &bCM_USART1->CR1_b.RIE,
+                   &bCM_USART1->SR_b.RXNE, 1UL, &USART1_RxFull_IrqHandler),
+    INTC_SHARE_SRC(INT_SRC_USART4_RI, &bCM_USART4->CR1_b.RIE,
+                   &bCM_USART4->SR_b.RXNE, 1UL, &USART4_RxFull_IrqHandler),
+};
+
+static const stc_intc_share_src_t m_astcIrq026Src[] = {
+    INTC_SHARE_SRC(INT_SRC_TMRB_5_OVF, &bCM_TMRB_5->BCSTR_b.ITENOVF,
+                   &bCM_TMRB_5->BCSTR_b.OVFF, 1UL, &TMRB_5_Ovf_IrqHandler),
+    INTC_SHARE_SRC(INT_SRC_TMRB_5_UDF, &bCM_TMRB_5->BCSTR_b.ITENUDF,
+                   &bCM_TMRB_5->BCSTR_b.UDFF, 1UL, &TMRB_5_Udf_IrqHandler),
+    INTC_SHARE_SRC(INT_SRC_TMRB_6_CMP, &bCM_TMRB_6->ICONR_b.ITEN1,
+                   &bCM_TMRB_6->STFLR_b.CMPF1, 1UL, &TMRB_6_Cmp_IrqHandler),
+    INTC_SHARE_SRC(INT_SRC_USART1_TI, &bCM_USART1->CR1_b.TXEIE,
+                   &bCM_USART1->SR_b.TXE, 1UL, &USART1_TxEmpty_IrqHandler),
+    INTC_SHARE_SRC(INT_SRC_USART3_EI, &bCM_USART3->CR1_b.RIE,
+                   &CM_USART3->SR, (USART_SR_PE | USART_SR_FE | USART_SR_ORE), &USART3_RxError_IrqHandler),
+};
+
+static const stc_intc_share_src_t m_astcIrq027Src[] = {
+    INTC_SHARE_SRC(INT_SRC_TMR0_CMP_A, &bCM_TMR0->BCONR_b.INTENA,
+                   &bCM_TMR0->STFLR_b.CMFA, 1UL, &TMR0_CmpA_IrqHandler),
+    INTC_SHARE_SRC(INT_SRC_TMRB_6_OVF, &bCM_TMRB_6->BCSTR_b.ITENOVF,
+                   &bCM_TMRB_6->BCSTR_b.OVFF, 1UL, &TMRB_6_Ovf_IrqHandler),
+    INTC_SHARE_SRC(INT_SRC_TMRB_6_UDF, &bCM_TMRB_6->BCSTR_b.ITENUDF,
+                   &bCM_TMRB_6->BCSTR_b.UDFF, 1UL, &TMRB_6_Udf_IrqHandler),
+    INTC_SHARE_SRC(INT_SRC_TMRB_5_CMP, &bCM_TMRB_5->ICONR_b.ITEN1,
+                   &bCM_TMRB_5->STFLR_b.CMPF1, 1UL, &TMRB_5_Cmp_IrqHandler),
+    INTC_SHARE_SRC(INT_SRC_USART1_TCI, &bCM_USART1->CR1_b.TCIE,
+                   &bCM_USART1->SR_b.TC, 1UL, &USART1_TxComplete_IrqHandler),
+    INTC_SHARE_SRC(INT_SRC_USART3_RI, &bCM_USART3->CR1_b.RIE,
+                   &bCM_USART3->SR_b.RXNE, 1UL, &USART3_RxFull_IrqHandler),
+    INTC_SHARE_SRC(INT_SRC_SPI_SPRI, &bCM_SPI->CR1_b.RXIE,
+                   &bCM_SPI->SR_b.RDFF, 1UL, &SPI_RxFull_IrqHandler),
+};
+
+static const stc_intc_share_src_t m_astcIrq028Src[] = {
+    INTC_SHARE_SRC(INT_SRC_TMRB_3_OVF, &bCM_TMRB_3->BCSTR_b.ITENOVF,
+                   &bCM_TMRB_3->BCSTR_b.OVFF, 1UL, &TMRB_3_Ovf_IrqHandler),
+    INTC_SHARE_SRC(INT_SRC_TMRB_3_UDF, &bCM_TMRB_3->BCSTR_b.ITENUDF,
+                   &bCM_TMRB_3->BCSTR_b.UDFF, 1UL, &TMRB_3_Udf_IrqHandler),
+    INTC_SHARE_SRC(INT_SRC_TMRB_4_CMP, &bCM_TMRB_4->ICONR_b.ITEN1,
+                   &bCM_TMRB_4->STFLR_b.CMPF1, 1UL, &TMRB_4_Cmp_IrqHandler),
+    INTC_SHARE_SRC(INT_SRC_ADC_EOCA, &bCM_ADC->ICR_b.EOCAIEN,
+                   &bCM_ADC->ISR_b.EOCAF, 1UL, &ADC_SeqA_IrqHandler),
+    INTC_SHARE_SRC(INT_SRC_USART2_EI, &bCM_USART2->CR1_b.RIE,
+                   &CM_USART2->SR, (USART_SR_PE | USART_SR_FE | USART_SR_ORE), &USART2_RxError_IrqHandler),
+    INTC_SHARE_SRC(INT_SRC_USART3_TI, &bCM_USART3->CR1_b.TXEIE,
+                   &bCM_USART3->SR_b.TXE, 1UL, &USART3_TxEmpty_IrqHandler),
+    INTC_SHARE_SRC(INT_SRC_I2C_TEI, &bCM_I2C->CR2_b.TENDIE,
+                   &bCM_I2C->SR_b.TENDF, 1UL, &I2C_TxComplete_IrqHandler),
+    INTC_SHARE_SRC_INV(INT_SRC_SPI_SPII, &bCM_SPI->CR1_b.IDIE,
+                       &bCM_SPI->SR_b.IDLNF, 1UL, &SPI_Idle_IrqHandler),
+};
+
+static const stc_intc_share_src_t m_astcIrq029Src[] = {
+    INTC_SHARE_SRC(INT_SRC_TMRB_4_OVF, &bCM_TMRB_4->BCSTR_b.ITENOVF,
+                   &bCM_TMRB_4->BCSTR_b.OVFF, 1UL, &TMRB_4_Ovf_IrqHandler),
+    INTC_SHARE_SRC(INT_SRC_TMRB_4_UDF, &bCM_TMRB_4->BCSTR_b.ITENUDF,
+                   &bCM_TMRB_4->BCSTR_b.UDFF, 1UL, &TMRB_4_Udf_IrqHandler),
+    INTC_SHARE_SRC(INT_SRC_TMRB_3_CMP, &bCM_TMRB_3->ICONR_b.ITEN1,
+                   &bCM_TMRB_3->STFLR_b.CMPF1, 1UL, &TMRB_3_Cmp_IrqHandler),
+    INTC_SHARE_SRC(INT_SRC_ADC_EOCB, &bCM_ADC->ICR_b.EOCBIEN,
+                   &bCM_ADC->ISR_b.EOCBF, 1UL, &ADC_SeqB_IrqHandler),
+    INTC_SHARE_SRC(INT_SRC_USART2_RI, &bCM_USART2->CR1_b.RIE,
+                   &bCM_USART2->SR_b.RXNE, 1UL, &USART2_RxFull_IrqHandler),
+    INTC_SHARE_SRC(INT_SRC_USART3_TCI, &bCM_USART3->CR1_b.TCIE,
+                   &bCM_USART3->SR_b.TC, 1UL, &USART3_TxComplete_IrqHandler),
+    INTC_SHARE_SRC(INT_SRC_I2C_RXI, &bCM_I2C->CR2_b.RFULLIE,
+                   &bCM_I2C->SR_b.RFULLF, 1UL, &I2C_RxFull_IrqHandler),
+};
+
+static const stc_intc_share_src_t m_astcIrq030Src[] = {
+    INTC_SHARE_SRC(INT_SRC_TMRB_1_OVF, &bCM_TMRB_1->BCSTR_b.ITENOVF,
+                   &bCM_TMRB_1->BCSTR_b.OVFF, 1UL, &TMRB_1_Ovf_IrqHandler),
+    INTC_SHARE_SRC(INT_SRC_TMRB_1_UDF, &bCM_TMRB_1->BCSTR_b.ITENUDF,
+                   &bCM_TMRB_1->BCSTR_b.UDFF, 1UL, &TMRB_1_Udf_IrqHandler),
+    INTC_SHARE_SRC(INT_SRC_TMRB_2_CMP, &bCM_TMRB_2->ICONR_b.ITEN1,
+                   &bCM_TMRB_2->STFLR_b.CMPF1, 1UL, &TMRB_2_Cmp_IrqHandler),
+    INTC_SHARE_SRC(INT_SRC_ADC_CMP0, &bCM_ADC->AWDCR_b.AWD0IEN,
+                   &bCM_ADC->AWDSR_b.AWD0F, 1UL, &ADC_Cmp0_IrqHandler),
+    INTC_SHARE_SRC(INT_SRC_USART2_TI, &bCM_USART2->CR1_b.TXEIE,
+                   &bCM_USART2->SR_b.TXE, 1UL, &USART2_TxEmpty_IrqHandler),
+    INTC_SHARE_SRC(INT_SRC_I2C_TXI, &bCM_I2C->CR2_b.TEMPTYIE,
+                   &bCM_I2C->SR_b.TEMPTYF, 1UL, &I2C_TxEmpty_IrqHandler),
+    INTC_SHARE_SRC(INT_SRC_USART4_TI, &bCM_USART4->CR1_b.TXEIE,
+                   &bCM_USART4->SR_b.TXE, 1UL, &USART4_TxEmpty_IrqHandler),
+};
+
+static const stc_intc_share_src_t m_astcIrq031Src[] = {
+    INTC_SHARE_SRC(INT_SRC_EFM_OPTEND, &bCM_EFM->FITE_b.OPTENDITE,
+                   &bCM_EFM->FSR_b.OPTEND, 1UL, &EFM_OpEnd_IrqHandler),
+    INTC_SHARE_SRC(INT_SRC_TMRB_2_OVF, &bCM_TMRB_2->BCSTR_b.ITENOVF,
+                   &bCM_TMRB_2->BCSTR_b.OVFF, 1UL, &TMRB_2_Ovf_IrqHandler),
+    INTC_SHARE_SRC(INT_SRC_TMRB_2_UDF, &bCM_TMRB_2->BCSTR_b.ITENUDF,
+                   &bCM_TMRB_2->BCSTR_b.UDFF, 1UL, &TMRB_2_Udf_IrqHandler),
+    INTC_SHARE_SRC(INT_SRC_TMRB_1_CMP, &bCM_TMRB_1->ICONR_b.ITEN1,
+                   &bCM_TMRB_1->STFLR_b.CMPF1, 1UL, &TMRB_1_Cmp_IrqHandler),
+    INTC_SHARE_SRC(INT_SRC_USART2_TCI, &bCM_USART2->CR1_b.TCIE,
+                   &bCM_USART2->SR_b.TC, 1UL, &USART2_TxComplete_IrqHandler),
+    INTC_SHARE_SRC(INT_SRC_SPI_SPTI, &bCM_SPI->CR1_b.TXIE,
+                   &bCM_SPI->SR_b.TDEF, 1UL, &SPI_TxEmpty_IrqHandler),
+    INTC_SHARE_SRC(INT_SRC_USART4_TCI, &bCM_USART4->CR1_b.TCIE,
+                   &bCM_USART4->SR_b.TC, 1UL, &USART4_TxComplete_IrqHandler),
+};
+/**
+ * @}
+ */
 
 /*******************************************************************************
  * Function implementation - global ('extern') and local ('static')
  ******************************************************************************/
+/**
+ * @defgroup Share_Interrupts_Local_Functions Share Interrupts Local Functions
+ * @{
+ */
+/**
+ * @brief  Call the handler of each selected, enabled and pending source.
+ * @param  [in] u32Sel          Value of ISELBRxx, read once by the IRQ handler
+ * @param  [in] pstcSrc         Dispatch table of the IRQ
+ * @param  [in] u32Num          Number of entries in pstcSrc
+ * @retval None
+ * @note   Only the sources selected in u32Sel are read from the peripherals, the
+ *         scan stops after the last one of them.
+ */
+static void INTC_ShareIrqDispatch(uint32_t u32Sel, const stc_intc_share_src_t *pstcSrc, uint32_t u32Num)
+{
+    uint32_t i;
+    uint32_t u32SelBit;
+    uint32_t u32Pending;
+
+    for (i = 0UL; (i < u32Num) && (0UL != u32Sel); i++) {
+        u32SelBit = 1UL << pstcSrc[i].u8Sel;
+        if (0UL != (u32Sel & u32SelBit)) {
+            u32Sel &= ~u32SelBit;
+            if ((NULL == pstcSrc[i].pu32Ie) || (0UL != *pstcSrc[i].pu32Ie)) {
+                u32Pending = *pstcSrc[i].pu32Flag & pstcSrc[i].u32FlagMask;
+                if (0U != pstcSrc[i].u8FlagInv) {
+                    u32Pending ^= pstcSrc[i].u32FlagMask;
+                }
+                if (0UL != u32Pending) {
+                    pstcSrc[i].pfnIrqHandler();
+                }
+            }
+        }
+    }
+}
+/**
+ * @}
+ */
+
 /**
  * @defgroup Share_Interrupts_Global_Functions Share Interrupts Global Functions
  * @{
@@ -135,96 +374,18 @@ int32_t INTC_ShareIrqCmd(en_int_src_t enIntSrc, en_functional_state_t enNewState
  */
 void IRQ024_Handler(void)
 {
-    uint32_t u32Tmp1;
-    uint32_t u32Tmp2;
-    /* External interrupt 08 */
-    u32Tmp1 = bCM_INTC->EIRQFR_b.EIRQF8;
-    if ((1UL == bCM_INTC->ISELBR24_b.ISEL1) && (0UL != u32Tmp1)) {
-        EXTINT08_IrqHandler();
-    }
-    /* EFM program/erase error */
-    if (1UL == bCM_EFM->FITE_b.PEERRITE) {
-        u32Tmp1 = CM_EFM->FSR & (EFM_FSR_PEWERR | EFM_FSR_PEPRTERR | EFM_FSR_PGMISMTCH);
-        if ((1UL == bCM_INTC->ISELBR24_b.ISEL4) && (0UL != u32Tmp1)) {
-            EFM_ProgramEraseError_IrqHandler();
-        }
-    }
-    /* EFM read collision */
-    if (1UL == bCM_EFM->FITE_b.COLERRITE) {
-        u32Tmp1 = bCM_EFM->FSR_b.COLERR;
-        if ((1UL == bCM_INTC->ISELBR24_b.ISEL5) && (0UL != u32Tmp1)) {
-            EFM_ColError_IrqHandler();
-        }
-    }
-    /* XTAL stop */
-    if (1UL == bCM_CMU->XTALSTDCR_b.XTALSTDIE) {
-        u32Tmp1 = bCM_CMU->XTALSTDSR_b.XTALSTDF;
-        if ((1UL == bCM_INTC->ISELBR24_b.ISEL6) && (0UL != u32Tmp1)) {
-            CLK_XtalStop_IrqHandler();
-        }
-    }
-    /* SWDT underflow or fresh error */
-    u32Tmp1 = CM_SWDT->SR & (SWDT_SR_UDF | SWDT_SR_REF);
-    if ((1UL == bCM_INTC->ISELBR24_b.ISEL7) && (0UL != u32Tmp1)) {
-        SWDT_IrqHandler();
-    }
-    /* TimerB7 overflow */
-    if (1UL == bCM_TMRB_7->BCSTR_b.ITENOVF) {
-        u32Tmp1 = bCM_TMRB_7->BCSTR_b.OVFF;
-        if ((1UL == bCM_INTC->ISELBR24_b.ISEL8) && (0UL != u32Tmp1)) {
-            TMRB_7_Ovf_IrqHandler();
-        }
-    }
-    /* TimerB7 underflow */
-    if (1UL == bCM_TMRB_7->BCSTR_b.ITENUDF) {
-        u32Tmp1 = bCM_TMRB_7->BCSTR_b.UDFF;
-        if ((1UL == bCM_INTC->ISELBR24_b.ISEL9) && (0UL != u32Tmp1)) {
-            TMRB_7_Udf_IrqHandler();
-        }
-    }
-    /* TimerB8 compare match */
-    if (1UL == bCM_TMRB_8->ICONR_b.ITEN1) {
-        u32Tmp1 = bCM_TMRB_8->STFLR_b.CMPF1;
-        if ((1UL == bCM_INTC->ISELBR24_b.ISEL10) && (1UL == u32Tmp1)) {
-            TMRB_8_Cmp_IrqHandler();
-        }
-    }
-    /* USART1 Rx ORE/FE/PE error */
-    if (1UL == bCM_USART1->CR1_b.RIE) {
-        u32Tmp1 = CM_USART1->SR & (USART_SR_PE | USART_SR_FE | USART_SR_ORE);
-        if ((1UL == bCM_INTC->ISELBR24_b.ISEL12) && (0UL != u32Tmp1)) {
-            USART1_RxError_IrqHandler();
-        }
-    }
-    /* I2c error and event */
-    u32Tmp1 = CM_I2C->SR & (I2C_SR_STARTF   | I2C_SR_SLADDR0F       |           \
-                            I2C_SR_SLADDR1F | I2C_SR_STOPF          |           \
-                            I2C_SR_ARLOF    | I2C_SR_NACKF          |           \
-                            I2C_SR_GENCALLF | I2C_SR_SMBDEFAULTF    |           \
-                            I2C_SR_SMBHOSTF | I2C_SR_SMBALRTF);
-
-    u32Tmp2 = CM_I2C->CR2 & (I2C_CR2_STARTIE  | I2C_CR2_SLADDR0IE    |           \
-                             I2C_CR2_SLADDR1IE | I2C_CR2_STOPIE       |           \
-                             I2C_CR2_ARLOIE   | I2C_CR2_NACKIE       |           \
-                             I2C_CR2_GENCALLIE | I2C_CR2_SMBDEFAULTIE |           \
-                             I2C_CR2_SMBHOSTIE | I2C_CR2_SMBALRTIE);
-    if ((1UL == bCM_INTC->ISELBR24_b.ISEL13) && (0UL != (u32Tmp1 & u32Tmp2))) {
-        I2C_EE_IrqHandler();
-    }
-    /* SPI parity/overflow/underflow/mode error */
-    if (1UL == bCM_SPI->CR1_b.EIE) {
-        u32Tmp1 = CM_SPI->SR & (SPI_SR_UDRERF | SPI_SR_PERF | SPI_SR_MODFERF | SPI_SR_OVRERF);
-        if ((1UL == bCM_INTC->ISELBR24_b.ISEL14) && (0UL != u32Tmp1)) {
-            SPI_Error_IrqHandler();
-        }
-    }
-    /* USART4 Rx ORE/FE/PE error */
-    if (1UL == bCM_USART4->CR1_b.RIE) {
-        u32Tmp1 = CM_USART4->SR & (USART_SR_PE | USART_SR_FE | USART_SR_ORE);
-        if ((1UL == bCM_INTC->ISELBR24_b.ISEL15) && (0UL != u32Tmp1)) {
-            USART4_RxError_IrqHandler();
+    uint32_t u32Sel;
+
+    INTC_STAT_IRQ_ENTER(INT024_IRQn);
+    u32Sel = CM_INTC->ISELBR24;
+    INTC_ShareIrqDispatch(u32Sel & ~INTC_SHARE_SEL_I2C_EE, m_astcIrq024Src, ARRAY_SZ(m_astcIrq024Src));
+    /* I2c error and event, each flag has its own enable bit */
+    if (0UL != (u32Sel & INTC_SHARE_SEL_I2C_EE)) {
+        if (0UL != (CM_I2C->SR & CM_I2C->CR2 & INTC_SHARE_I2C_EE_FLAG)) {
+            I2C_EE_IrqHandler();
         }
     }
+    INTC_STAT_IRQ_EXIT(INT024_IRQn);
 }
 
 /**
@@ -234,54 +395,9 @@ void IRQ024_Handler(void)
  */
 void IRQ025_Handler(void)
 {
-    uint32_t u32Tmp1;
-    /* External interrupt 09 */
-    u32Tmp1 = bCM_INTC->EIRQFR_b.EIRQF9;
-    if ((1UL == bCM_INTC->ISELBR25_b.ISEL1) && (0UL != u32Tmp1)) {
-        EXTINT09_IrqHandler();
-    }
-    /* Clock trimming error */
-    if (1UL == bCM_CTC->CR1_b.ERRIE) {
-        u32Tmp1 = CM_CTC->STR & (CTC_STR_TRMOVF | CTC_STR_TRMUDF);
-        if ((1UL == bCM_INTC->ISELBR25_b.ISEL4) && (0UL != u32Tmp1)) {
-            CTC_IrqHandler();
-        }
-    }
-    /* TimerB8 overflow */
-    if (1UL == bCM_TMRB_8->BCSTR_b.ITENOVF) {
-        u32Tmp1 = bCM_TMRB_8->BCSTR_b.OVFF;
-        if ((1UL == bCM_INTC->ISELBR25_b.ISEL8) && (0UL != u32Tmp1)) {
-            TMRB_8_Ovf_IrqHandler();
-        }
-    }
-    /* TimerB8 underflow */
-    if (1UL == bCM_TMRB_8->BCSTR_b.ITENUDF) {
-        u32Tmp1 = bCM_TMRB_8->BCSTR_b.UDFF;
-        if ((1UL == bCM_INTC->ISELBR25_b.ISEL9) && (0UL != u32Tmp1)) {
-            TMRB_8_Udf_IrqHandler();
-        }
-    }
-    /* TimerB7 compare match */
-    if (1UL == bCM_TMRB_7->ICONR_b.ITEN1) {
-        u32Tmp1 = bCM_TMRB_7->STFLR_b.CMPF1;
-        if ((1UL == bCM_INTC->ISELBR25_b.ISEL10) && (0UL != u32Tmp1)) {
-            TMRB_7_Cmp_IrqHandler();
-        }
-    }
-    /* USART1 Rx end */
-    if (1UL == bCM_USART1->CR1_b.RIE) {
-        u32Tmp1 = bCM_USART1->SR_b.RXNE;
-        if ((1UL == bCM_INTC->ISELBR25_b.ISEL12) && (0UL != u32Tmp1)) {
-            USART1_RxFull_IrqHandler();
-        }
-    }
-    /* USART4 Rx end */
-    if (1UL == bCM_USART4->CR1_b.RIE) {
-        u32Tmp1 = bCM_USART4->SR_b.RXNE;
-        if ((1UL == bCM_INTC->ISELBR25_b.ISEL15) && (0UL != u32Tmp1)) {
-            USART4_RxFull_IrqHandler();
-        }
-    }
+    INTC_STAT_IRQ_ENTER(INT025_IRQn);
+    INTC_ShareIrqDispatch(CM_INTC->ISELBR25, m_astcIrq025Src, ARRAY_SZ(m_astcIrq025Src));
+    INTC_STAT_IRQ_EXIT(INT025_IRQn);
 }
 
 /**
@@ -291,42 +407,9 @@ void IRQ025_Handler(void)
  */
 void IRQ026_Handler(void)
 {
-    uint32_t u32Tmp1;
-    /* TimerB5 overflow */
-    if (1UL == bCM_TMRB_5->BCSTR_b.ITENOVF) {
-        u32Tmp1 = bCM_TMRB_5->BCSTR_b.OVFF;
-        if ((1UL == bCM_INTC->ISELBR26_b.ISEL8) && (0UL != u32Tmp1)) {
-            TMRB_5_Ovf_IrqHandler();
-        }
-    }
-    /* TimerB5 underflow */
-    if (1UL == bCM_TMRB_5->BCSTR_b.ITENUDF) {
-        u32Tmp1 = bCM_TMRB_5->BCSTR_b.UDFF;
-        if ((1UL == bCM_INTC->ISELBR26_b.ISEL9) && (0UL != u32Tmp1)) {
-            TMRB_5_Udf_IrqHandler();
-        }
-    }
-    /* TimerB6 compare match */
-    if (1UL == bCM_TMRB_6->ICONR_b.ITEN1) {
-        u32Tmp1 = bCM_TMRB_6->STFLR_b.CMPF1;
-        if ((1UL == bCM_INTC->ISELBR26_b.ISEL10) && (0UL != u32Tmp1)) {
-            TMRB_6_Cmp_IrqHandler();
-        }
-    }
-    /* USART1 Tx buffer empty */
-    if (1UL == bCM_USART1->CR1_b.TXEIE) {
-        u32Tmp1 = bCM_USART1->SR_b.TXE;
-        if ((1UL == bCM_INTC->ISELBR26_b.ISEL12) && (0UL != u32Tmp1)) {
-            USART1_TxEmpty_IrqHandler();
-        }
-    }
-    /* USART3 Rx ORE/FE/PE error */
-    if (1UL == bCM_USART3->CR1_b.RIE) {
-        u32Tmp1 = CM_USART3->SR & (USART_SR_PE | USART_SR_FE | USART_SR_ORE);
-        if ((1UL == bCM_INTC->ISELBR26_b.ISEL13) && (0UL != u32Tmp1)) {
-            USART3_RxError_IrqHandler();
-        }
-    }
+    INTC_STAT_IRQ_ENTER(INT026_IRQn);
+    INTC_ShareIrqDispatch(CM_INTC->ISELBR26, m_astcIrq026Src, ARRAY_SZ(m_astcIrq026Src));
+    INTC_STAT_IRQ_EXIT(INT026_IRQn);
 }
 
 /**
@@ -336,61 +419,17 @@ void IRQ026_Handler(void)
  */
 void IRQ027_Handler(void)
 {
-    uint32_t u32Tmp1;
+    uint32_t u32Sel;
+
+    INTC_STAT_IRQ_ENTER(INT027_IRQn);
+    u32Sel = CM_INTC->ISELBR27;
     /* EKEY and other Interrupt source are exclusive */
-    if (1UL == bCM_INTC->ISELBR27_b.ISEL1) {
+    if (0UL != (u32Sel & INTC_SHARE_SEL_EKEY)) {
         EKEY_IrqHandler();
     } else {
-        /* Timer 0 compare match */
-        if (1UL == bCM_TMR0->BCONR_b.INTENA) {
-            u32Tmp1 = bCM_TMR0->STFLR_b.CMFA;
-            if ((1UL == bCM_INTC->ISELBR27_b.ISEL2) && (0UL != u32Tmp1)) {
-                TMR0_CmpA_IrqHandler();
-            }
-        }
-        /* TimerB6 overflow */
-        if (1UL == bCM_TMRB_6->BCSTR_b.ITENOVF) {
-            u32Tmp1 = bCM_TMRB_6->BCSTR_b.OVFF;
-            if ((1UL == bCM_INTC->ISELBR27_b.ISEL8) && (0UL != u32Tmp1)) {
-                TMRB_6_Ovf_IrqHandler();
-            }
-        }
-        /* TimerB6 underflow */
-        if (1UL == bCM_TMRB_6->BCSTR_b.ITENUDF) {
-            u32Tmp1 = bCM_TMRB_6->BCSTR_b.UDFF;
-            if ((1UL == bCM_INTC->ISELBR27_b.ISEL9) && (0UL != u32Tmp1)) {
-                TMRB_6_Udf_IrqHandler();
-            }
-        }
-        /* TimerB5 compare match */
-        if (1UL == bCM_TMRB_5->ICONR_b.ITEN1) {
-            u32Tmp1 = bCM_TMRB_5->STFLR_b.CMPF1;
-            if ((1UL == bCM_INTC->ISELBR27_b.ISEL10) && (0UL != u32Tmp1)) {
-                TMRB_5_Cmp_IrqHandler();
-            }
-        }
-        /* USART1 Tx end */
-        if (1UL == bCM_USART1->CR1_b.TCIE) {
-            u32Tmp1 = bCM_USART1->SR_b.TC;
-            if ((1UL == bCM_INTC->ISELBR27_b.ISEL12) && (0UL != u32Tmp1)) {
-                USART1_TxComplete_IrqHandler();
-            }
-        }
-        /* USART3 Rx end */
-        if (1UL == bCM_USART3->CR1_b.RIE) {
-            u32Tmp1 = bCM_USART3->SR_b.RXNE;
-            if ((1UL == bCM_INTC->ISELBR27_b.ISEL13) && (0UL != u32Tmp1)) {
-                USART3_RxFull_IrqHandler();
-            }
-        }
-        /* SPI Rx end */
-        if (1UL == bCM_SPI->CR1_b.RXIE) {
-            u32Tmp1 = bCM_SPI->SR_b.RDFF;
-            if ((1UL == bCM_INTC->ISELBR27_b.ISEL14) && (0UL != u32Tmp1)) {
-                SPI_RxFull_IrqHandler();
-            }
-        }
+        INTC_ShareIrqDispatch(u32Sel, m_astcIrq027Src, ARRAY_SZ(m_astcIrq027Src));
     }
+    INTC_STAT_IRQ_EXIT(INT027_IRQn);
 }
 
 /**
@@ -400,63 +439,9 @@ void IRQ027_Handler(void)
  */
 void IRQ028_Handler(void)
 {
-    uint32_t u32Tmp1;
-    /* TimerB3 overflow */
-    if (1UL == bCM_TMRB_3->BCSTR_b.ITENOVF) {
-        u32Tmp1 = bCM_TMRB_3->BCSTR_b.OVFF;
-        if ((1UL == bCM_INTC->ISELBR28_b.ISEL8) && (0UL != u32Tmp1)) {
-            TMRB_3_Ovf_IrqHandler();
-        }
-    }
-    /* TimerB3 underflow */
-    if (1UL == bCM_TMRB_3->BCSTR_b.ITENUDF) {
-        u32Tmp1 = bCM_TMRB_3->BCSTR_b.UDFF;
-        if ((1UL == bCM_INTC->ISELBR28_b.ISEL9) && (0UL != u32Tmp1)) {
-            TMRB_3_Udf_IrqHandler();
-        }
-    }
-    /* TimerB4 compare match */
-    if (1UL == bCM_TMRB_4->ICONR_b.ITEN1) {
-        u32Tmp1 = bCM_TMRB_4->STFLR_b.CMPF1;
-        if ((1UL == bCM_INTC->ISELBR28_b.ISEL10) && (0UL != u32Tmp1)) {
-            TMRB_4_Cmp_IrqHandler();
-        }
-    }
-    /* ADC seq.A convert complete */
-    if (1UL == bCM_ADC->ICR_b.EOCAIEN) {
-        u32Tmp1 = bCM_ADC->ISR_b.EOCAF;
-        if ((1UL == bCM_INTC->ISELBR28_b.ISEL11) && (0UL != u32Tmp1)) {
-            ADC_SeqA_IrqHandler();
-        }
-    }
-    /* USART2 Rx ORE/FE/PE error */
-    if (1UL == bCM_USART2->CR1_b.RIE) {
-        u32Tmp1 = CM_USART2->SR & (USART_SR_PE | USART_SR_FE | USART_SR_ORE);
-        if ((1UL == bCM_INTC->ISELBR28_b.ISEL12) && (0UL != u32Tmp1)) {
-            USART2_RxError_IrqHandler();
-        }
-    }
-    /* USART3 Tx buffer empty */
-    if (1UL == bCM_USART3->CR1_b.TXEIE) {
-        u32Tmp1 = bCM_USART3->SR_b.TXE;
-        if ((1UL == bCM_INTC->ISELBR28_b.ISEL13) && (0UL != u32Tmp1)) {
-            USART3_TxEmpty_IrqHandler();
-        }
-    }
-    /* I2c Tx end */
-    if (1UL == bCM_I2C->CR2_b.TENDIE) {
-        u32Tmp1 = bCM_I2C->SR_b.TENDF;
-        if ((1UL == bCM_INTC->ISELBR28_b.ISEL14) && (0UL != u32Tmp1)) {
-            I2C_TxComplete_IrqHandler();
-        }
-    }
-    /* SPI bus idle */
-    if (1UL == bCM_SPI->CR1_b.IDIE) {
-        u32Tmp1 = bCM_SPI->SR_b.IDLNF;
-        if ((1UL == bCM_INTC->ISELBR28_b.ISEL15) && (0UL == u32Tmp1)) {
-            SPI_Idle_IrqHandler();
-        }
-    }
+    INTC_STAT_IRQ_ENTER(INT028_IRQn);
+    INTC_ShareIrqDispatch(CM_INTC->ISELBR28, m_astcIrq028Src, ARRAY_SZ(m_astcIrq028Src));
+    INTC_STAT_IRQ_EXIT(INT028_IRQn);
 }
 
 /**
@@ -466,56 +451,9 @@ void IRQ028_Handler(void)
  */
 void IRQ029_Handler(void)
 {
-    uint32_t u32Tmp1;
-    /* TimerB4 overflow */
-    if (1UL == bCM_TMRB_4->BCSTR_b.ITENOVF) {
-        u32Tmp1 = bCM_TMRB_4->BCSTR_b.OVFF;
-        if ((1UL == bCM_INTC->ISELBR29_b.ISEL8) && (0UL != u32Tmp1)) {
-            TMRB_4_Ovf_IrqHandler();
-        }
-    }
-    /* TimerB4 underflow */
-    if (1UL == bCM_TMRB_4->BCSTR_b.ITENUDF) {
-        u32Tmp1 = bCM_TMRB_4->BCSTR_b.UDFF;
-        if ((1UL == bCM_INTC->ISELBR29_b.ISEL9) && (0UL != u32Tmp1)) {
-            TMRB_4_Udf_IrqHandler();
-        }
-    }
-    /* TimerB3 compare match */
-    if (1UL == bCM_TMRB_3->ICONR_b.ITEN1) {
-        u32Tmp1 = bCM_TMRB_3->STFLR_b.CMPF1;
-        if ((1UL == bCM_INTC->ISELBR29_b.ISEL10) && (0UL != u32Tmp1)) {
-            TMRB_3_Cmp_IrqHandler();
-        }
-    }
-    /* ADC seq.B convert complete */
-    if (1UL == bCM_ADC->ICR_b.EOCBIEN) {
-        u32Tmp1 = bCM_ADC->ISR_b.EOCBF;
-        if ((1UL == bCM_INTC->ISELBR29_b.ISEL11) && (0UL != u32Tmp1)) {
-            ADC_SeqB_IrqHandler();
-        }
-    }
-    /* USART2 Rx end */
-    if (1UL == bCM_USART2->CR1_b.RIE) {
-        u32Tmp1 = bCM_USART2->SR_b.RXNE;
-        if ((1UL == bCM_INTC->ISELBR29_b.ISEL12) && (0UL != u32Tmp1)) {
-            USART2_RxFull_IrqHandler();
-        }
-    }
-    /* USART3 Tx end */
-    if (1UL == bCM_USART3->CR1_b.TCIE) {
-        u32Tmp1 = bCM_USART3->SR_b.TC;
-        if ((1UL == bCM_INTC->ISELBR29_b.ISEL13) && (0UL != u32Tmp1)) {
-            USART3_TxComplete_IrqHandler();
-        }
-    }
-    /* I2c Rx end */
-    if (1UL == bCM_I2C->CR2_b.RFULLIE) {
-        u32Tmp1 = bCM_I2C->SR_b.RFULLF;
-        if ((1UL == bCM_INTC->ISELBR29_b.ISEL14) && (0UL != u32Tmp1)) {
-            I2C_RxFull_IrqHandler();
-        }
-    }
+    INTC_STAT_IRQ_ENTER(INT029_IRQn);
+    INTC_ShareIrqDispatch(CM_INTC->ISELBR29, m_astcIrq029Src, ARRAY_SZ(m_astcIrq029Src));
+    INTC_STAT_IRQ_EXIT(INT029_IRQn);
 }
 
 /**
@@ -525,56 +463,9 @@ void IRQ029_Handler(void)
  */
 void IRQ030_Handler(void)
 {
-    uint32_t u32Tmp1;
-    /* TimerB1 overflow */
-    if (1UL == bCM_TMRB_1->BCSTR_b.ITENOVF) {
-        u32Tmp1 = bCM_TMRB_1->BCSTR_b.OVFF;
-        if ((1UL == bCM_INTC->ISELBR30_b.ISEL8) && (0UL != u32Tmp1)) {
-            TMRB_1_Ovf_IrqHandler();
-        }
-    }
-    /* TimerB1 underflow */
-    if (1UL == bCM_TMRB_1->BCSTR_b.ITENUDF) {
-        u32Tmp1 = bCM_TMRB_1->BCSTR_b.UDFF;
-        if ((1UL == bCM_INTC->ISELBR30_b.ISEL9) && (0UL != u32Tmp1)) {
-            TMRB_1_Udf_IrqHandler();
-        }
-    }
-    /* TimerB2 compare match */
-    if (1UL == bCM_TMRB_2->ICONR_b.ITEN1) {
-        u32Tmp1 = bCM_TMRB_2->STFLR_b.CMPF1;
-        if ((1UL == bCM_INTC->ISELBR30_b.ISEL10) && (0UL != u32Tmp1)) {
-            TMRB_2_Cmp_IrqHandler();
-        }
-    }
-    /* ADC convert result in range of window 0 setting */
-    if (1UL == bCM_ADC->AWDCR_b.AWD0IEN) {
-        u32Tmp1 = bCM_ADC->AWDSR_b.AWD0F;
-        if ((1UL == bCM_INTC->ISELBR30_b.ISEL11) && (0UL != u32Tmp1)) {
-            ADC_Cmp0_IrqHandler();
-        }
-    }
-    /* USART2 Tx buffer empty */
-    if (1UL == bCM_USART2->CR1_b.TXEIE) {
-        u32Tmp1 = bCM_USART2->SR_b.TXE;
-        if ((1UL == bCM_INTC->ISELBR30_b.ISEL12) && (0UL != u32Tmp1)) {
-            USART2_TxEmpty_IrqHandler();
-        }
-    }
-    /* I2c Tx buffer empty */
-    if (1UL == bCM_I2C->CR2_b.TEMPTYIE) {
-        u32Tmp1 = bCM_I2C->SR_b.TEMPTYF;
-        if ((1UL == bCM_INTC->ISELBR28_b.ISEL14) && (0UL != u32Tmp1)) {
-            I2C_TxEmpty_IrqHandler();
-        }
-    }
-    /* USART4 Tx buffer empty */
-    if (1UL == bCM_USART4->CR1_b.TXEIE) {
-        u32Tmp1 = bCM_USART4->SR_b.TXE;
-        if ((1UL == bCM_INTC->ISELBR30_b.ISEL15) && (0UL != u32Tmp1)) {
-            USART4_TxEmpty_IrqHandler();
-        }
-    }
+    INTC_STAT_IRQ_ENTER(INT030_IRQn);
+    INTC_ShareIrqDispatch(CM_INTC->ISELBR30, m_astcIrq030Src, ARRAY_SZ(m_astcIrq030Src));
+    INTC_STAT_IRQ_EXIT(INT030_IRQn);
 }
 
 /**
@@ -584,77 +475,33 @@ void IRQ030_Handler(void)
  */
 void IRQ031_Handler(void)
 {
-    uint32_t u32Tmp1;
-    uint32_t u32Tmp2;
-    /* LVD detected */
-    if (0UL == bCM_EFM->LVDICGCR_b.LVDDIS) {
-        u32Tmp1 = bCM_PWC->LVDCSR_b.DETF;
-        if ((1UL == bCM_INTC->ISELBR31_b.ISEL2) && (0UL != u32Tmp1)) {
+    uint32_t u32Sel;
+    uint32_t u32Flag;
+
+    INTC_STAT_IRQ_ENTER(INT031_IRQn);
+    u32Sel = CM_INTC->ISELBR31;
+    /* LVD detected, the interrupt is enabled while LVDDIS is 0 */
+    if (0UL != (u32Sel & INTC_SHARE_SEL_LVD)) {
+        if ((0UL == bCM_EFM->LVDICGCR_b.LVDDIS) && (0UL != bCM_PWC->LVDCSR_b.DETF)) {
             PWC_LVD_IrqHandler();
         }
     }
-    /* EFM operate end */
-    if (1UL == bCM_EFM->FITE_b.OPTENDITE) {
-        u32Tmp1 = bCM_EFM->FSR_b.OPTEND;
-        if ((1UL == bCM_INTC->ISELBR31_b.ISEL4) && (0UL != u32Tmp1)) {
-            EFM_OpEnd_IrqHandler();
-        }
-    }
-    /* TimerB2 overflow */
-    if (1UL == bCM_TMRB_2->BCSTR_b.ITENOVF) {
-        u32Tmp1 = bCM_TMRB_2->BCSTR_b.OVFF;
-        if ((1UL == bCM_INTC->ISELBR31_b.ISEL8) && (0UL != u32Tmp1)) {
-            TMRB_2_Ovf_IrqHandler();
-        }
-    }
-    /* TimerB2 underflow */
-    if (1UL == bCM_TMRB_2->BCSTR_b.ITENUDF) {
-        u32Tmp1 = bCM_TMRB_2->BCSTR_b.UDFF;
-        if ((1UL == bCM_INTC->ISELBR31_b.ISEL9) && (0UL != u32Tmp1)) {
-            TMRB_2_Udf_IrqHandler();
-        }
-    }
-    /* TimerB1 compare match */
-    if (1UL == bCM_TMRB_1->ICONR_b.ITEN1) {
-        u32Tmp1 = bCM_TMRB_1->STFLR_b.CMPF1;
-        if ((1UL == bCM_INTC->ISELBR31_b.ISEL10) && (0UL != u32Tmp1)) {
-            TMRB_1_Cmp_IrqHandler();
-        }
-    }
-    if (1UL == bCM_ADC->AWDCR_b.AWD1IEN) {
-        /* ADC convert result in range of window 1 if independence use */
-        u32Tmp1 = bCM_ADC->AWDSR_b.AWD1F;
-        u32Tmp2 = (uint32_t)CM_ADC->AWDCR & (uint32_t)ADC_AWDCR_AWDCM;
-        if ((1UL == bCM_INTC->ISELBR31_b.ISEL11) && (0UL != u32Tmp1) && (0UL == u32Tmp2)) {
-            ADC_Cmp1_IrqHandler();
-        }
-        /* ADC convert result combination use of window 0 & 1 */
-        u32Tmp1 = bCM_ADC->AWDSR_b.AWDCMF;
-        if ((1UL == bCM_INTC->ISELBR31_b.ISEL11) && (0UL != u32Tmp1) && (0UL != u32Tmp2)) {
-            ADC_Cmp1_IrqHandler();
-        }
-    }
-    /* USART2 Tx end */
-    if (1UL == bCM_USART2->CR1_b.TCIE) {
-        u32Tmp1 = bCM_USART2->SR_b.TC;
-        if ((1UL == bCM_INTC->ISELBR31_b.ISEL12) && (0UL != u32Tmp1)) {
-            USART2_TxComplete_IrqHandler();
-        }
-    }
-    /* SPI Tx buffer empty */
-    if (1UL == bCM_SPI->CR1_b.TXIE) {
-        u32Tmp1 = bCM_SPI->SR_b.TDEF;
-        if ((1UL == bCM_INTC->ISELBR31_b.ISEL13) && (0UL != u32Tmp1)) {
-            SPI_TxEmpty_IrqHandler();
-        }
-    }
-    /* USART4 Tx end */
-    if (1UL == bCM_USART4->CR1_b.TCIE) {
-        u32Tmp1 = bCM_USART4->SR_b.TC;
-        if ((1UL == bCM_INTC->ISELBR31_b.ISEL15) && (0UL != u32Tmp1)) {
-            USART4_TxComplete_IrqHandler();
+    INTC_ShareIrqDispatch(u32Sel & ~(INTC_SHARE_SEL_LVD | INTC_SHARE_SEL_ADC_CMP1),
+                          m_astcIrq031Src, ARRAY_SZ(m_astcIrq031Src));
+    /* ADC convert result in range of window 1 if independence use, or of window 0 & 1 if combination use */
+    if (0UL != (u32Sel & INTC_SHARE_SEL_ADC_CMP1)) {
+        if (1UL == bCM_ADC->AWDCR_b.AWD1IEN) {
+            if (0U == (CM_ADC->AWDCR & ADC_AWDCR_AWDCM)) {
+                u32Flag = bCM_ADC->AWDSR_b.AWD1F;
+            } else {
+                u32Flag = bCM_ADC->AWDSR_b.AWDCMF;
+            }
+            if (0UL != u32Flag) {
+                ADC_Cmp1_IrqHandler();
+            }
         }
     }
+    INTC_STAT_IRQ_EXIT(INT031_IRQn);
 }
 /**
  * @}
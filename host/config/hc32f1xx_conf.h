@@ -0,0 +1,159 @@
+/**
+ *******************************************************************************
+ * @file  host/config/hc32f1xx_conf.h
+ * @brief This file contains HC32 Series Device Driver Library usage management
+ *        of the host build, every module is built.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-16       CDT             First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2022-2023, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+#ifndef __HC32F1XX_CONF_H__
+#define __HC32F1XX_CONF_H__
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+
+/* C binding of definitions if building with C++ compiler */
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Global type definitions ('typedef')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Global pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+
+/**
+ * @brief This is the list of modules to be used in the Device Driver Library.
+ * Select the modules you need to use to DDL_ON.
+ * @note LL_ICG_ENABLE must be turned on(DDL_ON) to ensure that the chip works
+ * properly.
+ * @note LL_UTILITY_ENABLE must be turned on(DDL_ON) if using Device Driver
+ * Library.
+ * @note LL_PRINT_ENABLE must be turned on(DDL_ON) if using printf function.
+ * @note LL_USART_ASYNC_ENABLE requires LL_USART_ENABLE and LL_SPSC_ENABLE, and
+ * LL_INTERRUPTS_ENABLE for USART_Async_IrqSignIn().
+ * @note LL_I2C_INT_ENABLE requires LL_I2C_ENABLE, and LL_INTERRUPTS_ENABLE
+ * for I2C_Int_IrqSignIn().
+ * @note LL_EFM_KV_ENABLE requires LL_EFM_ENABLE.
+ * @note LL_ADC_ACQ_ENABLE requires LL_ADC_ENABLE and LL_AOS_ENABLE, and
+ * LL_INTERRUPTS_ENABLE for ADC_ACQ_IrqSignIn().
+ * @note LL_TMR0_WHEEL_ENABLE requires LL_TMR0_ENABLE, and LL_INTERRUPTS_ENABLE
+ * for TMR0_Wheel_IrqSignIn().
+ * @note LL_SCHED_ENABLE enters sleep mode when idle with LL_PWC_ENABLE, WFI
+ * without.
+ * @note LL_PWC_IDLE_ENABLE requires LL_PWC_ENABLE, LL_CLK_ENABLE and
+ * LL_INTERRUPTS_ENABLE, it follows the TMR0 timer wheel with LL_TMR0_WHEEL_ENABLE.
+ * @note LL_DVFS_ENABLE requires LL_CLK_ENABLE, LL_EFM_ENABLE and LL_PWC_ENABLE,
+ * its USART and I2C notifier callbacks follow LL_USART_ENABLE and LL_I2C_ENABLE.
+ * @note LL_TLOG_ENABLE requires LL_USART_ASYNC_ENABLE, the records are decoded by
+ * host/tlog.
+ * @note LL_PROF_ENABLE requires LL_TMRB_ENABLE and LL_USART_ENABLE, and
+ * LL_INTERRUPTS_ENABLE for PROF_IrqSignIn(). The dumps are decoded by host/prof.
+ * @note LL_INTC_STAT_ENABLE requires SysTick_Init(), and LL_USART_ENABLE for
+ * INTC_STAT_Dump().
+ * @note LL_SPI_INT_ENABLE requires LL_SPI_ENABLE and LL_GPIO_ENABLE, and
+ * LL_INTERRUPTS_ENABLE for SPI_Int_IrqSignIn().
+ * @note LL_KERNEL_ENABLE takes SysTick and PendSV: SysTick_Handler() must call
+ * KERNEL_TickHandler(). On the host, host/kernel switches the threads in
+ * place of PendSV_Handler().
+ */
+#define LL_ICG_ENABLE                               (DDL_ON)
+#define LL_UTILITY_ENABLE                           (DDL_ON)
+#define LL_PRINT_ENABLE                             (DDL_ON)
+
+#define LL_ADC_ENABLE                               (DDL_ON)
+#define LL_ADC_ACQ_ENABLE                           (DDL_ON)
+#define LL_AOS_ENABLE                               (DDL_ON)
+#define LL_CLK_ENABLE                               (DDL_ON)
+#define LL_CRC_ENABLE                               (DDL_ON)
+#define LL_CTC_ENABLE                               (DDL_ON)
+#define LL_DVFS_ENABLE                              (DDL_ON)
+#define LL_EFM_ENABLE                               (DDL_ON)
+#define LL_EFM_KV_ENABLE                            (DDL_ON)
+#define LL_FCG_ENABLE                               (DDL_ON)
+#define LL_GPIO_ENABLE                              (DDL_ON)
+#define LL_I2C_ENABLE                               (DDL_ON)
+#define LL_I2C_INT_ENABLE                           (DDL_ON)
+#define LL_INTC_STAT_ENABLE                         (DDL_ON)
+#define LL_INTERRUPTS_ENABLE                        (DDL_ON)
+#define LL_INTERRUPTS_SHARE_ENABLE                  (DDL_ON)
+#define LL_KERNEL_ENABLE                            (DDL_ON)
+#define LL_PWC_ENABLE                               (DDL_ON)
+#define LL_PWC_IDLE_ENABLE                          (DDL_ON)
+#define LL_PROF_ENABLE                              (DDL_ON)
+#define LL_RMU_ENABLE                               (DDL_ON)
+#define LL_SCHED_ENABLE                             (DDL_ON)
+#define LL_SPI_ENABLE                               (DDL_ON)
+#define LL_SPI_INT_ENABLE                           (DDL_ON)
+#define LL_SPSC_ENABLE                              (DDL_ON)
+#define LL_SWDT_ENABLE                              (DDL_ON)
+#define LL_TLOG_ENABLE                              (DDL_ON)
+#define LL_TMR0_ENABLE                              (DDL_ON)
+#define LL_TMR0_WHEEL_ENABLE                        (DDL_ON)
+#define LL_TMRB_ENABLE                              (DDL_ON)
+#define LL_USART_ENABLE                             (DDL_ON)
+#define LL_USART_ASYNC_ENABLE                       (DDL_ON)
+
+/**
+ * @brief Link the EFM program and erase functions to .ramfunc, so that the core
+ * keeps running from RAM while the flash is busy.
+ * @note  The functions take RAM space, and are copied from flash at startup.
+ */
+#define LL_EFM_RAM_FUNC_ENABLE                      (DDL_ON)
+
+/**
+ * @brief The following is a list of currently supported BSP boards.
+ */
+#define BSP_SK_HC32F120_LQFP44                      (1U)
+
+/**
+ * @brief The macro BSP_SK_HC32F1XX is used to specify the BSP board currently
+ * in use.
+ * The value should be set to one of the list of currently supported BSP boards.
+ * @note  If there is no supported BSP board or the BSP function is not used,
+ * the value needs to be set to 0U.
+ */
+#define BSP_SK_HC32F1XX                             (0U)
+
+/**
+ * @brief This is the list of BSP components to be used.
+ * Select the components you need to use to DDL_ON.
+ * @note  BSP_SPI_NOR_ENABLE requires LL_SPI_ENABLE and LL_GPIO_ENABLE.
+ */
+#define BSP_INT_KEY_ENABLE                          (DDL_OFF)
+#define BSP_SPI_NOR_ENABLE                          (DDL_ON)
+
+/*******************************************************************************
+ * Global variable definitions ('extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Global function prototypes (definition in C source)
+ ******************************************************************************/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __HC32F1XX_CONF_H__ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
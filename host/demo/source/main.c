@@ -0,0 +1,2284 @@
+/**
+ *******************************************************************************
+ * @file  host/demo/source/main.c
+ * @brief Host build smoke run: USART, SPI, EFM drivers, the EFM key/value
+ *        store, the ADC acquisition, the TMR0 timer wheel and the scheduler on
+ *        the simulated register file, the SPSC queue, the idle governor, the
+ *        frequency scaling service, the tokenized logging, the profiler, the
+ *        interrupt timing statistics, the baudrate division, the GPIO fast
+ *        path, the pin configuration table, the SPI transaction queue, the
+ *        SysTick timebase, the CRC contexts and the I2C transaction queue.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-16       CDT             First version
+                                    Add EFM key/value store case
+                                    Add ADC acquisition case
+                                    Add TMR0 timer wheel case
+                                    Add scheduler case
+                                    Add SPSC queue case
+                                    Add idle governor case
+                                    Add frequency scaling case
+                                    Add tokenized logging case
+   2026-10-17       CDT             Add profiler case
+                                    Add interrupt timing statistics case
+                                    Add baudrate division case
+                                    Add GPIO fast path case
+                                    Add pin configuration table case
+                                    Add SPI transaction queue case
+                                    Add idle governor wakeup clock case
+                                    Add EFM key/value store power loss case
+                                    Add SysTick timebase case
+                                    Add CRC context case
+                                    Add I2C transaction queue case
+                                    Check that HRC runs at the stop mode entry of the idle governor
+                                    Check the unseen entries and the unattached handlers of INTC_STAT
+                                    Check the frequency scaling rollback when the wait cycles stay
+                                    Check SysTick_SleepUntil with interrupts disabled
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2022-2023, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include <stdio.h>
+#include <string.h>
+
+#include "hc32_sim.h"
+
+/**
+ * @addtogroup HC32F120_DDL_Host
+ * @{
+ */
+
+/**
+ * @addtogroup DEMO
+ * @{
+ */
+
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @brief Captured USART output.
+ */
+typedef struct {
+    uint8_t au8Data[512];
+    uint32_t u32Len;
+} stc_demo_capture_t;
+
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+#define DEMO_USART_UNIT         (CM_USART1)
+#define DEMO_USART_FCG          (FCG0_PERIPH_USART1)
+#define DEMO_SPI_UNIT           (CM_SPI)
+#define DEMO_SPI_FCG            (FCG0_PERIPH_SPI)
+#define DEMO_CRC_FCG            (FCG0_PERIPH_CRC)
+#define DEMO_I2C_UNIT           (CM_I2C)
+#define DEMO_I2C_FCG            (FCG0_PERIPH_I2C)
+#define DEMO_TIMEOUT            (0x1000UL)
+
+#define DEMO_SPI_LEN            (32U)
+#define DEMO_FLASH_ADDR         (EFM_SECTOR_ADDR(120UL))
+#define DEMO_FLASH_LEN          (11U)
+#define DEMO_KV_ADDR            (EFM_SECTOR_ADDR(124UL))
+#define DEMO_KV_SECTOR_NUM      (3UL)
+#define DEMO_KV_KEY_SERIAL      (3U)
+#define DEMO_KV_KEY_CAL         (4U)
+#define DEMO_KV_KEY_COUNT       (5U)
+#define DEMO_KV_SERIAL_LEN      (16UL)
+#define DEMO_KV_CAL             (0x5AA5C33CUL)
+#define DEMO_KV_FILL            (60UL)
+#define DEMO_ADC_CH_MASK        ((1U << ADC_CH0) | (1U << ADC_CH2) | (1U << ADC_CH5))
+#define DEMO_ADC_CH_NUM         (3U)
+#define DEMO_ADC_BLOCK_SCANS    (4U)
+#define DEMO_WHEEL_TIMER_NUM    (1000U)
+#define DEMO_WHEEL_TICKS_MAX    (3000000UL)
+#define DEMO_WHEEL_PERIOD       (5000UL)
+#define DEMO_WHEEL_REPEAT       (10UL)
+#define DEMO_SCHED_TRACE_LEN    (8U)
+#define DEMO_SPSC_SIZE          (64U)
+#define DEMO_SPSC_CHUNK         (40U)
+#define DEMO_IDLE_STOP_MIN      (32UL)
+#define DEMO_IDLE_TICK_STEP     (5UL)
+#define DEMO_DVFS_BAUDRATE      (115200UL)
+#define DEMO_DVFS_TICK_FREQ     (1000UL)
+#define DEMO_DVFS_TRACE_LEN     (24U)
+#define DEMO_TLOG_BUF_SIZE      (32U)
+#define DEMO_PROF_UNIT          (CM_TMRB_1)
+#define DEMO_PROF_TEXT          (0x1000UL)
+#define DEMO_PROF_BIN_NUM       (64U)
+#define DEMO_STAT_TICK_FREQ     (1000UL)
+#define DEMO_BRR_CLK1           (8000000UL)
+#define DEMO_BRR_CLK2           (24000000UL)
+#define DEMO_SPI_INT_LOG_LEN    (16U)
+#define DEMO_SPI_INT_TRACE_LEN  (8U)
+#define DEMO_SPI_INT_CS_PORT    (GPIO_PORT_2)
+#define DEMO_SPI_INT_CS_A       (GPIO_PIN_05)
+#define DEMO_SPI_INT_CS_B       (GPIO_PIN_06)
+#define DEMO_SPI_INT_CS_ALL     (DEMO_SPI_INT_CS_A | DEMO_SPI_INT_CS_B)
+#define DEMO_TICK_FREQ          (1000UL)
+#define DEMO_TICK_SLEEP_US      (6000UL)
+#define DEMO_TICK_DELAY_US      (1500UL)
+/* SCS reads of a timebase call besides its wait loop */
+#define DEMO_TICK_READ_MAX      (8UL)
+#define DEMO_CRC_LEN_A          (203UL)
+#define DEMO_CRC_LEN_B          (157UL)
+#define DEMO_I2C_INT_ADDR       (0x50U)
+#define DEMO_I2C_INT_MEM_SIZE   (8U)
+#define DEMO_I2C_INT_LOG_LEN    (48U)
+#define DEMO_I2C_INT_TRACE_LEN  (8U)
+/* Handler calls of a queue run, far above the events of the case */
+#define DEMO_I2C_INT_POLL_MAX   (256UL)
+
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+static stc_demo_capture_t m_stcCapture;
+
+static uint8_t m_au8SpiTx[DEMO_SPI_LEN];
+static uint8_t m_au8SpiRx[DEMO_SPI_LEN];
+static uint8_t m_au8Flash[DEMO_FLASH_LEN];
+static uint8_t m_au8KvImage[DEMO_KV_SECTOR_NUM * SECTOR_SIZE];
+static uint32_t m_u32KvCount;
+/* Word aligned, the streams start at odd offsets in it */
+static uint32_t m_au32CrcBuf[(DEMO_CRC_LEN_A + DEMO_CRC_LEN_B + 8UL) / 4UL];
+static uint16_t m_au16AdcBuf[2U * DEMO_ADC_BLOCK_SCANS * DEMO_ADC_CH_NUM];
+static stc_tmr0_wheel_timer_t m_astcWheelTimer[DEMO_WHEEL_TIMER_NUM];
+static uint32_t m_au32WheelExpect[DEMO_WHEEL_TIMER_NUM];
+static uint32_t m_u32WheelFired;
+static uint32_t m_u32WheelLate;
+static stc_sched_task_t m_stcSchedHigh;
+static stc_sched_task_t m_stcSchedLow1;
+static stc_sched_task_t m_stcSchedLow2;
+static char m_acSchedTrace[DEMO_SCHED_TRACE_LEN];
+static uint32_t m_u32SchedTraceLen;
+static uint32_t m_u32SchedLow1Events;
+static uint32_t m_au32SpscBuf[DEMO_SPSC_SIZE / 4U];
+static uint8_t m_au8SpscData[2U * DEMO_SPSC_CHUNK];
+static uint8_t m_au8SpscOut[2U * DEMO_SPSC_CHUNK];
+static uint32_t m_u32IdleTicks;
+static uint32_t m_u32IdleTick;
+static uint8_t m_u8IdleStopHrcCr;
+static char m_acDvfsTrace[DEMO_DVFS_TRACE_LEN];
+static uint32_t m_u32DvfsTraceLen;
+static uint8_t m_au8TlogBuf[DEMO_TLOG_BUF_SIZE];
+static uint16_t m_au16ProfBin[DEMO_PROF_BIN_NUM];
+static stc_intc_stat_t m_stcStatTick;
+static stc_intc_stat_t m_stcStat008;
+static stc_intc_stat_t m_stcStat009;
+static uint32_t m_au32SpiIntLog[DEMO_SPI_INT_LOG_LEN];
+static uint32_t m_u32SpiIntLogLen;
+static char m_acSpiIntTrace[DEMO_SPI_INT_TRACE_LEN];
+static uint32_t m_u32SpiIntTraceLen;
+static uint8_t m_au8I2cIntMem[DEMO_I2C_INT_MEM_SIZE];
+static uint32_t m_u32I2cIntPtr;
+static uint8_t m_u8I2cIntPtrSet;
+static char m_acI2cIntLog[DEMO_I2C_INT_LOG_LEN];
+static uint32_t m_u32I2cIntLogLen;
+static char m_acI2cIntTrace[DEMO_I2C_INT_TRACE_LEN];
+static uint32_t m_u32I2cIntTraceLen;
+
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @brief  USART TX sink, collects the frames.
+ * @param  [in] u16Data                 Frame
+ * @param  [in] pvArg                   Pointer to the capture buffer
+ * @retval None
+ */
+static void Demo_UsartCapture(uint16_t u16Data, void *pvArg)
+{
+    stc_demo_capture_t *pstcCapture = (stc_demo_capture_t *)pvArg;
+
+    if (pstcCapture->u32Len < sizeof(pstcCapture->au8Data)) {
+        pstcCapture->au8Data[pstcCapture->u32Len++] = (uint8_t)u16Data;
+    }
+}
+
+/**
+ * @brief  Print one result line.
+ * @param  [in] pcName                  Case name
+ * @param  [in] i32Ret                  LL_OK if the case passed
+ * @retval i32Ret
+ */
+static int32_t Demo_Report(const char *pcName, int32_t i32Ret)
+{
+    (void)printf("%-28s %s (%ld)\n", pcName, (LL_OK == i32Ret) ? "pass" : "FAIL", (long)i32Ret);
+    return i32Ret;
+}
+
+/**
+ * @brief  Polling UART transmit and receive.
+ * @param  None
+ * @retval int32_t:
+ *           - LL_OK:                   Passed.
+ *           - Others:                  Failed.
+ */
+static int32_t Demo_Usart(void)
+{
+    static const char acTx[] = "hello, host";
+    static const uint16_t au16Rx[] = {'o', 'k'};
+    stc_usart_uart_init_t stcUartInit;
+    uint8_t au8Rx[2];
+    int32_t i32Ret;
+
+    (void)USART_UART_StructInit(&stcUartInit);
+    (void)USART_UART_Init(DEMO_USART_UNIT, &stcUartInit, NULL);
+    USART_FuncCmd(DEMO_USART_UNIT, (USART_TX | USART_RX), ENABLE);
+    SIM_USART_SetTxCallback(DEMO_USART_UNIT, &Demo_UsartCapture, &m_stcCapture);
+
+    i32Ret = USART_UART_Trans(DEMO_USART_UNIT, acTx, sizeof(acTx) - 1U, DEMO_TIMEOUT);
+    if ((LL_OK == i32Ret) &&
+        ((m_stcCapture.u32Len != (sizeof(acTx) - 1U)) || (0 != memcmp(m_stcCapture.au8Data, acTx, m_stcCapture.u32Len)))) {
+        i32Ret = LL_ERR;
+    }
+    (void)Demo_Report("USART_UART_Trans", i32Ret);
+
+    (void)SIM_USART_InjectRx(DEMO_USART_UNIT, au16Rx, ARRAY_SZ(au16Rx));
+    i32Ret = USART_UART_Receive(DEMO_USART_UNIT, au8Rx, ARRAY_SZ(au8Rx), DEMO_TIMEOUT);
+    if ((LL_OK == i32Ret) && ((au8Rx[0] != 'o') || (au8Rx[1] != 'k'))) {
+        i32Ret = LL_ERR;
+    }
+    (void)Demo_Report("USART_UART_Receive", i32Ret);
+    if (LL_OK == i32Ret) {
+        /* Nothing left, must time out */
+        i32Ret = (LL_ERR_TIMEOUT == USART_UART_Receive(DEMO_USART_UNIT, au8Rx, 1UL, DEMO_TIMEOUT)) ? LL_OK : LL_ERR;
+        (void)Demo_Report("USART_UART_Receive(empty)", i32Ret);
+    }
+    return i32Ret;
+}
+
+/**
+ * @brief  SPI transfers in MOSI to MISO loopback.
+ * @param  None
+ * @retval int32_t:
+ *           - LL_OK:                   Passed.
+ *           - Others:                  Failed.
+ */
+static int32_t Demo_Spi(void)
+{
+    stc_spi_init_t stcSpiInit;
+    uint32_t i;
+    int32_t i32Ret;
+
+    for (i = 0UL; i < DEMO_SPI_LEN; i++) {
+        m_au8SpiTx[i] = (uint8_t)(i * 37UL + 5UL);
+    }
+    (void)SPI_StructInit(&stcSpiInit);
+    stcSpiInit.u32WireMode    = SPI_3_WIRE;
+    stcSpiInit.u32TransMode   = SPI_FULL_DUPLEX;
+    stcSpiInit.u32MasterSlave = SPI_MASTER;
+    (void)SPI_Init(DEMO_SPI_UNIT, &stcSpiInit);
+    SPI_LoopbackModeConfig(DEMO_SPI_UNIT, SPI_LOOPBACK_MOSI);
+    SPI_Cmd(DEMO_SPI_UNIT, ENABLE);
+
+    (void)memset(m_au8SpiRx, 0, sizeof(m_au8SpiRx));
+    i32Ret = SPI_TransReceive(DEMO_SPI_UNIT, m_au8SpiTx, m_au8SpiRx, DEMO_SPI_LEN, DEMO_TIMEOUT);
+    if ((LL_OK == i32Ret) && (0 != memcmp(m_au8SpiTx, m_au8SpiRx, DEMO_SPI_LEN))) {
+        i32Ret = LL_ERR;
+    }
+    (void)Demo_Report("SPI_TransReceive", i32Ret);
+
+    (void)memset(m_au8SpiRx, 0, sizeof(m_au8SpiRx));
+    i32Ret = SPI_PipelineTransReceive(DEMO_SPI_UNIT, m_au8SpiTx, m_au8SpiRx, DEMO_SPI_LEN, DEMO_TIMEOUT);
+    if ((LL_OK == i32Ret) && (0 != memcmp(m_au8SpiTx, m_au8SpiRx, DEMO_SPI_LEN))) {
+        i32Ret = LL_ERR;
+    }
+    return Demo_Report("SPI_PipelineTransReceive", i32Ret);
+}
+
+/**
+ * @brief  Flash erase, program and read back.
+ * @param  None
+ * @retval int32_t:
+ *           - LL_OK:                   Passed.
+ *           - Others:                  Failed.
+ */
+static int32_t Demo_Efm(void)
+{
+    static uint8_t au8Data[DEMO_FLASH_LEN] = "flash data";
+    int32_t i32Ret;
+
+    EFM_FWMC_Cmd(ENABLE);
+    i32Ret = EFM_SectorErase(DEMO_FLASH_ADDR);
+    if (LL_OK == i32Ret) {
+        i32Ret = EFM_Program(DEMO_FLASH_ADDR, au8Data, DEMO_FLASH_LEN);
+    }
+    if (LL_OK == i32Ret) {
+        i32Ret = EFM_ReadByte(DEMO_FLASH_ADDR, m_au8Flash, DEMO_FLASH_LEN);
+    }
+    if ((LL_OK == i32Ret) && (0 != memcmp(au8Data, m_au8Flash, DEMO_FLASH_LEN))) {
+        i32Ret = LL_ERR;
+    }
+    (void)Demo_Report("EFM_Program", i32Ret);
+
+    if (LL_OK == i32Ret) {
+        /* Programming can only clear bits, setting them again must mismatch */
+        i32Ret = EFM_ProgramWordReadBack(DEMO_FLASH_ADDR, 0xFFFFFFFFUL);
+        i32Ret = (LL_ERR == i32Ret) ? LL_OK : LL_ERR;
+        (void)Demo_Report("EFM_ProgramWordReadBack", i32Ret);
+    }
+    EFM_FWMC_Cmd(DISABLE);
+    return i32Ret;
+}
+
+/**
+ * @brief  Key/value store writes, remount and delete.
+ * @param  None
+ * @retval int32_t:
+ *           - LL_OK:                   Passed.
+ *           - Others:                  Failed.
+ */
+static int32_t Demo_EfmKv(void)
+{
+    stc_efm_kv_init_t stcKvInit;
+    uint32_t u32Count;
+    uint32_t u32Len = 0UL;
+    uint32_t i;
+    int32_t i32Ret;
+
+    EFM_FWMC_Cmd(ENABLE);
+    (void)EFM_KV_StructInit(&stcKvInit);
+    stcKvInit.u32StartAddr = DEMO_KV_ADDR;
+    stcKvInit.u32SectorNum = DEMO_KV_SECTOR_NUM;
+    i32Ret = EFM_KV_Init(&stcKvInit);
+    /* Enough counter updates to wrap the sectors several times */
+    for (i = 0UL; (i < 500UL) && (LL_OK == i32Ret); i++) {
+        i32Ret = EFM_KV_Write(1U, (const uint8_t *)&i, sizeof(i));
+        if (LL_OK == i32Ret) {
+            i32Ret = EFM_KV_Write(2U, (const uint8_t *)"calibration", 11UL);
+        }
+        while (LL_ERR_BUSY == EFM_KV_Compact()) {
+        }
+    }
+    /* Remount, as after a reset */
+    if (LL_OK == i32Ret) {
+        i32Ret = EFM_KV_Init(&stcKvInit);
+    }
+    if (LL_OK == i32Ret) {
+        i32Ret = EFM_KV_Read(1U, (uint8_t *)&u32Count, sizeof(u32Count), &u32Len);
+    }
+    if ((LL_OK == i32Ret) && ((u32Len != sizeof(u32Count)) || (u32Count != 499UL))) {
+        i32Ret = LL_ERR;
+    }
+    (void)Demo_Report("EFM_KV_Write", i32Ret);
+
+    if (LL_OK == i32Ret) {
+        i32Ret = EFM_KV_Delete(1U);
+        if (LL_OK == i32Ret) {
+            i32Ret = EFM_KV_Init(&stcKvInit);
+        }
+        if ((LL_OK == i32Ret) && (LL_ERR != EFM_KV_Read(1U, (uint8_t *)&u32Count, sizeof(u32Count), NULL))) {
+            i32Ret = LL_ERR;
+        }
+        (void)Demo_Report("EFM_KV_Delete", i32Ret);
+    }
+    EFM_FWMC_Cmd(DISABLE);
+    return i32Ret;
+}
+
+/**
+ * @brief  Program and erase operations of the EFM so far.
+ * @param  None
+ * @retval uint32_t:                    Operation count
+ */
+static uint32_t Demo_KvOpCount(void)
+{
+    const stc_sim_efm_stat_t *pstcStat = SIM_EFM_GetStat();
+    uint32_t u32Count = pstcStat->u32ProgramCount + pstcStat->u32ChipEraseCount;
+    uint32_t i;
+
+    for (i = 0UL; i < ARRAY_SZ(pstcStat->au32SectorEraseCount); i++) {
+        u32Count += pstcStat->au32SectorEraseCount[i];
+    }
+    return u32Count;
+}
+
+/**
+ * @brief  Store operation: write m_u32KvCount to the counter key.
+ * @param  None
+ * @retval int32_t:                     @ref EFM_KV_Write
+ */
+static int32_t Demo_KvWriteCount(void)
+{
+    return EFM_KV_Write(DEMO_KV_KEY_COUNT, (const uint8_t *)&m_u32KvCount, sizeof(m_u32KvCount));
+}
+
+/**
+ * @brief  Store operation: run the compaction to the end.
+ * @param  None
+ * @retval int32_t:                     @ref EFM_KV_Compact
+ * @note   A sector takes at most a copy per key and the erase. The steps are bounded as
+ *         the CPU keeps running here once the power is lost, and a lost erase leaves
+ *         the compaction to be done again.
+ */
+static int32_t Demo_KvCompact(void)
+{
+    uint32_t i;
+    int32_t i32Ret = LL_ERR_BUSY;
+
+    for (i = 0UL; (i < (EFM_KV_KEY_NUM + 2UL)) && (LL_ERR_BUSY == i32Ret); i++) {
+        i32Ret = EFM_KV_Compact();
+    }
+    return i32Ret;
+}
+
+/**
+ * @brief  Run a store operation with the power lost in its last program or erase,
+ *         then remount the store as after the reset.
+ * @param  [in] pstcKvInit              Store area
+ * @param  [in] pfnOp                   Store operation
+ * @param  [in] u32TornMask             Bits the cut program still clears
+ * @param  [out] pu32OpNum              Program and erase operations of the operation
+ * @retval int32_t:
+ *           - LL_OK:                   Remounted.
+ *           - Others:                  Failed.
+ */
+static int32_t Demo_KvPowerCut(const stc_efm_kv_init_t *pstcKvInit, int32_t (*pfnOp)(void),
+                               uint32_t u32TornMask, uint32_t *pu32OpNum)
+{
+    uint32_t u32OpNum = 0UL;
+    int32_t i32Ret;
+
+    /* Count the operations of a run with the power on, then take it back */
+    i32Ret = EFM_KV_Init(pstcKvInit);
+    if (LL_OK == i32Ret) {
+        (void)memcpy(m_au8KvImage, SIM_ShadowAddr(DEMO_KV_ADDR), sizeof(m_au8KvImage));
+        u32OpNum = Demo_KvOpCount();
+        i32Ret = pfnOp();
+        u32OpNum = Demo_KvOpCount() - u32OpNum;
+        (void)memcpy(SIM_ShadowAddr(DEMO_KV_ADDR), m_au8KvImage, sizeof(m_au8KvImage));
+    }
+    if ((LL_OK == i32Ret) && (0UL == u32OpNum)) {
+        i32Ret = LL_ERR;
+    }
+    if (LL_OK == i32Ret) {
+        i32Ret = EFM_KV_Init(pstcKvInit);
+    }
+    if (LL_OK == i32Ret) {
+        SIM_EFM_PowerCut(u32OpNum - 1UL, u32TornMask);
+        (void)pfnOp();
+        SIM_EFM_PowerOn();
+        i32Ret = EFM_KV_Init(pstcKvInit);
+    }
+    *pu32OpNum = u32OpNum;
+    return i32Ret;
+}
+
+/**
+ * @brief  Check the last committed value of every key of the power loss case.
+ * @param  [in] u32Count                Last committed counter
+ * @retval int32_t:
+ *           - LL_OK:                   All values read back.
+ *           - Others:                  Failed.
+ */
+static int32_t Demo_KvPowerCutCheck(uint32_t u32Count)
+{
+    uint8_t au8Serial[DEMO_KV_SERIAL_LEN];
+    uint32_t u32Value = 0UL;
+    uint32_t u32Len = 0UL;
+    int32_t i32Ret;
+
+    i32Ret = EFM_KV_Read(DEMO_KV_KEY_SERIAL, au8Serial, sizeof(au8Serial), &u32Len);
+    if ((LL_OK == i32Ret) &&
+        ((DEMO_KV_SERIAL_LEN != u32Len) || (0 != memcmp(au8Serial, "SN-2026-0000417A", DEMO_KV_SERIAL_LEN)))) {
+        i32Ret = LL_ERR;
+    }
+    if (LL_OK == i32Ret) {
+        i32Ret = EFM_KV_Read(DEMO_KV_KEY_CAL, (uint8_t *)&u32Value, sizeof(u32Value), &u32Len);
+    }
+    if ((LL_OK == i32Ret) && ((sizeof(u32Value) != u32Len) || (DEMO_KV_CAL != u32Value))) {
+        i32Ret = LL_ERR;
+    }
+    if (LL_OK == i32Ret) {
+        i32Ret = EFM_KV_Read(DEMO_KV_KEY_COUNT, (uint8_t *)&u32Value, sizeof(u32Value), &u32Len);
+    }
+    if ((LL_OK == i32Ret) && ((sizeof(u32Value) != u32Len) || (u32Count != u32Value))) {
+        i32Ret = LL_ERR;
+    }
+    return i32Ret;
+}
+
+/**
+ * @brief  Key/value store power loss: the power goes after the value of a record but
+ *         before its commit word, in the middle of the commit word, and after a
+ *         compaction copied the live records but before it erased the old sector.
+ *         Every remount must return the last committed value of every key.
+ * @param  None
+ * @retval int32_t:
+ *           - LL_OK:                   Passed.
+ *           - Others:                  Failed.
+ */
+static int32_t Demo_EfmKvPowerCut(void)
+{
+    stc_efm_kv_init_t stcKvInit;
+    const uint32_t u32Cal = DEMO_KV_CAL;
+    uint32_t u32OpNum;
+    uint32_t i;
+    int32_t i32Ret = LL_OK;
+
+    EFM_FWMC_Cmd(ENABLE);
+    for (i = 0UL; (i < DEMO_KV_SECTOR_NUM) && (LL_OK == i32Ret); i++) {
+        i32Ret = EFM_SectorErase(DEMO_KV_ADDR + (i * SECTOR_SIZE));
+    }
+    (void)EFM_KV_StructInit(&stcKvInit);
+    stcKvInit.u32StartAddr = DEMO_KV_ADDR;
+    stcKvInit.u32SectorNum = DEMO_KV_SECTOR_NUM;
+    if (LL_OK == i32Ret) {
+        i32Ret = EFM_KV_Init(&stcKvInit);
+    }
+    if (LL_OK == i32Ret) {
+        i32Ret = EFM_KV_Write(DEMO_KV_KEY_SERIAL, (const uint8_t *)"SN-2026-0000417A", DEMO_KV_SERIAL_LEN);
+    }
+    if (LL_OK == i32Ret) {
+        i32Ret = EFM_KV_Write(DEMO_KV_KEY_CAL, (const uint8_t *)&u32Cal, sizeof(u32Cal));
+    }
+    /* No compaction: the first sector is full of old counters and the two keys above */
+    for (m_u32KvCount = 0UL; (m_u32KvCount < DEMO_KV_FILL) && (LL_OK == i32Ret); m_u32KvCount++) {
+        i32Ret = Demo_KvWriteCount();
+    }
+
+    /* Value programmed, commit word not */
+    if (LL_OK == i32Ret) {
+        i32Ret = Demo_KvPowerCut(&stcKvInit, &Demo_KvWriteCount, 0UL, &u32OpNum);
+    }
+    if (LL_OK == i32Ret) {
+        i32Ret = Demo_KvPowerCutCheck(DEMO_KV_FILL - 1UL);
+    }
+    /* Commit word half programmed, its CRC does not match */
+    if (LL_OK == i32Ret) {
+        i32Ret = Demo_KvPowerCut(&stcKvInit, &Demo_KvWriteCount, 0x0000FFFFUL, &u32OpNum);
+    }
+    if (LL_OK == i32Ret) {
+        i32Ret = Demo_KvPowerCutCheck(DEMO_KV_FILL - 1UL);
+    }
+    /* Live records copied, old sector not erased: they are in the store twice */
+    if (LL_OK == i32Ret) {
+        i32Ret = Demo_KvPowerCut(&stcKvInit, &Demo_KvCompact, 0UL, &u32OpNum);
+    }
+    if ((LL_OK == i32Ret) && (u32OpNum < 2UL)) {
+        /* The compaction must have copied records before the erase */
+        i32Ret = LL_ERR;
+    }
+    if (LL_OK == i32Ret) {
+        i32Ret = Demo_KvPowerCutCheck(DEMO_KV_FILL - 1UL);
+    }
+    /* The store goes on from any of them */
+    if (LL_OK == i32Ret) {
+        i32Ret = Demo_KvWriteCount();
+    }
+    if (LL_OK == i32Ret) {
+        i32Ret = Demo_KvCompact();
+    }
+    if (LL_OK == i32Ret) {
+        i32Ret = EFM_KV_Init(&stcKvInit);
+    }
+    if (LL_OK == i32Ret) {
+        i32Ret = Demo_KvPowerCutCheck(DEMO_KV_FILL);
+    }
+    (void)Demo_Report("EFM_KV power loss", i32Ret);
+    EFM_FWMC_Cmd(DISABLE);
+    return i32Ret;
+}
+
+/**
+ * @brief  ADC acquisition: the model has no ADC, each scan is written to the data
+ *         registers and ADC_ACQ_EocaIrqHandler() called as the EOCA IRQ would.
+ * @param  None
+ * @retval int32_t:
+ *           - LL_OK:                   Passed.
+ *           - Others:                  Failed.
+ */
+static int32_t Demo_AdcAcq(void)
+{
+    stc_adc_acq_init_t stcAcqInit;
+    const uint16_t *pu16Block = NULL;
+    uint32_t u32Scan;
+    uint32_t i;
+    int32_t i32Ret;
+
+    (void)ADC_ACQ_StructInit(&stcAcqInit);
+    stcAcqInit.u16ChMask = DEMO_ADC_CH_MASK;
+    stcAcqInit.enTriggerSrc = EVT_SRC_TMRB_1_CMP;
+    stcAcqInit.pu16Buf = m_au16AdcBuf;
+    stcAcqInit.u32BlockScans = DEMO_ADC_BLOCK_SCANS;
+    i32Ret = ADC_ACQ_Init(CM_ADC, &stcAcqInit);
+    ADC_ACQ_Start(CM_ADC);
+
+    /* Two blocks while the first one is held: the second one overruns */
+    for (u32Scan = 0UL; (u32Scan < (2UL * DEMO_ADC_BLOCK_SCANS)) && (LL_OK == i32Ret); u32Scan++) {
+        RW_MEM16((uint32_t)&CM_ADC->DR0 + ADC_CH0 * 2UL) = (uint16_t)(u32Scan * 3UL);
+        RW_MEM16((uint32_t)&CM_ADC->DR0 + ADC_CH2 * 2UL) = (uint16_t)(u32Scan * 3UL + 1UL);
+        RW_MEM16((uint32_t)&CM_ADC->DR0 + ADC_CH5 * 2UL) = (uint16_t)(u32Scan * 3UL + 2UL);
+        ADC_ACQ_EocaIrqHandler(CM_ADC);
+    }
+    if (LL_OK == i32Ret) {
+        i32Ret = ADC_ACQ_GetBlock(CM_ADC, &pu16Block);
+    }
+    for (i = 0UL; (i < (DEMO_ADC_BLOCK_SCANS * DEMO_ADC_CH_NUM)) && (LL_OK == i32Ret); i++) {
+        if (pu16Block[i] != (uint16_t)i) {
+            i32Ret = LL_ERR;
+        }
+    }
+    if ((LL_OK == i32Ret) && (1UL != ADC_ACQ_GetOverrunCount(CM_ADC))) {
+        i32Ret = LL_ERR;
+    }
+    if (LL_OK == i32Ret) {
+        ADC_ACQ_ReleaseBlock(CM_ADC);
+        i32Ret = (LL_ERR_BUF_EMPTY == ADC_ACQ_GetBlock(CM_ADC, &pu16Block)) ? LL_OK : LL_ERR;
+    }
+    ADC_ACQ_Stop(CM_ADC);
+    return Demo_Report("ADC_ACQ_EocaIrqHandler", i32Ret);
+}
+
+/**
+ * @brief  Timer wheel callback: checks the expiry tick, a periodic timer stops itself
+ *         after DEMO_WHEEL_REPEAT expiries.
+ * @param  [in] pstcTimer               Timer, the user data points to its expected expiry.
+ * @retval None
+ */
+static void Demo_WheelCallback(stc_tmr0_wheel_timer_t *pstcTimer)
+{
+    uint32_t *pu32Expect = (uint32_t *)pstcTimer->pvUserData;
+    /* The handler runs on the tick after the match, once the counter restarted */
+    const uint32_t u32Late = TMR0_Wheel_GetTick() - 1UL - *pu32Expect;
+
+    /* Up to the compare guard (2 ticks) late if close to the previous match */
+    if (u32Late > 2UL) {
+        m_u32WheelLate++;
+    }
+    m_u32WheelFired++;
+    if (SET == TMR0_Wheel_TimerIsRunning(pstcTimer)) {
+        *pu32Expect += DEMO_WHEEL_PERIOD;
+        if (*pu32Expect == (DEMO_WHEEL_PERIOD * (DEMO_WHEEL_REPEAT + 1UL))) {
+            TMR0_Wheel_TimerStop(pstcTimer);
+        }
+    }
+}
+
+/**
+ * @brief  TMR0 timer wheel: the model has no TMR0, each compare match is played by
+ *         restarting the counter, setting the flag and calling TMR0_Wheel_CmpIrqHandler().
+ * @param  None
+ * @retval int32_t:
+ *           - LL_OK:                   Passed.
+ *           - Others:                  Failed.
+ */
+static int32_t Demo_Tmr0Wheel(void)
+{
+    stc_tmr0_wheel_init_t stcWheelInit;
+    uint32_t u32Seed = 12345UL;
+    uint32_t u32Expect = 0UL;
+    uint32_t u32Irq = 0UL;
+    uint32_t i;
+    int32_t i32Ret;
+
+    FCG_Fcg0PeriphClockCmd(FCG0_PERIPH_TMR0, ENABLE);
+    (void)TMR0_Wheel_StructInit(&stcWheelInit);
+    i32Ret = TMR0_Wheel_Init(CM_TMR0, &stcWheelInit);
+
+    m_u32WheelFired = 0UL;
+    m_u32WheelLate = 0UL;
+    for (i = 0UL; (i < DEMO_WHEEL_TIMER_NUM) && (LL_OK == i32Ret); i++) {
+        u32Seed = (u32Seed * 1103515245UL) + 12345UL;
+        m_au32WheelExpect[i] = (i == 0UL) ? DEMO_WHEEL_PERIOD : (1UL + ((u32Seed >> 8U) % DEMO_WHEEL_TICKS_MAX));
+        (void)TMR0_Wheel_TimerInit(&m_astcWheelTimer[i], &Demo_WheelCallback, &m_au32WheelExpect[i]);
+        i32Ret = TMR0_Wheel_TimerStart(&m_astcWheelTimer[i], m_au32WheelExpect[i],
+                                       (i == 0UL) ? DEMO_WHEEL_PERIOD : 0UL);
+    }
+    /* Cancel every 7th one-shot timer */
+    for (i = 7UL; i < DEMO_WHEEL_TIMER_NUM; i += 7UL) {
+        TMR0_Wheel_TimerStop(&m_astcWheelTimer[i]);
+    }
+    for (i = 1UL; i < DEMO_WHEEL_TIMER_NUM; i++) {
+        if (0UL != (i % 7UL)) {
+            u32Expect++;
+        }
+    }
+    u32Expect += DEMO_WHEEL_REPEAT;
+
+    while ((LL_OK == i32Ret) && (m_u32WheelFired < u32Expect) && (u32Irq < (4UL * DEMO_WHEEL_TIMER_NUM))) {
+        TMR0_SetCountValue(CM_TMR0, TMR0_CH_A, 0U);
+        SET_REG32_BIT(CM_TMR0->STFLR, TMR0_FLAG_CMP_A);
+        TMR0_Wheel_CmpIrqHandler(CM_TMR0);
+        u32Irq++;
+    }
+    if ((LL_OK == i32Ret) && ((m_u32WheelFired != u32Expect) || (0UL != m_u32WheelLate))) {
+        i32Ret = LL_ERR;
+    }
+    for (i = 0UL; (i < DEMO_WHEEL_TIMER_NUM) && (LL_OK == i32Ret); i++) {
+        if (SET == TMR0_Wheel_TimerIsRunning(&m_astcWheelTimer[i])) {
+            i32Ret = LL_ERR;
+        }
+    }
+    TMR0_Stop(CM_TMR0, TMR0_CH_A);
+    return Demo_Report("TMR0_Wheel_CmpIrqHandler", i32Ret);
+}
+
+/**
+ * @brief  Scheduler task: records its run, the high priority task posts to a low one.
+ * @param  [in] pstcTask                Task, the user data is its trace letter.
+ * @param  [in] u32Events               Posted events
+ * @retval None
+ */
+static void Demo_SchedTask(stc_sched_task_t *pstcTask, uint32_t u32Events)
+{
+    const char cName = *(const char *)pstcTask->pvUserData;
+
+    if (m_u32SchedTraceLen < DEMO_SCHED_TRACE_LEN) {
+        m_acSchedTrace[m_u32SchedTraceLen++] = cName;
+    }
+    if (pstcTask == &m_stcSchedHigh) {
+        (void)SCHED_Post(&m_stcSchedLow1, 0x08UL);
+    } else if (pstcTask == &m_stcSchedLow1) {
+        m_u32SchedLow1Events = u32Events;
+    } else {
+        /* Nothing more */
+    }
+}
+
+/**
+ * @brief  Scheduler: priority order, round robin within a priority and merged posts.
+ * @param  None
+ * @retval int32_t:
+ *           - LL_OK:                   Passed.
+ *           - Others:                  Failed.
+ */
+static int32_t Demo_Sched(void)
+{
+    static const char cHigh = 'H';
+    static const char cLow1 = 'L';
+    static const char cLow2 = 'M';
+    stc_sched_stat_t stcStat;
+    int32_t i32Ret;
+
+    SCHED_Init();
+    m_u32SchedTraceLen = 0UL;
+    i32Ret = SCHED_TaskInit(&m_stcSchedHigh, &Demo_SchedTask, 0U, (void *)&cHigh);
+    if (LL_OK == i32Ret) {
+        i32Ret = SCHED_TaskInit(&m_stcSchedLow1, &Demo_SchedTask, 3U, (void *)&cLow1);
+    }
+    if (LL_OK == i32Ret) {
+        i32Ret = SCHED_TaskInit(&m_stcSchedLow2, &Demo_SchedTask, 3U, (void *)&cLow2);
+    }
+    if (LL_OK == i32Ret) {
+        /* As from IRQ handlers: the second post to Low1 is merged into its first one */
+        (void)SCHED_Post(&m_stcSchedLow1, 0x01UL);
+        (void)SCHED_Post(&m_stcSchedLow2, 0x01UL);
+        (void)SCHED_Post(&m_stcSchedHigh, 0x02UL);
+        (void)SCHED_Post(&m_stcSchedLow1, 0x04UL);
+        while (LL_OK == SCHED_RunOnce()) {
+        }
+        if ((3UL != m_u32SchedTraceLen) || (0 != memcmp(m_acSchedTrace, "HLM", 3U)) ||
+            (0x0DUL != m_u32SchedLow1Events)) {
+            i32Ret = LL_ERR;
+        }
+    }
+    if (LL_OK == i32Ret) {
+        (void)SCHED_GetStat(&m_stcSchedLow1, &stcStat);
+        i32Ret = (1UL == stcStat.u32RunCount) ? LL_OK : LL_ERR;
+    }
+    return Demo_Report("SCHED_RunOnce", i32Ret);
+}
+
+/**
+ * @brief  SPSC queue: bulk copies across the storage end, full and empty queue.
+ * @param  None
+ * @retval int32_t:
+ *           - LL_OK:                   Passed.
+ *           - Others:                  Failed.
+ */
+static int32_t Demo_Spsc(void)
+{
+    stc_spsc_t stcQueue;
+    uint32_t i;
+    uint32_t u32Len = 0UL;
+    uint8_t u8Data;
+    int32_t i32Ret;
+
+    for (i = 0UL; i < ARRAY_SZ(m_au8SpscData); i++) {
+        m_au8SpscData[i] = (uint8_t)((i * 7UL) + 1UL);
+    }
+    i32Ret = SPSC_Init(&stcQueue, m_au32SpscBuf, DEMO_SPSC_SIZE);
+    if (LL_OK == i32Ret) {
+        /* The second push wraps: word copies up to the end, then from the start */
+        u32Len += SPSC_Push(&stcQueue, m_au8SpscData, DEMO_SPSC_CHUNK);
+        u32Len += SPSC_Pop(&stcQueue, m_au8SpscOut, 24U);
+        u32Len += SPSC_Push(&stcQueue, &m_au8SpscData[DEMO_SPSC_CHUNK], DEMO_SPSC_CHUNK);
+        u32Len += SPSC_Pop(&stcQueue, &m_au8SpscOut[24U], ARRAY_SZ(m_au8SpscOut));
+        /* Every byte is pushed once and popped once */
+        if (((4UL * DEMO_SPSC_CHUNK) != u32Len) ||
+            (0 != memcmp(m_au8SpscOut, m_au8SpscData, ARRAY_SZ(m_au8SpscData)))) {
+            i32Ret = LL_ERR;
+        }
+    }
+    if (LL_OK == i32Ret) {
+        for (i = 0UL; i < DEMO_SPSC_SIZE; i++) {
+            (void)SPSC_PushByte(&stcQueue, (uint8_t)i);
+        }
+        if ((LL_ERR_BUF_FULL != SPSC_PushByte(&stcQueue, 0U)) || (0UL != SPSC_GetSpace(&stcQueue))) {
+            i32Ret = LL_ERR;
+        }
+    }
+    if (LL_OK == i32Ret) {
+        for (i = 0UL; (i < DEMO_SPSC_SIZE) && (LL_OK == i32Ret); i++) {
+            i32Ret = SPSC_PopByte(&stcQueue, &u8Data);
+            if ((LL_OK == i32Ret) && ((uint8_t)i != u8Data)) {
+                i32Ret = LL_ERR;
+            }
+        }
+        if ((LL_OK == i32Ret) && (LL_ERR_BUF_EMPTY != SPSC_PopByte(&stcQueue, &u8Data))) {
+            i32Ret = LL_ERR;
+        }
+    }
+    return Demo_Report("SPSC_Push/Pop", i32Ret);
+}
+
+/**
+ * @brief  Idle governor deadline: set by the case.
+ * @param  None
+ * @retval Ticks until the next deadline
+ */
+static uint32_t Demo_IdleGetIdleTicks(void)
+{
+    return m_u32IdleTicks;
+}
+
+/**
+ * @brief  Idle governor time base: advances on every read.
+ * @param  None
+ * @retval Tick
+ */
+static uint32_t Demo_IdleGetTick(void)
+{
+    m_u32IdleTick += DEMO_IDLE_TICK_STEP;
+    return m_u32IdleTick;
+}
+
+/**
+ * @brief  Idle governor: mode choice, stop inhibit, clock and wakeup source restore, statistics.
+ * @param  None
+ * @retval int32_t:
+ *           - LL_OK:                   Passed.
+ *           - Others:                  Failed.
+ */
+static int32_t Demo_PwcIdle(void)
+{
+    static const uint32_t au32Idle[] = {0UL, DEMO_IDLE_STOP_MIN - 1UL, DEMO_IDLE_STOP_MIN, 0xFFFFFFFFUL};
+    static const uint8_t au8Mode[] = {PWC_IDLE_MD_NONE, PWC_IDLE_MD_SLEEP, PWC_IDLE_MD_STOP, PWC_IDLE_MD_STOP};
+    stc_pwc_idle_init_t stcIdleInit;
+    stc_pwc_idle_stat_t stcStat;
+    uint32_t i;
+    int32_t i32Ret;
+
+    (void)PWC_Idle_StructInit(&stcIdleInit);
+    stcIdleInit.u32StopMinTicks = DEMO_IDLE_STOP_MIN;
+    stcIdleInit.u32WakeupSrc = INTC_STOP_WKUP_TMR0_CMP;
+    stcIdleInit.pfnGetIdleTicks = &Demo_IdleGetIdleTicks;
+    stcIdleInit.pfnGetTick = &Demo_IdleGetTick;
+    i32Ret = PWC_Idle_Init(&stcIdleInit);
+
+    /* Running on XTAL with HRC stopped: the governor wakes up on HRC and must undo it */
+    WRITE_REG8(CM_CMU->CKSWR, CLK_SYSCLK_SRC_XTAL);
+    WRITE_REG8(CM_CMU->SCKDIVR, 1U);
+    WRITE_REG8(CM_CMU->HRCCR, CMU_HRCCR_HRCSTP);
+    WRITE_REG32(CM_INTC->WUPEN, INTC_STOP_WKUP_EXTINT_CH0);
+    for (i = 0UL; (i < ARRAY_SZ(au32Idle)) && (LL_OK == i32Ret); i++) {
+        m_u32IdleTicks = au32Idle[i];
+        if (au8Mode[i] != PWC_Idle_Enter()) {
+            i32Ret = LL_ERR;
+        }
+    }
+    if ((LL_OK == i32Ret) && ((CMU_HRCCR_HRCSTP != READ_REG8(CM_CMU->HRCCR)) ||
+                              (CLK_SYSCLK_SRC_XTAL != READ_REG8(CM_CMU->CKSWR)) ||
+                              (1U != READ_REG8(CM_CMU->SCKDIVR)) ||
+                              (INTC_STOP_WKUP_EXTINT_CH0 != READ_REG32(CM_INTC->WUPEN)) ||
+                              (0U != READ_REG8_BIT(CM_PWC->STPMCR, PWC_STPMCR_STOP)))) {
+        i32Ret = LL_ERR;
+    }
+    if (LL_OK == i32Ret) {
+        PWC_Idle_StopInhibitCmd(0x01UL, ENABLE);
+        i32Ret = (PWC_IDLE_MD_SLEEP == PWC_Idle_Enter()) ? LL_OK : LL_ERR;
+        PWC_Idle_StopInhibitCmd(0x01UL, DISABLE);
+    }
+    if (LL_OK == i32Ret) {
+        (void)PWC_Idle_GetStat(&stcStat);
+        if ((2UL != stcStat.u32SleepCount) || (2UL != stcStat.u32StopCount) ||
+            ((2UL * DEMO_IDLE_TICK_STEP) != stcStat.u32StopTicks) ||
+            (stcStat.u32TotalTicks < (stcStat.u32SleepTicks + stcStat.u32StopTicks))) {
+            i32Ret = LL_ERR;
+        }
+    }
+    WRITE_REG8(CM_CMU->CKSWR, CLK_SYSCLK_SRC_HRC);
+    WRITE_REG8(CM_CMU->SCKDIVR, 0U);
+    WRITE_REG8(CM_CMU->HRCCR, 0U);
+    WRITE_REG32(CM_INTC->WUPEN, 0UL);
+    return Demo_Report("PWC_Idle_Enter", i32Ret);
+}
+
+/**
+ * @brief  WFI hook of the idle governor cases: records HRCCR at stop mode entry.
+ * @param  None
+ * @retval None
+ */
+static void Demo_IdleWfiHook(void)
+{
+    if (0U != READ_REG8_BIT(CM_PWC->STPMCR, PWC_STPMCR_STOP)) {
+        m_u8IdleStopHrcCr = READ_REG8(CM_CMU->HRCCR);
+    }
+}
+
+/**
+ * @brief  Idle governor wakeup clock: HRC only if HRC with the divider fits the flash wait
+ *         cycles and the power mode, the own clock otherwise. HRC is stopped before each
+ *         entry and must run in stop mode with either wakeup clock.
+ * @param  None
+ * @retval int32_t                      LL_OK if all checks passed.
+ */
+static int32_t Demo_PwcIdleClk(void)
+{
+    /* HRC at 48MHz: divider, flash wait cycle, high speed mode, wakeup clock */
+    static const uint8_t au8Case[][4] = {
+        {0U, 0U, 1U, PWC_STOP_CLK_KEEP},    /* 48MHz without wait cycle */
+        {1U, 0U, 1U, PWC_STOP_CLK_HRC},     /* 24MHz without wait cycle */
+        {0U, 1U, 1U, PWC_STOP_CLK_HRC},     /* 48MHz with wait cycle */
+        {1U, 1U, 0U, PWC_STOP_CLK_KEEP},    /* 24MHz in ultra low speed mode */
+        {5U, 0U, 0U, PWC_STOP_CLK_HRC},     /* 1.5MHz in ultra low speed mode */
+    };
+    uint32_t u32HrcValue = HRC_VALUE;
+    uint32_t u32Frmc = READ_REG32(CM_EFM->FRMC);
+    uint8_t u8Pwrc = READ_REG8(CM_PWC->PWRC);
+    uint32_t i;
+    int32_t i32Ret = LL_OK;
+
+    HRC_VALUE = 48000000UL;
+    m_u32IdleTicks = 0xFFFFFFFFUL;
+    SIM_SetWfiHook(&Demo_IdleWfiHook);
+    WRITE_REG8(CM_CMU->CKSWR, CLK_SYSCLK_SRC_XTAL);
+    for (i = 0UL; (i < ARRAY_SZ(au8Case)) && (LL_OK == i32Ret); i++) {
+        WRITE_REG8(CM_CMU->SCKDIVR, au8Case[i][0]);
+        WRITE_REG32(CM_EFM->FRMC, (u32Frmc & ~EFM_FRMC_FLWT) | au8Case[i][1]);
+        WRITE_REG8(CM_PWC->PWRC, (0U != au8Case[i][2]) ? PWC_PWRC_PWDRV : 0U);
+        WRITE_REG8(CM_CMU->HRCCR, CMU_HRCCR_HRCSTP);
+        m_u8IdleStopHrcCr = CMU_HRCCR_HRCSTP;
+        if ((PWC_IDLE_MD_STOP != PWC_Idle_Enter()) || (0U != m_u8IdleStopHrcCr) ||
+            (au8Case[i][3] != READ_REG8_BIT(CM_PWC->STPMCR, PWC_STPMCR_CKSHRC)) ||
+            (CLK_SYSCLK_SRC_XTAL != READ_REG8(CM_CMU->CKSWR)) ||
+            (au8Case[i][0] != READ_REG8(CM_CMU->SCKDIVR)) ||
+            (CMU_HRCCR_HRCSTP != READ_REG8(CM_CMU->HRCCR))) {
+            i32Ret = LL_ERR;
+        }
+    }
+    /* Already on HRC: nothing to switch */
+    if (LL_OK == i32Ret) {
+        WRITE_REG8(CM_CMU->CKSWR, CLK_SYSCLK_SRC_HRC);
+        WRITE_REG8(CM_CMU->SCKDIVR, 1U);
+        if ((PWC_IDLE_MD_STOP != PWC_Idle_Enter()) ||
+            (PWC_STOP_CLK_KEEP != READ_REG8_BIT(CM_PWC->STPMCR, PWC_STPMCR_CKSHRC))) {
+            i32Ret = LL_ERR;
+        }
+    }
+    SIM_SetWfiHook(NULL);
+    HRC_VALUE = u32HrcValue;
+    WRITE_REG32(CM_EFM->FRMC, u32Frmc);
+    WRITE_REG8(CM_PWC->PWRC, u8Pwrc);
+    WRITE_REG8(CM_CMU->CKSWR, CLK_SYSCLK_SRC_HRC);
+    WRITE_REG8(CM_CMU->SCKDIVR, 0U);
+    WRITE_REG8(CM_CMU->HRCCR, 0U);
+    WRITE_REG8(CM_PWC->STPMCR, 0U);
+    return Demo_Report("PWC_Idle_Enter wakeup clock", i32Ret);
+}
+
+/**
+ * @brief  Frequency scaling notifier: records the events.
+ * @param  [in] u32Event                A @ref DVFS_Event value.
+ * @param  [in] pstcChange              Clock change, not used.
+ * @param  [in] pvUserData              Veto flag, vetoes DVFS_EVT_PRE_CHANGE when set.
+ * @retval int32_t:
+ *           - LL_OK:                   Accepted.
+ *           - LL_ERR_BUSY:             Vetoed.
+ */
+static int32_t Demo_DvfsCallback(uint32_t u32Event, const stc_dvfs_change_t *pstcChange, void *pvUserData)
+{
+    static const char acEvent[] = {'P', 'D', 'A'};
+    int32_t i32Ret = LL_OK;
+
+    (void)pstcChange;
+    if (m_u32DvfsTraceLen < DEMO_DVFS_TRACE_LEN) {
+        m_acDvfsTrace[m_u32DvfsTraceLen++] = acEvent[u32Event];
+    }
+    if ((DVFS_EVT_PRE_CHANGE == u32Event) && (0UL != *(const uint32_t *)pvUserData)) {
+        i32Ret = LL_ERR_BUSY;
+    }
+    return i32Ret;
+}
+
+/**
+ * @brief  Frequency scaling: notifier order and veto, flash wait cycles, SysTick rescale,
+ *         USART baudrate recompute and power mode.
+ * @param  None
+ * @retval int32_t:
+ *           - LL_OK:                   Passed.
+ *           - Others:                  Failed.
+ */
+static int32_t Demo_Dvfs(void)
+{
+    static const char acTrace[] = "PPDDPPAPPDDPPDDPPAAPPDD";
+    const stc_dvfs_opp_t stcOppHigh = {CLK_SYSCLK_SRC_HRC, CLK_HCLK_DIV1, DVFS_PWR_MD_HIGH_SPEED};
+    const stc_dvfs_opp_t stcOppMid = {CLK_SYSCLK_SRC_XTAL, CLK_HCLK_DIV4, DVFS_PWR_MD_HIGH_SPEED};
+    const stc_dvfs_opp_t stcOppLow = {CLK_SYSCLK_SRC_LRC, CLK_HCLK_DIV1, DVFS_PWR_MD_LOW_SPEED};
+    stc_dvfs_usart_t stcUsart = {DEMO_USART_UNIT, DEMO_DVFS_BAUDRATE};
+    stc_dvfs_notifier_t stcNotifierTrace = {&Demo_DvfsCallback, NULL, NULL};
+    stc_dvfs_notifier_t stcNotifierUsart = {&DVFS_UsartCallback, NULL, NULL};
+    stc_dvfs_notifier_t stcNotifierVeto = {&Demo_DvfsCallback, NULL, NULL};
+    uint32_t u32NoVeto = 0UL;
+    uint32_t u32Veto = 0UL;
+    uint32_t u32Brr;
+    float32_t f32Error;
+    int32_t i32Ret;
+
+    /* Running at full speed with a 1kHz SysTick and the USART at the baudrate to keep */
+    WRITE_REG8(CM_PWC->PWRC, PWC_PWRC_PWDRV);
+    (void)SIM_BusWrite((uint32_t)&CM_CMU->OSCSTBSR, 1UL, (uint32_t)CLK_STB_FLAG_HRC | CLK_STB_FLAG_XTAL);
+    SystemCoreClockUpdate();
+    (void)SysTick_Init(DEMO_DVFS_TICK_FREQ);
+    (void)USART_SetBaudrate(DEMO_USART_UNIT, DEMO_DVFS_BAUDRATE, &f32Error);
+    u32Brr = READ_REG32(DEMO_USART_UNIT->BRR);
+
+    stcNotifierTrace.pvUserData = (void *)&u32NoVeto;
+    stcNotifierUsart.pvUserData = (void *)&stcUsart;
+    stcNotifierVeto.pvUserData = (void *)&u32Veto;
+    m_u32DvfsTraceLen = 0UL;
+    i32Ret = DVFS_NotifierRegister(&stcNotifierTrace);
+    if (LL_OK == i32Ret) {
+        i32Ret = DVFS_NotifierRegister(&stcNotifierUsart);
+    }
+    if (LL_OK == i32Ret) {
+        i32Ret = DVFS_NotifierRegister(&stcNotifierVeto);
+    }
+
+    /* Slow down: no wait cycle, SysTick reload and USART divider follow HCLK */
+    if (LL_OK == i32Ret) {
+        i32Ret = DVFS_SetOpp(&stcOppMid);
+    }
+    if ((LL_OK == i32Ret) && ((EFM_WAIT_CYCLE0 != READ_REG32_BIT(CM_EFM->FRMC, EFM_FRMC_FLWT)) ||
+                              ((DVFS_GetOppFreq(&stcOppMid) / DEMO_DVFS_TICK_FREQ) != (SysTick->LOAD + 1UL)) ||
+                              (u32Brr == READ_REG32(DEMO_USART_UNIT->BRR)))) {
+        i32Ret = LL_ERR;
+    }
+
+    /* A veto aborts the notifiers called before it, the clock stays */
+    if (LL_OK == i32Ret) {
+        u32Veto = 1UL;
+        i32Ret = (LL_ERR_BUSY == DVFS_SetOpp(&stcOppHigh)) ? LL_OK : LL_ERR;
+        u32Veto = 0UL;
+    }
+    if ((LL_OK == i32Ret) && (CLK_SYSCLK_SRC_XTAL != READ_REG8(CM_CMU->CKSWR))) {
+        i32Ret = LL_ERR;
+    }
+
+    /* Speed up again: wait cycle first, the original dividers come back */
+    if (LL_OK == i32Ret) {
+        i32Ret = DVFS_SetOpp(&stcOppHigh);
+    }
+    if ((LL_OK == i32Ret) && ((EFM_WAIT_CYCLE1 != READ_REG32_BIT(CM_EFM->FRMC, EFM_FRMC_FLWT)) ||
+                              ((HRC_VALUE / DEMO_DVFS_TICK_FREQ) != (SysTick->LOAD + 1UL)) ||
+                              (u32Brr != READ_REG32(DEMO_USART_UNIT->BRR)))) {
+        i32Ret = LL_ERR;
+    }
+
+    /* Low speed mode round trip, SysTick stopped as the mode switch delays count on it */
+    SysTick->CTRL = 0UL;
+    if (LL_OK == i32Ret) {
+        (void)DVFS_NotifierUnregister(&stcNotifierUsart);
+        i32Ret = DVFS_SetOpp(&stcOppLow);
+    }
+    if ((LL_OK == i32Ret) && (0U != READ_REG8_BIT(CM_PWC->PWRC, PWC_PWRC_PWDRV))) {
+        i32Ret = LL_ERR;
+    }
+    /* The wait cycles cannot be raised: aborted, back in low speed mode on the same clock */
+    if (LL_OK == i32Ret) {
+        SIM_EFM_HoldWaitCycle(ENABLE);
+        i32Ret = (LL_ERR_TIMEOUT == DVFS_SetOpp(&stcOppHigh)) ? LL_OK : LL_ERR;
+        SIM_EFM_HoldWaitCycle(DISABLE);
+    }
+    if ((LL_OK == i32Ret) && ((0U != READ_REG8_BIT(CM_PWC->PWRC, PWC_PWRC_PWDRV)) ||
+                              (CLK_SYSCLK_SRC_LRC != READ_REG8(CM_CMU->CKSWR)) ||
+                              (EFM_WAIT_CYCLE0 != READ_REG32_BIT(CM_EFM->FRMC, EFM_FRMC_FLWT)))) {
+        i32Ret = LL_ERR;
+    }
+    if (LL_OK == i32Ret) {
+        i32Ret = DVFS_SetOpp(&stcOppHigh);
+    }
+    if ((LL_OK == i32Ret) && (PWC_PWRC_PWDRV != READ_REG8_BIT(CM_PWC->PWRC, PWC_PWRC_PWDRV))) {
+        i32Ret = LL_ERR;
+    }
+    /* Trace and veto notifiers: pre and post of each change, the veto aborts the trace notifier */
+    if ((LL_OK == i32Ret) && (((sizeof(acTrace) - 1U) != m_u32DvfsTraceLen) ||
+                              (0 != memcmp(m_acDvfsTrace, acTrace, m_u32DvfsTraceLen)))) {
+        i32Ret = LL_ERR;
+    }
+
+    (void)DVFS_NotifierUnregister(&stcNotifierUsart);
+    (void)DVFS_NotifierUnregister(&stcNotifierTrace);
+    (void)DVFS_NotifierUnregister(&stcNotifierVeto);
+    return Demo_Report("DVFS_SetOpp", i32Ret);
+}
+
+/**
+ * @brief  Send the queued records as the TI and TCI interrupts would.
+ * @param  None
+ * @retval None
+ */
+static void Demo_TlogDrain(void)
+{
+    while (0UL != READ_REG32_BIT(DEMO_USART_UNIT->CR1, USART_CR1_TXEIE)) {
+        USART_Async_TxEmptyIrqHandler(DEMO_USART_UNIT);
+    }
+    if (0UL != READ_REG32_BIT(DEMO_USART_UNIT->CR1, USART_CR1_TCIE)) {
+        USART_Async_TxCpltIrqHandler(DEMO_USART_UNIT);
+    }
+}
+
+/**
+ * @brief  Check a record header of the captured stream.
+ * @param  [in] au32Word                Captured words
+ * @param  [in] u32Pos                  Word index of the header
+ * @param  [in] u32ArgNum               Expected number of arguments
+ * @param  [in] pcFmt                   Expected format string, NULL for a drop record
+ * @retval int32_t:
+ *           - LL_OK:                   The header matches.
+ *           - LL_ERR:                  It does not.
+ */
+static int32_t Demo_TlogCheck(const uint32_t au32Word[], uint32_t u32Pos, uint32_t u32ArgNum, const char *pcFmt)
+{
+    const uint32_t u32Hdr = au32Word[u32Pos];
+    const uint32_t u32Id = u32Hdr & TLOG_ID_MASK;
+    const char *pcId;
+
+    if ((TLOG_HDR_MARK | (u32ArgNum << TLOG_HDR_ARGN_POS)) != (u32Hdr & ~TLOG_ID_MASK)) {
+        return LL_ERR;
+    }
+    if (NULL == pcFmt) {
+        return (TLOG_ID_DROP == u32Id) ? LL_OK : LL_ERR;
+    }
+    /* The host build loads .tlog next to the data, the ID is the low part of the address */
+    pcId = (const char *)((((uintptr_t)&m_stcCapture) & ~(uintptr_t)TLOG_ID_MASK) | u32Id);
+    return (0 == strcmp(pcId, pcFmt)) ? LL_OK : LL_ERR;
+}
+
+/**
+ * @brief  Tokenized logging: record layout, format string IDs and drop record.
+ * @param  None
+ * @retval int32_t:
+ *           - LL_OK:                   Passed.
+ *           - Others:                  Failed.
+ */
+static int32_t Demo_Tlog(void)
+{
+    static const char acName[] = "spi";
+    stc_usart_async_init_t stcAsyncInit;
+    uint32_t au32Word[sizeof(m_stcCapture.au8Data) / 4U];
+    int32_t i32Ret;
+
+    (void)USART_Async_StructInit(&stcAsyncInit);
+    stcAsyncInit.pu8TxBuf = m_au8TlogBuf;
+    stcAsyncInit.u32TxBufSize = DEMO_TLOG_BUF_SIZE;
+    i32Ret = USART_Async_Init(DEMO_USART_UNIT, &stcAsyncInit);
+    if (LL_OK == i32Ret) {
+        i32Ret = TLOG_Init(DEMO_USART_UNIT);
+    }
+    m_stcCapture.u32Len = 0UL;
+
+    /* 28 of the 32 bytes queued, the fourth record is dropped */
+    TLOG("adc ch%u = %d\n", 2U, -5);
+    TLOG("idle\n");
+    TLOG("%s: %08x\n", (uint32_t)(uintptr_t)acName, 0xCAFEU);
+    TLOG("lost %u\n", 1U);
+    if ((LL_OK == i32Ret) && (1UL != TLOG_GetDropCount())) {
+        i32Ret = LL_ERR;
+    }
+    /* Once sent, the drop record goes out ahead of the next record */
+    Demo_TlogDrain();
+    TLOG("idle\n");
+    Demo_TlogDrain();
+
+    if ((LL_OK == i32Ret) && (40UL != m_stcCapture.u32Len)) {
+        i32Ret = LL_ERR;
+    }
+    if (LL_OK == i32Ret) {
+        (void)memcpy(au32Word, m_stcCapture.au8Data, m_stcCapture.u32Len);
+        if ((LL_OK != Demo_TlogCheck(au32Word, 0UL, 2UL, "adc ch%u = %d\n")) ||
+            (2UL != au32Word[1]) || ((uint32_t)-5 != au32Word[2]) ||
+            (LL_OK != Demo_TlogCheck(au32Word, 3UL, 0UL, "idle\n")) ||
+            (LL_OK != Demo_TlogCheck(au32Word, 4UL, 2UL, "%s: %08x\n")) ||
+            ((uint32_t)(uintptr_t)acName != au32Word[5]) || (0xCAFEUL != au32Word[6]) ||
+            (LL_OK != Demo_TlogCheck(au32Word, 7UL, 1UL, NULL)) || (1UL != au32Word[8]) ||
+            (LL_OK != Demo_TlogCheck(au32Word, 9UL, 0UL, "idle\n"))) {
+            i32Ret = LL_ERR;
+        }
+    }
+
+    USART_Async_DeInit(DEMO_USART_UNIT);
+    return Demo_Report("TLOG_Write", i32Ret);
+}
+
+/**
+ * @brief  Profiler: binning of the samples and histogram dump.
+ * @param  None
+ * @retval int32_t:
+ *           - LL_OK:                   Passed.
+ *           - Others:                  Failed.
+ */
+static int32_t Demo_Prof(void)
+{
+    /* 256 bytes in 64 bins: 4-byte bins */
+    static const char acDump[] = "PROF 00001000 00000002 00000040 00000006 00000002\r\n"
+                                 "00000000 00000002\r\n"
+                                 "00000001 00000001\r\n"
+                                 "0000003f 00000001\r\n"
+                                 "END\r\n";
+    static const uint32_t au32Pc[] = {
+        DEMO_PROF_TEXT, DEMO_PROF_TEXT + 2UL, DEMO_PROF_TEXT + 4UL, DEMO_PROF_TEXT + 0xFEUL,
+        DEMO_PROF_TEXT + 0x100UL, DEMO_PROF_TEXT - 2UL
+    };
+    stc_prof_init_t stcProfInit;
+    uint32_t i;
+    int32_t i32Ret;
+
+    (void)PROF_StructInit(&stcProfInit);
+    stcProfInit.u32TextStart = DEMO_PROF_TEXT;
+    stcProfInit.u32TextEnd = DEMO_PROF_TEXT + 0x100UL;
+    stcProfInit.pu16Bin = m_au16ProfBin;
+    stcProfInit.u32BinNum = DEMO_PROF_BIN_NUM;
+    stcProfInit.u16ClockDiv = TMRB_CLK_DIV16;
+    stcProfInit.u16Period = 2999U;
+    i32Ret = PROF_Init(DEMO_PROF_UNIT, &stcProfInit);
+    if ((LL_OK == i32Ret) && ((2999U != TMRB_GetPeriodValue(DEMO_PROF_UNIT)) ||
+                              (0U == READ_REG16_BIT(DEMO_PROF_UNIT->BCSTR, TMRB_INT_OVF)))) {
+        i32Ret = LL_ERR;
+    }
+
+    /* The samples of the TMRB handler, without the exception frames of the core */
+    for (i = 0UL; i < ARRAY_SZ(au32Pc); i++) {
+        PROF_AddSample(au32Pc[i]);
+    }
+    if ((LL_OK == i32Ret) && (ARRAY_SZ(au32Pc) != PROF_GetSampleCount())) {
+        i32Ret = LL_ERR;
+    }
+
+    USART_FuncCmd(DEMO_USART_UNIT, USART_TX, ENABLE);
+    m_stcCapture.u32Len = 0UL;
+    if (LL_OK == i32Ret) {
+        i32Ret = PROF_Dump(DEMO_USART_UNIT, DEMO_TIMEOUT);
+    }
+    if ((LL_OK == i32Ret) && (((sizeof(acDump) - 1U) != m_stcCapture.u32Len) ||
+                              (0 != memcmp(m_stcCapture.au8Data, acDump, m_stcCapture.u32Len)))) {
+        i32Ret = LL_ERR;
+    }
+    PROF_Clear();
+    if ((LL_OK == i32Ret) && ((0UL != PROF_GetSampleCount()) || (0U != m_au16ProfBin[0]))) {
+        i32Ret = LL_ERR;
+    }
+    return Demo_Report("PROF_Dump", i32Ret);
+}
+
+/**
+ * @brief  Set the SysTick counter: the model does not count.
+ * @param  [in] u32Cycle                Cycles since the reload
+ * @retval None
+ */
+static void Demo_StatSetTime(uint32_t u32Cycle)
+{
+    SysTick->VAL = SysTick->LOAD - u32Cycle;
+}
+
+/**
+ * @brief  Interrupt timing statistics: the handlers are played by INTC_STAT_Enter() and
+ *         INTC_STAT_Exit() with the SysTick counter set in between, the IRQ pending bits
+ *         by NVIC->ISPR.
+ * @param  None
+ * @retval int32_t:
+ *           - LL_OK:                   The statistics and the dump are as expected.
+ *           - LL_ERR:                  Otherwise.
+ */
+static int32_t Demo_IntcStat(void)
+{
+    static const char acDump[] =
+        "irq -1 exec 1 40 40 40 | 0 0 0 0 0 1 0 0 0 0 0 0 0 0 0 0\r\n"
+        "irq -1 lat 1 20 20 20 | 0 0 0 0 1 0 0 0 0 0 0 0 0 0 0 0 | unseen 0\r\n"
+        "irq 8 exec 3 41 130 300 | 0 0 0 0 0 2 0 0 1 0 0 0 0 0 0 0\r\n"
+        "irq 8 lat 0 0 0 0 | 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 0 | unseen 3\r\n"
+        "irq 9 exec 2 200 275 350 | 0 0 0 0 0 0 0 1 1 0 0 0 0 0 0 0\r\n"
+        "irq 9 lat 2 50 75 100 | 0 0 0 0 0 1 1 0 0 0 0 0 0 0 0 0 | unseen 0\r\n";
+    stc_intc_stat_t stcStat;
+    int32_t i32Ret;
+
+    i32Ret = SysTick_Init(DEMO_STAT_TICK_FREQ);
+    if (LL_OK == i32Ret) {
+        i32Ret = INTC_STAT_Init();
+    }
+    if (LL_OK == i32Ret) {
+        (void)INTC_STAT_Attach(SysTick_IRQn, &m_stcStatTick);
+        (void)INTC_STAT_Attach(INT008_IRQn, &m_stcStat008);
+        i32Ret = INTC_STAT_Attach(INT009_IRQn, &m_stcStat009);
+    }
+
+    /* IRQ008 runs 300 cycles, IRQ009 is raised meanwhile and waits 50 cycles after it */
+    Demo_StatSetTime(100UL);
+    INTC_STAT_Enter(INT008_IRQn);
+    NVIC->ISPR[0U] = 1UL << (uint32_t)INT009_IRQn;
+    Demo_StatSetTime(400UL);
+    INTC_STAT_Exit(INT008_IRQn);
+    NVIC->ISPR[0U] = 0UL;
+    Demo_StatSetTime(450UL);
+    INTC_STAT_Enter(INT009_IRQn);
+    Demo_StatSetTime(650UL);
+    INTC_STAT_Exit(INT009_IRQn);
+
+    /* IRQ009 raised while the unattached IRQ010 runs, taken 100 cycles after its entry */
+    NVIC->ISPR[0U] = 1UL << (uint32_t)INT009_IRQn;
+    Demo_StatSetTime(900UL);
+    INTC_STAT_Enter(INT010_IRQn);
+    Demo_StatSetTime(950UL);
+    INTC_STAT_Exit(INT010_IRQn);
+    NVIC->ISPR[0U] = 0UL;
+
+    /* IRQ008 nested in IRQ009 for 50 cycles, IRQ009 runs 350 cycles by itself */
+    Demo_StatSetTime(1000UL);
+    INTC_STAT_Enter(INT009_IRQn);
+    Demo_StatSetTime(1100UL);
+    INTC_STAT_Enter(INT008_IRQn);
+    Demo_StatSetTime(1150UL);
+    INTC_STAT_Exit(INT008_IRQn);
+    Demo_StatSetTime(1400UL);
+    INTC_STAT_Exit(INT009_IRQn);
+
+    /* SysTick entered 20 cycles after the reload */
+    Demo_StatSetTime(20UL);
+    INTC_STAT_Enter(SysTick_IRQn);
+    Demo_StatSetTime(60UL);
+    INTC_STAT_Exit(SysTick_IRQn);
+
+    /* IRQ008 across a reload whose SysTick interrupt is pending: 41 cycles */
+    Demo_StatSetTime(SysTick->LOAD - 10UL);
+    INTC_STAT_Enter(INT008_IRQn);
+    SCB->ICSR |= SCB_ICSR_PENDSTSET_Msk;
+    Demo_StatSetTime(30UL);
+    INTC_STAT_Exit(INT008_IRQn);
+    SCB->ICSR &= ~SCB_ICSR_PENDSTSET_Msk;
+
+    if ((LL_OK == i32Ret) && ((LL_OK != INTC_STAT_Get(INT009_IRQn, &stcStat)) ||
+                              (2UL != stcStat.stcExec.u32Count) || (275UL != INTC_STAT_GetMean(&stcStat.stcExec)) ||
+                              (2UL != stcStat.stcLatency.u32Count) || (100UL != stcStat.stcLatency.u32Max) ||
+                              (0UL != stcStat.u32Unseen))) {
+        i32Ret = LL_ERR;
+    }
+
+    USART_FuncCmd(DEMO_USART_UNIT, USART_TX, ENABLE);
+    m_stcCapture.u32Len = 0UL;
+    if (LL_OK == i32Ret) {
+        i32Ret = INTC_STAT_Dump(DEMO_USART_UNIT, DEMO_TIMEOUT);
+    }
+    if ((LL_OK == i32Ret) && (((sizeof(acDump) - 1U) != m_stcCapture.u32Len) ||
+                              (0 != memcmp(m_stcCapture.au8Data, acDump, m_stcCapture.u32Len)))) {
+        i32Ret = LL_ERR;
+    }
+
+    INTC_STAT_Clear(INT008_IRQn);
+    if ((LL_OK == i32Ret) && ((LL_OK != INTC_STAT_Get(INT008_IRQn, &stcStat)) || (0UL != stcStat.stcExec.u32Count))) {
+        i32Ret = LL_ERR;
+    }
+    INTC_STAT_Detach(SysTick_IRQn);
+    INTC_STAT_Detach(INT008_IRQn);
+    INTC_STAT_Detach(INT009_IRQn);
+    if ((LL_OK == i32Ret) && (LL_ERR_INVD_PARAM != INTC_STAT_Get(INT008_IRQn, &stcStat))) {
+        i32Ret = LL_ERR;
+    }
+    return Demo_Report("INTC_STAT_Dump", i32Ret);
+}
+
+/**
+ * @brief  Baudrate division: the run time solver against the build time initializers and
+ *         the error against a floating point reference.
+ * @param  None
+ * @retval int32_t:
+ *           - LL_OK:                   The divisions and errors match.
+ *           - LL_ERR:                  Otherwise.
+ */
+static int32_t Demo_UsartBrr(void)
+{
+    static const stc_usart_brr_t astcConst[] = {
+        USART_UART_BRR_CONST(DEMO_BRR_CLK1, 9600UL, USART_OVER_SAMPLE_16BIT),
+        USART_UART_BRR_CONST(DEMO_BRR_CLK1, 115200UL, USART_OVER_SAMPLE_8BIT),
+        USART_UART_BRR_CONST(DEMO_BRR_CLK2, 115200UL, USART_OVER_SAMPLE_16BIT),
+        USART_UART_BRR_CONST(DEMO_BRR_CLK2, 1000000UL, USART_OVER_SAMPLE_8BIT),
+    };
+    static const uint32_t au32Clk[] = {DEMO_BRR_CLK1, DEMO_BRR_CLK1, DEMO_BRR_CLK2, DEMO_BRR_CLK2};
+    static const uint32_t au32Baud[] = {9600UL, 115200UL, 115200UL, 1000000UL};
+    static const uint32_t au32Over[] = {
+        USART_OVER_SAMPLE_16BIT, USART_OVER_SAMPLE_8BIT, USART_OVER_SAMPLE_16BIT, USART_OVER_SAMPLE_8BIT
+    };
+    const uint32_t u32Over = READ_REG32_BIT(DEMO_USART_UNIT->CR1, USART_CR1_OVER8);
+    stc_usart_brr_t stcBrr;
+    float64_t f64Ppm;
+    uint32_t i;
+    int32_t i32Ret = LL_OK;
+
+    /* 8MHz / (16 * 52) for 9600 */
+    if ((51UL != astcConst[0].u32DivInteger) || (1603L != astcConst[0].i32ErrorPpm)) {
+        i32Ret = LL_ERR;
+    }
+    for (i = 0UL; (LL_OK == i32Ret) && (i < ARRAY_SZ(astcConst)); i++) {
+        USART_SetOverSampleBit(DEMO_USART_UNIT, au32Over[i]);
+        i32Ret = USART_CalculateBrr(DEMO_USART_UNIT, au32Clk[i], au32Baud[i], &stcBrr);
+        if ((LL_OK == i32Ret) && ((stcBrr.u32DivInteger != astcConst[i].u32DivInteger) ||
+                                  (stcBrr.u32DivFraction != astcConst[i].u32DivFraction) ||
+                                  (stcBrr.i32ErrorPpm != astcConst[i].i32ErrorPpm))) {
+            i32Ret = LL_ERR;
+        }
+        f64Ppm = (((float64_t)au32Clk[i] / ((float64_t)au32Baud[i] * ((USART_OVER_SAMPLE_8BIT == au32Over[i]) ? 8.0 : 16.0) *
+                                            (float64_t)(stcBrr.u32DivInteger + 1UL))) - 1.0) * 1000000.0;
+        if ((LL_OK == i32Ret) && (((f64Ppm - (float64_t)stcBrr.i32ErrorPpm) > 0.5) ||
+                                  ((f64Ppm - (float64_t)stcBrr.i32ErrorPpm) < -0.5))) {
+            i32Ret = LL_ERR;
+        }
+        if (LL_OK == i32Ret) {
+            USART_SetBrr(DEMO_USART_UNIT, &astcConst[i]);
+            if ((READ_REG32_BIT(DEMO_USART_UNIT->BRR, USART_BRR_DIV_INTEGER) >> USART_BRR_DIV_INTEGER_POS) !=
+                astcConst[i].u32DivInteger) {
+                i32Ret = LL_ERR;
+            }
+        }
+    }
+
+    /* Out of the BRR range */
+    if ((LL_OK == i32Ret) && (LL_ERR_INVD_PARAM != USART_CalculateBrr(DEMO_USART_UNIT, DEMO_BRR_CLK2, 300UL, &stcBrr))) {
+        i32Ret = LL_ERR;
+    }
+
+    USART_SetOverSampleBit(DEMO_USART_UNIT, u32Over);
+    return Demo_Report("USART_CalculateBrr", i32Ret);
+}
+
+/**
+ * @brief  GPIO fast path: the model has no GPIO, the stores land in the register file and
+ *         the bit-band accesses in the bits of PODR/PIDR.
+ * @param  None
+ * @retval int32_t:
+ *           - LL_OK:                   The registers are as expected.
+ *           - LL_ERR:                  Otherwise.
+ */
+static int32_t Demo_GpioFast(void)
+{
+    __IO uint8_t *PODR = (__IO uint8_t *)&CM_GPIO->PODR12;
+    __IO uint8_t *PIDR = (__IO uint8_t *)&CM_GPIO->PIDR2;
+    int32_t i32Ret = LL_OK;
+
+    GPIO_FAST_TogglePins(GPIO_PORT_2, GPIO_PIN_05 | GPIO_PIN_07);
+    GPIO_FAST_SetPins(GPIO_PORT_13, GPIO_PIN_01);
+    GPIO_FAST_ResetPins(GPIO_PORT_0, GPIO_PIN_ALL);
+    if ((0xA0U != READ_REG8(CM_GPIO->POTR2)) || (0x02U != READ_REG8(CM_GPIO->POSR13)) ||
+        (0xFFU != READ_REG8(CM_GPIO->PORR0))) {
+        i32Ret = LL_ERR;
+    }
+
+    /* One pin written, the others kept */
+    WRITE_REG8(*PODR, 0x81U);
+    GPIO_FAST_WritePin(GPIO_PORT_12, GPIO_PIN_06, PIN_SET);
+    GPIO_FAST_WritePin(GPIO_PORT_12, GPIO_PIN_00, PIN_RESET);
+    if ((LL_OK == i32Ret) && ((0xC0U != READ_REG8(*PODR)) ||
+                              (PIN_SET != GPIO_FAST_ReadOutputPin(GPIO_PORT_12, GPIO_PIN_07)) ||
+                              (PIN_RESET != GPIO_FAST_ReadOutputPin(GPIO_PORT_12, GPIO_PIN_00)))) {
+        i32Ret = LL_ERR;
+    }
+
+    WRITE_REG8(*PIDR, 0x10U);
+    if ((LL_OK == i32Ret) && ((PIN_SET != GPIO_FAST_ReadInputPin(GPIO_PORT_2, GPIO_PIN_04)) ||
+                              (PIN_RESET != GPIO_FAST_ReadInputPin(GPIO_PORT_2, GPIO_PIN_03)) ||
+                              (GPIO_ReadInputPins(GPIO_PORT_2, GPIO_PIN_04) != GPIO_FAST_ReadInputPin(GPIO_PORT_2, GPIO_PIN_04)))) {
+        i32Ret = LL_ERR;
+    }
+    return Demo_Report("GPIO_FAST", i32Ret);
+}
+
+/**
+ * @brief  Pin configuration table: same PCR as GPIO_Init() and GPIO_SetFunc().
+ * @param  None
+ * @retval int32_t:
+ *           - LL_OK:                   The registers are as expected.
+ *           - LL_ERR:                  Otherwise.
+ */
+static int32_t Demo_GpioTable(void)
+{
+    static const stc_gpio_pin_cfg_t astcPinCfg[] = {
+        GPIO_PIN_CFG(GPIO_PORT_6, GPIO_PIN_00 | GPIO_PIN_02, GPIO_FUNC_3,
+                     PIN_DIR_OUT | PIN_STAT_SET | PIN_PU_ON | PIN_HIGH_DRV),
+        GPIO_PIN_CFG(GPIO_PORT_7, GPIO_PIN_03, GPIO_FUNC_0, PIN_EXTINT_ON | PIN_IN_TYPE_CMOS),
+    };
+    stc_gpio_init_t stcGpioInit;
+    uint16_t au16Pcr[3];
+    int32_t i32Ret = LL_OK;
+
+    GPIO_REG_Unlock();
+    WRITE_REG16(CM_GPIO->PCR61, 0x1234U);
+    (void)GPIO_StructInit(&stcGpioInit);
+    stcGpioInit.u16PinDir = PIN_DIR_OUT;
+    stcGpioInit.u16PinState = PIN_STAT_SET;
+    stcGpioInit.u16PullUp = PIN_PU_ON;
+    stcGpioInit.u16PinDrv = PIN_HIGH_DRV;
+    (void)GPIO_Init(GPIO_PORT_6, GPIO_PIN_00 | GPIO_PIN_02, &stcGpioInit);
+    GPIO_SetFunc(GPIO_PORT_6, GPIO_PIN_00 | GPIO_PIN_02, GPIO_FUNC_3);
+    (void)GPIO_StructInit(&stcGpioInit);
+    stcGpioInit.u16ExtInt = PIN_EXTINT_ON;
+    stcGpioInit.u16PinInputType = PIN_IN_TYPE_CMOS;
+    (void)GPIO_Init(GPIO_PORT_7, GPIO_PIN_03, &stcGpioInit);
+    au16Pcr[0] = READ_REG16(CM_GPIO->PCR60);
+    au16Pcr[1] = READ_REG16(CM_GPIO->PCR62);
+    au16Pcr[2] = READ_REG16(CM_GPIO->PCR73);
+
+    WRITE_REG16(CM_GPIO->PCR60, 0U);
+    WRITE_REG16(CM_GPIO->PCR62, 0U);
+    WRITE_REG16(CM_GPIO->PCR73, 0U);
+    if ((LL_OK != GPIO_InitTable(astcPinCfg, ARRAY_SZ(astcPinCfg))) ||
+        (au16Pcr[0] != READ_REG16(CM_GPIO->PCR60)) || (au16Pcr[1] != READ_REG16(CM_GPIO->PCR62)) ||
+        (au16Pcr[2] != READ_REG16(CM_GPIO->PCR73)) || (0x1234U != READ_REG16(CM_GPIO->PCR61)) ||
+        (LL_ERR_INVD_PARAM != GPIO_InitTable(NULL, 1UL))) {
+        i32Ret = LL_ERR;
+    }
+    GPIO_REG_Lock();
+    return Demo_Report("GPIO_InitTable", i32Ret);
+}
+
+/**
+ * @brief  SPI slave of the SPI queue case, logs each frame with the chip selects and
+ *         the word size.
+ * @param  [in] u32Mosi                 Frame sent by the master
+ * @param  [in] pvArg                   Unused
+ * @retval Frame returned on MISO
+ */
+static uint32_t Demo_SpiIntSlave(uint32_t u32Mosi, void *pvArg)
+{
+    uint32_t u32Cs = SIM_REG8(&CM_GPIO->PODR2) & DEMO_SPI_INT_CS_ALL;
+    uint32_t u32Size = SIM_REG32(&CM_SPI->CFG2) & SPI_CFG2_DSIZE;
+
+    (void)pvArg;
+    if (m_u32SpiIntLogLen < DEMO_SPI_INT_LOG_LEN) {
+        m_au32SpiIntLog[m_u32SpiIntLogLen++] = u32Mosi | (u32Cs << 16U) | (u32Size << 16U);
+    }
+    return u32Mosi ^ 0xA5A5UL;
+}
+
+/**
+ * @brief  SPI queue completion callback, traces the pvUserData character.
+ * @param  [in] pstcTrans               Ended phase
+ * @retval None
+ */
+static void Demo_SpiIntCallback(stc_spi_int_trans_t *pstcTrans)
+{
+    if (m_u32SpiIntTraceLen < DEMO_SPI_INT_TRACE_LEN) {
+        m_acSpiIntTrace[m_u32SpiIntTraceLen++] = (LL_OK == pstcTrans->i32Result) ?
+                                                 *(const char *)pstcTrans->pvUserData : 'x';
+    }
+}
+
+/**
+ * @brief  SPI transaction queue: a command then data transaction for an 8-bit device queued
+ *         with a 16-bit one, the SPRI IRQ is served by polling RDFF.
+ * @param  None
+ * @retval int32_t:
+ *           - LL_OK:                   The frames, chip selects and callbacks are as expected.
+ *           - LL_ERR:                  Otherwise.
+ */
+static int32_t Demo_SpiInt(void)
+{
+    static const stc_spi_int_dev_t stcDevA = {
+        SPI_MD_0, SPI_BR_CLK_DIV8, SPI_DATA_SIZE_8BIT, SPI_FIRST_MSB, DEMO_SPI_INT_CS_PORT, DEMO_SPI_INT_CS_A
+    };
+    static const stc_spi_int_dev_t stcDevB = {
+        SPI_MD_3, SPI_BR_CLK_DIV2, SPI_DATA_SIZE_16BIT, SPI_FIRST_MSB, DEMO_SPI_INT_CS_PORT, DEMO_SPI_INT_CS_B
+    };
+    static const uint8_t au8Cmd[1] = {0x9FU};
+    static const uint16_t au16Tx[2] = {0x1234U, 0xABCDU};
+    /* Frame | chip selects << 16 | DSIZE << 16 */
+    static const uint32_t au32Expect[6] = {
+        0x0040009FUL, 0x004000FFUL, 0x004000FFUL, 0x004000FFUL, 0x01201234UL, 0x0120ABCDUL
+    };
+    stc_spi_int_trans_t stcCmd;
+    stc_spi_int_trans_t stcData;
+    stc_spi_int_trans_t stcWord;
+    uint8_t au8Id[3] = {0U};
+    uint16_t au16Rx[2] = {0U};
+    int32_t i32Ret = LL_OK;
+
+    m_u32SpiIntLogLen = 0UL;
+    m_u32SpiIntTraceLen = 0UL;
+    GPIO_FAST_WritePin(DEMO_SPI_INT_CS_PORT, DEMO_SPI_INT_CS_A, PIN_SET);
+    GPIO_FAST_WritePin(DEMO_SPI_INT_CS_PORT, DEMO_SPI_INT_CS_B, PIN_SET);
+    SPI_LoopbackModeConfig(DEMO_SPI_UNIT, SPI_LOOPBACK_INVD);
+    SIM_SPI_SetSlave(&Demo_SpiIntSlave, NULL);
+    (void)SPI_Int_Init(DEMO_SPI_UNIT);
+
+    (void)SPI_Int_TransStructInit(&stcCmd);
+    (void)SPI_Int_TransStructInit(&stcData);
+    (void)SPI_Int_TransStructInit(&stcWord);
+    stcCmd.pstcDev = &stcDevA;
+    stcCmd.pvTxBuf = au8Cmd;
+    stcCmd.u32Len = 1UL;
+    stcCmd.pstcChain = &stcData;
+    stcCmd.pfnCallback = &Demo_SpiIntCallback;
+    stcCmd.pvUserData = "c";
+    stcData.pvRxBuf = au8Id;
+    stcData.u32Len = 3UL;
+    stcData.pfnCallback = &Demo_SpiIntCallback;
+    stcData.pvUserData = "d";
+    stcWord.pstcDev = &stcDevB;
+    stcWord.pvTxBuf = au16Tx;
+    stcWord.pvRxBuf = au16Rx;
+    stcWord.u32Len = 2UL;
+    stcWord.pfnCallback = &Demo_SpiIntCallback;
+    stcWord.pvUserData = "w";
+
+    if ((LL_OK != SPI_Int_Submit(DEMO_SPI_UNIT, &stcCmd)) || (LL_OK != SPI_Int_Submit(DEMO_SPI_UNIT, &stcWord)) ||
+        (LL_ERR_BUSY != SPI_Int_Submit(DEMO_SPI_UNIT, &stcCmd))) {
+        i32Ret = LL_ERR;
+    }
+    while ((LL_OK == i32Ret) && (SET == SPI_Int_GetBusy(DEMO_SPI_UNIT))) {
+        if (SET == SPI_GetStatus(DEMO_SPI_UNIT, SPI_FLAG_RX_BUF_FULL)) {
+            SPI_Int_RxIrqHandler(DEMO_SPI_UNIT);
+        }
+    }
+    if ((LL_OK == i32Ret) &&
+        ((m_u32SpiIntLogLen != ARRAY_SZ(au32Expect)) ||
+         (0 != memcmp(m_au32SpiIntLog, au32Expect, sizeof(au32Expect))) ||
+         (0 != memcmp(m_acSpiIntTrace, "cdw", 3U)) ||
+         (au8Id[0] != 0x5AU) || (au16Rx[0] != (0x1234U ^ 0xA5A5U)) || (au16Rx[1] != (0xABCDU ^ 0xA5A5U)) ||
+         (DEMO_SPI_INT_CS_ALL != (READ_REG8(CM_GPIO->PODR2) & DEMO_SPI_INT_CS_ALL)))) {
+        i32Ret = LL_ERR;
+    }
+
+    /* Aborted with the command sent: the data phase times out, the chip select is released */
+    if ((LL_OK == i32Ret) && (LL_OK == SPI_Int_Submit(DEMO_SPI_UNIT, &stcCmd))) {
+        SPI_Int_RxIrqHandler(DEMO_SPI_UNIT);
+        SPI_Int_Abort(DEMO_SPI_UNIT);
+        if ((LL_OK != stcCmd.i32Result) || (LL_ERR_TIMEOUT != stcData.i32Result) ||
+            (0 != memcmp(m_acSpiIntTrace, "cdwcx", 5U)) || (RESET != SPI_Int_GetBusy(DEMO_SPI_UNIT)) ||
+            (DEMO_SPI_INT_CS_ALL != (READ_REG8(CM_GPIO->PODR2) & DEMO_SPI_INT_CS_ALL))) {
+            i32Ret = LL_ERR;
+        }
+    }
+
+    SPI_Int_DeInit(DEMO_SPI_UNIT);
+    SIM_SPI_SetSlave(NULL, NULL);
+    return Demo_Report("SPI_Int_Submit", i32Ret);
+}
+
+/**
+ * @brief  SysTick handler of the timebase case.
+ * @param  None
+ * @retval None
+ */
+static void Demo_SysTickHandler(void)
+{
+    SysTick_IncTick();
+}
+
+/**
+ * @brief  Check SysTick_GetMicros() against the model cycles over a number of them.
+ * @param  [in] u32CyclePerRead         Cycles of an SCS read
+ * @param  [in] u32CyclePerUs           HCLK cycles per microsecond
+ * @param  [in] u32Cycle                Cycles to run for
+ * @retval int32_t:
+ *           - LL_OK:                   Never went back, never further from the cycles
+ *                                      than the reads of one call.
+ *           - LL_ERR:                  Failed.
+ */
+static int32_t Demo_SysTickMicros(uint32_t u32CyclePerRead, uint32_t u32CyclePerUs, uint32_t u32Cycle)
+{
+    const int32_t i32Tol = (int32_t)((DEMO_TICK_READ_MAX * u32CyclePerRead) / u32CyclePerUs) + 2;
+    uint64_t u64Start;
+    uint64_t u64Now;
+    uint32_t u32Start;
+    uint32_t u32Prev;
+    uint32_t u32Micros;
+    int32_t i32Err;
+    int32_t i32Ret = LL_OK;
+
+    u32Start = SysTick_GetMicros();
+    u64Start = SIM_SYSTICK_GetCycle();
+    u32Prev = u32Start;
+    do {
+        u32Micros = SysTick_GetMicros();
+        u64Now = SIM_SYSTICK_GetCycle();
+        i32Err = (int32_t)((u32Micros - u32Start) - (uint32_t)((u64Now - u64Start) / u32CyclePerUs));
+        if (((int32_t)(u32Micros - u32Prev) < 0) || (i32Err < -i32Tol) || (i32Err > i32Tol)) {
+            i32Ret = LL_ERR;
+        }
+        u32Prev = u32Micros;
+    } while ((LL_OK == i32Ret) && ((u64Now - u64Start) < u32Cycle));
+    return i32Ret;
+}
+
+/**
+ * @brief  Check the HCLK cycles a timebase call takes.
+ * @param  [in] u64Start                Model cycles before the call
+ * @param  [in] u32Min                  Fewest cycles
+ * @param  [in] u32Max                  Most cycles
+ * @retval int32_t:
+ *           - LL_OK:                   Within.
+ *           - LL_ERR:                  Not within.
+ */
+static int32_t Demo_SysTickElapsed(uint64_t u64Start, uint32_t u32Min, uint32_t u32Max)
+{
+    const uint64_t u64Elapsed = SIM_SYSTICK_GetCycle() - u64Start;
+
+    return ((u64Elapsed >= u32Min) && (u64Elapsed <= u32Max)) ? LL_OK : LL_ERR;
+}
+
+/**
+ * @brief  SysTick timebase on the SysTick model: SysTick_GetMicros() with the tick
+ *         pending while it reads the counter, with interrupts enabled and disabled,
+ *         SysTick_SleepUntil() over the wrap of the timestamp, and zero and very
+ *         short DDL_DelayUS() and SysTick_SleepUntil() waits, the latter also with
+ *         interrupts disabled.
+ * @param  None
+ * @retval int32_t:
+ *           - LL_OK:                   Passed.
+ *           - Others:                  Failed.
+ */
+static int32_t Demo_SysTick(void)
+{
+    /* Prime to the SysTick period, the tick falls between every pair of reads in turn */
+    const uint32_t au32CyclePerRead[] = {13UL, 97UL, 331UL};
+    uint32_t u32CyclePerUs;
+    uint32_t u32Period;
+    uint32_t u32Step;
+    uint32_t u32Now;
+    uint64_t u64Start;
+    uint32_t i;
+    int32_t i32Ret;
+
+    SystemCoreClockUpdate();
+    u32CyclePerUs = HCLK_VALUE / 1000000UL;
+    u32Period = HCLK_VALUE / DEMO_TICK_FREQ;
+    i32Ret = SIM_SYSTICK_Init();
+    if (LL_OK == i32Ret) {
+        SIM_SetSysTickHandler(&Demo_SysTickHandler);
+        SIM_SYSTICK_SetCycle(au32CyclePerRead[0]);
+        i32Ret = SysTick_Init(DEMO_TICK_FREQ);
+    }
+
+    /* Interrupts enabled: taken between the reads. Disabled for less than a tick: pending */
+    for (i = 0UL; (i < ARRAY_SZ(au32CyclePerRead)) && (LL_OK == i32Ret); i++) {
+        u32Step = au32CyclePerRead[i];
+        SIM_SYSTICK_SetCycle(u32Step);
+        i32Ret = Demo_SysTickMicros(u32Step, u32CyclePerUs, 3UL * u32Period);
+        if (LL_OK == i32Ret) {
+            __disable_irq();
+            i32Ret = Demo_SysTickMicros(u32Step, u32CyclePerUs, u32Period - (DEMO_TICK_READ_MAX * u32Step));
+            __enable_irq();
+        }
+        if (LL_OK == i32Ret) {
+            i32Ret = Demo_SysTickMicros(u32Step, u32CyclePerUs, u32Period);
+        }
+    }
+    (void)Demo_Report("SysTick_GetMicros", i32Ret);
+
+    if (LL_OK == i32Ret) {
+        /* A few ticks before the microsecond timestamp wraps */
+        u32Step = au32CyclePerRead[1];
+        SIM_SYSTICK_SetCycle(u32Step);
+        while (SysTick_GetTick() < ((0xFFFFFFFFUL / 1000UL) - 3UL)) {
+            SysTick_IncTick();
+        }
+        /* At least the time to the deadline, less the truncation of the timestamp */
+        u32Now = SysTick_GetMicros();
+        u64Start = SIM_SYSTICK_GetCycle();
+        SysTick_SleepUntil(u32Now + DEMO_TICK_SLEEP_US);
+        i32Ret = Demo_SysTickElapsed(u64Start, (DEMO_TICK_SLEEP_US - 1UL) * u32CyclePerUs,
+                                     (DEMO_TICK_SLEEP_US * u32CyclePerUs) + (DEMO_TICK_READ_MAX * u32Step));
+        if ((LL_OK == i32Ret) && (SysTick_GetMicros() > u32Now)) {
+            /* Did not wrap */
+            i32Ret = LL_ERR;
+        }
+        (void)Demo_Report("SysTick_SleepUntil", i32Ret);
+    }
+
+    if (LL_OK == i32Ret) {
+        u64Start = SIM_SYSTICK_GetCycle();
+        DDL_DelayUS(0UL);
+        i32Ret = Demo_SysTickElapsed(u64Start, 0UL, DEMO_TICK_READ_MAX * u32Step);
+        for (i = 1UL; (i <= 3UL) && (LL_OK == i32Ret); i++) {
+            u64Start = SIM_SYSTICK_GetCycle();
+            DDL_DelayUS(i);
+            i32Ret = Demo_SysTickElapsed(u64Start, i * u32CyclePerUs,
+                                         (i * u32CyclePerUs) + (DEMO_TICK_READ_MAX * u32Step));
+        }
+        /* Over the reload of the counter, in millisecond parts */
+        if (LL_OK == i32Ret) {
+            u64Start = SIM_SYSTICK_GetCycle();
+            DDL_DelayUS(DEMO_TICK_DELAY_US);
+            i32Ret = Demo_SysTickElapsed(u64Start, DEMO_TICK_DELAY_US * u32CyclePerUs,
+                                         (DEMO_TICK_DELAY_US * u32CyclePerUs) + (2UL * DEMO_TICK_READ_MAX * u32Step));
+        }
+        /* Deadline now, already passed, and a few microseconds ahead */
+        if (LL_OK == i32Ret) {
+            u32Now = SysTick_GetMicros();
+            u64Start = SIM_SYSTICK_GetCycle();
+            SysTick_SleepUntil(u32Now);
+            SysTick_SleepUntil(u32Now - 5UL);
+            i32Ret = Demo_SysTickElapsed(u64Start, 0UL, 2UL * DEMO_TICK_READ_MAX * u32Step);
+        }
+        /* Ticks ahead with interrupts disabled: no tick would end the sleep */
+        if (LL_OK == i32Ret) {
+            __disable_irq();
+            u32Now = SysTick_GetMicros();
+            u64Start = SIM_SYSTICK_GetCycle();
+            SysTick_SleepUntil(u32Now + DEMO_TICK_SLEEP_US);
+            i32Ret = Demo_SysTickElapsed(u64Start, 0UL, DEMO_TICK_READ_MAX * u32Step);
+            __enable_irq();
+        }
+        if (LL_OK == i32Ret) {
+            u32Now = SysTick_GetMicros();
+            u64Start = SIM_SYSTICK_GetCycle();
+            SysTick_SleepUntil(u32Now + 3UL);
+            i32Ret = Demo_SysTickElapsed(u64Start, 2UL * u32CyclePerUs,
+                                         (3UL * u32CyclePerUs) + (DEMO_TICK_READ_MAX * u32Step));
+        }
+        (void)Demo_Report("DDL_DelayUS", i32Ret);
+    }
+
+    SIM_SYSTICK_SetCycle(0UL);
+    SysTick->CTRL = 0UL;
+    SCB->ICSR = 0UL;
+    SIM_SetSysTickHandler(NULL);
+    return i32Ret;
+}
+
+/**
+ * @brief  One-shot CRC of a buffer with CRC_AccumulateData8().
+ * @param  [in] u32Protocol             CRC protocol
+ * @param  [in] u32InitValue            Initial value
+ * @param  [in] au8Data                 Data
+ * @param  [in] u32Len                  Length in bytes
+ * @retval CRC value
+ */
+static uint32_t Demo_CrcOneShot(uint32_t u32Protocol, uint32_t u32InitValue, const uint8_t au8Data[], uint32_t u32Len)
+{
+    stc_crc_init_t stcCrcInit;
+
+    stcCrcInit.u32Protocol = u32Protocol;
+    stcCrcInit.u32InitValue = u32InitValue;
+    (void)CRC_Init(&stcCrcInit);
+    return CRC_AccumulateData8(au8Data, u32Len);
+}
+
+/**
+ * @brief  CRC contexts: a CRC32 and a CRC16 stream at odd addresses fed in turns, in
+ *         chunks of odd sizes that leave every alignment at the start and the end
+ *         of a chunk. Each must equal the CRC_AccumulateData8() of its whole data.
+ * @param  None
+ * @retval int32_t:
+ *           - LL_OK:                   Passed.
+ *           - Others:                  Failed.
+ */
+static int32_t Demo_CrcContext(void)
+{
+    const uint8_t au8ChunkLen[] = {1U, 3U, 7U, 2U, 5U, 13U, 0U, 4U, 11U, 6U, 9U, 31U};
+    uint8_t *pu8A = &((uint8_t *)m_au32CrcBuf)[1U];
+    uint8_t *pu8B = &((uint8_t *)m_au32CrcBuf)[DEMO_CRC_LEN_A + 6UL];
+    stc_crc_context_t stcCtxA;
+    stc_crc_context_t stcCtxB;
+    uint32_t u32PosA = 0UL;
+    uint32_t u32PosB = 0UL;
+    uint32_t u32Len;
+    uint32_t u32Seed = 0x2545F491UL;
+    uint32_t i;
+    int32_t i32Ret = LL_OK;
+
+    FCG_Fcg0PeriphClockCmd(DEMO_CRC_FCG, ENABLE);
+    for (i = 0UL; i < sizeof(m_au32CrcBuf); i++) {
+        u32Seed = (u32Seed * 1103515245UL) + 12345UL;
+        ((uint8_t *)m_au32CrcBuf)[i] = (uint8_t)(u32Seed >> 16U);
+    }
+
+    /* The check values of the protocols, the one-shot CRC is the reference */
+    if ((0x906EUL != Demo_CrcOneShot(CRC_CRC16, CRC16_INIT_VALUE, (const uint8_t *)"123456789", 9UL)) ||
+        (0xCBF43926UL != Demo_CrcOneShot(CRC_CRC32, CRC32_INIT_VALUE, (const uint8_t *)"123456789", 9UL))) {
+        i32Ret = LL_ERR;
+    }
+
+    if (LL_OK == i32Ret) {
+        (void)CRC_ContextInit(&stcCtxA, CRC_CRC32, CRC32_INIT_VALUE);
+        (void)CRC_ContextInit(&stcCtxB, CRC_CRC16, CRC16_INIT_VALUE);
+        for (i = 0UL; (u32PosA < DEMO_CRC_LEN_A) || (u32PosB < DEMO_CRC_LEN_B); i++) {
+            u32Len = au8ChunkLen[i % ARRAY_SZ(au8ChunkLen)];
+            if (u32Len > (DEMO_CRC_LEN_A - u32PosA)) {
+                u32Len = DEMO_CRC_LEN_A - u32PosA;
+            }
+            (void)CRC_ContextUpdate(&stcCtxA, &pu8A[u32PosA], u32Len);
+            u32PosA += u32Len;
+
+            u32Len = au8ChunkLen[(i + 5UL) % ARRAY_SZ(au8ChunkLen)];
+            if (u32Len > (DEMO_CRC_LEN_B - u32PosB)) {
+                u32Len = DEMO_CRC_LEN_B - u32PosB;
+            }
+            (void)CRC_ContextUpdate(&stcCtxB, &pu8B[u32PosB], u32Len);
+            u32PosB += u32Len;
+        }
+        if ((CRC_ContextGetValue(&stcCtxA) != Demo_CrcOneShot(CRC_CRC32, CRC32_INIT_VALUE, pu8A, DEMO_CRC_LEN_A)) ||
+            (CRC_ContextGetValue(&stcCtxB) != Demo_CrcOneShot(CRC_CRC16, CRC16_INIT_VALUE, pu8B, DEMO_CRC_LEN_B))) {
+            i32Ret = LL_ERR;
+        }
+    }
+    (void)Demo_Report("CRC_ContextUpdate", i32Ret);
+    CRC_DeInit();
+    FCG_Fcg0PeriphClockCmd(DEMO_CRC_FCG, DISABLE);
+    return i32Ret;
+}
+
+/**
+ * @brief  I2C slave of the I2C queue case, a memory with an address pointer set by the
+ *         first byte written. Logs the bus: S (re)start, W/R address ACKed, N NACK of the
+ *         slave, w byte written, a/n byte read with ACK/NACK of the master, P stop.
+ * @param  [in] u32Event                Bus event
+ * @param  [in] u32Data                 Event data
+ * @param  [in] pvArg                   Unused
+ * @retval ACK, NACK or the byte read
+ */
+static uint32_t Demo_I2cIntSlave(uint32_t u32Event, uint32_t u32Data, void *pvArg)
+{
+    uint32_t u32Ret = SIM_I2C_ACK;
+    char cLog;
+
+    (void)pvArg;
+    if (SIM_I2C_EVT_START == u32Event) {
+        cLog = 'S';
+    } else if (SIM_I2C_EVT_ADDR == u32Event) {
+        if (DEMO_I2C_INT_ADDR != (u32Data >> 1U)) {
+            u32Ret = SIM_I2C_NACK;
+            cLog = 'N';
+        } else {
+            m_u8I2cIntPtrSet = 0U;
+            cLog = (0UL != (u32Data & 1UL)) ? 'R' : 'W';
+        }
+    } else if (SIM_I2C_EVT_WRITE == u32Event) {
+        if (0U == m_u8I2cIntPtrSet) {
+            m_u32I2cIntPtr = u32Data;
+            m_u8I2cIntPtrSet = 1U;
+            cLog = 'w';
+        } else if (m_u32I2cIntPtr < DEMO_I2C_INT_MEM_SIZE) {
+            m_au8I2cIntMem[m_u32I2cIntPtr++] = (uint8_t)u32Data;
+            cLog = 'w';
+        } else {
+            u32Ret = SIM_I2C_NACK;
+            cLog = 'N';
+        }
+    } else if (SIM_I2C_EVT_READ == u32Event) {
+        u32Ret = m_au8I2cIntMem[m_u32I2cIntPtr % DEMO_I2C_INT_MEM_SIZE];
+        m_u32I2cIntPtr++;
+        cLog = (SIM_I2C_ACK == u32Data) ? 'a' : 'n';
+    } else {
+        cLog = 'P';
+    }
+    if (m_u32I2cIntLogLen < DEMO_I2C_INT_LOG_LEN) {
+        m_acI2cIntLog[m_u32I2cIntLogLen++] = cLog;
+    }
+    return u32Ret;
+}
+
+/**
+ * @brief  I2C queue completion callback, traces the pvUserData character.
+ * @param  [in] pstcTrans               Ended transaction
+ * @retval None
+ */
+static void Demo_I2cIntCallback(stc_i2c_int_trans_t *pstcTrans)
+{
+    if (m_u32I2cIntTraceLen < DEMO_I2C_INT_TRACE_LEN) {
+        m_acI2cIntTrace[m_u32I2cIntTraceLen++] = (LL_OK == pstcTrans->i32Result) ?
+                                                 *(const char *)pstcTrans->pvUserData : 'x';
+    }
+}
+
+/**
+ * @brief  Serve the I2C IRQs by polling the flags until the queue is empty.
+ * @param  None
+ * @retval None
+ */
+static void Demo_I2cIntPoll(void)
+{
+    uint32_t u32Status;
+    uint32_t u32Count = 0UL;
+
+    while ((SET == I2C_Int_GetBusy(DEMO_I2C_UNIT)) && (u32Count < DEMO_I2C_INT_POLL_MAX)) {
+        /* The SR event flags and their CR2 interrupt enable bits share the same positions */
+        u32Status = READ_REG32(DEMO_I2C_UNIT->SR) & READ_REG32(DEMO_I2C_UNIT->CR2);
+        if (0UL != (u32Status & (I2C_FLAG_START | I2C_FLAG_STOP | I2C_FLAG_NACKF | I2C_FLAG_ARBITRATE_FAIL))) {
+            I2C_Int_EeiIrqHandler(DEMO_I2C_UNIT);
+        } else if (0UL != (u32Status & I2C_FLAG_RX_FULL)) {
+            I2C_Int_RxiIrqHandler(DEMO_I2C_UNIT);
+        } else if (0UL != (u32Status & I2C_FLAG_TX_EMPTY)) {
+            I2C_Int_TxiIrqHandler(DEMO_I2C_UNIT);
+        } else if (0UL != (u32Status & I2C_FLAG_TX_CPLT)) {
+            I2C_Int_TeiIrqHandler(DEMO_I2C_UNIT);
+        } else {
+            /* Bus event in progress */
+        }
+        u32Count++;
+    }
+}
+
+/**
+ * @brief  I2C transaction queue: a write, a write then read and a single byte read queued
+ *         together, then a write to an absent device and a write NACKed at the end of the
+ *         slave memory queued before a write then read. The IRQs are served by polling
+ *         the flags.
+ * @param  None
+ * @retval int32_t:
+ *           - LL_OK:                   The bus events, data and callbacks are as expected.
+ *           - LL_ERR:                  Otherwise.
+ */
+static int32_t Demo_I2cInt(void)
+{
+    static const uint8_t au8Write[4] = {0x02U, 0x11U, 0x22U, 0x33U};
+    static const uint8_t au8Ptr[1] = {0x02U};
+    static const uint8_t au8Over[3] = {0x07U, 0xAAU, 0xBBU};
+    static const uint8_t au8Expect[3] = {0x11U, 0x22U, 0x33U};
+    stc_i2c_init_t stcI2cInit;
+    stc_i2c_int_trans_t stcWrite;
+    stc_i2c_int_trans_t stcRead;
+    stc_i2c_int_trans_t stcOne;
+    stc_i2c_int_trans_t stcNoDev;
+    stc_i2c_int_trans_t stcOver;
+    uint8_t au8Rx[3] = {0U};
+    uint8_t au8One[1] = {0U};
+    uint32_t i;
+    int32_t i32Ret;
+
+    FCG_Fcg0PeriphClockCmd(DEMO_I2C_FCG, ENABLE);
+    for (i = 0UL; i < DEMO_I2C_INT_MEM_SIZE; i++) {
+        m_au8I2cIntMem[i] = (uint8_t)(0xC0UL | i);
+    }
+    m_u32I2cIntLogLen = 0UL;
+    m_u32I2cIntTraceLen = 0UL;
+    SIM_I2C_SetSlave(&Demo_I2cIntSlave, NULL);
+    (void)I2C_StructInit(&stcI2cInit);
+    /* 40 clocks per bit from the HCLK of 32MHz */
+    stcI2cInit.u32Baudrate = 100000UL;
+    stcI2cInit.u32ClockDiv = I2C_CLK_DIV8;
+    i32Ret = I2C_Init(DEMO_I2C_UNIT, &stcI2cInit, NULL);
+    if (LL_OK == i32Ret) {
+        (void)I2C_Int_Init(DEMO_I2C_UNIT);
+    }
+
+    (void)I2C_Int_TransStructInit(&stcWrite);
+    (void)I2C_Int_TransStructInit(&stcRead);
+    (void)I2C_Int_TransStructInit(&stcOne);
+    (void)I2C_Int_TransStructInit(&stcNoDev);
+    (void)I2C_Int_TransStructInit(&stcOver);
+    stcWrite.u16SlaveAddr = DEMO_I2C_INT_ADDR;
+    stcWrite.pu8TxBuf = au8Write;
+    stcWrite.u32TxLen = 4UL;
+    stcWrite.pfnCallback = &Demo_I2cIntCallback;
+    stcWrite.pvUserData = "w";
+    stcRead.u16SlaveAddr = DEMO_I2C_INT_ADDR;
+    stcRead.pu8TxBuf = au8Ptr;
+    stcRead.u32TxLen = 1UL;
+    stcRead.pu8RxBuf = au8Rx;
+    stcRead.u32RxLen = 3UL;
+    stcRead.pfnCallback = &Demo_I2cIntCallback;
+    stcRead.pvUserData = "r";
+    stcOne.u16SlaveAddr = DEMO_I2C_INT_ADDR;
+    stcOne.pu8RxBuf = au8One;
+    stcOne.u32RxLen = 1UL;
+    stcOne.pfnCallback = &Demo_I2cIntCallback;
+    stcOne.pvUserData = "o";
+    stcNoDev.u16SlaveAddr = DEMO_I2C_INT_ADDR + 1U;
+    stcNoDev.pu8TxBuf = au8Ptr;
+    stcNoDev.u32TxLen = 1UL;
+    stcNoDev.pfnCallback = &Demo_I2cIntCallback;
+    stcNoDev.pvUserData = "a";
+    stcOver.u16SlaveAddr = DEMO_I2C_INT_ADDR;
+    stcOver.pu8TxBuf = au8Over;
+    stcOver.u32TxLen = 3UL;
+    stcOver.pfnCallback = &Demo_I2cIntCallback;
+    stcOver.pvUserData = "b";
+
+    if ((LL_OK == i32Ret) &&
+        ((LL_OK != I2C_Int_Submit(DEMO_I2C_UNIT, &stcWrite)) || (LL_OK != I2C_Int_Submit(DEMO_I2C_UNIT, &stcRead)) ||
+         (LL_OK != I2C_Int_Submit(DEMO_I2C_UNIT, &stcOne)) || (LL_ERR_BUSY != I2C_Int_Submit(DEMO_I2C_UNIT, &stcRead)))) {
+        i32Ret = LL_ERR;
+    }
+    if (LL_OK == i32Ret) {
+        Demo_I2cIntPoll();
+        /* The single byte read is NACKed before it is received */
+        if ((RESET != I2C_Int_GetBusy(DEMO_I2C_UNIT)) ||
+            (m_u32I2cIntLogLen != 20UL) || (0 != memcmp(m_acI2cIntLog, "SWwwwwPSWwSRaanPSRnP", 20U)) ||
+            (m_u32I2cIntTraceLen != 3UL) || (0 != memcmp(m_acI2cIntTrace, "wro", 3U)) ||
+            (0 != memcmp(&m_au8I2cIntMem[2], au8Expect, 3U)) || (0 != memcmp(au8Rx, au8Expect, 3U)) ||
+            (au8One[0] != 0xC5U) || (0U != READ_REG32_BIT(DEMO_I2C_UNIT->SR, I2C_FLAG_BUSY))) {
+            i32Ret = LL_ERR;
+        }
+    }
+
+    /* NACK aborts: the address of an absent device and the byte past the slave memory */
+    if (LL_OK == i32Ret) {
+        (void)memset(au8Rx, 0, sizeof(au8Rx));
+        m_u32I2cIntLogLen = 0UL;
+        if ((LL_OK != I2C_Int_Submit(DEMO_I2C_UNIT, &stcNoDev)) || (LL_OK != I2C_Int_Submit(DEMO_I2C_UNIT, &stcOver)) ||
+            (LL_OK != I2C_Int_Submit(DEMO_I2C_UNIT, &stcRead))) {
+            i32Ret = LL_ERR;
+        }
+    }
+    if (LL_OK == i32Ret) {
+        Demo_I2cIntPoll();
+        if ((RESET != I2C_Int_GetBusy(DEMO_I2C_UNIT)) ||
+            (m_u32I2cIntLogLen != 18UL) || (0 != memcmp(m_acI2cIntLog, "SNPSWwwNPSWwSRaanP", 18U)) ||
+            (m_u32I2cIntTraceLen != 6UL) || (0 != memcmp(m_acI2cIntTrace, "wroxxr", 6U)) ||
+            (LL_ERR != stcNoDev.i32Result) || (LL_ERR != stcOver.i32Result) || (LL_OK != stcRead.i32Result) ||
+            (0xAAU != m_au8I2cIntMem[7]) || (0 != memcmp(au8Rx, au8Expect, 3U)) ||
+            (0U != READ_REG32_BIT(DEMO_I2C_UNIT->SR, I2C_FLAG_BUSY))) {
+            i32Ret = LL_ERR;
+        }
+    }
+
+    I2C_Int_DeInit(DEMO_I2C_UNIT);
+    I2C_DeInit(DEMO_I2C_UNIT);
+    SIM_I2C_SetSlave(NULL, NULL);
+    FCG_Fcg0PeriphClockCmd(DEMO_I2C_FCG, DISABLE);
+    return Demo_Report("I2C_Int_Submit", i32Ret);
+}
+
+/**
+ * @brief  Application, run by SIM_Run().
+ * @param  None
+ * @retval int32_t:
+ *           - LL_OK:                   All cases passed.
+ *           - LL_ERR:                  A case failed.
+ */
+static int32_t Demo_Main(void)
+{
+    int32_t i32Ret = LL_OK;
+
+    /* As the startup code, the EFM timeouts depend on it */
+    SystemCoreClockUpdate();
+    LL_PERIPH_WE(LL_PERIPH_ALL);
+    FCG_Fcg0PeriphClockCmd(DEMO_USART_FCG | DEMO_SPI_FCG, ENABLE);
+
+    if (LL_OK != Demo_Usart()) {
+        i32Ret = LL_ERR;
+    }
+    if (LL_OK != Demo_Spi()) {
+        i32Ret = LL_ERR;
+    }
+    if (LL_OK != Demo_Efm()) {
+        i32Ret = LL_ERR;
+    }
+    if (LL_OK != Demo_EfmKv()) {
+        i32Ret = LL_ERR;
+    }
+    if (LL_OK != Demo_EfmKvPowerCut()) {
+        i32Ret = LL_ERR;
+    }
+    if (LL_OK != Demo_AdcAcq()) {
+        i32Ret = LL_ERR;
+    }
+    if (LL_OK != Demo_Tmr0Wheel()) {
+        i32Ret = LL_ERR;
+    }
+    if (LL_OK != Demo_Sched()) {
+        i32Ret = LL_ERR;
+    }
+    if (LL_OK != Demo_Spsc()) {
+        i32Ret = LL_ERR;
+    }
+    if (LL_OK != Demo_PwcIdle()) {
+        i32Ret = LL_ERR;
+    }
+    if (LL_OK != Demo_PwcIdleClk()) {
+        i32Ret = LL_ERR;
+    }
+    if (LL_OK != Demo_Dvfs()) {
+        i32Ret = LL_ERR;
+    }
+    if (LL_OK != Demo_Tlog()) {
+        i32Ret = LL_ERR;
+    }
+    if (LL_OK != Demo_Prof()) {
+        i32Ret = LL_ERR;
+    }
+    if (LL_OK != Demo_IntcStat()) {
+        i32Ret = LL_ERR;
+    }
+    if (LL_OK != Demo_UsartBrr()) {
+        i32Ret = LL_ERR;
+    }
+    if (LL_OK != Demo_GpioFast()) {
+        i32Ret = LL_ERR;
+    }
+    if (LL_OK != Demo_GpioTable()) {
+        i32Ret = LL_ERR;
+    }
+    if (LL_OK != Demo_SpiInt()) {
+        i32Ret = LL_ERR;
+    }
+    if (LL_OK != Demo_SysTick()) {
+        i32Ret = LL_ERR;
+    }
+    if (LL_OK != Demo_CrcContext()) {
+        i32Ret = LL_ERR;
+    }
+    if (LL_OK != Demo_I2cInt()) {
+        i32Ret = LL_ERR;
+    }
+
+    LL_PERIPH_WP(LL_PERIPH_ALL);
+    return i32Ret;
+}
+
+/**
+ * @brief  Main function of the host demo
+ * @param  None
+ * @retval 0 if all cases passed
+ */
+int main(void)
+{
+    int32_t i32Ret = SIM_Init();
+
+    if (LL_OK == i32Ret) {
+        i32Ret = SIM_Run(&Demo_Main);
+    }
+    return (LL_OK == i32Ret) ? 0 : 1;
+}
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
@@ -0,0 +1,451 @@
+/**
+ *******************************************************************************
+ * @file  host/emu/hc32_emu.c
+ * @brief Runs an HC32F120 firmware image on the Thumb emulator and converts
+ *        its benchmark report into a cycle table.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-16       CDT             First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2022-2023, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include <elf.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "hc32_sim.h"
+#include "hc32_thumb.h"
+
+/**
+ * @addtogroup HC32F120_DDL_Host
+ * @{
+ */
+
+/**
+ * @defgroup EMU EMU
+ * @brief Firmware runner: usage "hc32_emu [-H] [-t tag] [-c cycles] [-m mul] fw.elf".
+ * @note  The ELF image is loaded at its load addresses, the core starts from the
+ *        vector table like after a reset. Flash and peripherals are those of the
+ *        simulated register file (host/sim), so EFM programming and the USART
+ *        and SPI models behave as in the host build. SRAM is plain memory, the
+ *        SysTick counter runs at one count per emulated core cycle.
+ * @note  USART1 is the console. A line "@<func>[/<variant>],<units>,<cycles>"
+ *        printed by the firmware becomes the table row
+ *        "<tag>,<func>,<units>,<cycles>,<cycles per unit>,<code size>" on stdout,
+ *        the code size being the ELF symbol size of <func> ("-" when the
+ *        function was inlined away). Any other line goes to stderr.
+ * @{
+ */
+
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @brief Emulated memories outside the simulated register file.
+ */
+typedef struct {
+    uint8_t au8Sram[0x1000UL];          /*!< SRAM 0x20000000 ~ 0x20000FFF. */
+    uint8_t au8Scs[0x1000UL];           /*!< System control space 0xE000E000 ~ 0xE000EFFF. */
+    uint64_t u64SysTickBase;            /*!< Core cycle at which SysTick VAL was last written or enabled. */
+    uint32_t u32SysTickVal;             /*!< SysTick VAL at u64SysTickBase. */
+    stc_thumb_cpu_t *pstcCpu;           /*!< Core, for the SysTick time base. */
+} stc_emu_bus_t;
+
+/**
+ * @brief Firmware image.
+ */
+typedef struct {
+    uint8_t *pu8File;                   /*!< ELF file contents. */
+    size_t uSize;                       /*!< ELF file size. */
+    const Elf32_Sym *pstcSym;           /*!< Symbol table, NULL if stripped. */
+    uint32_t u32SymNum;                 /*!< Number of symbols. */
+    const char *pcStr;                  /*!< String table of the symbols. */
+} stc_emu_image_t;
+
+/**
+ * @brief Console line assembler.
+ */
+typedef struct {
+    char acLine[160];                   /*!< Line being received. */
+    uint32_t u32Len;                    /*!< Characters in acLine. */
+    const char *pcTag;                  /*!< Tag printed in the first column. */
+    const stc_emu_image_t *pstcImage;   /*!< Image, for the code sizes. */
+    uint32_t u32Rows;                   /*!< Table rows printed. */
+} stc_emu_console_t;
+
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+#define EMU_SRAM_BASE                   (0x20000000UL)
+#define EMU_SCS_BASE                    (0xE000E000UL)
+#define EMU_MEM_SIZE                    (0x1000UL)
+
+#define EMU_SYSTICK_CTRL                (0x010UL)
+#define EMU_SYSTICK_LOAD                (0x014UL)
+#define EMU_SYSTICK_VAL                 (0x018UL)
+
+#define EMU_MAX_CYCLES                  (2000000000ULL)
+
+#define EMU_IN_RANGE(x, base, size)     (((x) >= (base)) && (((x) - (base)) < (size)))
+
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+static stc_emu_bus_t m_stcBus;
+static stc_emu_image_t m_stcImage;
+static stc_emu_console_t m_stcConsole;
+
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @brief  Get the current SysTick counter value.
+ * @param  [in] pstcBus                 Pointer to the bus
+ * @retval VAL
+ */
+static uint32_t EMU_SysTickVal(const stc_emu_bus_t *pstcBus)
+{
+    const uint32_t *pu32Scs = (const uint32_t *)pstcBus->au8Scs;
+    uint32_t u32Load = pu32Scs[EMU_SYSTICK_LOAD / 4U] & 0x00FFFFFFUL;
+    uint64_t u64Elapsed = pstcBus->pstcCpu->u64Cycles - pstcBus->u64SysTickBase;
+
+    if (0UL == (pu32Scs[EMU_SYSTICK_CTRL / 4U] & 1UL)) {
+        return pstcBus->u32SysTickVal;
+    }
+    if (u64Elapsed <= pstcBus->u32SysTickVal) {
+        return pstcBus->u32SysTickVal - (uint32_t)u64Elapsed;
+    }
+    /* Reloads with LOAD on the tick after reaching 0 */
+    u64Elapsed -= (uint64_t)pstcBus->u32SysTickVal + 1ULL;
+    return u32Load - (uint32_t)(u64Elapsed % ((uint64_t)u32Load + 1ULL));
+}
+
+/**
+ * @brief  Bus read of the emulated core.
+ * @param  [in] pvArg                   Pointer to the bus
+ * @param  [in] u32Addr                 Address
+ * @param  [in] u32Size                 1, 2 or 4 bytes
+ * @param  [out] pu32Data               Data read
+ * @retval 0 on success
+ */
+static int32_t EMU_BusRead(void *pvArg, uint32_t u32Addr, uint32_t u32Size, uint32_t *pu32Data)
+{
+    stc_emu_bus_t *pstcBus = (stc_emu_bus_t *)pvArg;
+    const uint8_t *pu8Mem;
+
+    if (u32Addr < SIM_FLASH_SIZE) {
+        /* No model hooks on flash reads, take the fast path */
+        pu8Mem = (const uint8_t *)SIM_ShadowAddr(u32Addr);
+    } else if (EMU_IN_RANGE(u32Addr, EMU_SRAM_BASE, EMU_MEM_SIZE)) {
+        pu8Mem = &pstcBus->au8Sram[u32Addr - EMU_SRAM_BASE];
+    } else if (EMU_IN_RANGE(u32Addr, EMU_SCS_BASE, EMU_MEM_SIZE)) {
+        if ((EMU_SCS_BASE + EMU_SYSTICK_VAL) == (u32Addr & ~3UL)) {
+            *(uint32_t *)&pstcBus->au8Scs[EMU_SYSTICK_VAL] = EMU_SysTickVal(pstcBus);
+        }
+        pu8Mem = &pstcBus->au8Scs[u32Addr - EMU_SCS_BASE];
+    } else {
+        return SIM_BusRead(u32Addr, u32Size, pu32Data);
+    }
+
+    if (1UL == u32Size) {
+        *pu32Data = *pu8Mem;
+    } else if (2UL == u32Size) {
+        *pu32Data = *(const uint16_t *)pu8Mem;
+    } else {
+        *pu32Data = *(const uint32_t *)pu8Mem;
+    }
+    return 0;
+}
+
+/**
+ * @brief  Bus write of the emulated core.
+ * @param  [in] pvArg                   Pointer to the bus
+ * @param  [in] u32Addr                 Address
+ * @param  [in] u32Size                 1, 2 or 4 bytes
+ * @param  [in] u32Data                 Data
+ * @retval 0 on success
+ */
+static int32_t EMU_BusWrite(void *pvArg, uint32_t u32Addr, uint32_t u32Size, uint32_t u32Data)
+{
+    stc_emu_bus_t *pstcBus = (stc_emu_bus_t *)pvArg;
+    uint8_t *pu8Mem;
+    uint32_t u32Reg;
+
+    if (EMU_IN_RANGE(u32Addr, EMU_SRAM_BASE, EMU_MEM_SIZE)) {
+        pu8Mem = &pstcBus->au8Sram[u32Addr - EMU_SRAM_BASE];
+    } else if (EMU_IN_RANGE(u32Addr, EMU_SCS_BASE, EMU_MEM_SIZE)) {
+        u32Reg = u32Addr & ~3UL;
+        if ((EMU_SCS_BASE + EMU_SYSTICK_VAL) == u32Reg) {
+            /* Any write clears the counter */
+            pstcBus->u32SysTickVal = 0UL;
+            pstcBus->u64SysTickBase = pstcBus->pstcCpu->u64Cycles;
+            return 0;
+        }
+        if ((EMU_SCS_BASE + EMU_SYSTICK_CTRL) == u32Reg) {
+            /* Freeze VAL while disabled, count on from it when enabled */
+            pstcBus->u32SysTickVal = EMU_SysTickVal(pstcBus);
+            pstcBus->u64SysTickBase = pstcBus->pstcCpu->u64Cycles;
+        }
+        pu8Mem = &pstcBus->au8Scs[u32Addr - EMU_SCS_BASE];
+    } else {
+        return SIM_BusWrite(u32Addr, u32Size, u32Data);
+    }
+
+    if (1UL == u32Size) {
+        *pu8Mem = (uint8_t)u32Data;
+    } else if (2UL == u32Size) {
+        *(uint16_t *)pu8Mem = (uint16_t)u32Data;
+    } else {
+        *(uint32_t *)pu8Mem = u32Data;
+    }
+    return 0;
+}
+
+/**
+ * @brief  Find the size of a function symbol.
+ * @param  [in] pcName                  Function name, a "/<variant>" suffix is ignored
+ * @retval Size in bytes, 0 if the function is not in the image.
+ */
+static uint32_t EMU_FuncSize(const stc_emu_image_t *pstcImage, const char *pcName)
+{
+    size_t uLen = strcspn(pcName, "/");
+    const char *pcSym;
+    uint32_t i;
+
+    for (i = 0UL; i < pstcImage->u32SymNum; i++) {
+        pcSym = &pstcImage->pcStr[pstcImage->pstcSym[i].st_name];
+        /* "<func>.constprop.0" etc. are clones of <func> made by the optimizer */
+        if ((STT_FUNC == ELF32_ST_TYPE(pstcImage->pstcSym[i].st_info)) && (0 == strncmp(pcSym, pcName, uLen)) &&
+            (('\0' == pcSym[uLen]) || ('.' == pcSym[uLen]))) {
+            return pstcImage->pstcSym[i].st_size;
+        }
+    }
+    return 0UL;
+}
+
+/**
+ * @brief  Handle one console line.
+ * @param  [in] pstcConsole             Pointer to the console
+ * @retval None
+ */
+static void EMU_ConsoleLine(stc_emu_console_t *pstcConsole)
+{
+    char acFunc[64];
+    unsigned long ulUnits;
+    unsigned long ulCycles;
+    uint32_t u32Size;
+
+    if ((3 == sscanf(pstcConsole->acLine, "@%63[^,],%lu,%lu", acFunc, &ulUnits, &ulCycles)) && (0UL != ulUnits)) {
+        u32Size = EMU_FuncSize(pstcConsole->pstcImage, acFunc);
+        (void)printf("%s,%s,%lu,%lu,%.2f,", pstcConsole->pcTag, acFunc, ulUnits, ulCycles,
+                     (double)ulCycles / (double)ulUnits);
+        if (0UL != u32Size) {
+            (void)printf("%lu\n", (unsigned long)u32Size);
+        } else {
+            (void)printf("-\n");
+        }
+        pstcConsole->u32Rows++;
+    } else {
+        (void)fprintf(stderr, "%s: %s\n", pstcConsole->pcTag, pstcConsole->acLine);
+    }
+}
+
+/**
+ * @brief  USART1 transmit sink.
+ * @param  [in] u16Data                 Frame
+ * @param  [in] pvArg                   Pointer to the console
+ * @retval None
+ */
+static void EMU_ConsoleTx(uint16_t u16Data, void *pvArg)
+{
+    stc_emu_console_t *pstcConsole = (stc_emu_console_t *)pvArg;
+    char cData = (char)u16Data;
+
+    if ('\n' == cData) {
+        pstcConsole->acLine[pstcConsole->u32Len] = '\0';
+        EMU_ConsoleLine(pstcConsole);
+        pstcConsole->u32Len = 0UL;
+    } else if (('\r' != cData) && (pstcConsole->u32Len < (sizeof(pstcConsole->acLine) - 1U))) {
+        pstcConsole->acLine[pstcConsole->u32Len++] = cData;
+    } else {
+        /* Dropped */
+    }
+}
+
+/**
+ * @brief  Load an ELF image into flash and SRAM.
+ * @param  [in] pcPath                  File name
+ * @param  [out] pstcImage              Pointer to the image
+ * @retval int32_t:
+ *           - LL_OK:                   Loaded.
+ *           - LL_ERR:                  Not an Arm ELF image or a segment is outside the memories.
+ */
+static int32_t EMU_Load(const char *pcPath, stc_emu_image_t *pstcImage)
+{
+    FILE *pFile = fopen(pcPath, "rb");
+    const Elf32_Ehdr *pstcEhdr;
+    const Elf32_Phdr *pstcPhdr;
+    const Elf32_Shdr *pstcShdr;
+    uint32_t u32Addr;
+    uint32_t i;
+    uint32_t j;
+    uint8_t *pu8Dest;
+
+    if (NULL == pFile) {
+        return LL_ERR;
+    }
+    (void)fseek(pFile, 0L, SEEK_END);
+    pstcImage->uSize = (size_t)ftell(pFile);
+    (void)fseek(pFile, 0L, SEEK_SET);
+    pstcImage->pu8File = (uint8_t *)malloc(pstcImage->uSize);
+    if ((NULL == pstcImage->pu8File) || (pstcImage->uSize < sizeof(Elf32_Ehdr)) ||
+        (1U != fread(pstcImage->pu8File, pstcImage->uSize, 1U, pFile))) {
+        (void)fclose(pFile);
+        return LL_ERR;
+    }
+    (void)fclose(pFile);
+
+    pstcEhdr = (const Elf32_Ehdr *)pstcImage->pu8File;
+    if ((0 != memcmp(pstcEhdr->e_ident, ELFMAG, SELFMAG)) || (ELFCLASS32 != pstcEhdr->e_ident[EI_CLASS]) ||
+        (EM_ARM != pstcEhdr->e_machine)) {
+        return LL_ERR;
+    }
+
+    /* Segments go to their load address, .data is copied to SRAM by the startup code */
+    for (i = 0UL; i < pstcEhdr->e_phnum; i++) {
+        pstcPhdr = (const Elf32_Phdr *)&pstcImage->pu8File[pstcEhdr->e_phoff + (i * pstcEhdr->e_phentsize)];
+        if ((PT_LOAD != pstcPhdr->p_type) || (0UL == pstcPhdr->p_filesz)) {
+            continue;
+        }
+        for (j = 0UL; j < pstcPhdr->p_filesz; j++) {
+            u32Addr = pstcPhdr->p_paddr + j;
+            if (u32Addr < SIM_FLASH_SIZE) {
+                pu8Dest = (uint8_t *)SIM_ShadowAddr(u32Addr);
+            } else if (EMU_IN_RANGE(u32Addr, EMU_SRAM_BASE, EMU_MEM_SIZE)) {
+                pu8Dest = &m_stcBus.au8Sram[u32Addr - EMU_SRAM_BASE];
+            } else {
+                return LL_ERR;
+            }
+            *pu8Dest = pstcImage->pu8File[pstcPhdr->p_offset + j];
+        }
+    }
+
+    /* Symbols for the code sizes */
+    for (i = 0UL; i < pstcEhdr->e_shnum; i++) {
+        pstcShdr = (const Elf32_Shdr *)&pstcImage->pu8File[pstcEhdr->e_shoff + (i * pstcEhdr->e_shentsize)];
+        if (SHT_SYMTAB == pstcShdr->sh_type) {
+            pstcImage->pstcSym = (const Elf32_Sym *)&pstcImage->pu8File[pstcShdr->sh_offset];
+            pstcImage->u32SymNum = pstcShdr->sh_size / sizeof(Elf32_Sym);
+            pstcShdr = (const Elf32_Shdr *)&pstcImage->pu8File[pstcEhdr->e_shoff +
+                                                                (pstcShdr->sh_link * pstcEhdr->e_shentsize)];
+            pstcImage->pcStr = (const char *)&pstcImage->pu8File[pstcShdr->sh_offset];
+            break;
+        }
+    }
+    return LL_OK;
+}
+
+/**
+ * @brief  Main function of the firmware runner
+ * @param  [in] argc                    Argument count
+ * @param  [in] argv                    Arguments
+ * @retval 0 if the firmware ran to its final loop or BKPT
+ */
+int main(int argc, char *argv[])
+{
+    stc_thumb_cpu_t stcCpu = {0};
+    uint64_t u64MaxCycles = EMU_MAX_CYCLES;
+    uint32_t u32Header = 0UL;
+    uint32_t u32Stop;
+    int iOpt;
+
+    m_stcConsole.pcTag = "-";
+    while (-1 != (iOpt = getopt(argc, argv, "Ht:c:m:"))) {
+        switch (iOpt) {
+            case 'H':
+                u32Header = 1UL;
+                break;
+            case 't':
+                m_stcConsole.pcTag = optarg;
+                break;
+            case 'c':
+                u64MaxCycles = strtoull(optarg, NULL, 0);
+                break;
+            case 'm':
+                stcCpu.u32MulCycles = (uint32_t)strtoul(optarg, NULL, 0);
+                break;
+            default:
+                (void)fprintf(stderr, "usage: %s [-H] [-t tag] [-c cycles] [-m mul] fw.elf\n", argv[0]);
+                return 2;
+        }
+    }
+    if (optind >= argc) {
+        (void)fprintf(stderr, "usage: %s [-H] [-t tag] [-c cycles] [-m mul] fw.elf\n", argv[0]);
+        return 2;
+    }
+    if (0UL != u32Header) {
+        (void)printf("tag,func,units,cycles,cycles_per_unit,code_size\n");
+    }
+
+    if (LL_OK != SIM_Init()) {
+        (void)fprintf(stderr, "%s: cannot map the register file\n", argv[0]);
+        return 1;
+    }
+    if (LL_OK != EMU_Load(argv[optind], &m_stcImage)) {
+        (void)fprintf(stderr, "%s: cannot load %s\n", argv[0], argv[optind]);
+        return 1;
+    }
+    m_stcConsole.pstcImage = &m_stcImage;
+    SIM_USART_SetTxCallback(CM_USART1, &EMU_ConsoleTx, &m_stcConsole);
+
+    m_stcBus.pstcCpu = &stcCpu;
+    stcCpu.pfnRead = &EMU_BusRead;
+    stcCpu.pfnWrite = &EMU_BusWrite;
+    stcCpu.pvBusArg = &m_stcBus;
+    THUMB_Reset(&stcCpu);
+    u32Stop = THUMB_Run(&stcCpu, u64MaxCycles);
+
+    (void)fprintf(stderr, "%s: %s at 0x%08lx after %llu cycles, %llu instructions, %lu rows\n",
+                  m_stcConsole.pcTag, THUMB_GetStopString(u32Stop), (unsigned long)stcCpu.u32StopPc,
+                  (unsigned long long)stcCpu.u64Cycles, (unsigned long long)stcCpu.u64Insts,
+                  (unsigned long)m_stcConsole.u32Rows);
+    if ((THUMB_STOP_BUS_FAULT == u32Stop) || (THUMB_STOP_ALIGN_FAULT == u32Stop)) {
+        (void)fprintf(stderr, "%s: fault address 0x%08lx\n", m_stcConsole.pcTag, (unsigned long)stcCpu.u32FaultAddr);
+    }
+    return ((THUMB_STOP_LOOP == u32Stop) || (THUMB_STOP_BKPT == u32Stop)) ? 0 : 1;
+}
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
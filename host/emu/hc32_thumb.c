@@ -0,0 +1,909 @@
+/**
+ *******************************************************************************
+ * @file  host/emu/hc32_thumb.c
+ * @brief ARMv6-M Thumb instruction set emulator with Cortex-M0+ cycle counting.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-16       CDT             First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2022-2023, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include <stddef.h>
+
+#include "hc32_thumb.h"
+
+/**
+ * @addtogroup HC32F120_DDL_Host
+ * @{
+ */
+
+/**
+ * @defgroup THUMB THUMB
+ * @brief ARMv6-M Thumb instruction set emulator.
+ * @note  Cycles follow the Cortex-M0+ instruction timings with zero wait state
+ *        memory: data processing 1, MULS 1 or 32, load/store 2, LDM/STM/PUSH/POP
+ *        1+N, POP with PC 3+N, taken branch 2 (BL 3), MRS/MSR/barriers 3.
+ *        Flash wait states, bus bridges and peripheral stalls are not counted.
+ * @note  Exceptions are not emulated: no interrupt entry, SVC and faults stop
+ *        the core (u32Stop).
+ * @{
+ */
+
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+#define APSR_N                          (1UL << 31U)
+#define APSR_Z                          (1UL << 30U)
+#define APSR_C                          (1UL << 29U)
+#define APSR_V                          (1UL << 28U)
+#define APSR_NZCV                       (APSR_N | APSR_Z | APSR_C | APSR_V)
+
+#define BIT(x, pos)                     (((x) >> (pos)) & 1UL)
+#define BITS(x, hi, lo)                 (((x) >> (lo)) & ((1UL << ((hi) - (lo) + 1U)) - 1UL))
+
+/* Cortex-M0+ cycle counts */
+#define CYC_ALU                         (1UL)
+#define CYC_MEM                         (2UL)
+#define CYC_BRANCH                      (2UL)
+#define CYC_BL                          (3UL)
+#define CYC_SYS                         (3UL)
+
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @brief  Stop the core.
+ * @param  [in] pstcCpu                 Pointer to the core
+ * @param  [in] u32Stop                 @ref THUMB_Stop_Reason
+ * @param  [in] u32Pc                   Address of the stopping instruction
+ * @retval None
+ */
+static void THUMB_Stop(stc_thumb_cpu_t *pstcCpu, uint32_t u32Stop, uint32_t u32Pc)
+{
+    if (THUMB_RUNNING == pstcCpu->u32Stop) {
+        pstcCpu->u32Stop = u32Stop;
+        pstcCpu->u32StopPc = u32Pc;
+    }
+}
+
+/**
+ * @brief  Read the bus, stop the core on failure.
+ * @param  [in] pstcCpu                 Pointer to the core
+ * @param  [in] u32Addr                 Address
+ * @param  [in] u32Size                 1, 2 or 4 bytes
+ * @param  [in] u32Pc                   Address of the current instruction
+ * @retval Data read, zero extended. 0 on failure.
+ */
+static uint32_t THUMB_Read(stc_thumb_cpu_t *pstcCpu, uint32_t u32Addr, uint32_t u32Size, uint32_t u32Pc)
+{
+    uint32_t u32Data = 0UL;
+
+    if (0UL != (u32Addr & (u32Size - 1UL))) {
+        THUMB_Stop(pstcCpu, THUMB_STOP_ALIGN_FAULT, u32Pc);
+        pstcCpu->u32FaultAddr = u32Addr;
+    } else if (0 != pstcCpu->pfnRead(pstcCpu->pvBusArg, u32Addr, u32Size, &u32Data)) {
+        THUMB_Stop(pstcCpu, THUMB_STOP_BUS_FAULT, u32Pc);
+        pstcCpu->u32FaultAddr = u32Addr;
+        u32Data = 0UL;
+    } else {
+        /* OK */
+    }
+    return u32Data;
+}
+
+/**
+ * @brief  Write the bus, stop the core on failure.
+ * @param  [in] pstcCpu                 Pointer to the core
+ * @param  [in] u32Addr                 Address
+ * @param  [in] u32Size                 1, 2 or 4 bytes
+ * @param  [in] u32Data                 Data, the low u32Size bytes are written
+ * @param  [in] u32Pc                   Address of the current instruction
+ * @retval None
+ */
+static void THUMB_Write(stc_thumb_cpu_t *pstcCpu, uint32_t u32Addr, uint32_t u32Size, uint32_t u32Data, uint32_t u32Pc)
+{
+    if (0UL != (u32Addr & (u32Size - 1UL))) {
+        THUMB_Stop(pstcCpu, THUMB_STOP_ALIGN_FAULT, u32Pc);
+        pstcCpu->u32FaultAddr = u32Addr;
+    } else if (0 != pstcCpu->pfnWrite(pstcCpu->pvBusArg, u32Addr, u32Size, u32Data)) {
+        THUMB_Stop(pstcCpu, THUMB_STOP_BUS_FAULT, u32Pc);
+        pstcCpu->u32FaultAddr = u32Addr;
+    } else {
+        /* OK */
+    }
+}
+
+/**
+ * @brief  Update N and Z.
+ * @param  [in] pstcCpu                 Pointer to the core
+ * @param  [in] u32Result               Result
+ * @retval None
+ */
+static void THUMB_SetNZ(stc_thumb_cpu_t *pstcCpu, uint32_t u32Result)
+{
+    pstcCpu->u32Apsr &= ~(APSR_N | APSR_Z);
+    pstcCpu->u32Apsr |= (u32Result & APSR_N);
+    if (0UL == u32Result) {
+        pstcCpu->u32Apsr |= APSR_Z;
+    }
+}
+
+/**
+ * @brief  Set or clear C.
+ * @param  [in] pstcCpu                 Pointer to the core
+ * @param  [in] u32Carry                0 or 1
+ * @retval None
+ */
+static void THUMB_SetC(stc_thumb_cpu_t *pstcCpu, uint32_t u32Carry)
+{
+    pstcCpu->u32Apsr = (pstcCpu->u32Apsr & ~APSR_C) | ((0UL != u32Carry) ? APSR_C : 0UL);
+}
+
+/**
+ * @brief  AddWithCarry() of the Arm ARM.
+ * @param  [in] pstcCpu                 Pointer to the core
+ * @param  [in] u32X                    Operand
+ * @param  [in] u32Y                    Operand
+ * @param  [in] u32CarryIn              0 or 1
+ * @param  [in] u32SetFlags             Update NZCV if non-zero
+ * @retval Result
+ */
+static uint32_t THUMB_AddWithCarry(stc_thumb_cpu_t *pstcCpu, uint32_t u32X, uint32_t u32Y, uint32_t u32CarryIn,
+                                   uint32_t u32SetFlags)
+{
+    uint64_t u64Sum = (uint64_t)u32X + (uint64_t)u32Y + (uint64_t)u32CarryIn;
+    uint32_t u32Result = (uint32_t)u64Sum;
+
+    if (0UL != u32SetFlags) {
+        THUMB_SetNZ(pstcCpu, u32Result);
+        THUMB_SetC(pstcCpu, (uint32_t)(u64Sum >> 32U));
+        pstcCpu->u32Apsr &= ~APSR_V;
+        if (0UL != ((~(u32X ^ u32Y) & (u32X ^ u32Result)) & 0x80000000UL)) {
+            pstcCpu->u32Apsr |= APSR_V;
+        }
+    }
+    return u32Result;
+}
+
+/**
+ * @brief  Register read, PC reads as the instruction address + 4.
+ * @param  [in] pstcCpu                 Pointer to the core
+ * @param  [in] u32Reg                  Register number
+ * @param  [in] u32Pc                   Address of the current instruction
+ * @retval Register value
+ */
+static uint32_t THUMB_GetReg(const stc_thumb_cpu_t *pstcCpu, uint32_t u32Reg, uint32_t u32Pc)
+{
+    return (THUMB_PC == u32Reg) ? (u32Pc + 4UL) : pstcCpu->au32R[u32Reg];
+}
+
+/**
+ * @brief  Evaluate a condition code.
+ * @param  [in] u32Apsr                 APSR
+ * @param  [in] u32Cond                 Condition, 0 ~ 14
+ * @retval 1 if the condition passes
+ */
+static uint32_t THUMB_CondPass(uint32_t u32Apsr, uint32_t u32Cond)
+{
+    uint32_t u32N = BIT(u32Apsr, 31U);
+    uint32_t u32Z = BIT(u32Apsr, 30U);
+    uint32_t u32C = BIT(u32Apsr, 29U);
+    uint32_t u32V = BIT(u32Apsr, 28U);
+    uint32_t u32Pass;
+
+    switch (u32Cond >> 1U) {
+        case 0U:
+            u32Pass = u32Z;
+            break;
+        case 1U:
+            u32Pass = u32C;
+            break;
+        case 2U:
+            u32Pass = u32N;
+            break;
+        case 3U:
+            u32Pass = u32V;
+            break;
+        case 4U:
+            u32Pass = u32C & (u32Z ^ 1UL);
+            break;
+        case 5U:
+            u32Pass = (u32N == u32V) ? 1UL : 0UL;
+            break;
+        case 6U:
+            u32Pass = ((u32N == u32V) && (0UL == u32Z)) ? 1UL : 0UL;
+            break;
+        default:
+            u32Pass = 1UL;
+            break;
+    }
+    if ((0UL != (u32Cond & 1UL)) && (0xEUL != u32Cond)) {
+        u32Pass ^= 1UL;
+    }
+    return u32Pass;
+}
+
+/**
+ * @brief  Shift by register with carry out, the LSL/LSR/ASR/ROR data processing instructions.
+ * @param  [in] pstcCpu                 Pointer to the core
+ * @param  [in] u32Type                 0: LSL, 1: LSR, 2: ASR, 3: ROR
+ * @param  [in] u32Value                Value to shift
+ * @param  [in] u32Shift                Shift amount, bits 7:0 used
+ * @retval Result, C updated
+ */
+static uint32_t THUMB_ShiftReg(stc_thumb_cpu_t *pstcCpu, uint32_t u32Type, uint32_t u32Value, uint32_t u32Shift)
+{
+    uint32_t u32Result = u32Value;
+    uint32_t n = u32Shift & 0xFFUL;
+
+    if (0UL == n) {
+        return u32Result;
+    }
+    switch (u32Type) {
+        case 0U:
+            if (n < 32UL) {
+                THUMB_SetC(pstcCpu, BIT(u32Value, 32UL - n));
+                u32Result = u32Value << n;
+            } else {
+                THUMB_SetC(pstcCpu, (32UL == n) ? BIT(u32Value, 0U) : 0UL);
+                u32Result = 0UL;
+            }
+            break;
+        case 1U:
+            if (n < 32UL) {
+                THUMB_SetC(pstcCpu, BIT(u32Value, n - 1UL));
+                u32Result = u32Value >> n;
+            } else {
+                THUMB_SetC(pstcCpu, (32UL == n) ? BIT(u32Value, 31U) : 0UL);
+                u32Result = 0UL;
+            }
+            break;
+        case 2U:
+            if (n < 32UL) {
+                THUMB_SetC(pstcCpu, BIT(u32Value, n - 1UL));
+                u32Result = (uint32_t)((int32_t)u32Value >> n);
+            } else {
+                THUMB_SetC(pstcCpu, BIT(u32Value, 31U));
+                u32Result = (0UL != BIT(u32Value, 31U)) ? 0xFFFFFFFFUL : 0UL;
+            }
+            break;
+        default:
+            n &= 31UL;
+            if (0UL != n) {
+                u32Result = (u32Value >> n) | (u32Value << (32UL - n));
+            }
+            THUMB_SetC(pstcCpu, BIT(u32Result, 31U));
+            break;
+    }
+    return u32Result;
+}
+
+/**
+ * @brief  Branch, detect the branch to itself.
+ * @param  [in] pstcCpu                 Pointer to the core
+ * @param  [in] u32Target               Target address
+ * @param  [in] u32Pc                   Address of the branch
+ * @retval None
+ */
+static void THUMB_Branch(stc_thumb_cpu_t *pstcCpu, uint32_t u32Target, uint32_t u32Pc)
+{
+    if (u32Target == u32Pc) {
+        THUMB_Stop(pstcCpu, THUMB_STOP_LOOP, u32Pc);
+    }
+    pstcCpu->au32R[THUMB_PC] = u32Target;
+}
+
+/**
+ * @brief  Interworking branch (BX, BLX, POP {PC}), only Thumb targets are valid.
+ * @param  [in] pstcCpu                 Pointer to the core
+ * @param  [in] u32Target               Target address with the Thumb bit
+ * @param  [in] u32Pc                   Address of the branch
+ * @retval None
+ */
+static void THUMB_BranchX(stc_thumb_cpu_t *pstcCpu, uint32_t u32Target, uint32_t u32Pc)
+{
+    /* ARM state and EXC_RETURN are not supported */
+    if ((0UL == (u32Target & 1UL)) || (u32Target >= 0xF0000000UL)) {
+        THUMB_Stop(pstcCpu, THUMB_STOP_UNDEF, u32Pc);
+    }
+    THUMB_Branch(pstcCpu, u32Target & ~1UL, u32Pc);
+}
+
+/**
+ * @brief  Execute a data processing instruction (010000 opcode).
+ * @param  [in] pstcCpu                 Pointer to the core
+ * @param  [in] u32Inst                 Instruction
+ * @retval Cycles
+ */
+static uint32_t THUMB_DataProc(stc_thumb_cpu_t *pstcCpu, uint32_t u32Inst)
+{
+    uint32_t u32Rdn = BITS(u32Inst, 2U, 0U);
+    uint32_t u32X = pstcCpu->au32R[u32Rdn];
+    uint32_t u32Y = pstcCpu->au32R[BITS(u32Inst, 5U, 3U)];
+    uint32_t u32Result = 0UL;
+    uint32_t u32Write = 1UL;
+    uint32_t u32Cycles = CYC_ALU;
+
+    switch (BITS(u32Inst, 9U, 6U)) {
+        case 0x0U:  /* ANDS */
+            u32Result = u32X & u32Y;
+            break;
+        case 0x1U:  /* EORS */
+            u32Result = u32X ^ u32Y;
+            break;
+        case 0x2U:  /* LSLS */
+            u32Result = THUMB_ShiftReg(pstcCpu, 0U, u32X, u32Y);
+            break;
+        case 0x3U:  /* LSRS */
+            u32Result = THUMB_ShiftReg(pstcCpu, 1U, u32X, u32Y);
+            break;
+        case 0x4U:  /* ASRS */
+            u32Result = THUMB_ShiftReg(pstcCpu, 2U, u32X, u32Y);
+            break;
+        case 0x5U:  /* ADCS */
+            u32Result = THUMB_AddWithCarry(pstcCpu, u32X, u32Y, BIT(pstcCpu->u32Apsr, 29U), 1UL);
+            break;
+        case 0x6U:  /* SBCS */
+            u32Result = THUMB_AddWithCarry(pstcCpu, u32X, ~u32Y, BIT(pstcCpu->u32Apsr, 29U), 1UL);
+            break;
+        case 0x7U:  /* RORS */
+            u32Result = THUMB_ShiftReg(pstcCpu, 3U, u32X, u32Y);
+            break;
+        case 0x8U:  /* TST */
+            u32Result = u32X & u32Y;
+            u32Write = 0UL;
+            break;
+        case 0x9U:  /* RSBS #0 */
+            u32Result = THUMB_AddWithCarry(pstcCpu, ~u32Y, 0UL, 1UL, 1UL);
+            break;
+        case 0xAU:  /* CMP */
+            (void)THUMB_AddWithCarry(pstcCpu, u32X, ~u32Y, 1UL, 1UL);
+            return u32Cycles;
+        case 0xBU:  /* CMN */
+            (void)THUMB_AddWithCarry(pstcCpu, u32X, u32Y, 0UL, 1UL);
+            return u32Cycles;
+        case 0xCU:  /* ORRS */
+            u32Result = u32X | u32Y;
+            break;
+        case 0xDU:  /* MULS */
+            u32Result = u32X * u32Y;
+            u32Cycles = pstcCpu->u32MulCycles;
+            break;
+        case 0xEU:  /* BICS */
+            u32Result = u32X & ~u32Y;
+            break;
+        default:    /* MVNS */
+            u32Result = ~u32Y;
+            break;
+    }
+    /* ADCS, SBCS and RSBS set all flags in THUMB_AddWithCarry() already */
+    THUMB_SetNZ(pstcCpu, u32Result);
+    if (0UL != u32Write) {
+        pstcCpu->au32R[u32Rdn] = u32Result;
+    }
+    return u32Cycles;
+}
+
+/**
+ * @brief  Execute a 32-bit instruction: BL, MSR, MRS, DMB, DSB, ISB.
+ * @param  [in] pstcCpu                 Pointer to the core
+ * @param  [in] u32Hw1                  First halfword
+ * @param  [in] u32Hw2                  Second halfword
+ * @param  [in] u32Pc                   Address of the instruction
+ * @retval Cycles
+ */
+static uint32_t THUMB_Exec32(stc_thumb_cpu_t *pstcCpu, uint32_t u32Hw1, uint32_t u32Hw2, uint32_t u32Pc)
+{
+    uint32_t u32S;
+    uint32_t u32Imm;
+    uint32_t u32SysM;
+    uint32_t u32Reg;
+
+    if ((0x1EUL == BITS(u32Hw1, 15U, 11U)) && (0xD000UL == (u32Hw2 & 0xD000UL))) {
+        /* BL */
+        u32S = BIT(u32Hw1, 10U);
+        u32Imm = (u32S << 24U) |
+                 (((BIT(u32Hw2, 13U) ^ u32S) ^ 1UL) << 23U) |
+                 (((BIT(u32Hw2, 11U) ^ u32S) ^ 1UL) << 22U) |
+                 (BITS(u32Hw1, 9U, 0U) << 12U) | (BITS(u32Hw2, 10U, 0U) << 1U);
+        if (0UL != u32S) {
+            u32Imm |= 0xFE000000UL;
+        }
+        pstcCpu->au32R[THUMB_LR] = (u32Pc + 4UL) | 1UL;
+        THUMB_Branch(pstcCpu, u32Pc + 4UL + u32Imm, u32Pc);
+        return CYC_BL;
+    }
+
+    u32SysM = BITS(u32Hw2, 7U, 0U);
+    if ((0xF380UL == (u32Hw1 & 0xFFF0UL)) && (0x8800UL == (u32Hw2 & 0xFF00UL))) {
+        /* MSR */
+        u32Reg = pstcCpu->au32R[BITS(u32Hw1, 3U, 0U)];
+        if (u32SysM <= 3UL) {
+            pstcCpu->u32Apsr = u32Reg & APSR_NZCV;
+        } else if ((8UL == u32SysM) || (9UL == u32SysM)) {
+            pstcCpu->au32R[THUMB_SP] = u32Reg & ~3UL;
+        } else if (16UL == u32SysM) {
+            pstcCpu->u32Primask = u32Reg & 1UL;
+        } else {
+            /* IPSR, EPSR and CONTROL are ignored */
+        }
+        return CYC_SYS;
+    }
+    if ((0xF3EFUL == u32Hw1) && (0x8000UL == (u32Hw2 & 0xF000UL))) {
+        /* MRS */
+        if (u32SysM <= 7UL) {
+            u32Reg = pstcCpu->u32Apsr & APSR_NZCV;
+        } else if ((8UL == u32SysM) || (9UL == u32SysM)) {
+            u32Reg = pstcCpu->au32R[THUMB_SP];
+        } else if (16UL == u32SysM) {
+            u32Reg = pstcCpu->u32Primask;
+        } else {
+            u32Reg = 0UL;
+        }
+        pstcCpu->au32R[BITS(u32Hw2, 11U, 8U)] = u32Reg;
+        return CYC_SYS;
+    }
+    if ((0xF3BFUL == u32Hw1) && (0x8F00UL == (u32Hw2 & 0xFF00UL))) {
+        /* DSB, DMB, ISB */
+        return CYC_SYS;
+    }
+
+    THUMB_Stop(pstcCpu, THUMB_STOP_UNDEF, u32Pc);
+    return CYC_ALU;
+}
+
+/**
+ * @brief  Execute a miscellaneous instruction (1011 opcode).
+ * @param  [in] pstcCpu                 Pointer to the core
+ * @param  [in] u32Inst                 Instruction
+ * @param  [in] u32Pc                   Address of the instruction
+ * @retval Cycles
+ */
+static uint32_t THUMB_ExecMisc(stc_thumb_cpu_t *pstcCpu, uint32_t u32Inst, uint32_t u32Pc)
+{
+    uint32_t u32Rd = BITS(u32Inst, 2U, 0U);
+    uint32_t u32Rm = pstcCpu->au32R[BITS(u32Inst, 5U, 3U)];
+    uint32_t u32Addr;
+    uint32_t u32Cycles = CYC_ALU;
+    uint32_t u32Target = 0UL;
+    uint32_t i;
+
+    switch (BITS(u32Inst, 11U, 8U)) {
+        case 0x0U:  /* ADD/SUB SP, SP, #imm7 */
+            if (0UL != BIT(u32Inst, 7U)) {
+                pstcCpu->au32R[THUMB_SP] -= BITS(u32Inst, 6U, 0U) << 2U;
+            } else {
+                pstcCpu->au32R[THUMB_SP] += BITS(u32Inst, 6U, 0U) << 2U;
+            }
+            break;
+        case 0x2U:
+            switch (BITS(u32Inst, 7U, 6U)) {
+                case 0U:    /* SXTH */
+                    pstcCpu->au32R[u32Rd] = (uint32_t)(int32_t)(int16_t)u32Rm;
+                    break;
+                case 1U:    /* SXTB */
+                    pstcCpu->au32R[u32Rd] = (uint32_t)(int32_t)(int8_t)u32Rm;
+                    break;
+                case 2U:    /* UXTH */
+                    pstcCpu->au32R[u32Rd] = u32Rm & 0xFFFFUL;
+                    break;
+                default:    /* UXTB */
+                    pstcCpu->au32R[u32Rd] = u32Rm & 0xFFUL;
+                    break;
+            }
+            break;
+        case 0x4U:
+        case 0x5U:  /* PUSH */
+            u32Addr = pstcCpu->au32R[THUMB_SP];
+            for (i = 0UL; i < 9UL; i++) {
+                if (0UL != BIT(u32Inst, i)) {
+                    u32Addr -= 4UL;
+                    u32Cycles++;
+                }
+            }
+            pstcCpu->au32R[THUMB_SP] = u32Addr;
+            for (i = 0UL; i < 8UL; i++) {
+                if (0UL != BIT(u32Inst, i)) {
+                    THUMB_Write(pstcCpu, u32Addr, 4UL, pstcCpu->au32R[i], u32Pc);
+                    u32Addr += 4UL;
+                }
+            }
+            if (0UL != BIT(u32Inst, 8U)) {
+                THUMB_Write(pstcCpu, u32Addr, 4UL, pstcCpu->au32R[THUMB_LR], u32Pc);
+            }
+            break;
+        case 0x6U:  /* CPSIE i, CPSID i */
+            if (0x0062UL == (u32Inst & 0x00EFUL)) {
+                pstcCpu->u32Primask = BIT(u32Inst, 4U);
+            } else {
+                THUMB_Stop(pstcCpu, THUMB_STOP_UNDEF, u32Pc);
+            }
+            break;
+        case 0xAU:
+            switch (BITS(u32Inst, 7U, 6U)) {
+                case 0U:    /* REV */
+                    pstcCpu->au32R[u32Rd] = __builtin_bswap32(u32Rm);
+                    break;
+                case 1U:    /* REV16 */
+                    pstcCpu->au32R[u32Rd] = ((u32Rm & 0xFF00FF00UL) >> 8U) | ((u32Rm & 0x00FF00FFUL) << 8U);
+                    break;
+                case 3U:    /* REVSH */
+                    pstcCpu->au32R[u32Rd] = (uint32_t)(int32_t)(int16_t)(((u32Rm & 0xFFUL) << 8U) |
+                                                                         ((u32Rm >> 8U) & 0xFFUL));
+                    break;
+                default:
+                    THUMB_Stop(pstcCpu, THUMB_STOP_UNDEF, u32Pc);
+                    break;
+            }
+            break;
+        case 0xCU:
+        case 0xDU:  /* POP */
+            u32Addr = pstcCpu->au32R[THUMB_SP];
+            for (i = 0UL; i < 8UL; i++) {
+                if (0UL != BIT(u32Inst, i)) {
+                    pstcCpu->au32R[i] = THUMB_Read(pstcCpu, u32Addr, 4UL, u32Pc);
+                    u32Addr += 4UL;
+                    u32Cycles++;
+                }
+            }
+            if (0UL != BIT(u32Inst, 8U)) {
+                u32Target = THUMB_Read(pstcCpu, u32Addr, 4UL, u32Pc);
+                u32Addr += 4UL;
+                u32Cycles += 3UL;
+            }
+            pstcCpu->au32R[THUMB_SP] = u32Addr;
+            if (0UL != BIT(u32Inst, 8U)) {
+                THUMB_BranchX(pstcCpu, u32Target, u32Pc);
+            }
+            break;
+        case 0xEU:  /* BKPT */
+            THUMB_Stop(pstcCpu, THUMB_STOP_BKPT, u32Pc);
+            break;
+        case 0xFU:  /* NOP, YIELD, WFE, WFI, SEV */
+            if ((0UL != BITS(u32Inst, 3U, 0U)) || (BITS(u32Inst, 7U, 4U) > 4UL)) {
+                THUMB_Stop(pstcCpu, THUMB_STOP_UNDEF, u32Pc);
+            }
+            break;
+        default:
+            THUMB_Stop(pstcCpu, THUMB_STOP_UNDEF, u32Pc);
+            break;
+    }
+    return u32Cycles;
+}
+
+/**
+ * @brief  Reset the core: SP and PC from the vector table at address 0.
+ * @param  [in] pstcCpu                 Pointer to the core, the bus members must be set.
+ * @retval None
+ */
+void THUMB_Reset(stc_thumb_cpu_t *pstcCpu)
+{
+    uint32_t i;
+
+    for (i = 0UL; i < 16UL; i++) {
+        pstcCpu->au32R[i] = 0UL;
+    }
+    pstcCpu->u32Apsr = 0UL;
+    pstcCpu->u32Primask = 0UL;
+    pstcCpu->u64Cycles = 0ULL;
+    pstcCpu->u64Insts = 0ULL;
+    if (0UL == pstcCpu->u32MulCycles) {
+        pstcCpu->u32MulCycles = 1UL;
+    }
+    pstcCpu->u32Stop = THUMB_RUNNING;
+    pstcCpu->u32StopPc = 0UL;
+    pstcCpu->u32FaultAddr = 0UL;
+    pstcCpu->au32R[THUMB_SP] = THUMB_Read(pstcCpu, 0UL, 4UL, 0UL) & ~3UL;
+    pstcCpu->au32R[THUMB_PC] = THUMB_Read(pstcCpu, 4UL, 4UL, 0UL) & ~1UL;
+}
+
+/**
+ * @brief  Execute one instruction.
+ * @param  [in] pstcCpu                 Pointer to the core
+ * @retval u32Stop after the instruction, THUMB_RUNNING to continue.
+ */
+uint32_t THUMB_Step(stc_thumb_cpu_t *pstcCpu)
+{
+    uint32_t u32Pc = pstcCpu->au32R[THUMB_PC];
+    uint32_t u32Inst;
+    uint32_t u32Rd;
+    uint32_t u32Rn;
+    uint32_t u32Rm;
+    uint32_t u32Imm;
+    uint32_t u32Addr;
+    uint32_t u32Cycles = CYC_ALU;
+    uint32_t u32Count;
+    uint32_t i;
+
+    if (THUMB_RUNNING != pstcCpu->u32Stop) {
+        return pstcCpu->u32Stop;
+    }
+
+    u32Inst = THUMB_Read(pstcCpu, u32Pc, 2UL, u32Pc);
+    pstcCpu->au32R[THUMB_PC] = u32Pc + 2UL;
+    u32Rd = BITS(u32Inst, 2U, 0U);
+    u32Rn = BITS(u32Inst, 5U, 3U);
+
+    switch (u32Inst >> 11U) {
+        case 0x00U: /* LSLS Rd, Rm, #imm5 */
+        case 0x01U: /* LSRS */
+        case 0x02U: /* ASRS */
+            u32Imm = BITS(u32Inst, 10U, 6U);
+            u32Rm = pstcCpu->au32R[u32Rn];
+            if ((0UL == u32Imm) && (0x00U != (u32Inst >> 11U))) {
+                u32Imm = 32UL;
+            }
+            pstcCpu->au32R[u32Rd] = THUMB_ShiftReg(pstcCpu, u32Inst >> 11U, u32Rm, u32Imm);
+            THUMB_SetNZ(pstcCpu, pstcCpu->au32R[u32Rd]);
+            break;
+        case 0x03U: /* ADDS/SUBS register or #imm3 */
+            u32Imm = BITS(u32Inst, 8U, 6U);
+            u32Rm = (0UL != BIT(u32Inst, 10U)) ? u32Imm : pstcCpu->au32R[u32Imm];
+            if (0UL != BIT(u32Inst, 9U)) {
+                pstcCpu->au32R[u32Rd] = THUMB_AddWithCarry(pstcCpu, pstcCpu->au32R[u32Rn], ~u32Rm, 1UL, 1UL);
+            } else {
+                pstcCpu->au32R[u32Rd] = THUMB_AddWithCarry(pstcCpu, pstcCpu->au32R[u32Rn], u32Rm, 0UL, 1UL);
+            }
+            break;
+        case 0x04U: /* MOVS Rd, #imm8 */
+            u32Rd = BITS(u32Inst, 10U, 8U);
+            pstcCpu->au32R[u32Rd] = BITS(u32Inst, 7U, 0U);
+            THUMB_SetNZ(pstcCpu, pstcCpu->au32R[u32Rd]);
+            break;
+        case 0x05U: /* CMP Rn, #imm8 */
+            (void)THUMB_AddWithCarry(pstcCpu, pstcCpu->au32R[BITS(u32Inst, 10U, 8U)], ~BITS(u32Inst, 7U, 0U), 1UL, 1UL);
+            break;
+        case 0x06U: /* ADDS Rdn, #imm8 */
+            u32Rd = BITS(u32Inst, 10U, 8U);
+            pstcCpu->au32R[u32Rd] = THUMB_AddWithCarry(pstcCpu, pstcCpu->au32R[u32Rd], BITS(u32Inst, 7U, 0U), 0UL, 1UL);
+            break;
+        case 0x07U: /* SUBS Rdn, #imm8 */
+            u32Rd = BITS(u32Inst, 10U, 8U);
+            pstcCpu->au32R[u32Rd] = THUMB_AddWithCarry(pstcCpu, pstcCpu->au32R[u32Rd], ~BITS(u32Inst, 7U, 0U), 1UL, 1UL);
+            break;
+        case 0x08U:
+            if (0UL == BIT(u32Inst, 10U)) {
+                u32Cycles = THUMB_DataProc(pstcCpu, u32Inst);
+            } else {
+                /* ADD, CMP, MOV with high registers, BX, BLX */
+                u32Rd = (BIT(u32Inst, 7U) << 3U) | BITS(u32Inst, 2U, 0U);
+                u32Rm = THUMB_GetReg(pstcCpu, BITS(u32Inst, 6U, 3U), u32Pc);
+                switch (BITS(u32Inst, 9U, 8U)) {
+                    case 0U:    /* ADD */
+                        u32Imm = THUMB_GetReg(pstcCpu, u32Rd, u32Pc) + u32Rm;
+                        if (THUMB_PC == u32Rd) {
+                            THUMB_Branch(pstcCpu, u32Imm & ~1UL, u32Pc);
+                            u32Cycles = CYC_BRANCH;
+                        } else {
+                            pstcCpu->au32R[u32Rd] = u32Imm;
+                        }
+                        break;
+                    case 1U:    /* CMP */
+                        (void)THUMB_AddWithCarry(pstcCpu, THUMB_GetReg(pstcCpu, u32Rd, u32Pc), ~u32Rm, 1UL, 1UL);
+                        break;
+                    case 2U:    /* MOV */
+                        if (THUMB_PC == u32Rd) {
+                            THUMB_Branch(pstcCpu, u32Rm & ~1UL, u32Pc);
+                            u32Cycles = CYC_BRANCH;
+                        } else {
+                            pstcCpu->au32R[u32Rd] = u32Rm;
+                        }
+                        break;
+                    default:    /* BX, BLX */
+                        if (0UL != BIT(u32Inst, 7U)) {
+                            pstcCpu->au32R[THUMB_LR] = (u32Pc + 2UL) | 1UL;
+                        }
+                        THUMB_BranchX(pstcCpu, u32Rm, u32Pc);
+                        u32Cycles = CYC_BRANCH;
+                        break;
+                }
+            }
+            break;
+        case 0x09U: /* LDR Rt, [PC, #imm8] */
+            u32Addr = ((u32Pc + 4UL) & ~3UL) + (BITS(u32Inst, 7U, 0U) << 2U);
+            pstcCpu->au32R[BITS(u32Inst, 10U, 8U)] = THUMB_Read(pstcCpu, u32Addr, 4UL, u32Pc);
+            u32Cycles = CYC_MEM;
+            break;
+        case 0x0AU:
+        case 0x0BU: /* Load/store register offset */
+            u32Addr = pstcCpu->au32R[u32Rn] + pstcCpu->au32R[BITS(u32Inst, 8U, 6U)];
+            switch (BITS(u32Inst, 11U, 9U)) {
+                case 0U:    /* STR */
+                    THUMB_Write(pstcCpu, u32Addr, 4UL, pstcCpu->au32R[u32Rd], u32Pc);
+                    break;
+                case 1U:    /* STRH */
+                    THUMB_Write(pstcCpu, u32Addr, 2UL, pstcCpu->au32R[u32Rd], u32Pc);
+                    break;
+                case 2U:    /* STRB */
+                    THUMB_Write(pstcCpu, u32Addr, 1UL, pstcCpu->au32R[u32Rd], u32Pc);
+                    break;
+                case 3U:    /* LDRSB */
+                    pstcCpu->au32R[u32Rd] = (uint32_t)(int32_t)(int8_t)THUMB_Read(pstcCpu, u32Addr, 1UL, u32Pc);
+                    break;
+                case 4U:    /* LDR */
+                    pstcCpu->au32R[u32Rd] = THUMB_Read(pstcCpu, u32Addr, 4UL, u32Pc);
+                    break;
+                case 5U:    /* LDRH */
+                    pstcCpu->au32R[u32Rd] = THUMB_Read(pstcCpu, u32Addr, 2UL, u32Pc);
+                    break;
+                case 6U:    /* LDRB */
+                    pstcCpu->au32R[u32Rd] = THUMB_Read(pstcCpu, u32Addr, 1UL, u32Pc);
+                    break;
+                default:    /* LDRSH */
+                    pstcCpu->au32R[u32Rd] = (uint32_t)(int32_t)(int16_t)THUMB_Read(pstcCpu, u32Addr, 2UL, u32Pc);
+                    break;
+            }
+            u32Cycles = CYC_MEM;
+            break;
+        case 0x0CU: /* STR Rt, [Rn, #imm5 * 4] */
+            THUMB_Write(pstcCpu, pstcCpu->au32R[u32Rn] + (BITS(u32Inst, 10U, 6U) << 2U), 4UL, pstcCpu->au32R[u32Rd], u32Pc);
+            u32Cycles = CYC_MEM;
+            break;
+        case 0x0DU: /* LDR Rt, [Rn, #imm5 * 4] */
+            pstcCpu->au32R[u32Rd] = THUMB_Read(pstcCpu, pstcCpu->au32R[u32Rn] + (BITS(u32Inst, 10U, 6U) << 2U), 4UL, u32Pc);
+            u32Cycles = CYC_MEM;
+            break;
+        case 0x0EU: /* STRB Rt, [Rn, #imm5] */
+            THUMB_Write(pstcCpu, pstcCpu->au32R[u32Rn] + BITS(u32Inst, 10U, 6U), 1UL, pstcCpu->au32R[u32Rd], u32Pc);
+            u32Cycles = CYC_MEM;
+            break;
+        case 0x0FU: /* LDRB Rt, [Rn, #imm5] */
+            pstcCpu->au32R[u32Rd] = THUMB_Read(pstcCpu, pstcCpu->au32R[u32Rn] + BITS(u32Inst, 10U, 6U), 1UL, u32Pc);
+            u32Cycles = CYC_MEM;
+            break;
+        case 0x10U: /* STRH Rt, [Rn, #imm5 * 2] */
+            THUMB_Write(pstcCpu, pstcCpu->au32R[u32Rn] + (BITS(u32Inst, 10U, 6U) << 1U), 2UL, pstcCpu->au32R[u32Rd], u32Pc);
+            u32Cycles = CYC_MEM;
+            break;
+        case 0x11U: /* LDRH Rt, [Rn, #imm5 * 2] */
+            pstcCpu->au32R[u32Rd] = THUMB_Read(pstcCpu, pstcCpu->au32R[u32Rn] + (BITS(u32Inst, 10U, 6U) << 1U), 2UL, u32Pc);
+            u32Cycles = CYC_MEM;
+            break;
+        case 0x12U: /* STR Rt, [SP, #imm8 * 4] */
+            THUMB_Write(pstcCpu, pstcCpu->au32R[THUMB_SP] + (BITS(u32Inst, 7U, 0U) << 2U), 4UL,
+                        pstcCpu->au32R[BITS(u32Inst, 10U, 8U)], u32Pc);
+            u32Cycles = CYC_MEM;
+            break;
+        case 0x13U: /* LDR Rt, [SP, #imm8 * 4] */
+            pstcCpu->au32R[BITS(u32Inst, 10U, 8U)] =
+                THUMB_Read(pstcCpu, pstcCpu->au32R[THUMB_SP] + (BITS(u32Inst, 7U, 0U) << 2U), 4UL, u32Pc);
+            u32Cycles = CYC_MEM;
+            break;
+        case 0x14U: /* ADR Rd, #imm8 * 4 */
+            pstcCpu->au32R[BITS(u32Inst, 10U, 8U)] = ((u32Pc + 4UL) & ~3UL) + (BITS(u32Inst, 7U, 0U) << 2U);
+            break;
+        case 0x15U: /* ADD Rd, SP, #imm8 * 4 */
+            pstcCpu->au32R[BITS(u32Inst, 10U, 8U)] = pstcCpu->au32R[THUMB_SP] + (BITS(u32Inst, 7U, 0U) << 2U);
+            break;
+        case 0x16U:
+        case 0x17U:
+            u32Cycles = THUMB_ExecMisc(pstcCpu, u32Inst, u32Pc);
+            break;
+        case 0x18U: /* STM Rn!, {reglist} */
+            u32Rn = BITS(u32Inst, 10U, 8U);
+            u32Addr = pstcCpu->au32R[u32Rn];
+            for (i = 0UL; i < 8UL; i++) {
+                if (0UL != BIT(u32Inst, i)) {
+                    THUMB_Write(pstcCpu, u32Addr, 4UL, pstcCpu->au32R[i], u32Pc);
+                    u32Addr += 4UL;
+                    u32Cycles++;
+                }
+            }
+            pstcCpu->au32R[u32Rn] = u32Addr;
+            break;
+        case 0x19U: /* LDM Rn(!), {reglist} */
+            u32Rn = BITS(u32Inst, 10U, 8U);
+            u32Addr = pstcCpu->au32R[u32Rn];
+            for (i = 0UL; i < 8UL; i++) {
+                if (0UL != BIT(u32Inst, i)) {
+                    pstcCpu->au32R[i] = THUMB_Read(pstcCpu, u32Addr, 4UL, u32Pc);
+                    u32Addr += 4UL;
+                    u32Cycles++;
+                }
+            }
+            if (0UL == BIT(u32Inst, u32Rn)) {
+                pstcCpu->au32R[u32Rn] = u32Addr;
+            }
+            break;
+        case 0x1AU:
+        case 0x1BU: /* B<cond>, UDF, SVC */
+            u32Count = BITS(u32Inst, 11U, 8U);
+            if (u32Count >= 0xEUL) {
+                THUMB_Stop(pstcCpu, THUMB_STOP_UNDEF, u32Pc);
+            } else if (0UL != THUMB_CondPass(pstcCpu->u32Apsr, u32Count)) {
+                u32Imm = (uint32_t)((int32_t)(int8_t)BITS(u32Inst, 7U, 0U) * 2);
+                THUMB_Branch(pstcCpu, u32Pc + 4UL + u32Imm, u32Pc);
+                u32Cycles = CYC_BRANCH;
+            } else {
+                /* Not taken */
+            }
+            break;
+        case 0x1CU: /* B */
+            u32Imm = BITS(u32Inst, 10U, 0U) << 1U;
+            if (0UL != BIT(u32Imm, 11U)) {
+                u32Imm |= 0xFFFFF000UL;
+            }
+            THUMB_Branch(pstcCpu, u32Pc + 4UL + u32Imm, u32Pc);
+            u32Cycles = CYC_BRANCH;
+            break;
+        default:    /* 32-bit instructions */
+            pstcCpu->au32R[THUMB_PC] = u32Pc + 4UL;
+            u32Cycles = THUMB_Exec32(pstcCpu, u32Inst, THUMB_Read(pstcCpu, u32Pc + 2UL, 2UL, u32Pc), u32Pc);
+            break;
+    }
+
+    pstcCpu->u64Cycles += u32Cycles;
+    pstcCpu->u64Insts++;
+    return pstcCpu->u32Stop;
+}
+
+/**
+ * @brief  Execute until the core stops.
+ * @param  [in] pstcCpu                 Pointer to the core
+ * @param  [in] u64MaxCycles            Stop with THUMB_STOP_CYCLES after this many cycles
+ * @retval @ref THUMB_Stop_Reason
+ */
+uint32_t THUMB_Run(stc_thumb_cpu_t *pstcCpu, uint64_t u64MaxCycles)
+{
+    while (THUMB_RUNNING == THUMB_Step(pstcCpu)) {
+        if (pstcCpu->u64Cycles >= u64MaxCycles) {
+            THUMB_Stop(pstcCpu, THUMB_STOP_CYCLES, pstcCpu->au32R[THUMB_PC]);
+        }
+    }
+    return pstcCpu->u32Stop;
+}
+
+/**
+ * @brief  Get the name of a stop reason.
+ * @param  [in] u32Stop                 @ref THUMB_Stop_Reason
+ * @retval Name
+ */
+const char *THUMB_GetStopString(uint32_t u32Stop)
+{
+    static const char *const apcStop[] = {
+        "running", "loop", "bkpt", "cycle limit", "undefined instruction", "bus fault", "alignment fault"
+    };
+
+    return (u32Stop < (sizeof(apcStop) / sizeof(apcStop[0]))) ? apcStop[u32Stop] : "?";
+}
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
@@ -0,0 +1,161 @@
+/**
+ *******************************************************************************
+ * @file  host/emu/hc32_thumb.h
+ * @brief This file contains all the functions prototypes of the ARMv6-M Thumb
+ *        instruction set emulator with Cortex-M0+ cycle counting.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-16       CDT             First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2022-2023, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+#ifndef __HC32_THUMB_H__
+#define __HC32_THUMB_H__
+
+/* C binding of definitions if building with C++ compiler */
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include <stdint.h>
+
+/**
+ * @addtogroup HC32F120_DDL_Host
+ * @{
+ */
+
+/**
+ * @addtogroup THUMB
+ * @{
+ */
+
+/*******************************************************************************
+ * Global type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @defgroup THUMB_Global_Types THUMB Global Types
+ * @{
+ */
+
+/**
+ * @brief Bus read, u32Size is 1, 2 or 4 bytes.
+ * @retval 0 on success, any other value raises a fault.
+ */
+typedef int32_t (*func_ptr_thumb_read_t)(void *pvArg, uint32_t u32Addr, uint32_t u32Size, uint32_t *pu32Data);
+
+/**
+ * @brief Bus write, u32Size is 1, 2 or 4 bytes.
+ * @retval 0 on success, any other value raises a fault.
+ */
+typedef int32_t (*func_ptr_thumb_write_t)(void *pvArg, uint32_t u32Addr, uint32_t u32Size, uint32_t u32Data);
+
+/**
+ * @brief Emulated core state.
+ */
+typedef struct {
+    uint32_t au32R[16];                 /*!< R0 ~ R12, SP, LR, PC. PC is the address of the next instruction. */
+    uint32_t u32Apsr;                   /*!< N, Z, C, V in bit 31 ~ 28. */
+    uint32_t u32Primask;                /*!< PRIMASK, no effect on the emulation. */
+    uint64_t u64Cycles;                 /*!< Core clock cycles executed. */
+    uint64_t u64Insts;                  /*!< Instructions executed. */
+    uint32_t u32MulCycles;              /*!< Cycles of MULS, 1 (fast multiplier) or 32 (small multiplier). */
+    uint32_t u32Stop;                   /*!< @ref THUMB_Stop_Reason, THUMB_RUNNING while executing. */
+    uint32_t u32StopPc;                 /*!< Address of the instruction that stopped the core. */
+    uint32_t u32FaultAddr;              /*!< Bus address of a THUMB_STOP_BUS_FAULT. */
+    func_ptr_thumb_read_t pfnRead;      /*!< Bus read. */
+    func_ptr_thumb_write_t pfnWrite;    /*!< Bus write. */
+    void *pvBusArg;                     /*!< Argument of pfnRead/pfnWrite. */
+} stc_thumb_cpu_t;
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup THUMB_Global_Macros THUMB Global Macros
+ * @{
+ */
+
+/**
+ * @defgroup THUMB_Register THUMB Register
+ * @{
+ */
+#define THUMB_SP                        (13U)
+#define THUMB_LR                        (14U)
+#define THUMB_PC                        (15U)
+/**
+ * @}
+ */
+
+/**
+ * @defgroup THUMB_Stop_Reason THUMB Stop Reason
+ * @{
+ */
+#define THUMB_RUNNING                   (0UL)
+#define THUMB_STOP_LOOP                 (1UL)   /*!< Branch to itself, the end of a bare-metal program. */
+#define THUMB_STOP_BKPT                 (2UL)   /*!< BKPT instruction. */
+#define THUMB_STOP_CYCLES               (3UL)   /*!< Cycle limit of THUMB_Run() reached. */
+#define THUMB_STOP_UNDEF                (4UL)   /*!< Undefined or unsupported instruction, SVC. */
+#define THUMB_STOP_BUS_FAULT            (5UL)   /*!< Bus read or write failed. */
+#define THUMB_STOP_ALIGN_FAULT          (6UL)   /*!< Unaligned halfword or word access. */
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions ('extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+  Global function prototypes (definition in C source)
+ ******************************************************************************/
+/**
+ * @addtogroup THUMB_Global_Functions
+ * @{
+ */
+void THUMB_Reset(stc_thumb_cpu_t *pstcCpu);
+uint32_t THUMB_Step(stc_thumb_cpu_t *pstcCpu);
+uint32_t THUMB_Run(stc_thumb_cpu_t *pstcCpu, uint64_t u64MaxCycles);
+const char *THUMB_GetStopString(uint32_t u32Stop);
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __HC32_THUMB_H__ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
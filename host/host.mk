@@ -0,0 +1,67 @@
+#-{ Shared rules for the host (x86-64 Linux) projects }-------------------------
+#
+# The LL drivers are built with the host compiler against the simulated
+# register file in host/sim, see host/sim/hc32_sim.c.
+#
+# Include from host/<name>/Makefile after setting:
+#   NAME      - project name, used for the output files
+#   APP_SRC   - project sources (source/main.c etc.)
+# Optional:
+#   OPT       - optimization flags (default -O2)
+#   LIB_SRC   - library sources (default the LL drivers), empty for host tools
+#               that only use the simulated register file
+# A source/hc32f1xx_conf.h of the project replaces host/config/hc32f1xx_conf.h.
+
+ROOT?=../..
+BIN=./binary
+APP_INC=./source
+HOST=$(ROOT)/host
+DDL=$(ROOT)/drivers/hc32_ll_driver
+DEV=$(ROOT)/drivers/cmsis/Device/HDSC/hc32f1xx
+
+#-{ Compiler Definitions }------------------------------------------------------
+
+CC=gcc
+
+OPT?=-O2
+# The drivers keep register and buffer addresses in uint32_t, the program is
+# linked without PIE and SIM_Run() puts the stack in the low 4GB
+DFLAGS=-fno-pie -include $(HOST)/sim/cmsis_host.h
+# _GNU_SOURCE for memfd_create() and the ucontext register names of host/sim
+DEFS=-DHC32F120 -DUSE_DDL_DRIVER -D_GNU_SOURCE
+INCS=-I$(APP_INC) -I$(HOST)/config -I$(HOST)/sim -I$(DDL)/inc -I$(ROOT)/drivers/cmsis/Include -I$(DEV)/Include
+WARN=-Wall -Wextra -Wno-pointer-to-int-cast -Wno-int-to-pointer-cast
+CFLAGS=$(DFLAGS) $(OPT) -g $(WARN) $(DEFS) $(INCS)
+
+LFLAGS=-no-pie
+
+#-{ Sources }-------------------------------------------------------------------
+
+LIB_SRC?=$(wildcard $(DDL)/src/*.c) $(DEV)/Source/system_hc32f120.c
+SRCS=$(APP_SRC) $(LIB_SRC) $(wildcard $(HOST)/sim/*.c)
+OBJS=$(addprefix $(BIN)/,$(notdir $(SRCS:.c=.o)))
+
+vpath %.c $(sort $(dir $(SRCS)))
+
+EXE=$(BIN)/$(NAME)
+
+#-{ Rules }---------------------------------------------------------------------
+
+all: $(EXE)
+
+$(EXE): $(OBJS)
+	$(CC) $(LFLAGS) $(OBJS) -o $(EXE)
+
+$(BIN)/%.o: %.c | $(BIN)
+	$(CC) $(CFLAGS) -c $< -o $@
+
+$(BIN):
+	mkdir -p $(BIN)
+
+run: $(EXE)
+	$(EXE)
+
+clean:
+	rm -rf $(BIN)
+
+.PHONY: all run clean
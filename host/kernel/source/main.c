@@ -0,0 +1,629 @@
+/**
+ *******************************************************************************
+ * @file  host/kernel/source/main.c
+ * @brief Micro-kernel on the host: priority order, blocking and wakeup on
+ *        semaphores and queues, and timeouts. The context switch of
+ *        PendSV_Handler() is replaced by ucontexts.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-17       CDT             First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2022-2023, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include <ucontext.h>
+
+#include "hc32_sim.h"
+
+/**
+ * @addtogroup HC32F120_DDL_Host
+ * @{
+ */
+
+/**
+ * @defgroup KERNEL_HOST Kernel Host
+ * @brief The kernel keeps a stack pointer per thread, the host keeps a ucontext
+ *        per initial stack frame. The stack pointer handed to
+ *        KERNEL_SwitchContext() is the initial frame of the thread, so the
+ *        one it returns finds the ucontext back. A thread created on a used
+ *        stack is found by the entry point KERNEL_TcbInit() writes to the frame.
+ * @note  KERNEL_Idle() is one SysTick period: the tick advances only when all
+ *        the other threads wait, the timeouts are exact.
+ * @{
+ */
+
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @brief Host context of a kernel thread.
+ */
+typedef struct {
+    uint32_t u32Frame;                  /*!< Initial frame on the kernel stack, 0 for a free slot. */
+    uint32_t u32Entry;                  /*!< Thread function. */
+    uint32_t u32Arg;                    /*!< Thread function argument. */
+    uint32_t u32Exit;                   /*!< Return address, KERNEL_ThreadExit(). */
+    ucontext_t stcCtx;                  /*!< Saved host context. */
+} stc_kernel_host_thread_t;
+
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+#define KERNEL_HOST_THREAD_NUM  (KERNEL_THREAD_NUM + 1U)
+#define KERNEL_HOST_STACK_SIZE  (0x10000UL)
+
+/* Initial frame words written by KERNEL_TcbInit() */
+#define KERNEL_HOST_FRAME_R0    (8U)
+#define KERNEL_HOST_FRAME_LR    (13U)
+#define KERNEL_HOST_FRAME_PC    (14U)
+
+/* Ticks before a case is stopped as dead-locked */
+#define TEST_TICK_MAX           (1000UL)
+#define TEST_TRACE_LEN          (32U)
+
+#define TEST_QUEUE_DEPTH        (2U)
+#define TEST_QUEUE_ITEMS        (4U)
+
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+/* Called by PendSV_Handler on the target, hc32_ll_kernel.c */
+uint32_t KERNEL_SwitchContext(uint32_t u32Sp);
+
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+static stc_kernel_host_thread_t m_astcThread[KERNEL_HOST_THREAD_NUM];
+static stc_kernel_host_thread_t *m_pstcCurrent;
+/* In .bss, the drivers keep addresses in uint32_t */
+static uint64_t m_au64HostStack[KERNEL_HOST_THREAD_NUM + 1U][KERNEL_HOST_STACK_SIZE / 8U];
+static ucontext_t m_stcMainCtx;
+static ucontext_t m_stcStartCtx;
+
+static uint32_t m_u32ThreadNum;
+static uint32_t m_u32DoneNum;
+static char m_acTrace[TEST_TRACE_LEN];
+static uint32_t m_u32TraceLen;
+static int32_t m_i32CaseRet;
+
+static stc_kernel_sem_t m_stcSem;
+static stc_kernel_queue_t m_stcQueue;
+static uint32_t m_au32QueueBuf[TEST_QUEUE_DEPTH];
+static uint32_t m_au32Received[TEST_QUEUE_ITEMS];
+
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @brief  First code of a thread context: the exception return, then the thread function.
+ * @param  None
+ * @retval None
+ */
+static void KERNEL_HOST_ThreadEntry(void)
+{
+    const stc_kernel_host_thread_t *pstcThread = m_pstcCurrent;
+
+    SIM_SetPrimask(0UL);
+    ((void (*)(void *))(uintptr_t)pstcThread->u32Entry)((void *)(uintptr_t)pstcThread->u32Arg);
+    ((void (*)(void))(uintptr_t)pstcThread->u32Exit)();
+}
+
+/**
+ * @brief  Set up a context running pfnEntry on a host stack.
+ * @param  [out] pstcCtx                Context
+ * @param  [in] pu64Stack               Stack of KERNEL_HOST_STACK_SIZE bytes
+ * @param  [in] pfnEntry                Context function
+ * @retval None
+ */
+static void KERNEL_HOST_MakeContext(ucontext_t *pstcCtx, uint64_t *pu64Stack, void (*pfnEntry)(void))
+{
+    (void)getcontext(pstcCtx);
+    pstcCtx->uc_stack.ss_sp = pu64Stack;
+    pstcCtx->uc_stack.ss_size = KERNEL_HOST_STACK_SIZE;
+    pstcCtx->uc_link = NULL;
+    makecontext(pstcCtx, pfnEntry, 0);
+}
+
+/**
+ * @brief  Find the host context of a stack pointer returned by KERNEL_SwitchContext().
+ * @param  [in] u32Sp                   Stack pointer
+ * @retval Host context, set up if the thread never ran.
+ */
+static stc_kernel_host_thread_t *KERNEL_HOST_GetThread(uint32_t u32Sp)
+{
+    uint32_t *pu32Frame = (uint32_t *)(uintptr_t)u32Sp;
+    stc_kernel_host_thread_t *pstcThread = NULL;
+    uint32_t i;
+
+    for (i = 0UL; i < KERNEL_HOST_THREAD_NUM; i++) {
+        if ((u32Sp == m_astcThread[i].u32Frame) ||
+            ((NULL == pstcThread) && (0UL == m_astcThread[i].u32Frame))) {
+            pstcThread = &m_astcThread[i];
+        }
+    }
+    /* A new thread: never seen, or a new entry point on the stack of an ended one */
+    if ((u32Sp != pstcThread->u32Frame) || (0UL != pu32Frame[KERNEL_HOST_FRAME_PC])) {
+        pstcThread->u32Frame = u32Sp;
+        pstcThread->u32Entry = pu32Frame[KERNEL_HOST_FRAME_PC];
+        pstcThread->u32Arg = pu32Frame[KERNEL_HOST_FRAME_R0];
+        pstcThread->u32Exit = pu32Frame[KERNEL_HOST_FRAME_LR];
+        pu32Frame[KERNEL_HOST_FRAME_PC] = 0UL;
+        KERNEL_HOST_MakeContext(&pstcThread->stcCtx, m_au64HostStack[pstcThread - m_astcThread],
+                                &KERNEL_HOST_ThreadEntry);
+    }
+
+    return pstcThread;
+}
+
+/**
+ * @brief  PendSV handler of the host: saves the running thread, resumes the next one.
+ * @param  None
+ * @retval None
+ */
+static void KERNEL_HOST_PendSV(void)
+{
+    stc_kernel_host_thread_t *pstcPrev = m_pstcCurrent;
+    uint32_t u32Sp = (NULL != pstcPrev) ? pstcPrev->u32Frame : 0UL;
+
+    m_pstcCurrent = KERNEL_HOST_GetThread(KERNEL_SwitchContext(u32Sp));
+    if (NULL == pstcPrev) {
+        /* Out of KERNEL_Start(), never resumed */
+        (void)swapcontext(&m_stcStartCtx, &m_pstcCurrent->stcCtx);
+    } else if (pstcPrev != m_pstcCurrent) {
+        (void)swapcontext(&pstcPrev->stcCtx, &m_pstcCurrent->stcCtx);
+    } else {
+        /* Pended, then the same thread was selected again */
+    }
+}
+
+/**
+ * @brief  Entry of the context calling KERNEL_Start().
+ * @param  None
+ * @retval None
+ */
+static void KERNEL_HOST_StartEntry(void)
+{
+    KERNEL_Start();
+}
+
+/**
+ * @brief  Start the kernel, return once the threads of the case ended.
+ * @param  [in] u32ThreadNum            Threads of the case, they call Test_Done() at their end.
+ * @retval int32_t:
+ *           - LL_OK:                   All ended.
+ *           - LL_ERR_TIMEOUT:          TEST_TICK_MAX ticks passed before.
+ */
+static int32_t KERNEL_HOST_Run(uint32_t u32ThreadNum)
+{
+    (void)memset(m_astcThread, 0, sizeof(m_astcThread));
+    m_pstcCurrent = NULL;
+    m_u32ThreadNum = u32ThreadNum;
+    m_u32DoneNum = 0UL;
+
+    KERNEL_HOST_MakeContext(&m_stcStartCtx, m_au64HostStack[KERNEL_HOST_THREAD_NUM], &KERNEL_HOST_StartEntry);
+    SIM_SetPendSVHandler(&KERNEL_HOST_PendSV);
+    (void)swapcontext(&m_stcMainCtx, &m_stcStartCtx);
+    SIM_SetPendSVHandler(NULL);
+    SCB->ICSR = 0UL;
+    SIM_SetPrimask(0UL);
+
+    return (m_u32DoneNum == m_u32ThreadNum) ? LL_OK : LL_ERR_TIMEOUT;
+}
+
+/**
+ * @brief  Idle hook: one SysTick period, ends the case once all its threads ended.
+ * @param  None
+ * @retval None
+ */
+void KERNEL_Idle(void)
+{
+    if ((m_u32DoneNum == m_u32ThreadNum) || (KERNEL_GetTick() >= TEST_TICK_MAX)) {
+        (void)setcontext(&m_stcMainCtx);
+    }
+    KERNEL_TickHandler();
+}
+
+/**
+ * @brief  Print one result line.
+ * @param  [in] pcName                  Case name
+ * @param  [in] i32Ret                  LL_OK if the case passed
+ * @retval i32Ret
+ */
+static int32_t Test_Report(const char *pcName, int32_t i32Ret)
+{
+    (void)printf("%-28s %s (%ld)\n", pcName, (LL_OK == i32Ret) ? "pass" : "FAIL", (long)i32Ret);
+    return i32Ret;
+}
+
+/**
+ * @brief  Start a case.
+ * @param  None
+ * @retval None
+ */
+static void Test_Begin(void)
+{
+    KERNEL_Init();
+    m_u32TraceLen = 0UL;
+    (void)memset(m_acTrace, 0, sizeof(m_acTrace));
+    m_i32CaseRet = LL_OK;
+}
+
+/**
+ * @brief  Run the threads of a case and check the trace they left.
+ * @param  [in] u32ThreadNum            Threads created before the call, and by them.
+ * @param  [in] pcTrace                 Expected trace.
+ * @retval int32_t                      LL_OK if all threads ended, passed their checks and left pcTrace.
+ */
+static int32_t Test_End(uint32_t u32ThreadNum, const char *pcTrace)
+{
+    int32_t i32Ret = KERNEL_HOST_Run(u32ThreadNum);
+
+    if ((LL_OK == i32Ret) && ((LL_OK != m_i32CaseRet) || (0 != strcmp(m_acTrace, pcTrace)))) {
+        (void)printf("trace \"%s\", expected \"%s\"\n", m_acTrace, pcTrace);
+        i32Ret = LL_ERR;
+    }
+    return i32Ret;
+}
+
+/**
+ * @brief  Append a character to the trace.
+ * @param  [in] cEvent                  Event
+ * @retval None
+ */
+static void Test_Trace(char cEvent)
+{
+    if (m_u32TraceLen < (TEST_TRACE_LEN - 1U)) {
+        m_acTrace[m_u32TraceLen++] = cEvent;
+    }
+}
+
+/**
+ * @brief  Fail the case unless a value is the expected one.
+ * @param  [in] i32Value                Value
+ * @param  [in] i32Expect               Expected value
+ * @retval None
+ */
+static void Test_Check(int32_t i32Value, int32_t i32Expect)
+{
+    if (i32Value != i32Expect) {
+        m_i32CaseRet = LL_ERR;
+    }
+}
+
+/**
+ * @brief  Thread: traces its argument, a character.
+ * @param  [in] pvArg                   Character
+ * @retval None
+ */
+static void Test_TraceThread(void *pvArg)
+{
+    Test_Trace((char)(uintptr_t)pvArg);
+    m_u32DoneNum++;
+}
+
+/**
+ * @brief  Thread: traces its argument three times, yielding after each.
+ * @param  [in] pvArg                   Character
+ * @retval None
+ */
+static void Test_YieldThread(void *pvArg)
+{
+    uint32_t i;
+
+    for (i = 0UL; i < 3UL; i++) {
+        Test_Trace((char)(uintptr_t)pvArg);
+        KERNEL_Yield();
+    }
+    m_u32DoneNum++;
+}
+
+/**
+ * @brief  Thread: creates a higher priority thread, which runs at once.
+ * @param  [in] pvArg                   Not used
+ * @retval None
+ */
+static void Test_CreatorThread(void *pvArg)
+{
+    (void)pvArg;
+    Test_Trace('1');
+    Test_Check(KERNEL_ThreadCreate(&Test_TraceThread, (void *)(uintptr_t)'2', 0U), LL_OK);
+    Test_Trace('3');
+    m_u32DoneNum++;
+}
+
+/**
+ * @brief  Priority order: the highest priority ready thread runs first, equal priorities
+ *         take turns, a new thread of higher priority preempts its creator.
+ * @param  None
+ * @retval int32_t                      LL_OK if all checks passed.
+ */
+static int32_t Test_Priority(void)
+{
+    int32_t i32Ret;
+
+    Test_Begin();
+    (void)KERNEL_ThreadCreate(&Test_TraceThread, (void *)(uintptr_t)'c', 2U);
+    (void)KERNEL_ThreadCreate(&Test_TraceThread, (void *)(uintptr_t)'a', 0U);
+    (void)KERNEL_ThreadCreate(&Test_TraceThread, (void *)(uintptr_t)'b', 1U);
+    i32Ret = Test_End(3UL, "abc");
+
+    if (LL_OK == i32Ret) {
+        Test_Begin();
+        (void)KERNEL_ThreadCreate(&Test_YieldThread, (void *)(uintptr_t)'x', 1U);
+        (void)KERNEL_ThreadCreate(&Test_YieldThread, (void *)(uintptr_t)'y', 1U);
+        i32Ret = Test_End(2UL, "xyxyxy");
+    }
+    if (LL_OK == i32Ret) {
+        Test_Begin();
+        (void)KERNEL_ThreadCreate(&Test_CreatorThread, NULL, 1U);
+        i32Ret = Test_End(2UL, "123");
+    }
+    if (LL_OK == i32Ret) {
+        /* All slots in use until a thread ends */
+        Test_Begin();
+        (void)KERNEL_ThreadCreate(&Test_TraceThread, (void *)(uintptr_t)'a', 0U);
+        (void)KERNEL_ThreadCreate(&Test_TraceThread, (void *)(uintptr_t)'b', 0U);
+        (void)KERNEL_ThreadCreate(&Test_TraceThread, (void *)(uintptr_t)'c', 0U);
+        i32Ret = (LL_ERR_BUF_FULL == KERNEL_ThreadCreate(&Test_TraceThread, NULL, 0U)) ? LL_OK : LL_ERR;
+        if (LL_OK == i32Ret) {
+            i32Ret = Test_End(3UL, "abc");
+        }
+    }
+    return Test_Report("KERNEL priority order", i32Ret);
+}
+
+/**
+ * @brief  Thread: takes the semaphore, traces its argument before and after.
+ * @param  [in] pvArg                   Character, lower case, upper case once taken.
+ * @retval None
+ */
+static void Test_TakeThread(void *pvArg)
+{
+    char cEvent = (char)(uintptr_t)pvArg;
+
+    Test_Trace(cEvent);
+    Test_Check(KERNEL_SemTake(&m_stcSem, KERNEL_WAIT_FOREVER), LL_OK);
+    Test_Trace((char)(cEvent - 'a' + 'A'));
+    m_u32DoneNum++;
+}
+
+/**
+ * @brief  Thread: gives the semaphore twice, traces 'g' before each and 'G' at the end.
+ * @param  [in] pvArg                   Not used
+ * @retval None
+ */
+static void Test_GiveThread(void *pvArg)
+{
+    (void)pvArg;
+    Test_Trace('g');
+    Test_Check(KERNEL_SemGive(&m_stcSem), LL_OK);
+    Test_Trace('g');
+    Test_Check(KERNEL_SemGive(&m_stcSem), LL_OK);
+    Test_Trace('G');
+    m_u32DoneNum++;
+}
+
+/**
+ * @brief  Thread: sends TEST_QUEUE_ITEMS items, traces 'S' after each.
+ * @param  [in] pvArg                   Not used
+ * @retval None
+ */
+static void Test_SendThread(void *pvArg)
+{
+    uint32_t i;
+
+    (void)pvArg;
+    for (i = 0UL; i < TEST_QUEUE_ITEMS; i++) {
+        Test_Check(KERNEL_QueueSend(&m_stcQueue, &i, KERNEL_WAIT_FOREVER), LL_OK);
+        Test_Trace('S');
+    }
+    m_u32DoneNum++;
+}
+
+/**
+ * @brief  Thread: receives TEST_QUEUE_ITEMS items, traces 'R' after each.
+ * @param  [in] pvArg                   Not used
+ * @retval None
+ */
+static void Test_ReceiveThread(void *pvArg)
+{
+    uint32_t i;
+
+    (void)pvArg;
+    for (i = 0UL; i < TEST_QUEUE_ITEMS; i++) {
+        Test_Check(KERNEL_QueueReceive(&m_stcQueue, &m_au32Received[i], KERNEL_WAIT_FOREVER), LL_OK);
+        Test_Trace('R');
+    }
+    m_u32DoneNum++;
+}
+
+/**
+ * @brief  Blocking and wakeup: a give or a send wakes the highest priority waiter, which
+ *         preempts the lower priority caller at once. A full queue blocks the sender.
+ * @param  None
+ * @retval int32_t                      LL_OK if all checks passed.
+ */
+static int32_t Test_Block(void)
+{
+    uint32_t i;
+    int32_t i32Ret;
+
+    /* The waiter of priority 1 gets the first give, before the giver goes on */
+    Test_Begin();
+    (void)KERNEL_SemInit(&m_stcSem, 0UL, 1UL);
+    (void)KERNEL_ThreadCreate(&Test_TakeThread, (void *)(uintptr_t)'b', 2U);
+    (void)KERNEL_ThreadCreate(&Test_TakeThread, (void *)(uintptr_t)'a', 1U);
+    (void)KERNEL_ThreadCreate(&Test_GiveThread, NULL, 3U);
+    i32Ret = Test_End(3UL, "abgAgBG");
+
+    /* The sender of higher priority fills the queue, then sends as the receiver makes room */
+    if (LL_OK == i32Ret) {
+        Test_Begin();
+        (void)KERNEL_QueueInit(&m_stcQueue, m_au32QueueBuf, sizeof(uint32_t), TEST_QUEUE_DEPTH);
+        (void)memset(m_au32Received, 0xFF, sizeof(m_au32Received));
+        (void)KERNEL_ThreadCreate(&Test_SendThread, NULL, 0U);
+        (void)KERNEL_ThreadCreate(&Test_ReceiveThread, NULL, 1U);
+        i32Ret = Test_End(2UL, "SSSRSRRR");
+        for (i = 0UL; (i < TEST_QUEUE_ITEMS) && (LL_OK == i32Ret); i++) {
+            if (i != m_au32Received[i]) {
+                i32Ret = LL_ERR;
+            }
+        }
+    }
+    /* The receiver of higher priority waits on the empty queue, every send wakes it */
+    if (LL_OK == i32Ret) {
+        Test_Begin();
+        (void)KERNEL_QueueInit(&m_stcQueue, m_au32QueueBuf, sizeof(uint32_t), TEST_QUEUE_DEPTH);
+        (void)KERNEL_ThreadCreate(&Test_SendThread, NULL, 1U);
+        (void)KERNEL_ThreadCreate(&Test_ReceiveThread, NULL, 0U);
+        i32Ret = Test_End(2UL, "RSRSRSRS");
+    }
+    return Test_Report("KERNEL blocking and wakeup", i32Ret);
+}
+
+/**
+ * @brief  Thread: waits with timeouts on objects nobody gives, checks the ticks waited.
+ * @param  [in] pvArg                   Not used
+ * @retval None
+ */
+static void Test_TimeoutThread(void *pvArg)
+{
+    uint32_t u32Item = 0UL;
+    uint32_t u32Start;
+
+    (void)pvArg;
+    u32Start = KERNEL_GetTick();
+    Test_Check(KERNEL_SemTake(&m_stcSem, KERNEL_NO_WAIT), LL_ERR_TIMEOUT);
+    Test_Check((int32_t)(KERNEL_GetTick() - u32Start), 0L);
+
+    u32Start = KERNEL_GetTick();
+    Test_Check(KERNEL_SemTake(&m_stcSem, 5UL), LL_ERR_TIMEOUT);
+    Test_Check((int32_t)(KERNEL_GetTick() - u32Start), 5L);
+
+    u32Start = KERNEL_GetTick();
+    Test_Check(KERNEL_QueueReceive(&m_stcQueue, &u32Item, 3UL), LL_ERR_TIMEOUT);
+    Test_Check((int32_t)(KERNEL_GetTick() - u32Start), 3L);
+
+    (void)KERNEL_QueueSend(&m_stcQueue, &u32Item, KERNEL_NO_WAIT);
+    (void)KERNEL_QueueSend(&m_stcQueue, &u32Item, KERNEL_NO_WAIT);
+    u32Start = KERNEL_GetTick();
+    Test_Check(KERNEL_QueueSend(&m_stcQueue, &u32Item, 2UL), LL_ERR_TIMEOUT);
+    Test_Check((int32_t)(KERNEL_GetTick() - u32Start), 2L);
+
+    u32Start = KERNEL_GetTick();
+    KERNEL_Delay(4UL);
+    Test_Check((int32_t)(KERNEL_GetTick() - u32Start), 4L);
+
+    /* Given by the other thread before the timeout */
+    Test_Trace('w');
+    u32Start = KERNEL_GetTick();
+    Test_Check(KERNEL_SemTake(&m_stcSem, 10UL), LL_OK);
+    Test_Check((int32_t)(KERNEL_GetTick() - u32Start), 2L);
+    Test_Trace('W');
+    m_u32DoneNum++;
+}
+
+/**
+ * @brief  Thread: gives the semaphore 2 ticks after the timeout thread waits for it.
+ * @param  [in] pvArg                   Not used
+ * @retval None
+ */
+static void Test_LateGiveThread(void *pvArg)
+{
+    (void)pvArg;
+    /* Runs first while the timeout thread waits: 14 ticks of timeouts, then 2 more */
+    KERNEL_Delay(16UL);
+    Test_Trace('g');
+    Test_Check(KERNEL_SemGive(&m_stcSem), LL_OK);
+    Test_Trace('G');
+    m_u32DoneNum++;
+}
+
+/**
+ * @brief  Timeouts: a wait ends after exactly its timeout when nothing comes, earlier when
+ *         the object comes, at once with KERNEL_NO_WAIT.
+ * @param  None
+ * @retval int32_t                      LL_OK if all checks passed.
+ */
+static int32_t Test_Timeout(void)
+{
+    int32_t i32Ret;
+
+    Test_Begin();
+    (void)KERNEL_SemInit(&m_stcSem, 0UL, 1UL);
+    (void)KERNEL_QueueInit(&m_stcQueue, m_au32QueueBuf, sizeof(uint32_t), TEST_QUEUE_DEPTH);
+    (void)KERNEL_ThreadCreate(&Test_TimeoutThread, NULL, 0U);
+    (void)KERNEL_ThreadCreate(&Test_LateGiveThread, NULL, 1U);
+    i32Ret = Test_End(2UL, "wgWG");
+    if ((LL_OK == i32Ret) && (16UL != KERNEL_GetTick())) {
+        i32Ret = LL_ERR;
+    }
+    return Test_Report("KERNEL timeouts", i32Ret);
+}
+
+/**
+ * @brief  Application, run by SIM_Run().
+ * @param  None
+ * @retval LL_OK if all cases passed
+ */
+static int32_t Test_Main(void)
+{
+    int32_t i32Ret = LL_OK;
+
+    SystemCoreClockUpdate();
+    if (LL_OK != Test_Priority()) {
+        i32Ret = LL_ERR;
+    }
+    if (LL_OK != Test_Block()) {
+        i32Ret = LL_ERR;
+    }
+    if (LL_OK != Test_Timeout()) {
+        i32Ret = LL_ERR;
+    }
+    return i32Ret;
+}
+
+/**
+ * @brief  Main function of the kernel host test
+ * @param  None
+ * @retval 0 if all cases passed
+ */
+int main(void)
+{
+    int32_t i32Ret = SIM_Init();
+
+    if (LL_OK == i32Ret) {
+        i32Ret = SIM_Run(&Test_Main);
+    }
+    return (LL_OK == i32Ret) ? 0 : 1;
+}
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
@@ -0,0 +1,322 @@
+/**
+ *******************************************************************************
+ * @file  host/nor_bench/source/main.c
+ * @brief SPI NOR flash component throughput: fast read, page writes with and
+ *        without overlapping the program time, small appends with and without
+ *        coalescing, against the flash model of host/sim.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-17       CDT             First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2022-2023, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include <stdio.h>
+#include <string.h>
+
+#include "hc32_sim.h"
+#include "spi_nor.h"
+
+/**
+ * @addtogroup HC32F120_DDL_Host
+ * @{
+ */
+
+/**
+ * @defgroup NOR_BENCH NOR Bench
+ * @{
+ */
+
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @brief Write case.
+ */
+typedef struct {
+    const char *pcName;                 /*!< Case name. */
+    uint32_t u32Len;                    /*!< Bytes written. */
+    uint32_t u32Chunk;                  /*!< Bytes per SPI_NOR_Write() call. */
+    uint8_t u8FlushEach;                /*!< 1U to wait for the part after every call. */
+} stc_bench_write_t;
+
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+#define BENCH_SPI_UNIT          (CM_SPI)
+#define BENCH_SPI_FCG           (FCG0_PERIPH_SPI)
+#define BENCH_CS_PORT           (GPIO_PORT_1)
+#define BENCH_CS_PIN            (GPIO_PIN_04)
+
+/* HCLK and PCLK1 of 48MHz, W25Q64JV class part, typical datasheet times */
+#define BENCH_PCLK_HZ           (48000000UL)
+#define BENCH_JEDEC_ID          (0xEF4017UL)
+#define BENCH_TPP_US            (400UL)
+#define BENCH_TSE_US            (45000UL)
+#define BENCH_TBE32_US          (120000UL)
+#define BENCH_TBE64_US          (150000UL)
+#define BENCH_TCE_US            (20000000UL)
+
+#define BENCH_READ_LEN          (0x10000UL)
+#define BENCH_READ_CHUNK        (0x1000UL)
+#define BENCH_WRITE_LEN         (0x4000UL)
+/* Every status poll traps into the model, keep the append cases short */
+#define BENCH_APPEND_LEN        (0x400UL)
+#define BENCH_SECTOR_SIZE       (0x1000UL)
+/* Application time to produce one page of data */
+#define BENCH_PAGE_PREP_NS      (300000UL)
+
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+static stc_spi_nor_t m_stcNor;
+static uint8_t m_au8Data[BENCH_READ_LEN];
+static uint8_t m_au8Read[BENCH_READ_LEN];
+
+static const stc_bench_write_t m_astcWriteCase[] = {
+    {"page write, wait each",   BENCH_WRITE_LEN,  SPI_NOR_PAGE_SIZE, 1U},
+    {"page write, overlapped",  BENCH_WRITE_LEN,  SPI_NOR_PAGE_SIZE, 0U},
+    {"16B append, wait each",   BENCH_APPEND_LEN, 16UL,              1U},
+    {"16B append, coalesced",   BENCH_APPEND_LEN, 16UL,              0U},
+};
+
+static const uint32_t m_au32Prescaler[] = {SPI_BR_CLK_DIV2, SPI_BR_CLK_DIV4, SPI_BR_CLK_DIV8};
+
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @brief  Print one result line.
+ * @param  [in] pcName                  Case name
+ * @param  [in] u32SckKHz               SCK in kHz
+ * @param  [in] u32Bytes                Bytes moved
+ * @param  [in] u64Ns                   Model time taken
+ * @param  [in] i32Ret                  Case result
+ * @retval int32_t:                     i32Ret
+ */
+static int32_t Bench_Report(const char *pcName, uint32_t u32SckKHz, uint32_t u32Bytes, uint64_t u64Ns,
+                            int32_t i32Ret)
+{
+    const stc_sim_nor_stat_t *pstcStat = SIM_NOR_GetStat();
+
+    (void)printf("%-24s %6lu %7lu %10.1f %7.3f %6lu %8lu %s\n", pcName, (unsigned long)u32SckKHz,
+                 (unsigned long)u32Bytes, (double)u64Ns / 1000.0, ((double)u32Bytes * 1000.0) / (double)u64Ns,
+                 (unsigned long)pstcStat->u32ProgramCount, (unsigned long)pstcStat->u32BusyPolls,
+                 (LL_OK == i32Ret) ? "ok" : "FAIL");
+    return i32Ret;
+}
+
+/**
+ * @brief  Fast read of BENCH_READ_LEN bytes in BENCH_READ_CHUNK calls.
+ * @param  [in] u32SckKHz               SCK in kHz, for the report
+ * @retval int32_t:
+ *           - LL_OK:                   Data read matches the array.
+ *           - Others:                  Failed.
+ */
+static int32_t Bench_Read(uint32_t u32SckKHz)
+{
+    uint64_t u64Start;
+    uint32_t u32Addr;
+    int32_t i32Ret = LL_OK;
+
+    (void)memcpy(SIM_NOR_GetArray(), m_au8Data, BENCH_READ_LEN);
+    (void)memset(m_au8Read, 0, sizeof(m_au8Read));
+    SIM_NOR_ClearStat();
+    u64Start = SIM_NOR_GetTime();
+    for (u32Addr = 0UL; (u32Addr < BENCH_READ_LEN) && (LL_OK == i32Ret); u32Addr += BENCH_READ_CHUNK) {
+        i32Ret = SPI_NOR_Read(&m_stcNor, u32Addr, &m_au8Read[u32Addr], BENCH_READ_CHUNK);
+    }
+    if ((LL_OK == i32Ret) && (0 != memcmp(m_au8Read, m_au8Data, BENCH_READ_LEN))) {
+        i32Ret = LL_ERR;
+    }
+    return Bench_Report("fast read", u32SckKHz, BENCH_READ_LEN, SIM_NOR_GetTime() - u64Start, i32Ret);
+}
+
+/**
+ * @brief  Write the case length to the erased array, the application
+ *         spends the page preparation time before each call.
+ * @param  [in] pstcCase                Write case
+ * @param  [in] u32SckKHz               SCK in kHz, for the report
+ * @retval int32_t:
+ *           - LL_OK:                   Array holds the data.
+ *           - Others:                  Failed.
+ */
+static int32_t Bench_Write(const stc_bench_write_t *pstcCase, uint32_t u32SckKHz)
+{
+    uint32_t u32PrepNs = (uint32_t)(((uint64_t)BENCH_PAGE_PREP_NS * pstcCase->u32Chunk) / SPI_NOR_PAGE_SIZE);
+    uint64_t u64Start;
+    uint32_t u32Addr;
+    int32_t i32Ret = LL_OK;
+
+    /* Erased by the model, the erase time is in its own case */
+    (void)memset(SIM_NOR_GetArray(), 0xFF, pstcCase->u32Len);
+    SIM_NOR_ClearStat();
+    u64Start = SIM_NOR_GetTime();
+    for (u32Addr = 0UL; (u32Addr < pstcCase->u32Len) && (LL_OK == i32Ret); u32Addr += pstcCase->u32Chunk) {
+        SIM_NOR_Advance(u32PrepNs);
+        i32Ret = SPI_NOR_Write(&m_stcNor, u32Addr, &m_au8Data[u32Addr], pstcCase->u32Chunk);
+        if ((LL_OK == i32Ret) && (0U != pstcCase->u8FlushEach)) {
+            i32Ret = SPI_NOR_Flush(&m_stcNor);
+        }
+    }
+    if (LL_OK == i32Ret) {
+        i32Ret = SPI_NOR_Flush(&m_stcNor);
+    }
+    if ((LL_OK == i32Ret) &&
+        ((0 != memcmp(SIM_NOR_GetArray(), m_au8Data, pstcCase->u32Len)) || (0UL != SIM_NOR_GetStat()->u32ErrorCount))) {
+        i32Ret = LL_ERR;
+    }
+    return Bench_Report(pstcCase->pcName, u32SckKHz, pstcCase->u32Len, SIM_NOR_GetTime() - u64Start, i32Ret);
+}
+
+/**
+ * @brief  Erase one sector and wait for it.
+ * @param  [in] u32SckKHz               SCK in kHz, for the report
+ * @retval int32_t:
+ *           - LL_OK:                   Sector erased.
+ *           - Others:                  Failed.
+ */
+static int32_t Bench_Erase(uint32_t u32SckKHz)
+{
+    uint64_t u64Start;
+    uint32_t i;
+    int32_t i32Ret;
+
+    (void)memset(SIM_NOR_GetArray(), 0x00, BENCH_SECTOR_SIZE);
+    SIM_NOR_ClearStat();
+    u64Start = SIM_NOR_GetTime();
+    i32Ret = SPI_NOR_Erase(&m_stcNor, 0x0800UL, SPI_NOR_ERASE_SECTOR);
+    if (LL_OK == i32Ret) {
+        i32Ret = SPI_NOR_WaitReady(&m_stcNor, SPI_NOR_BUSY_TIMEOUT);
+    }
+    for (i = 0UL; (i < BENCH_SECTOR_SIZE) && (LL_OK == i32Ret); i++) {
+        if (0xFFU != SIM_NOR_GetArray()[i]) {
+            i32Ret = LL_ERR;
+        }
+    }
+    return Bench_Report("sector erase", u32SckKHz, BENCH_SECTOR_SIZE, SIM_NOR_GetTime() - u64Start, i32Ret);
+}
+
+/**
+ * @brief  Application, run by SIM_Run().
+ * @param  None
+ * @retval int32_t:
+ *           - LL_OK:                   All cases passed.
+ *           - LL_ERR:                  A case failed.
+ */
+static int32_t Bench_Main(void)
+{
+    stc_spi_init_t stcSpiInit;
+    stc_gpio_init_t stcGpioInit;
+    uint32_t u32SckKHz = 0UL;
+    uint32_t i;
+    uint32_t j;
+    int32_t i32Ret = LL_OK;
+
+    SystemCoreClockUpdate();
+    LL_PERIPH_WE(LL_PERIPH_ALL);
+    FCG_Fcg0PeriphClockCmd(BENCH_SPI_FCG, ENABLE);
+
+    (void)GPIO_StructInit(&stcGpioInit);
+    stcGpioInit.u16PinState = PIN_STAT_SET;
+    stcGpioInit.u16PinDir = PIN_DIR_OUT;
+    (void)GPIO_Init(BENCH_CS_PORT, BENCH_CS_PIN, &stcGpioInit);
+    for (i = 0UL; i < BENCH_READ_LEN; i++) {
+        m_au8Data[i] = (uint8_t)((i * 131UL) ^ (i >> 8U));
+    }
+
+    (void)printf("%-24s %6s %7s %10s %7s %6s %8s\n", "case", "SCK_k", "bytes", "time_us", "MB/s", "pages", "busy_rd");
+    for (j = 0UL; j < ARRAY_SZ(m_au32Prescaler); j++) {
+        (void)SPI_StructInit(&stcSpiInit);
+        stcSpiInit.u32WireMode          = SPI_3_WIRE;
+        stcSpiInit.u32TransMode         = SPI_FULL_DUPLEX;
+        stcSpiInit.u32MasterSlave       = SPI_MASTER;
+        stcSpiInit.u32BaudRatePrescaler = m_au32Prescaler[j];
+        (void)SPI_Init(BENCH_SPI_UNIT, &stcSpiInit);
+        SPI_Cmd(BENCH_SPI_UNIT, ENABLE);
+        u32SckKHz = (BENCH_PCLK_HZ / 1000UL) >> ((m_au32Prescaler[j] >> SPI_CFG2_MBR_POS) + 1UL);
+
+        if (LL_OK != SPI_NOR_Init(&m_stcNor, BENCH_SPI_UNIT, BENCH_CS_PORT, BENCH_CS_PIN)) {
+            (void)printf("SPI_NOR_Init failed\n");
+            i32Ret = LL_ERR;
+            break;
+        }
+        if (LL_OK != Bench_Read(u32SckKHz)) {
+            i32Ret = LL_ERR;
+        }
+        for (i = 0UL; i < ARRAY_SZ(m_astcWriteCase); i++) {
+            if (LL_OK != Bench_Write(&m_astcWriteCase[i], u32SckKHz)) {
+                i32Ret = LL_ERR;
+            }
+        }
+    }
+    /* The erase time is the part's, once at the last SCK */
+    if ((LL_OK == i32Ret) && (LL_OK != Bench_Erase(u32SckKHz))) {
+        i32Ret = LL_ERR;
+    }
+    SPI_Cmd(BENCH_SPI_UNIT, DISABLE);
+
+    LL_PERIPH_WP(LL_PERIPH_ALL);
+    return i32Ret;
+}
+
+/**
+ * @brief  Main function of the benchmark
+ * @param  None
+ * @retval 0 if all cases passed
+ */
+int main(void)
+{
+    const stc_sim_nor_cfg_t stcNorCfg = {
+        .u32JedecId = BENCH_JEDEC_ID,
+        .u32PclkHz = BENCH_PCLK_HZ,
+        .u8CsPort = BENCH_CS_PORT,
+        .u16CsPin = BENCH_CS_PIN,
+        .u32PageProgramUs = BENCH_TPP_US,
+        .u32SectorEraseUs = BENCH_TSE_US,
+        .u32Block32EraseUs = BENCH_TBE32_US,
+        .u32Block64EraseUs = BENCH_TBE64_US,
+        .u32ChipEraseUs = BENCH_TCE_US,
+    };
+    int32_t i32Ret = SIM_Init();
+
+    if (LL_OK == i32Ret) {
+        i32Ret = SIM_NOR_Init(&stcNorCfg);
+    }
+    if (LL_OK == i32Ret) {
+        i32Ret = SIM_Run(&Bench_Main);
+    }
+    return (LL_OK == i32Ret) ? 0 : 1;
+}
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
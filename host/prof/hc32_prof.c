@@ -0,0 +1,362 @@
+/**
+ *******************************************************************************
+ * @file  host/prof/hc32_prof.c
+ * @brief Attributes the PROF histogram dump of a firmware to the functions of
+ *        its ELF file.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-17       CDT             First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2022-2023, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include <elf.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "hc32_ll_def.h"
+
+/**
+ * @addtogroup HC32F120_DDL_Host
+ * @{
+ */
+
+/**
+ * @defgroup PROF_DEC PROF_DEC
+ * @brief PROF decoder: usage "hc32_prof fw.elf [dump.txt]", the dump is read from
+ *        stdin when not given.
+ * @note  The lines of the dump before "PROF" and after "END" are ignored, so a whole
+ *        console capture may be given. A bin goes to the function which contains its
+ *        first byte: bins larger than the shortest functions blur their boundaries.
+ * @note  32-bit Arm images and 64-bit host images are accepted.
+ * @{
+ */
+
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @brief Function of the ELF file.
+ */
+typedef struct {
+    uint64_t u64Addr;                   /*!< Start address, Thumb bit cleared. */
+    uint64_t u64Size;                   /*!< Size. */
+    const char *pcName;                 /*!< Name. */
+    uint32_t u32Count;                  /*!< Samples attributed. */
+} stc_prof_dec_func_t;
+
+/**
+ * @brief ELF image.
+ */
+typedef struct {
+    uint8_t *pu8File;                   /*!< ELF file contents. */
+    size_t uSize;                       /*!< ELF file size. */
+    stc_prof_dec_func_t *pstcFunc;      /*!< Functions, sorted by address. */
+    uint32_t u32FuncNum;                /*!< Number of functions. */
+} stc_prof_dec_image_t;
+
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+#define PROF_DEC_LINE_LEN               (160U)
+
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+static stc_prof_dec_image_t m_stcImage;
+
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @brief  Add a symbol to the functions of the image.
+ * @param  [in] pstcImage               Pointer to the image
+ * @param  [in] pcName                  Symbol name
+ * @param  [in] u32Type                 Symbol type
+ * @param  [in] u64Addr                 Symbol value
+ * @param  [in] u64Size                 Symbol size
+ * @retval None
+ */
+static void PROF_DEC_AddSymbol(stc_prof_dec_image_t *pstcImage, const char *pcName, uint32_t u32Type,
+                               uint64_t u64Addr, uint64_t u64Size)
+{
+    stc_prof_dec_func_t *pstcFunc;
+
+    if ((STT_FUNC != u32Type) || (0ULL == u64Size)) {
+        return;
+    }
+    pstcFunc = &pstcImage->pstcFunc[pstcImage->u32FuncNum++];
+    pstcFunc->u64Addr = u64Addr & ~1ULL;
+    pstcFunc->u64Size = u64Size;
+    pstcFunc->pcName = pcName;
+    pstcFunc->u32Count = 0UL;
+}
+
+/**
+ * @brief  Order the functions by address.
+ * @param  [in] pvA                     Function
+ * @param  [in] pvB                     Function
+ * @retval Comparison result, as qsort() expects
+ */
+static int PROF_DEC_CmpAddr(const void *pvA, const void *pvB)
+{
+    const stc_prof_dec_func_t *pstcA = (const stc_prof_dec_func_t *)pvA;
+    const stc_prof_dec_func_t *pstcB = (const stc_prof_dec_func_t *)pvB;
+
+    return (pstcA->u64Addr > pstcB->u64Addr) - (pstcA->u64Addr < pstcB->u64Addr);
+}
+
+/**
+ * @brief  Order the functions by samples, most first.
+ * @param  [in] pvA                     Function
+ * @param  [in] pvB                     Function
+ * @retval Comparison result, as qsort() expects
+ */
+static int PROF_DEC_CmpCount(const void *pvA, const void *pvB)
+{
+    const stc_prof_dec_func_t *pstcA = (const stc_prof_dec_func_t *)pvA;
+    const stc_prof_dec_func_t *pstcB = (const stc_prof_dec_func_t *)pvB;
+
+    if (pstcA->u32Count != pstcB->u32Count) {
+        return (pstcA->u32Count < pstcB->u32Count) ? 1 : -1;
+    }
+    return PROF_DEC_CmpAddr(pvA, pvB);
+}
+
+/**
+ * @brief  Load the function symbols of an ELF file.
+ * @param  [in] pcPath                  File name
+ * @param  [out] pstcImage              Pointer to the image
+ * @retval int32_t:
+ *           - LL_OK:                   Loaded.
+ *           - LL_ERR:                  Not a 32-bit or 64-bit little-endian ELF file, or no symbol table.
+ */
+static int32_t PROF_DEC_Load(const char *pcPath, stc_prof_dec_image_t *pstcImage)
+{
+    FILE *pFile = fopen(pcPath, "rb");
+    const Elf32_Ehdr *pstcEhdr32;
+    const Elf32_Shdr *pstcShdr32;
+    const Elf32_Sym *pstcSym32;
+    const Elf64_Ehdr *pstcEhdr64;
+    const Elf64_Shdr *pstcShdr64;
+    const Elf64_Sym *pstcSym64;
+    const char *pcStr;
+    uint32_t u32SymNum;
+    uint32_t i;
+    uint32_t j;
+
+    if (NULL == pFile) {
+        return LL_ERR;
+    }
+    (void)fseek(pFile, 0L, SEEK_END);
+    pstcImage->uSize = (size_t)ftell(pFile);
+    (void)fseek(pFile, 0L, SEEK_SET);
+    pstcImage->pu8File = (uint8_t *)malloc(pstcImage->uSize);
+    if ((NULL == pstcImage->pu8File) || (pstcImage->uSize < sizeof(Elf64_Ehdr)) ||
+        (1U != fread(pstcImage->pu8File, pstcImage->uSize, 1U, pFile))) {
+        (void)fclose(pFile);
+        return LL_ERR;
+    }
+    (void)fclose(pFile);
+
+    pstcEhdr32 = (const Elf32_Ehdr *)pstcImage->pu8File;
+    if ((0 != memcmp(pstcEhdr32->e_ident, ELFMAG, SELFMAG)) || (ELFDATA2LSB != pstcEhdr32->e_ident[EI_DATA])) {
+        return LL_ERR;
+    }
+
+    if (ELFCLASS32 == pstcEhdr32->e_ident[EI_CLASS]) {
+        for (i = 0UL; i < pstcEhdr32->e_shnum; i++) {
+            pstcShdr32 = (const Elf32_Shdr *)&pstcImage->pu8File[pstcEhdr32->e_shoff + (i * pstcEhdr32->e_shentsize)];
+            if (SHT_SYMTAB != pstcShdr32->sh_type) {
+                continue;
+            }
+            u32SymNum = pstcShdr32->sh_size / sizeof(Elf32_Sym);
+            pstcImage->pstcFunc = (stc_prof_dec_func_t *)calloc(u32SymNum + 1U, sizeof(stc_prof_dec_func_t));
+            pstcSym32 = (const Elf32_Sym *)&pstcImage->pu8File[pstcShdr32->sh_offset];
+            pstcShdr32 = (const Elf32_Shdr *)&pstcImage->pu8File[pstcEhdr32->e_shoff +
+                                                                  (pstcShdr32->sh_link * pstcEhdr32->e_shentsize)];
+            pcStr = (const char *)&pstcImage->pu8File[pstcShdr32->sh_offset];
+            for (j = 0UL; (NULL != pstcImage->pstcFunc) && (j < u32SymNum); j++) {
+                PROF_DEC_AddSymbol(pstcImage, &pcStr[pstcSym32[j].st_name], ELF32_ST_TYPE(pstcSym32[j].st_info),
+                                   pstcSym32[j].st_value, pstcSym32[j].st_size);
+            }
+            break;
+        }
+    } else if (ELFCLASS64 == pstcEhdr32->e_ident[EI_CLASS]) {
+        pstcEhdr64 = (const Elf64_Ehdr *)pstcImage->pu8File;
+        for (i = 0UL; i < pstcEhdr64->e_shnum; i++) {
+            pstcShdr64 = (const Elf64_Shdr *)&pstcImage->pu8File[pstcEhdr64->e_shoff + (i * pstcEhdr64->e_shentsize)];
+            if (SHT_SYMTAB != pstcShdr64->sh_type) {
+                continue;
+            }
+            u32SymNum = (uint32_t)(pstcShdr64->sh_size / sizeof(Elf64_Sym));
+            pstcImage->pstcFunc = (stc_prof_dec_func_t *)calloc(u32SymNum + 1U, sizeof(stc_prof_dec_func_t));
+            pstcSym64 = (const Elf64_Sym *)&pstcImage->pu8File[pstcShdr64->sh_offset];
+            pstcShdr64 = (const Elf64_Shdr *)&pstcImage->pu8File[pstcEhdr64->e_shoff +
+                                                                  (pstcShdr64->sh_link * pstcEhdr64->e_shentsize)];
+            pcStr = (const char *)&pstcImage->pu8File[pstcShdr64->sh_offset];
+            for (j = 0UL; (NULL != pstcImage->pstcFunc) && (j < u32SymNum); j++) {
+                PROF_DEC_AddSymbol(pstcImage, &pcStr[pstcSym64[j].st_name], ELF64_ST_TYPE(pstcSym64[j].st_info),
+                                   pstcSym64[j].st_value, pstcSym64[j].st_size);
+            }
+            break;
+        }
+    } else {
+        return LL_ERR;
+    }
+
+    if (NULL == pstcImage->pstcFunc) {
+        return LL_ERR;
+    }
+    qsort(pstcImage->pstcFunc, pstcImage->u32FuncNum, sizeof(stc_prof_dec_func_t), &PROF_DEC_CmpAddr);
+    return LL_OK;
+}
+
+/**
+ * @brief  Find the function which contains an address.
+ * @param  [in] pstcImage               Pointer to the image
+ * @param  [in] u64Addr                 Address
+ * @retval Function, NULL if none.
+ */
+static stc_prof_dec_func_t *PROF_DEC_Find(const stc_prof_dec_image_t *pstcImage, uint64_t u64Addr)
+{
+    uint32_t u32Low = 0UL;
+    uint32_t u32High = pstcImage->u32FuncNum;
+    uint32_t u32Mid;
+
+    /* Last function which starts at or below the address */
+    while (u32Low < u32High) {
+        u32Mid = (u32Low + u32High) / 2UL;
+        if (pstcImage->pstcFunc[u32Mid].u64Addr <= u64Addr) {
+            u32Low = u32Mid + 1UL;
+        } else {
+            u32High = u32Mid;
+        }
+    }
+    if ((0UL == u32Low) || ((u64Addr - pstcImage->pstcFunc[u32Low - 1UL].u64Addr) >= pstcImage->pstcFunc[u32Low - 1UL].u64Size)) {
+        return NULL;
+    }
+    return &pstcImage->pstcFunc[u32Low - 1UL];
+}
+
+/**
+ * @brief  Main function of the PROF decoder
+ * @param  [in] argc                    Argument count
+ * @param  [in] argv                    Arguments
+ * @retval 0 if a whole dump was read
+ */
+int main(int argc, char *argv[])
+{
+    FILE *pFile = stdin;
+    char acLine[PROF_DEC_LINE_LEN];
+    unsigned long aulHdr[5U];
+    unsigned long ulBin;
+    unsigned long ulCount;
+    uint32_t u32InDump = 0UL;
+    uint32_t u32Done = 0UL;
+    uint32_t u32Binned = 0UL;
+    uint32_t u32NoSym = 0UL;
+    stc_prof_dec_func_t *pstcFunc;
+    double dTotal;
+    uint32_t i;
+
+    if ((argc < 2) || (argc > 3)) {
+        (void)fprintf(stderr, "usage: %s fw.elf [dump.txt]\n", argv[0]);
+        return 2;
+    }
+    if (LL_OK != PROF_DEC_Load(argv[1], &m_stcImage)) {
+        (void)fprintf(stderr, "%s: cannot load the symbols of %s\n", argv[0], argv[1]);
+        return 1;
+    }
+    if (3 == argc) {
+        pFile = fopen(argv[2], "r");
+        if (NULL == pFile) {
+            (void)fprintf(stderr, "%s: cannot open %s\n", argv[0], argv[2]);
+            return 1;
+        }
+    }
+
+    while ((0UL == u32Done) && (NULL != fgets(acLine, (int)sizeof(acLine), pFile))) {
+        if (0UL == u32InDump) {
+            if (5 == sscanf(acLine, "PROF %lx %lx %lx %lx %lx",
+                            &aulHdr[0], &aulHdr[1], &aulHdr[2], &aulHdr[3], &aulHdr[4])) {
+                u32InDump = 1UL;
+            }
+        } else if (0 == strncmp(acLine, "END", 3U)) {
+            u32Done = 1UL;
+        } else if ((2 == sscanf(acLine, "%lx %lx", &ulBin, &ulCount)) && (ulBin < aulHdr[2])) {
+            pstcFunc = PROF_DEC_Find(&m_stcImage, (uint64_t)aulHdr[0] + ((uint64_t)ulBin << aulHdr[1]));
+            if (NULL != pstcFunc) {
+                pstcFunc->u32Count += (uint32_t)ulCount;
+            } else {
+                u32NoSym += (uint32_t)ulCount;
+            }
+            u32Binned += (uint32_t)ulCount;
+        } else {
+            /* Console noise inside the dump */
+        }
+    }
+    if (stdin != pFile) {
+        (void)fclose(pFile);
+    }
+    if (0UL == u32Done) {
+        (void)fprintf(stderr, "%s: no complete dump\n", argv[0]);
+        return 1;
+    }
+
+    (void)printf("%lu samples, %lu outside the range, %lu-byte bins\n",
+                 aulHdr[3], aulHdr[4], 1UL << aulHdr[1]);
+    if (aulHdr[3] != (u32Binned + aulHdr[4])) {
+        /* Saturated bins, or a dump taken while sampling */
+        (void)printf("%lu samples in the bins\n", (unsigned long)u32Binned);
+    }
+    dTotal = (0UL != aulHdr[3]) ? (double)aulHdr[3] : 1.0;
+    qsort(m_stcImage.pstcFunc, m_stcImage.u32FuncNum, sizeof(stc_prof_dec_func_t), &PROF_DEC_CmpCount);
+    for (i = 0UL; (i < m_stcImage.u32FuncNum) && (0UL != m_stcImage.pstcFunc[i].u32Count); i++) {
+        (void)printf("%8lu %6.2f%%  %s\n", (unsigned long)m_stcImage.pstcFunc[i].u32Count,
+                     (100.0 * m_stcImage.pstcFunc[i].u32Count) / dTotal,
+                     m_stcImage.pstcFunc[i].pcName);
+    }
+    if (0UL != u32NoSym) {
+        (void)printf("%8lu %6.2f%%  <no symbol>\n", (unsigned long)u32NoSym,
+                     (100.0 * u32NoSym) / dTotal);
+    }
+    if (0UL != aulHdr[4]) {
+        (void)printf("%8lu %6.2f%%  <outside the range>\n", aulHdr[4],
+                     (100.0 * aulHdr[4]) / dTotal);
+    }
+    return 0;
+}
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
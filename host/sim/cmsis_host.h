@@ -0,0 +1,135 @@
+/**
+ *******************************************************************************
+ * @file  host/sim/cmsis_host.h
+ * @brief CMSIS compiler and core intrinsic replacements for the host build.
+ *        Force included (gcc -include) ahead of every translation unit, it
+ *        takes the place of cmsis_gcc.h and relocates the flash array
+ *        accesses of the drivers into the simulated flash window.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-16       CDT             First version
+   2026-10-17       CDT             PRIMASK kept by the register file, unmasking takes a pending PendSV
+                                    __WFI() waits for the SysTick model
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2022-2023, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+#ifndef __CMSIS_HOST_H__
+#define __CMSIS_HOST_H__
+
+/* Take the include guard of cmsis_gcc.h, cmsis_compiler.h then skips the Arm version */
+#ifndef __CMSIS_GCC_H
+#define __CMSIS_GCC_H
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include <stdint.h>
+
+/* C binding of definitions if building with C++ compiler */
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Global pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @brief Compiler specific defines, same meaning as in cmsis_gcc.h
+ */
+#define __ASM                           __asm
+#define __INLINE                        inline
+#define __STATIC_INLINE                 static inline
+#define __STATIC_FORCEINLINE            __attribute__((always_inline)) static inline
+#define __NO_RETURN                     __attribute__((__noreturn__))
+#define __USED                          __attribute__((used))
+#define __WEAK                          __attribute__((weak))
+#define __PACKED                        __attribute__((packed, aligned(1)))
+#define __PACKED_STRUCT                 struct __attribute__((packed, aligned(1)))
+#define __PACKED_UNION                  union __attribute__((packed, aligned(1)))
+#define __ALIGNED(x)                    __attribute__((aligned(x)))
+#define __RESTRICT                      __restrict
+#define __COMPILER_BARRIER()            __asm volatile("" ::: "memory")
+/* long_call and .ramfunc only mean something to the Arm linker script */
+#define __RAM_FUNC
+
+/**
+ * @brief Simulated flash window
+ * @note  The flash array 0x00000000 ~ 0x0000FFFF is below the lowest address a
+ *        Linux process may map, RW_MEM8/16/32 move it up to SIM_FLASH_WINDOW.
+ */
+#define SIM_FLASH_WINDOW                (0x30000000UL)
+#define SIM_FLASH_SIZE                  (0x00010000UL)
+
+#define RW_MEM8(addr)                   (*(volatile uint8_t *)SIM_MemAddr((uint32_t)(addr)))
+#define RW_MEM16(addr)                  (*(volatile uint16_t *)SIM_MemAddr((uint32_t)(addr)))
+#define RW_MEM32(addr)                  (*(volatile uint32_t *)SIM_MemAddr((uint32_t)(addr)))
+
+/*******************************************************************************
+ * Global function prototypes (definition in C source)
+ ******************************************************************************/
+/* hc32_sim.c */
+uint32_t SIM_GetPrimask(void);
+void SIM_SetPrimask(uint32_t u32Primask);
+void SIM_WaitForInterrupt(void);
+
+/**
+ * @brief  Translate a device address to the host address it is simulated at.
+ * @param  [in] u32Addr                 Device address
+ * @retval Host address
+ */
+__STATIC_FORCEINLINE uintptr_t SIM_MemAddr(uint32_t u32Addr)
+{
+    return (u32Addr < SIM_FLASH_SIZE) ? ((uintptr_t)u32Addr + SIM_FLASH_WINDOW) : (uintptr_t)u32Addr;
+}
+
+/* The exceptions of the host are SysTick and PendSV, taken when PRIMASK is cleared, see SIM_SetPrimask().
+   The barriers only stop compiler reordering. */
+__STATIC_FORCEINLINE void __NOP(void) {}
+__STATIC_FORCEINLINE void __WFI(void) { SIM_WaitForInterrupt(); }
+__STATIC_FORCEINLINE void __WFE(void) {}
+__STATIC_FORCEINLINE void __SEV(void) {}
+__STATIC_FORCEINLINE void __ISB(void) { __COMPILER_BARRIER(); }
+__STATIC_FORCEINLINE void __DSB(void) { __COMPILER_BARRIER(); }
+__STATIC_FORCEINLINE void __DMB(void) { __COMPILER_BARRIER(); }
+__STATIC_FORCEINLINE void __enable_irq(void) { __COMPILER_BARRIER(); SIM_SetPrimask(0UL); }
+__STATIC_FORCEINLINE void __disable_irq(void) { SIM_SetPrimask(1UL); __COMPILER_BARRIER(); }
+__STATIC_FORCEINLINE uint32_t __get_PRIMASK(void) { return SIM_GetPrimask(); }
+__STATIC_FORCEINLINE void __set_PRIMASK(uint32_t priMask) { __COMPILER_BARRIER(); SIM_SetPrimask(priMask); }
+__STATIC_FORCEINLINE uint32_t __get_IPSR(void) { return 0UL; }
+__STATIC_FORCEINLINE uint32_t __get_CONTROL(void) { return 0UL; }
+__STATIC_FORCEINLINE void __set_CONTROL(uint32_t control) { (void)control; }
+__STATIC_FORCEINLINE uint32_t __get_PSP(void) { return 0UL; }
+__STATIC_FORCEINLINE void __set_PSP(uint32_t topOfProcStack) { (void)topOfProcStack; }
+__STATIC_FORCEINLINE uint32_t __get_MSP(void) { return 0UL; }
+__STATIC_FORCEINLINE void __set_MSP(uint32_t topOfMainStack) { (void)topOfMainStack; }
+__STATIC_FORCEINLINE uint32_t __REV(uint32_t value) { return __builtin_bswap32(value); }
+__STATIC_FORCEINLINE uint32_t __REV16(uint32_t value)
+{
+    return ((value & 0xFF00FF00UL) >> 8U) | ((value & 0x00FF00FFUL) << 8U);
+}
+__STATIC_FORCEINLINE uint8_t __CLZ(uint32_t value)
+{
+    return (0UL == value) ? 32U : (uint8_t)__builtin_clz(value);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __CMSIS_GCC_H */
+
+#endif /* __CMSIS_HOST_H__ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
@@ -0,0 +1,792 @@
+/**
+ *******************************************************************************
+ * @file  host/sim/hc32_sim.c
+ * @brief Simulated register file for the host (x86-64 Linux) build of the LL
+ *        drivers.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-16       CDT             First version
+   2026-10-17       CDT             Add PRIMASK and PendSV
+                                    Move the SCS into the register file, add the SysTick exception and WFI
+                                    Add SIM_GetAccessSize() and the CRC model
+                                    Add the I2C model
+                                    Add SIM_SetWfiHook()
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2022-2023, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include <signal.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <ucontext.h>
+#include <unistd.h>
+
+#include "hc32_sim.h"
+
+/**
+ * @addtogroup HC32F120_DDL_Host
+ * @{
+ */
+
+/**
+ * @defgroup SIM SIM
+ * @brief Simulated register file.
+ * @note  The drivers access CM_xxx/bCM_xxx at their device addresses. The
+ *        peripheral space, its bit-band alias and the flash window are mapped at
+ *        those addresses, the pages of a modeled peripheral without access
+ *        permission. An access to such a page faults, the fault handler runs the
+ *        pfnRead hook, opens the page and single-steps the faulting instruction
+ *        with the x86 trap flag. The trap handler closes the page again and runs
+ *        the pfnReadDone/pfnWrite hook. Unmodeled registers are plain memory.
+ * @note  The same memory is mapped a second time without protection, the
+ *        models work on that view (SIM_REG32() etc.).
+ * @note  Some drivers keep buffer addresses in uint32_t (EFM_Program() etc.),
+ *        SIM_Run() therefore runs the application on a stack in the low 4GB and
+ *        the host Makefile links without PIE.
+ * @note  PRIMASK is kept here for the intrinsics of cmsis_host.h. The exceptions
+ *        are SysTick and PendSV, pended through SCB->ICSR. Their handlers run when
+ *        PRIMASK is cleared, in the context of the code clearing it. SysTick is
+ *        also taken before a read of the SCS once the SysTick model runs, see
+ *        SIM_SYSTICK_Init().
+ * @{
+ */
+
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @brief Access being single-stepped.
+ */
+typedef struct {
+    uintptr_t uPage;                    /*!< Host page opened for the access. */
+    int iProt;                          /*!< Protection to restore. */
+    uint32_t u32Addr;                   /*!< Device address of the register (target of a bit-band access). */
+    uint32_t u32Old;                    /*!< Register word before the access. */
+    uint32_t u32BitPos;                 /*!< Bit of a bit-band access. */
+    uint8_t u8Write;                    /*!< 1U for a write access. */
+    uint8_t u8BitBand;                  /*!< 1U for an access to the bit-band alias. */
+    uint8_t u8Size;                     /*!< Access size in bytes. */
+} stc_sim_access_t;
+
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+#define SIM_PAGE_SIZE                   (0x1000UL)
+#define SIM_PAGE(x)                     ((uintptr_t)(x) & ~(uintptr_t)(SIM_PAGE_SIZE - 1UL))
+
+#define SIM_PERIPH_BASE                 (0x40000000UL)
+#define SIM_PERIPH_SIZE                 (0x00020000UL)
+#define SIM_BITBAND_BASE                (0x42000000UL)
+#define SIM_BITBAND_SIZE                (SIM_PERIPH_SIZE << 5U)
+/* NVIC, SysTick and SCB, plain memory unless the SysTick model is registered */
+#define SIM_SCS_BASE                    (SCS_BASE)
+#define SIM_SCS_SIZE                    (0x00001000UL)
+#define SIM_SCB_ICSR                    (SCB_BASE + 0x04UL)
+
+/* Offset of the flash array and of the SCS in the register file memory */
+#define SIM_FLASH_OFFSET                (SIM_PERIPH_SIZE)
+#define SIM_SCS_OFFSET                  (SIM_FLASH_OFFSET + SIM_FLASH_SIZE)
+#define SIM_FILE_SIZE                   (SIM_SCS_OFFSET + SIM_SCS_SIZE)
+#define SIM_PAGE_NUM                    (SIM_FILE_SIZE / SIM_PAGE_SIZE)
+
+#define SIM_ACCESS_MAX                  (4U)
+#define SIM_RUN_STACK_SIZE              (0x100000UL)
+
+/* x86 page fault error code: write access, EFLAGS: trap flag */
+#define SIM_X86_PF_WRITE                (0x2LL)
+#define SIM_X86_EFLAGS_TF               (0x100LL)
+
+#define SIM_IN_RANGE(x, base, size)     (((uintptr_t)(x) >= (base)) && ((uintptr_t)(x) < ((uintptr_t)(base) + (size))))
+
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+static uint8_t *m_pu8Shadow = NULL;
+static int m_aiPageProt[SIM_PAGE_NUM];
+
+static stc_sim_model_t m_astcModel[SIM_MODEL_MAX];
+static uint32_t m_u32ModelNum = 0UL;
+
+static stc_sim_access_t m_astcAccess[SIM_ACCESS_MAX];
+static uint32_t m_u32AccessNum = 0UL;
+
+static ucontext_t m_stcHostCtx;
+static ucontext_t m_stcRunCtx;
+static int32_t (*m_pfnRunMain)(void);
+static int32_t m_i32RunRet;
+
+static uint32_t m_u32Primask = 0UL;
+static void (*m_pfnPendSV)(void) = NULL;
+static void (*m_pfnSysTick)(void) = NULL;
+static void (*m_pfnWfiHook)(void) = NULL;
+static uint32_t m_u32HookSize = 4UL;
+
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @brief  Get the register file offset of a device address.
+ * @param  [in] u32Addr                 Device address
+ * @retval Offset, SIM_FILE_SIZE if the address is not simulated.
+ */
+static uint32_t SIM_FileOffset(uint32_t u32Addr)
+{
+    uint32_t u32Offset = SIM_FILE_SIZE;
+
+    if (u32Addr < SIM_FLASH_SIZE) {
+        u32Offset = SIM_FLASH_OFFSET + u32Addr;
+    } else if (SIM_IN_RANGE(u32Addr, SIM_PERIPH_BASE, SIM_PERIPH_SIZE)) {
+        u32Offset = u32Addr - SIM_PERIPH_BASE;
+    } else if (SIM_IN_RANGE(u32Addr, SIM_SCS_BASE, SIM_SCS_SIZE)) {
+        u32Offset = SIM_SCS_OFFSET + (u32Addr - SIM_SCS_BASE);
+    } else {
+        /* Not simulated */
+    }
+    return u32Offset;
+}
+
+/**
+ * @brief  Get the host address of a register file page.
+ * @param  [in] u32Page                 Page index
+ * @retval Host address
+ */
+static uintptr_t SIM_PageHostAddr(uint32_t u32Page)
+{
+    uint32_t u32Offset = u32Page * SIM_PAGE_SIZE;
+
+    if (u32Offset >= SIM_SCS_OFFSET) {
+        return (uintptr_t)SIM_SCS_BASE + (u32Offset - SIM_SCS_OFFSET);
+    }
+    if (u32Offset >= SIM_FLASH_OFFSET) {
+        return (uintptr_t)SIM_FLASH_WINDOW + (u32Offset - SIM_FLASH_OFFSET);
+    }
+    return (uintptr_t)SIM_PERIPH_BASE + u32Offset;
+}
+
+/**
+ * @brief  Find the model of a device address.
+ * @param  [in] u32Addr                 Device address
+ * @retval Pointer to the model, NULL if the address is not modeled.
+ */
+static const stc_sim_model_t *SIM_FindModel(uint32_t u32Addr)
+{
+    uint32_t i;
+
+    for (i = 0UL; i < m_u32ModelNum; i++) {
+        if ((u32Addr >= m_astcModel[i].u32Base) && ((u32Addr - m_astcModel[i].u32Base) < m_astcModel[i].u32Size)) {
+            return &m_astcModel[i];
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief  Get the operand size of the x86 instruction accessing memory.
+ * @param  [in] pu8Insn                 First byte of the instruction
+ * @retval Size in bytes, 4 for an instruction not known here.
+ * @note   Covers what the compiler emits for volatile accesses: the mov, movzx and
+ *         movsx forms and the ALU operations with a memory operand.
+ */
+static uint8_t SIM_DecodeSize(const uint8_t *pu8Insn)
+{
+    uint8_t u8OpSize = 4U;
+    uint8_t u8Size;
+    uint8_t u8Op;
+
+    /* Legacy prefixes and REX */
+    for (;;) {
+        u8Op = *pu8Insn;
+        if (0x66U == u8Op) {
+            u8OpSize = 2U;
+        } else if ((0x40U == (u8Op & 0xF0U)) && (0U != (u8Op & 0x08U))) {
+            u8OpSize = 8U;
+        } else if ((0x40U != (u8Op & 0xF0U)) && (0x67U != u8Op) && (0xF2U != u8Op) && (0xF3U != u8Op)) {
+            break;
+        } else {
+            /* Other prefix */
+        }
+        pu8Insn++;
+    }
+
+    if (0x0FU == u8Op) {
+        /* movzx, movsx */
+        u8Op = pu8Insn[1];
+        u8Size = ((0xB6U == u8Op) || (0xBEU == u8Op)) ? 1U : (((0xB7U == u8Op) || (0xBFU == u8Op)) ? 2U : 4U);
+    } else if (((u8Op < 0x40U) && ((u8Op & 0x07U) < 0x04U)) ||
+               ((u8Op >= 0x80U) && (u8Op <= 0x8BU) && (0x82U != u8Op)) ||
+               (0xC6U == u8Op) || (0xC7U == u8Op) || (0xF6U == u8Op) || (0xF7U == u8Op) ||
+               (0xFEU == u8Op) || (0xFFU == u8Op)) {
+        /* The byte form of these opcodes is the even one */
+        u8Size = (0U == (u8Op & 1U)) ? 1U : u8OpSize;
+    } else {
+        u8Size = 4U;
+    }
+    return u8Size;
+}
+
+/**
+ * @brief  Run the pre-access hook of a register.
+ * @param  [in] u32Addr                 Device address
+ * @retval None
+ */
+static void SIM_HookRead(uint32_t u32Addr)
+{
+    const stc_sim_model_t *pstcModel = SIM_FindModel(u32Addr);
+
+    if ((NULL != pstcModel) && (NULL != pstcModel->pfnRead)) {
+        pstcModel->pfnRead(u32Addr);
+    }
+}
+
+/**
+ * @brief  Run the post-access hook of a register.
+ * @param  [in] pstcAccess              Pointer to the completed access
+ * @retval None
+ */
+static void SIM_HookDone(const stc_sim_access_t *pstcAccess)
+{
+    const stc_sim_model_t *pstcModel = SIM_FindModel(pstcAccess->u32Addr);
+
+    m_u32HookSize = pstcAccess->u8Size;
+    if (NULL != pstcModel) {
+        if (0U != pstcAccess->u8Write) {
+            if (NULL != pstcModel->pfnWrite) {
+                pstcModel->pfnWrite(pstcAccess->u32Addr, pstcAccess->u32Old);
+            }
+        } else {
+            if (NULL != pstcModel->pfnReadDone) {
+                pstcModel->pfnReadDone(pstcAccess->u32Addr);
+            }
+        }
+    }
+}
+
+/**
+ * @brief  Page fault handler, opens the page for one instruction.
+ * @param  [in] iSig                    Signal number
+ * @param  [in] pstcInfo                Fault information
+ * @param  [in] pvCtx                   Interrupted context
+ * @retval None
+ */
+static void SIM_FaultHandler(int iSig, siginfo_t *pstcInfo, void *pvCtx)
+{
+    ucontext_t *pstcCtx = (ucontext_t *)pvCtx;
+    uintptr_t uAddr = (uintptr_t)pstcInfo->si_addr;
+    stc_sim_access_t *pstcAccess;
+    uint32_t u32Offset;
+    uint32_t u32Word;
+
+    if ((m_u32AccessNum >= SIM_ACCESS_MAX) ||
+        !(SIM_IN_RANGE(uAddr, SIM_PERIPH_BASE, SIM_PERIPH_SIZE) ||
+          SIM_IN_RANGE(uAddr, SIM_BITBAND_BASE, SIM_BITBAND_SIZE) ||
+          SIM_IN_RANGE(uAddr, SIM_FLASH_WINDOW, SIM_FLASH_SIZE) ||
+          SIM_IN_RANGE(uAddr, SIM_SCS_BASE, SIM_SCS_SIZE))) {
+        /* Not a simulated register, fault again with the default action */
+        (void)fprintf(stderr, "sim: invalid access at %p\n", (void *)uAddr);
+        (void)signal(iSig, SIG_DFL);
+        return;
+    }
+
+    pstcAccess = &m_astcAccess[m_u32AccessNum++];
+    pstcAccess->uPage = SIM_PAGE(uAddr);
+    pstcAccess->u8Write = (0LL != (pstcCtx->uc_mcontext.gregs[REG_ERR] & SIM_X86_PF_WRITE)) ? 1U : 0U;
+    pstcAccess->u8Size = SIM_DecodeSize((const uint8_t *)pstcCtx->uc_mcontext.gregs[REG_RIP]);
+
+    if (SIM_IN_RANGE(uAddr, SIM_BITBAND_BASE, SIM_BITBAND_SIZE)) {
+        /* One word of the alias region is one bit of the peripheral space */
+        pstcAccess->u8BitBand = 1U;
+        pstcAccess->u8Size = 4U;
+        pstcAccess->iProt = PROT_NONE;
+        pstcAccess->u32Addr = (uint32_t)(SIM_PERIPH_BASE + (((uAddr - SIM_BITBAND_BASE) >> 5U) & ~3UL));
+        pstcAccess->u32BitPos = (uint32_t)((uAddr - SIM_BITBAND_BASE) >> 2U) & 0x1FUL;
+        if (0U == pstcAccess->u8Write) {
+            SIM_HookRead(pstcAccess->u32Addr);
+        }
+        u32Word = SIM_REG32(pstcAccess->u32Addr);
+        pstcAccess->u32Old = u32Word;
+        (void)mprotect((void *)pstcAccess->uPage, SIM_PAGE_SIZE, PROT_READ | PROT_WRITE);
+        *(volatile uint32_t *)(uAddr & ~(uintptr_t)3U) = (u32Word >> pstcAccess->u32BitPos) & 1UL;
+    } else {
+        pstcAccess->u8BitBand = 0U;
+        if (SIM_IN_RANGE(uAddr, SIM_FLASH_WINDOW, SIM_FLASH_SIZE)) {
+            pstcAccess->u32Addr = (uint32_t)(uAddr - SIM_FLASH_WINDOW);
+        } else {
+            pstcAccess->u32Addr = (uint32_t)uAddr;
+        }
+        u32Offset = SIM_FileOffset(pstcAccess->u32Addr);
+        pstcAccess->iProt = m_aiPageProt[u32Offset / SIM_PAGE_SIZE];
+        if (0U == pstcAccess->u8Write) {
+            SIM_HookRead(pstcAccess->u32Addr);
+        }
+        pstcAccess->u32Old = SIM_REG32(pstcAccess->u32Addr & ~3UL);
+        (void)mprotect((void *)pstcAccess->uPage, SIM_PAGE_SIZE, PROT_READ | PROT_WRITE);
+    }
+
+    /* Trap again after the faulting instruction */
+    pstcCtx->uc_mcontext.gregs[REG_EFL] |= SIM_X86_EFLAGS_TF;
+}
+
+/**
+ * @brief  Single-step trap handler, closes the pages and runs the post-access hooks.
+ * @param  [in] iSig                    Signal number
+ * @param  [in] pstcInfo                Trap information
+ * @param  [in] pvCtx                   Interrupted context
+ * @retval None
+ */
+static void SIM_TrapHandler(int iSig, siginfo_t *pstcInfo, void *pvCtx)
+{
+    ucontext_t *pstcCtx = (ucontext_t *)pvCtx;
+    stc_sim_access_t *pstcAccess;
+    uint32_t u32AccessNum = m_u32AccessNum;
+    uint32_t u32Alias;
+    uint32_t i;
+
+    (void)pstcInfo;
+    if (0UL == u32AccessNum) {
+        (void)signal(iSig, SIG_DFL);
+        (void)raise(iSig);
+        return;
+    }
+    pstcCtx->uc_mcontext.gregs[REG_EFL] &= ~SIM_X86_EFLAGS_TF;
+
+    m_u32AccessNum = 0UL;
+    for (i = 0UL; i < u32AccessNum; i++) {
+        pstcAccess = &m_astcAccess[i];
+        if ((0U != pstcAccess->u8BitBand) && (0U != pstcAccess->u8Write)) {
+            u32Alias = *(volatile uint32_t *)(SIM_BITBAND_BASE + ((pstcAccess->u32Addr - SIM_PERIPH_BASE) << 5U) +
+                                              (pstcAccess->u32BitPos << 2U));
+            if (0UL != (u32Alias & 1UL)) {
+                SIM_REG32(pstcAccess->u32Addr) |= (1UL << pstcAccess->u32BitPos);
+            } else {
+                SIM_REG32(pstcAccess->u32Addr) &= ~(1UL << pstcAccess->u32BitPos);
+            }
+        }
+        (void)mprotect((void *)pstcAccess->uPage, SIM_PAGE_SIZE, pstcAccess->iProt);
+    }
+    for (i = 0UL; i < u32AccessNum; i++) {
+        SIM_HookDone(&m_astcAccess[i]);
+    }
+}
+
+/**
+ * @brief  Map a host range at a fixed address.
+ * @param  [in] uAddr                   Host address
+ * @param  [in] u32Size                 Size in bytes
+ * @param  [in] iProt                   Protection
+ * @param  [in] iFd                     File descriptor, -1 for anonymous memory
+ * @param  [in] u32Offset               File offset
+ * @retval int32_t:
+ *           - LL_OK:                   Mapped.
+ *           - LL_ERR:                  The address range is not available.
+ */
+static int32_t SIM_MapFixed(uintptr_t uAddr, uint32_t u32Size, int iProt, int iFd, uint32_t u32Offset)
+{
+    int iFlags = MAP_FIXED_NOREPLACE | ((iFd < 0) ? (MAP_PRIVATE | MAP_ANONYMOUS) : MAP_SHARED);
+    void *pvMap = mmap((void *)uAddr, u32Size, iProt, iFlags, iFd, (off_t)u32Offset);
+
+    if (pvMap != (void *)uAddr) {
+        (void)fprintf(stderr, "sim: cannot map %p\n", (void *)uAddr);
+        return LL_ERR;
+    }
+    return LL_OK;
+}
+
+/**
+ * @brief  Initialize the simulated register file and the built-in models.
+ * @param  None
+ * @retval int32_t:
+ *           - LL_OK:                   Initialized.
+ *           - LL_ERR:                  Mapping or signal setup failed.
+ * @note   Call once, before the first driver call.
+ */
+int32_t SIM_Init(void)
+{
+    struct sigaction stcAct;
+    int iFd;
+    int32_t i32Ret = LL_ERR;
+    uint32_t i;
+
+    iFd = memfd_create("hc32_sim", 0U);
+    if ((iFd >= 0) && (0 == ftruncate(iFd, (off_t)SIM_FILE_SIZE))) {
+        m_pu8Shadow = (uint8_t *)mmap(NULL, SIM_FILE_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED, iFd, 0);
+        if ((MAP_FAILED != m_pu8Shadow) &&
+            (LL_OK == SIM_MapFixed(SIM_PERIPH_BASE, SIM_PERIPH_SIZE, PROT_READ | PROT_WRITE, iFd, 0UL)) &&
+            (LL_OK == SIM_MapFixed(SIM_FLASH_WINDOW, SIM_FLASH_SIZE, PROT_READ | PROT_WRITE, iFd, SIM_FLASH_OFFSET)) &&
+            (LL_OK == SIM_MapFixed(SIM_BITBAND_BASE, SIM_BITBAND_SIZE, PROT_NONE, -1, 0UL)) &&
+            (LL_OK == SIM_MapFixed(SIM_SCS_BASE, SIM_SCS_SIZE, PROT_READ | PROT_WRITE, iFd, SIM_SCS_OFFSET))) {
+            i32Ret = LL_OK;
+        }
+    }
+    if (iFd >= 0) {
+        (void)close(iFd);
+    }
+
+    if (LL_OK == i32Ret) {
+        for (i = 0UL; i < SIM_PAGE_NUM; i++) {
+            m_aiPageProt[i] = PROT_READ | PROT_WRITE;
+        }
+        (void)memset(&stcAct, 0, sizeof(stcAct));
+        stcAct.sa_flags = SA_SIGINFO;
+        (void)sigemptyset(&stcAct.sa_mask);
+        stcAct.sa_sigaction = &SIM_FaultHandler;
+        if (0 != sigaction(SIGSEGV, &stcAct, NULL)) {
+            i32Ret = LL_ERR;
+        }
+        stcAct.sa_sigaction = &SIM_TrapHandler;
+        if (0 != sigaction(SIGTRAP, &stcAct, NULL)) {
+            i32Ret = LL_ERR;
+        }
+    }
+
+    if (LL_OK == i32Ret) {
+        if ((LL_OK != SIM_USART_Init()) || (LL_OK != SIM_SPI_Init()) || (LL_OK != SIM_EFM_Init()) ||
+            (LL_OK != SIM_CRC_Init()) || (LL_OK != SIM_I2C_Init())) {
+            i32Ret = LL_ERR;
+        }
+        SIM_Reset();
+    }
+    return i32Ret;
+}
+
+/**
+ * @brief  Reset all peripheral registers to zero, then apply the reset values of the models.
+ * @param  None
+ * @retval None
+ * @note   The flash array keeps its contents.
+ */
+void SIM_Reset(void)
+{
+    uint32_t i;
+
+    (void)memset(m_pu8Shadow, 0, SIM_PERIPH_SIZE);
+    (void)memset(&m_pu8Shadow[SIM_SCS_OFFSET], 0, SIM_SCS_SIZE);
+    for (i = 0UL; i < m_u32ModelNum; i++) {
+        if (NULL != m_astcModel[i].pfnReset) {
+            m_astcModel[i].pfnReset();
+        }
+    }
+}
+
+/**
+ * @brief  Attach a behavioral model to an address range.
+ * @param  [in] pstcModel               Pointer to the model, copied.
+ * @retval int32_t:
+ *           - LL_OK:                   Registered.
+ *           - LL_ERR_INVD_PARAM:       The range is not in the peripheral space, the flash array
+ *                                      or the SCS.
+ *           - LL_ERR_BUF_FULL:         SIM_MODEL_MAX models are registered already.
+ * @note   The first registered model of an address wins, models registered after
+ *         SIM_Init() can only cover addresses the built-in models leave free.
+ */
+int32_t SIM_RegisterModel(const stc_sim_model_t *pstcModel)
+{
+    uint32_t u32Offset;
+    uint32_t u32End;
+    uint32_t u32Page;
+    int iProt;
+
+    if ((NULL == pstcModel) || (0UL == pstcModel->u32Size) ||
+        (SIM_FILE_SIZE == SIM_FileOffset(pstcModel->u32Base)) ||
+        (SIM_FILE_SIZE == SIM_FileOffset(pstcModel->u32Base + pstcModel->u32Size - 1UL))) {
+        return LL_ERR_INVD_PARAM;
+    }
+    if (m_u32ModelNum >= SIM_MODEL_MAX) {
+        return LL_ERR_BUF_FULL;
+    }
+    m_astcModel[m_u32ModelNum++] = *pstcModel;
+
+    if (NULL != pstcModel->pfnRead) {
+        iProt = PROT_NONE;
+    } else if (NULL != pstcModel->pfnWrite) {
+        iProt = PROT_READ;
+    } else {
+        iProt = PROT_READ | PROT_WRITE;
+    }
+    u32Offset = SIM_FileOffset(pstcModel->u32Base);
+    u32End = u32Offset + pstcModel->u32Size - 1UL;
+    for (u32Page = u32Offset / SIM_PAGE_SIZE; u32Page <= (u32End / SIM_PAGE_SIZE); u32Page++) {
+        /* Pages shared by several models get the strictest protection */
+        if ((PROT_NONE == iProt) || (PROT_NONE == m_aiPageProt[u32Page])) {
+            m_aiPageProt[u32Page] = PROT_NONE;
+        } else if ((PROT_READ == iProt) || (PROT_READ == m_aiPageProt[u32Page])) {
+            m_aiPageProt[u32Page] = PROT_READ;
+        } else {
+            /* Plain memory */
+        }
+        (void)mprotect((void *)SIM_PageHostAddr(u32Page), SIM_PAGE_SIZE, m_aiPageProt[u32Page]);
+    }
+    return LL_OK;
+}
+
+/**
+ * @brief  Entry of the application context.
+ * @param  None
+ * @retval None
+ */
+static void SIM_RunEntry(void)
+{
+    m_i32RunRet = m_pfnRunMain();
+}
+
+/**
+ * @brief  Run the application on a stack in the low 4GB of the address space.
+ * @param  [in] pfnMain                 Application main function
+ * @retval Return value of pfnMain, LL_ERR if the stack could not be set up.
+ */
+int32_t SIM_Run(int32_t (*pfnMain)(void))
+{
+    void *pvStack;
+
+    pvStack = mmap(NULL, SIM_RUN_STACK_SIZE, PROT_READ | PROT_WRITE,
+                   MAP_PRIVATE | MAP_ANONYMOUS | MAP_STACK | MAP_32BIT, -1, 0);
+    if ((MAP_FAILED == pvStack) || (0 != getcontext(&m_stcRunCtx))) {
+        return LL_ERR;
+    }
+    m_stcRunCtx.uc_stack.ss_sp = pvStack;
+    m_stcRunCtx.uc_stack.ss_size = SIM_RUN_STACK_SIZE;
+    m_stcRunCtx.uc_link = &m_stcHostCtx;
+    makecontext(&m_stcRunCtx, &SIM_RunEntry, 0);
+
+    m_pfnRunMain = pfnMain;
+    m_i32RunRet = LL_ERR;
+    (void)swapcontext(&m_stcHostCtx, &m_stcRunCtx);
+    (void)munmap(pvStack, SIM_RUN_STACK_SIZE);
+    return m_i32RunRet;
+}
+
+/**
+ * @brief  Get the untrapped host address of a simulated register or flash location.
+ * @param  [in] u32Addr                 Device address
+ * @retval Host address, NULL if the address is not simulated.
+ */
+void *SIM_ShadowAddr(uint32_t u32Addr)
+{
+    uint32_t u32Offset = SIM_FileOffset(u32Addr);
+
+    return (SIM_FILE_SIZE == u32Offset) ? NULL : (void *)&m_pu8Shadow[u32Offset];
+}
+
+/**
+ * @brief  Read a simulated register or flash location without trapping, for
+ *         bus masters other than the host CPU (e.g. an instruction set emulator).
+ * @param  [in] u32Addr                 Device address, the bit-band alias included
+ * @param  [in] u32Size                 1, 2 or 4 bytes, u32Addr aligned to it
+ * @param  [out] pu32Data               Data read, zero extended
+ * @retval int32_t:
+ *           - LL_OK:                   Read, the model hooks ran as for a driver access.
+ *           - LL_ERR:                  The address is not simulated.
+ */
+int32_t SIM_BusRead(uint32_t u32Addr, uint32_t u32Size, uint32_t *pu32Data)
+{
+    stc_sim_access_t stcAccess = {0};
+    uint32_t u32Offset;
+
+    stcAccess.u8Size = (uint8_t)u32Size;
+    if (SIM_IN_RANGE(u32Addr, SIM_BITBAND_BASE, SIM_BITBAND_SIZE)) {
+        stcAccess.u32Addr = SIM_PERIPH_BASE + (((u32Addr - SIM_BITBAND_BASE) >> 5U) & ~3UL);
+        SIM_HookRead(stcAccess.u32Addr);
+        *pu32Data = (SIM_REG32(stcAccess.u32Addr) >> (((u32Addr - SIM_BITBAND_BASE) >> 2U) & 0x1FUL)) & 1UL;
+    } else {
+        u32Offset = SIM_FileOffset(u32Addr);
+        if (SIM_FILE_SIZE == u32Offset) {
+            return LL_ERR;
+        }
+        stcAccess.u32Addr = u32Addr;
+        SIM_HookRead(u32Addr);
+        if (1UL == u32Size) {
+            *pu32Data = m_pu8Shadow[u32Offset];
+        } else if (2UL == u32Size) {
+            *pu32Data = *(volatile uint16_t *)&m_pu8Shadow[u32Offset];
+        } else {
+            *pu32Data = *(volatile uint32_t *)&m_pu8Shadow[u32Offset];
+        }
+    }
+    SIM_HookDone(&stcAccess);
+    return LL_OK;
+}
+
+/**
+ * @brief  Write a simulated register or flash location without trapping.
+ * @param  [in] u32Addr                 Device address, the bit-band alias included
+ * @param  [in] u32Size                 1, 2 or 4 bytes, u32Addr aligned to it
+ * @param  [in] u32Data                 Data, the low u32Size bytes are written
+ * @retval int32_t:
+ *           - LL_OK:                   Written, the model hooks ran as for a driver access.
+ *           - LL_ERR:                  The address is not simulated.
+ */
+int32_t SIM_BusWrite(uint32_t u32Addr, uint32_t u32Size, uint32_t u32Data)
+{
+    stc_sim_access_t stcAccess = {0};
+    uint32_t u32Offset;
+    uint32_t u32BitPos;
+
+    stcAccess.u8Write = 1U;
+    stcAccess.u8Size = (uint8_t)u32Size;
+    if (SIM_IN_RANGE(u32Addr, SIM_BITBAND_BASE, SIM_BITBAND_SIZE)) {
+        stcAccess.u32Addr = SIM_PERIPH_BASE + (((u32Addr - SIM_BITBAND_BASE) >> 5U) & ~3UL);
+        u32BitPos = ((u32Addr - SIM_BITBAND_BASE) >> 2U) & 0x1FUL;
+        stcAccess.u32Old = SIM_REG32(stcAccess.u32Addr);
+        if (0UL != (u32Data & 1UL)) {
+            SIM_REG32(stcAccess.u32Addr) |= (1UL << u32BitPos);
+        } else {
+            SIM_REG32(stcAccess.u32Addr) &= ~(1UL << u32BitPos);
+        }
+    } else {
+        u32Offset = SIM_FileOffset(u32Addr);
+        if (SIM_FILE_SIZE == u32Offset) {
+            return LL_ERR;
+        }
+        stcAccess.u32Addr = u32Addr;
+        stcAccess.u32Old = SIM_REG32(u32Addr & ~3UL);
+        if (1UL == u32Size) {
+            m_pu8Shadow[u32Offset] = (uint8_t)u32Data;
+        } else if (2UL == u32Size) {
+            *(volatile uint16_t *)&m_pu8Shadow[u32Offset] = (uint16_t)u32Data;
+        } else {
+            *(volatile uint32_t *)&m_pu8Shadow[u32Offset] = u32Data;
+        }
+    }
+    SIM_HookDone(&stcAccess);
+    return LL_OK;
+}
+
+/**
+ * @brief  Get the size of the access whose pfnReadDone or pfnWrite hook runs.
+ * @param  None
+ * @retval 1, 2 or 4 bytes (8 for a 64-bit host access).
+ */
+uint32_t SIM_GetAccessSize(void)
+{
+    return m_u32HookSize;
+}
+
+/**
+ * @brief  Get PRIMASK, for __get_PRIMASK().
+ * @param  None
+ * @retval PRIMASK
+ */
+uint32_t SIM_GetPrimask(void)
+{
+    return m_u32Primask;
+}
+
+/**
+ * @brief  Set PRIMASK, for __set_PRIMASK(), __enable_irq() and __disable_irq().
+ * @param  [in] u32Primask              PRIMASK, bit 0 used.
+ * @retval None
+ * @note   Unmasked, a pending SysTick then a pending PendSV are taken before
+ *         returning. Their handlers run masked, as on the target.
+ */
+void SIM_SetPrimask(uint32_t u32Primask)
+{
+    m_u32Primask = u32Primask & 1UL;
+    SIM_TakeSysTick();
+    while ((0UL == m_u32Primask) && (NULL != m_pfnPendSV) && (0UL != (SIM_REG32(SIM_SCB_ICSR) & SCB_ICSR_PENDSVSET_Msk))) {
+        SIM_REG32(SIM_SCB_ICSR) &= ~SCB_ICSR_PENDSVSET_Msk;
+        m_u32Primask = 1UL;
+        m_pfnPendSV();
+        m_u32Primask = 0UL;
+    }
+}
+
+/**
+ * @brief  Take a pending SysTick exception unless PRIMASK is set.
+ * @param  None
+ * @retval None
+ */
+void SIM_TakeSysTick(void)
+{
+    if ((0UL == m_u32Primask) && (NULL != m_pfnSysTick) && (0UL != (SIM_REG32(SIM_SCB_ICSR) & SCB_ICSR_PENDSTSET_Msk))) {
+        SIM_REG32(SIM_SCB_ICSR) &= ~SCB_ICSR_PENDSTSET_Msk;
+        m_u32Primask = 1UL;
+        m_pfnSysTick();
+        m_u32Primask = 0UL;
+    }
+}
+
+/**
+ * @brief  Wait for an interrupt, for __WFI().
+ * @param  None
+ * @retval None
+ * @note   The SysTick model is the only timed interrupt source: while it runs, its
+ *         counter moves on to the next interrupt, which is taken unless PRIMASK
+ *         is set. Otherwise returns at once.
+ * @note   The hook of SIM_SetWfiHook() runs first.
+ */
+void SIM_WaitForInterrupt(void)
+{
+    if (NULL != m_pfnWfiHook) {
+        m_pfnWfiHook();
+    }
+    SIM_SYSTICK_Wait();
+    SIM_TakeSysTick();
+}
+
+/**
+ * @brief  Install the SysTick handler.
+ * @param  [in] pfnHandler              Handler, NULL to leave SysTick pending forever.
+ * @retval None
+ * @note   Taken before a read of the SCS, the handler runs inside the page fault
+ *         handler then and must not access a modeled register.
+ */
+void SIM_SetSysTickHandler(void (*pfnHandler)(void))
+{
+    m_pfnSysTick = pfnHandler;
+}
+
+/**
+ * @brief  Install the PendSV handler.
+ * @param  [in] pfnHandler              Handler, NULL to leave PendSV pending forever.
+ * @retval None
+ * @note   The handler may switch to another ucontext. A context entered for the
+ *         first time from the handler must call SIM_SetPrimask(0UL), the
+ *         exception return of the target.
+ */
+void SIM_SetPendSVHandler(void (*pfnHandler)(void))
+{
+    m_pfnPendSV = pfnHandler;
+}
+
+/**
+ * @brief  Install a hook called by __WFI() before the core waits.
+ * @param  [in] pfnHook                 Hook, NULL to remove it.
+ * @retval None
+ * @note   It sees the registers the way the core enters sleep or stop mode with.
+ */
+void SIM_SetWfiHook(void (*pfnHook)(void))
+{
+    m_pfnWfiHook = pfnHook;
+}
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
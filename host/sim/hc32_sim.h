@@ -0,0 +1,315 @@
+/**
+ *******************************************************************************
+ * @file  host/sim/hc32_sim.h
+ * @brief This file contains all the functions prototypes of the simulated
+ *        register file used by the host build of the LL drivers.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-16       CDT             First version
+   2026-10-17       CDT             Add SPI NOR flash model
+                                    Add SIM_SetPendSVHandler()
+                                    Add SIM_EFM_PowerCut() and SIM_EFM_PowerOn()
+                                    Add SysTick model
+                                    Add SIM_GetAccessSize() and the CRC model
+                                    Add I2C model
+                                    Add SIM_SetWfiHook()
+                                    Add SIM_EFM_HoldWaitCycle()
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2022-2023, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+#ifndef __HC32_SIM_H__
+#define __HC32_SIM_H__
+
+/* C binding of definitions if building with C++ compiler */
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_ll.h"
+
+/**
+ * @addtogroup HC32F120_DDL_Host
+ * @{
+ */
+
+/**
+ * @addtogroup SIM
+ * @{
+ */
+
+/*******************************************************************************
+ * Global type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @defgroup SIM_Global_Types SIM Global Types
+ * @{
+ */
+
+/**
+ * @brief Behavioral model of one peripheral (or of the flash array).
+ * @note  The register contents live in the simulated register file, the hooks
+ *        update them through SIM_REG32()/SIM_REG16()/SIM_REG8(). A hook must not
+ *        touch the device addresses (CM_xxx) itself.
+ * @note  All hooks are optional. A model without hooks is plain memory, a model
+ *        with only pfnWrite leaves reads untrapped and therefore fast.
+ * @note  pfnReadDone and pfnWrite get the access size from SIM_GetAccessSize().
+ */
+typedef struct {
+    uint32_t u32Base;                   /*!< Device address of the model. */
+    uint32_t u32Size;                   /*!< Size of the address range in bytes. */
+    void (*pfnReset)(void);             /*!< Called by SIM_Reset() after the registers were cleared. */
+    void (*pfnRead)(uint32_t u32Addr);  /*!< Called before the driver reads u32Addr, brings the
+                                             register up to date. Must have no other side effect. */
+    void (*pfnReadDone)(uint32_t u32Addr);
+                                        /*!< Called after the driver read u32Addr, for read side
+                                             effects such as popping a receive buffer. */
+    void (*pfnWrite)(uint32_t u32Addr, uint32_t u32Old);
+                                        /*!< Called after the driver wrote u32Addr, u32Old is the
+                                             word at (u32Addr & ~3) before the write. */
+} stc_sim_model_t;
+
+/**
+ * @brief SPI slave device called for every frame the SPI master shifts out.
+ * @param  [in] u32Mosi                 Frame sent by the master
+ * @param  [in] pvArg                   User argument given to SIM_SPI_SetSlave()
+ * @retval Frame returned on MISO
+ */
+typedef uint32_t (*func_ptr_sim_spi_slave_t)(uint32_t u32Mosi, void *pvArg);
+
+/**
+ * @brief I2C slave device called for every event on the bus of the I2C master.
+ * @param  [in] u32Event                @ref SIM_I2C_Slave_Event
+ * @param  [in] u32Data                 Address byte for SIM_I2C_EVT_ADDR, data byte for
+ *                                      SIM_I2C_EVT_WRITE, the @ref SIM_I2C_Ack the master
+ *                                      gives for SIM_I2C_EVT_READ, 0 otherwise
+ * @param  [in] pvArg                   User argument given to SIM_I2C_SetSlave()
+ * @retval The @ref SIM_I2C_Ack for SIM_I2C_EVT_ADDR and SIM_I2C_EVT_WRITE, the byte
+ *         sent for SIM_I2C_EVT_READ, ignored otherwise
+ */
+typedef uint32_t (*func_ptr_sim_i2c_slave_t)(uint32_t u32Event, uint32_t u32Data, void *pvArg);
+
+/**
+ * @brief USART transmit sink, called for every frame written to the data register.
+ * @param  [in] u16Data                 Frame transmitted
+ * @param  [in] pvArg                   User argument given to SIM_USART_SetTxCallback()
+ * @retval None
+ */
+typedef void (*func_ptr_sim_usart_tx_t)(uint16_t u16Data, void *pvArg);
+
+/**
+ * @brief Flash operation counters of the EFM model.
+ */
+typedef struct {
+    uint32_t u32ProgramCount;           /*!< Program operations (per written word, halfword or byte). */
+    uint32_t u32ChipEraseCount;         /*!< Chip erase operations. */
+    uint32_t au32SectorEraseCount[SIM_FLASH_SIZE / SECTOR_SIZE];
+                                        /*!< Sector erase operations per sector. */
+    uint32_t u32ErrorCount;             /*!< Writes to the flash array outside program/erase mode. */
+} stc_sim_efm_stat_t;
+
+/**
+ * @brief SPI NOR flash model configuration.
+ * @note  The busy times are those of the part, the typical values of the datasheet.
+ */
+typedef struct {
+    uint32_t u32JedecId;                /*!< Manufacturer, type and capacity bytes returned for 0x9F,
+                                             the array size is 2^capacity byte. */
+    uint32_t u32PclkHz;                 /*!< SPI clock source, SCK follows SPI_CFG2.MBR. */
+    uint8_t u8CsPort;                   /*!< Chip select port, @ref GPIO_Port_Source for details. */
+    uint16_t u16CsPin;                  /*!< Chip select pin, a single one of @ref GPIO_Pins_Define. */
+    uint32_t u32PageProgramUs;          /*!< Page program time. */
+    uint32_t u32SectorEraseUs;          /*!< 4KB sector erase time. */
+    uint32_t u32Block32EraseUs;         /*!< 32KB block erase time. */
+    uint32_t u32Block64EraseUs;         /*!< 64KB block erase time. */
+    uint32_t u32ChipEraseUs;            /*!< Chip erase time. */
+} stc_sim_nor_cfg_t;
+
+/**
+ * @brief Operation counters of the SPI NOR flash model.
+ */
+typedef struct {
+    uint32_t u32ReadBytes;              /*!< Data bytes returned by the read commands. */
+    uint32_t u32ProgramCount;           /*!< Page program operations. */
+    uint32_t u32ProgramBytes;           /*!< Bytes shifted in by the page program operations. */
+    uint32_t u32EraseCount;             /*!< Sector, block and chip erase operations. */
+    uint32_t u32StatusPolls;            /*!< Status register bytes read. */
+    uint32_t u32BusyPolls;              /*!< Status register bytes read with WIP set. */
+    uint32_t u32ErrorCount;             /*!< Commands ignored because the part was busy or not
+                                             write enabled. */
+} stc_sim_nor_stat_t;
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+/**
+ * @defgroup SIM_Global_Macros SIM Global Macros
+ * @{
+ */
+
+/**
+ * @defgroup SIM_Model_Max SIM Model Max
+ * @{
+ */
+#define SIM_MODEL_MAX                   (32U)
+/**
+ * @}
+ */
+
+/**
+ * @defgroup SIM_USART_Rx_Buf_Size SIM USART RX Buffer Size
+ * @{
+ */
+#define SIM_USART_RX_BUF_SIZE           (256U)  /*!< Frames SIM_USART_InjectRx() can queue per unit. */
+/**
+ * @}
+ */
+
+/**
+ * @defgroup SIM_I2C_Slave_Event SIM I2C Slave Event
+ * @{
+ */
+#define SIM_I2C_EVT_START               (0UL)   /*!< Start or repeated start condition. */
+#define SIM_I2C_EVT_ADDR                (1UL)   /*!< Address byte, 7-bit address << 1 | R/W bit. */
+#define SIM_I2C_EVT_WRITE               (2UL)   /*!< Data byte from the master. */
+#define SIM_I2C_EVT_READ                (3UL)   /*!< Data byte to the master. */
+#define SIM_I2C_EVT_STOP                (4UL)   /*!< Stop condition. */
+/**
+ * @}
+ */
+
+/**
+ * @defgroup SIM_I2C_Ack SIM I2C Ack
+ * @{
+ */
+#define SIM_I2C_ACK                     (0UL)
+#define SIM_I2C_NACK                    (1UL)
+/**
+ * @}
+ */
+
+/**
+ * @defgroup SIM_NOR_Page_Size SIM NOR Page Size
+ * @{
+ */
+#define SIM_NOR_PAGE_SIZE               (256UL) /*!< Page program wraps inside one page. */
+/**
+ * @}
+ */
+
+/**
+ * @defgroup SIM_Register_Access SIM Register Access
+ * @brief Access to the simulated register file from the models, untrapped.
+ * @{
+ */
+#define SIM_REG8(addr)                  (*(volatile uint8_t *)SIM_ShadowAddr((uint32_t)(addr)))
+#define SIM_REG16(addr)                 (*(volatile uint16_t *)SIM_ShadowAddr((uint32_t)(addr)))
+#define SIM_REG32(addr)                 (*(volatile uint32_t *)SIM_ShadowAddr((uint32_t)(addr)))
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * Global variable definitions ('extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+  Global function prototypes (definition in C source)
+ ******************************************************************************/
+/**
+ * @addtogroup SIM_Global_Functions
+ * @{
+ */
+/* hc32_sim.c */
+int32_t SIM_Init(void);
+void SIM_Reset(void);
+int32_t SIM_RegisterModel(const stc_sim_model_t *pstcModel);
+int32_t SIM_Run(int32_t (*pfnMain)(void));
+void *SIM_ShadowAddr(uint32_t u32Addr);
+int32_t SIM_BusRead(uint32_t u32Addr, uint32_t u32Size, uint32_t *pu32Data);
+int32_t SIM_BusWrite(uint32_t u32Addr, uint32_t u32Size, uint32_t u32Data);
+void SIM_SetPendSVHandler(void (*pfnHandler)(void));
+void SIM_SetSysTickHandler(void (*pfnHandler)(void));
+void SIM_SetWfiHook(void (*pfnHook)(void));
+uint32_t SIM_GetAccessSize(void);
+void SIM_TakeSysTick(void);
+
+/* hc32_sim_usart.c */
+int32_t SIM_USART_Init(void);
+void SIM_USART_SetTxCallback(const CM_USART_TypeDef *USARTx, func_ptr_sim_usart_tx_t pfnTx, void *pvArg);
+uint32_t SIM_USART_InjectRx(const CM_USART_TypeDef *USARTx, const uint16_t *pu16Data, uint32_t u32Len);
+
+/* hc32_sim_spi.c */
+int32_t SIM_SPI_Init(void);
+void SIM_SPI_SetSlave(func_ptr_sim_spi_slave_t pfnSlave, void *pvArg);
+
+/* hc32_sim_i2c.c */
+int32_t SIM_I2C_Init(void);
+void SIM_I2C_SetSlave(func_ptr_sim_i2c_slave_t pfnSlave, void *pvArg);
+
+/* hc32_sim_crc.c */
+int32_t SIM_CRC_Init(void);
+
+/* hc32_sim_efm.c */
+int32_t SIM_EFM_Init(void);
+const stc_sim_efm_stat_t *SIM_EFM_GetStat(void);
+void SIM_EFM_ClearStat(void);
+void SIM_EFM_PowerCut(uint32_t u32OpNum, uint32_t u32TornMask);
+void SIM_EFM_PowerOn(void);
+void SIM_EFM_HoldWaitCycle(en_functional_state_t enNewState);
+
+/* hc32_sim_systick.c */
+int32_t SIM_SYSTICK_Init(void);
+void SIM_SYSTICK_SetCycle(uint32_t u32CyclePerRead);
+uint64_t SIM_SYSTICK_GetCycle(void);
+void SIM_SYSTICK_Wait(void);
+
+/* hc32_sim_nor.c */
+int32_t SIM_NOR_Init(const stc_sim_nor_cfg_t *pstcCfg);
+uint8_t *SIM_NOR_GetArray(void);
+uint64_t SIM_NOR_GetTime(void);
+void SIM_NOR_Advance(uint32_t u32Ns);
+const stc_sim_nor_stat_t *SIM_NOR_GetStat(void);
+void SIM_NOR_ClearStat(void);
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __HC32_SIM_H__ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
@@ -0,0 +1,191 @@
+/**
+ *******************************************************************************
+ * @file  host/sim/hc32_sim_crc.c
+ * @brief CRC behavioral model of the simulated register file.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-17       CDT             First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2022-2023, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_sim.h"
+
+/**
+ * @addtogroup HC32F120_DDL_Host
+ * @{
+ */
+
+/**
+ * @defgroup SIM_CRC SIM CRC
+ * @brief CRC model of ISO/IEC 13239: CRC16 is X.25 and CRC32 is the CRC of
+ *        IEEE 802.3, both bit reflected. A write to RESLT sets the CRC register,
+ *        RESLT reads it inverted, the final value of the protocol. A write to
+ *        DAT0 ~ DAT31 feeds its bytes, the lowest first, 1, 2 or 4 of them
+ *        after the access size. CR.FLAG is set while the CRC register holds the
+ *        residue of a good frame, that is after the data and the value it
+ *        reads as. Only writes are trapped.
+ * @{
+ */
+
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+#define SIM_CRC_SIZE                    (0x100UL)
+
+#define SIM_CRC_CR                      (CM_CRC_BASE + 0x00UL)
+#define SIM_CRC_RESLT                   (CM_CRC_BASE + 0x04UL)
+#define SIM_CRC_DAT0                    (CM_CRC_BASE + 0x80UL)
+
+/* Reflected polynomials and the CRC register after a good frame */
+#define SIM_CRC16_POLY                  (0x8408UL)
+#define SIM_CRC16_RESIDUE               (0xF0B8UL)
+#define SIM_CRC32_POLY                  (0xEDB88320UL)
+#define SIM_CRC32_RESIDUE               (0xDEBB20E3UL)
+
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+static uint32_t m_u32Crc;
+
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @brief  Publish the CRC register in RESLT and CR.FLAG.
+ * @param  None
+ * @retval None
+ */
+static void SIM_CRC_Update(void)
+{
+    uint32_t u32Residue = SIM_CRC16_RESIDUE;
+    uint32_t u32Mask = 0xFFFFUL;
+
+    if (0UL != (SIM_REG32(SIM_CRC_CR) & CRC_CR_CR)) {
+        u32Residue = SIM_CRC32_RESIDUE;
+        u32Mask = 0xFFFFFFFFUL;
+    }
+    m_u32Crc &= u32Mask;
+    SIM_REG32(SIM_CRC_RESLT) = m_u32Crc ^ u32Mask;
+    if (m_u32Crc == u32Residue) {
+        SIM_REG32(SIM_CRC_CR) |= CRC_CR_FLAG;
+    } else {
+        SIM_REG32(SIM_CRC_CR) &= ~CRC_CR_FLAG;
+    }
+}
+
+/**
+ * @brief  Feed one byte to the CRC register.
+ * @param  [in] u8Data                  Data byte
+ * @retval None
+ */
+static void SIM_CRC_Feed(uint8_t u8Data)
+{
+    const uint32_t u32Poly = (0UL != (SIM_REG32(SIM_CRC_CR) & CRC_CR_CR)) ? SIM_CRC32_POLY : SIM_CRC16_POLY;
+    uint32_t i;
+
+    m_u32Crc ^= u8Data;
+    for (i = 0UL; i < 8UL; i++) {
+        m_u32Crc = (0UL != (m_u32Crc & 1UL)) ? ((m_u32Crc >> 1U) ^ u32Poly) : (m_u32Crc >> 1U);
+    }
+}
+
+/**
+ * @brief  Reset the CRC registers: CRC32 selected.
+ * @param  None
+ * @retval None
+ */
+static void SIM_CRC_Reset(void)
+{
+    SIM_REG32(SIM_CRC_CR) = CRC_CR_CR;
+    m_u32Crc = 0UL;
+    SIM_CRC_Update();
+}
+
+/**
+ * @brief  Set the CRC register or feed data.
+ * @param  [in] u32Addr                 Device address
+ * @param  [in] u32Old                  Register word before the write
+ * @retval None
+ */
+static void SIM_CRC_Write(uint32_t u32Addr, uint32_t u32Old)
+{
+    const uint32_t u32Word = u32Addr & ~3UL;
+    uint32_t u32Size = SIM_GetAccessSize();
+    uint32_t u32Data = SIM_REG32(u32Word) >> ((u32Addr & 3UL) * 8U);
+    uint32_t i;
+
+    if (u32Size > 4UL) {
+        u32Size = 4UL;
+    }
+    if (SIM_CRC_CR == u32Word) {
+        /* FLAG is read only */
+        SIM_REG32(SIM_CRC_CR) = (SIM_REG32(SIM_CRC_CR) & ~CRC_CR_FLAG) | (u32Old & CRC_CR_FLAG);
+    } else if (SIM_CRC_RESLT == u32Word) {
+        m_u32Crc = (4UL == u32Size) ? u32Data : (u32Data & 0xFFFFUL);
+    } else if (u32Word >= SIM_CRC_DAT0) {
+        for (i = 0UL; i < u32Size; i++) {
+            SIM_CRC_Feed((uint8_t)(u32Data >> (i * 8U)));
+        }
+    } else {
+        /* Reserved */
+    }
+    SIM_CRC_Update();
+}
+
+/**
+ * @brief  Register the CRC model.
+ * @param  None
+ * @retval int32_t:
+ *           - LL_OK:                   Registered.
+ *           - Others:                  @ref SIM_RegisterModel
+ */
+int32_t SIM_CRC_Init(void)
+{
+    const stc_sim_model_t stcModel = {
+        .u32Base = CM_CRC_BASE,
+        .u32Size = SIM_CRC_SIZE,
+        .pfnReset = &SIM_CRC_Reset,
+        .pfnRead = NULL,
+        .pfnReadDone = NULL,
+        .pfnWrite = &SIM_CRC_Write,
+    };
+
+    return SIM_RegisterModel(&stcModel);
+}
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
@@ -0,0 +1,314 @@
+/**
+ *******************************************************************************
+ * @file  host/sim/hc32_sim_efm.c
+ * @brief EFM and flash array behavioral model of the simulated register file.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-16       CDT             First version
+   2026-10-17       CDT             Add power loss in the middle of a program or erase sequence
+                                    Add a wait cycle setting that does not take effect
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2022-2023, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include <string.h>
+
+#include "hc32_sim.h"
+
+/**
+ * @addtogroup HC32F120_DDL_Host
+ * @{
+ */
+
+/**
+ * @defgroup SIM_EFM SIM EFM
+ * @brief EFM model: operations complete instantly, FSR.RDY always reads as set
+ *        and FSR.OPTEND is set after every program or erase. A program clears
+ *        bits only (new = old & data), a sector erase sets the 512 bytes of the
+ *        sector, a chip erase the whole array to 0xFF. A write to the array
+ *        outside program/erase mode is discarded and sets FSR.PEWERR.
+ *        The array is erased once at SIM_Init() and keeps its contents over
+ *        SIM_Reset().
+ *        SIM_EFM_PowerCut() loses the power after a number of program and erase
+ *        operations: the next program only clears the bits of a torn mask, the
+ *        next erase does nothing, and later operations are lost until
+ *        SIM_EFM_PowerOn(). FSR.OPTEND is still set, as the driver that saw the
+ *        power go would not run anymore.
+ * @{
+ */
+
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+#define SIM_EFM_SIZE                    (0x400UL)
+
+#define SIM_EFM_FRMC                    (CM_EFM_BASE + 0x08UL)
+#define SIM_EFM_FWMC                    (CM_EFM_BASE + 0x0CUL)
+#define SIM_EFM_FSR                     (CM_EFM_BASE + 0x10UL)
+#define SIM_EFM_FSCLR                   (CM_EFM_BASE + 0x14UL)
+
+#define SIM_EFM_POWER_ON                (0xFFFFFFFFUL)
+
+#define SIM_EFM_FSR_CLR_MASK            (EFM_FSR_PEWERR | EFM_FSR_PEPRTERR | EFM_FSR_PGMISMTCH | \
+                                         EFM_FSR_OPTEND | EFM_FSR_COLERR)
+
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+static stc_sim_efm_stat_t m_stcEfmStat;
+/* Operations left before the power is lost, SIM_EFM_POWER_ON if never */
+static uint32_t m_u32PowerOpLeft = SIM_EFM_POWER_ON;
+static uint32_t m_u32TornMask;
+/* FRMC.FLWT keeps its value while set */
+static en_functional_state_t m_enWaitCycleHold = DISABLE;
+
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @brief  Reset the EFM registers.
+ * @param  None
+ * @retval None
+ */
+static void SIM_EFM_Reset(void)
+{
+    SIM_REG32(SIM_EFM_FSR) = EFM_FSR_RDY;
+}
+
+/**
+ * @brief  The flash is ready whenever the driver looks.
+ * @param  [in] u32Addr                 Device address
+ * @retval None
+ */
+static void SIM_EFM_Read(uint32_t u32Addr)
+{
+    if ((u32Addr & ~3UL) == SIM_EFM_FSR) {
+        SIM_REG32(SIM_EFM_FSR) |= EFM_FSR_RDY;
+    }
+}
+
+/**
+ * @brief  FSCLR clears FSR flags and reads as 0, FSR is read only, FRMC.FLWT is held by
+ *         SIM_EFM_HoldWaitCycle().
+ * @param  [in] u32Addr                 Device address
+ * @param  [in] u32Old                  Register word before the write
+ * @retval None
+ */
+static void SIM_EFM_Write(uint32_t u32Addr, uint32_t u32Old)
+{
+    if ((u32Addr & ~3UL) == SIM_EFM_FSCLR) {
+        SIM_REG32(SIM_EFM_FSR) &= ~(SIM_REG32(SIM_EFM_FSCLR) & SIM_EFM_FSR_CLR_MASK);
+        SIM_REG32(SIM_EFM_FSCLR) = 0UL;
+    } else if ((u32Addr & ~3UL) == SIM_EFM_FSR) {
+        SIM_REG32(SIM_EFM_FSR) = u32Old;
+    } else if (((u32Addr & ~3UL) == SIM_EFM_FRMC) && (ENABLE == m_enWaitCycleHold)) {
+        SIM_REG32(SIM_EFM_FRMC) = (SIM_REG32(SIM_EFM_FRMC) & ~EFM_FRMC_FLWT) | (u32Old & EFM_FRMC_FLWT);
+    } else {
+        /* Plain register */
+    }
+}
+
+/**
+ * @brief  Count a program or erase operation against the power cut.
+ * @param  None
+ * @retval uint32_t:                    Bits the operation may clear, 0 once the power is lost
+ */
+static uint32_t SIM_EFM_PowerMask(void)
+{
+    uint32_t u32Mask = 0xFFFFFFFFUL;
+
+    if (SIM_EFM_POWER_ON != m_u32PowerOpLeft) {
+        if (m_u32PowerOpLeft > 0UL) {
+            m_u32PowerOpLeft--;
+        } else {
+            /* The operation the power is lost in, later ones have no power at all */
+            u32Mask = m_u32TornMask;
+            m_u32TornMask = 0UL;
+        }
+    }
+    return u32Mask;
+}
+
+/**
+ * @brief  Turn a write to the flash array into the operation selected by FWMC.
+ * @param  [in] u32Addr                 Flash address
+ * @param  [in] u32Old                  Flash word before the write
+ * @retval None
+ */
+static void SIM_EFM_FlashWrite(uint32_t u32Addr, uint32_t u32Old)
+{
+    uint32_t u32Word = u32Addr & ~3UL;
+    uint32_t u32Data = SIM_REG32(u32Word);
+    uint32_t u32Fwmc = SIM_REG32(SIM_EFM_FWMC);
+    uint32_t u32Sector;
+    uint32_t u32Flag = EFM_FSR_OPTEND;
+    uint32_t u32Mask;
+
+    if (0UL == (u32Fwmc & EFM_FWMC_PEMODE)) {
+        u32Fwmc = EFM_MD_READONLY;
+    }
+    switch (u32Fwmc & EFM_FWMC_PEMOD) {
+        case EFM_MD_PGM_SINGLE:
+        case EFM_MD_PGM_SEQ:
+            /* Bytes not written are unchanged, old & old keeps them */
+            u32Mask = SIM_EFM_PowerMask();
+            SIM_REG32(u32Word) = u32Old & (u32Data | ~u32Mask);
+            m_stcEfmStat.u32ProgramCount++;
+            break;
+        case EFM_MD_PGM_READBACK:
+            u32Mask = SIM_EFM_PowerMask();
+            SIM_REG32(u32Word) = u32Old & (u32Data | ~u32Mask);
+            if (SIM_REG32(u32Word) != u32Data) {
+                u32Flag |= EFM_FSR_PGMISMTCH;
+            }
+            m_stcEfmStat.u32ProgramCount++;
+            break;
+        case EFM_MD_ERASE_SECTOR:
+            SIM_REG32(u32Word) = u32Old;
+            u32Sector = u32Addr / SECTOR_SIZE;
+            if (0xFFFFFFFFUL == SIM_EFM_PowerMask()) {
+                (void)memset(SIM_ShadowAddr(u32Sector * SECTOR_SIZE), 0xFF, SECTOR_SIZE);
+            }
+            m_stcEfmStat.au32SectorEraseCount[u32Sector]++;
+            break;
+        case EFM_MD_ERASE_ALL_CHIP:
+            SIM_REG32(u32Word) = u32Old;
+            if (0xFFFFFFFFUL == SIM_EFM_PowerMask()) {
+                (void)memset(SIM_ShadowAddr(0UL), 0xFF, SIM_FLASH_SIZE);
+            }
+            m_stcEfmStat.u32ChipEraseCount++;
+            break;
+        default:
+            SIM_REG32(u32Word) = u32Old;
+            u32Flag = EFM_FSR_PEWERR;
+            m_stcEfmStat.u32ErrorCount++;
+            break;
+    }
+    SIM_REG32(SIM_EFM_FSR) |= u32Flag;
+}
+
+/**
+ * @brief  Register the EFM register and flash array models, erase the array.
+ * @param  None
+ * @retval int32_t:
+ *           - LL_OK:                   Registered.
+ *           - Others:                  @ref SIM_RegisterModel
+ */
+int32_t SIM_EFM_Init(void)
+{
+    const stc_sim_model_t stcEfmModel = {
+        .u32Base = CM_EFM_BASE,
+        .u32Size = SIM_EFM_SIZE,
+        .pfnReset = &SIM_EFM_Reset,
+        .pfnRead = &SIM_EFM_Read,
+        .pfnReadDone = NULL,
+        .pfnWrite = &SIM_EFM_Write,
+    };
+    /* Reads of the array are not trapped */
+    const stc_sim_model_t stcFlashModel = {
+        .u32Base = 0UL,
+        .u32Size = SIM_FLASH_SIZE,
+        .pfnReset = NULL,
+        .pfnRead = NULL,
+        .pfnReadDone = NULL,
+        .pfnWrite = &SIM_EFM_FlashWrite,
+    };
+    int32_t i32Ret;
+
+    (void)memset(SIM_ShadowAddr(0UL), 0xFF, SIM_FLASH_SIZE);
+    SIM_EFM_ClearStat();
+    i32Ret = SIM_RegisterModel(&stcEfmModel);
+    if (LL_OK == i32Ret) {
+        i32Ret = SIM_RegisterModel(&stcFlashModel);
+    }
+    return i32Ret;
+}
+
+/**
+ * @brief  Get the flash operation counters.
+ * @param  None
+ * @retval Pointer to the counters
+ */
+const stc_sim_efm_stat_t *SIM_EFM_GetStat(void)
+{
+    return &m_stcEfmStat;
+}
+
+/**
+ * @brief  Clear the flash operation counters.
+ * @param  None
+ * @retval None
+ */
+void SIM_EFM_ClearStat(void)
+{
+    (void)memset(&m_stcEfmStat, 0, sizeof(m_stcEfmStat));
+}
+
+/**
+ * @brief  Lose the power after a number of program and erase operations.
+ * @param  [in] u32OpNum                Operations that still complete, the next one is cut
+ * @param  [in] u32TornMask             Bits the cut program still clears, 0 for none
+ * @retval None
+ */
+void SIM_EFM_PowerCut(uint32_t u32OpNum, uint32_t u32TornMask)
+{
+    m_u32PowerOpLeft = u32OpNum;
+    m_u32TornMask = u32TornMask;
+}
+
+/**
+ * @brief  Restore the power, later operations complete again.
+ * @param  None
+ * @retval None
+ */
+void SIM_EFM_PowerOn(void)
+{
+    m_u32PowerOpLeft = SIM_EFM_POWER_ON;
+    m_u32TornMask = 0UL;
+}
+
+/**
+ * @brief  Keep the flash wait cycles as they are, EFM_SetWaitCycle() times out.
+ * @param  [in] enNewState              An @ref en_functional_state_t enumeration value.
+ * @retval None
+ */
+void SIM_EFM_HoldWaitCycle(en_functional_state_t enNewState)
+{
+    m_enWaitCycleHold = enNewState;
+}
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
@@ -0,0 +1,320 @@
+/**
+ *******************************************************************************
+ * @file  host/sim/hc32_sim_i2c.c
+ * @brief I2C behavioral model of the simulated register file.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-17       CDT             First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2022-2023, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_sim.h"
+
+/**
+ * @addtogroup HC32F120_DDL_Host
+ * @{
+ */
+
+/**
+ * @defgroup SIM_I2C SIM I2C
+ * @brief I2C master model with DTR, the shift register and DRR of the hardware.
+ *        The bus moves one event on each time SR or DRR is read or CR1 or DTR
+ *        is written: a start, restart or stop condition, a byte loaded from DTR
+ *        into the shift register, a byte sent or a byte received. The master
+ *        holds SCL while TENDF or RFULLF is set, so it never overruns. A byte
+ *        is received once DRR was read, with the ACK bit of CR1 at its end.
+ *        After a NACK of the slave no further byte is sent until the next
+ *        start. The bus belongs to the master alone, no arbitration is lost.
+ *        The slave is the device set with SIM_I2C_SetSlave(), without it every
+ *        address is NACKed. No interrupt is raised.
+ * @{
+ */
+
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @brief I2C model state.
+ */
+typedef struct {
+    func_ptr_sim_i2c_slave_t pfnSlave;  /*!< Slave device. */
+    void *pvSlaveArg;                   /*!< Slave device argument. */
+    uint8_t u8TxBuf;                    /*!< Byte written to DTR, not yet shifted. */
+    uint8_t u8Shift;                    /*!< Byte being sent. */
+    uint8_t u8TxFull;                   /*!< 1U while u8TxBuf is valid. */
+    uint8_t u8ShiftBusy;                /*!< 1U while u8Shift is valid. */
+    uint8_t u8Addr;                     /*!< 1U until the address after a start was sent. */
+    uint8_t u8Halt;                     /*!< 1U after a NACK of the slave. */
+    uint8_t u8RxOn;                     /*!< 1U while the master reads and ACKed the last byte. */
+} stc_sim_i2c_t;
+
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+#define SIM_I2C_SIZE                    (0x400UL)
+
+#define SIM_I2C_CR1                     (CM_I2C_BASE + 0x00UL)
+#define SIM_I2C_SR                      (CM_I2C_BASE + 0x1CUL)
+#define SIM_I2C_CLR                     (CM_I2C_BASE + 0x20UL)
+#define SIM_I2C_DTR                     (CM_I2C_BASE + 0x24UL)
+#define SIM_I2C_DRR                     (CM_I2C_BASE + 0x28UL)
+
+#define SIM_I2C_CLR_MASK                                                       \
+(   I2C_SR_STARTF | I2C_SR_SLADDR0F | I2C_SR_SLADDR1F | I2C_SR_TENDF |         \
+    I2C_SR_STOPF | I2C_SR_RFULLF | I2C_SR_TEMPTYF | I2C_SR_ARLOF |             \
+    I2C_SR_NACKF | I2C_SR_GENCALLF | I2C_SR_SMBDEFAULTF | I2C_SR_SMBHOSTF |    \
+    I2C_SR_SMBALRTF)
+
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+static stc_sim_i2c_t m_stcI2c;
+
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @brief  Pass a bus event to the slave.
+ * @param  [in] u32Event                @ref SIM_I2C_Slave_Event
+ * @param  [in] u32Data                 Event data
+ * @retval Slave answer, SIM_I2C_NACK or 0xFF without slave
+ */
+static uint32_t SIM_I2C_Slave(uint32_t u32Event, uint32_t u32Data)
+{
+    uint32_t u32Ret;
+
+    if (NULL != m_stcI2c.pfnSlave) {
+        u32Ret = m_stcI2c.pfnSlave(u32Event, u32Data, m_stcI2c.pvSlaveArg);
+    } else if (SIM_I2C_EVT_READ == u32Event) {
+        u32Ret = 0xFFUL;
+    } else {
+        u32Ret = SIM_I2C_NACK;
+    }
+    return u32Ret;
+}
+
+/**
+ * @brief  Clear the model state.
+ * @param  None
+ * @retval None
+ */
+static void SIM_I2C_Clear(void)
+{
+    m_stcI2c.u8TxFull = 0U;
+    m_stcI2c.u8ShiftBusy = 0U;
+    m_stcI2c.u8Addr = 0U;
+    m_stcI2c.u8Halt = 0U;
+    m_stcI2c.u8RxOn = 0U;
+}
+
+/**
+ * @brief  Finish the byte being sent.
+ * @param  [in,out] pu32Sr              SR value
+ * @retval None
+ */
+static void SIM_I2C_SendEnd(uint32_t *pu32Sr)
+{
+    uint32_t u32Event = (0U != m_stcI2c.u8Addr) ? SIM_I2C_EVT_ADDR : SIM_I2C_EVT_WRITE;
+    uint32_t u32Nack = SIM_I2C_Slave(u32Event, m_stcI2c.u8Shift) & SIM_I2C_NACK;
+
+    m_stcI2c.u8ShiftBusy = 0U;
+    if (SIM_I2C_NACK == u32Nack) {
+        *pu32Sr |= I2C_SR_NACKF | I2C_SR_ACKRF;
+        m_stcI2c.u8Halt = 1U;
+    } else {
+        *pu32Sr &= ~I2C_SR_ACKRF;
+    }
+    if (0U != m_stcI2c.u8Addr) {
+        m_stcI2c.u8Addr = 0U;
+        if (0U != (m_stcI2c.u8Shift & 1U)) {
+            *pu32Sr &= ~I2C_SR_TRA;
+            m_stcI2c.u8RxOn = (SIM_I2C_NACK == u32Nack) ? 0U : 1U;
+        }
+    }
+    /* Transfer end: the byte is sent and nothing waits in DTR */
+    if (0U == m_stcI2c.u8TxFull) {
+        *pu32Sr |= I2C_SR_TENDF;
+    }
+}
+
+/**
+ * @brief  Move the bus one event on and update SR.
+ * @param  None
+ * @retval None
+ */
+static void SIM_I2C_Step(void)
+{
+    uint32_t u32Cr1 = SIM_REG32(SIM_I2C_CR1);
+    uint32_t u32Sr = SIM_REG32(SIM_I2C_SR);
+    uint32_t u32Ack;
+
+    if ((0UL == (u32Cr1 & I2C_CR1_PE)) || (0UL != (u32Cr1 & I2C_CR1_SWRST))) {
+        /* Disabled or in reset */
+    } else if (0U != m_stcI2c.u8ShiftBusy) {
+        SIM_I2C_SendEnd(&u32Sr);
+    } else if (((0UL != (u32Cr1 & I2C_CR1_START)) && (0UL == (u32Sr & I2C_SR_BUSY))) ||
+               ((0UL != (u32Cr1 & I2C_CR1_RESTART)) && (0UL != (u32Sr & I2C_SR_MSL)))) {
+        (void)SIM_I2C_Slave(SIM_I2C_EVT_START, 0UL);
+        SIM_I2C_Clear();
+        m_stcI2c.u8Addr = 1U;
+        u32Sr &= ~(I2C_SR_TENDF | I2C_SR_RFULLF | I2C_SR_ACKRF);
+        u32Sr |= I2C_SR_STARTF | I2C_SR_MSL | I2C_SR_BUSY | I2C_SR_TRA | I2C_SR_TEMPTYF;
+        SIM_REG32(SIM_I2C_CR1) = u32Cr1 & ~(I2C_CR1_START | I2C_CR1_RESTART);
+    } else if ((0UL != (u32Cr1 & I2C_CR1_STOP)) && (0UL != (u32Sr & I2C_SR_MSL))) {
+        (void)SIM_I2C_Slave(SIM_I2C_EVT_STOP, 0UL);
+        SIM_I2C_Clear();
+        u32Sr &= ~(I2C_SR_MSL | I2C_SR_BUSY | I2C_SR_TRA);
+        u32Sr |= I2C_SR_STOPF;
+        SIM_REG32(SIM_I2C_CR1) = u32Cr1 & ~I2C_CR1_STOP;
+    } else if (0UL != (u32Sr & I2C_SR_TRA)) {
+        if ((0U != m_stcI2c.u8TxFull) && (0U == m_stcI2c.u8Halt)) {
+            m_stcI2c.u8Shift = m_stcI2c.u8TxBuf;
+            m_stcI2c.u8ShiftBusy = 1U;
+            m_stcI2c.u8TxFull = 0U;
+            u32Sr |= I2C_SR_TEMPTYF;
+        }
+    } else if ((0U != m_stcI2c.u8RxOn) && (0UL == (u32Sr & I2C_SR_RFULLF))) {
+        u32Ack = (0UL != (u32Cr1 & I2C_CR1_ACK)) ? SIM_I2C_NACK : SIM_I2C_ACK;
+        SIM_REG8(SIM_I2C_DRR) = (uint8_t)SIM_I2C_Slave(SIM_I2C_EVT_READ, u32Ack);
+        u32Sr |= I2C_SR_RFULLF;
+        if (SIM_I2C_NACK == u32Ack) {
+            m_stcI2c.u8RxOn = 0U;
+        }
+    } else {
+        /* SCL held */
+    }
+    SIM_REG32(SIM_I2C_SR) = u32Sr;
+}
+
+/**
+ * @brief  Reset the I2C registers.
+ * @param  None
+ * @retval None
+ */
+static void SIM_I2C_Reset(void)
+{
+    SIM_I2C_Clear();
+}
+
+/**
+ * @brief  Reading SR moves the bus on.
+ * @param  [in] u32Addr                 Device address
+ * @retval None
+ */
+static void SIM_I2C_Read(uint32_t u32Addr)
+{
+    if ((u32Addr & ~3UL) == SIM_I2C_SR) {
+        SIM_I2C_Step();
+    }
+}
+
+/**
+ * @brief  Reading DRR empties it and releases SCL.
+ * @param  [in] u32Addr                 Device address
+ * @retval None
+ */
+static void SIM_I2C_ReadDone(uint32_t u32Addr)
+{
+    if ((u32Addr & ~3UL) == SIM_I2C_DRR) {
+        SIM_REG32(SIM_I2C_SR) &= ~I2C_SR_RFULLF;
+        SIM_I2C_Step();
+    }
+}
+
+/**
+ * @brief  Writing DTR fills it, CLR clears the SR flags, CR1 requests the conditions.
+ * @param  [in] u32Addr                 Device address
+ * @param  [in] u32Old                  Register word before the write
+ * @retval None
+ */
+static void SIM_I2C_Write(uint32_t u32Addr, uint32_t u32Old)
+{
+    (void)u32Old;
+    if ((u32Addr & ~3UL) == SIM_I2C_DTR) {
+        /* A byte written to a full DTR is lost */
+        if (0U == m_stcI2c.u8TxFull) {
+            m_stcI2c.u8TxBuf = SIM_REG8(SIM_I2C_DTR);
+            m_stcI2c.u8TxFull = 1U;
+        }
+        SIM_REG32(SIM_I2C_SR) &= ~(I2C_SR_TEMPTYF | I2C_SR_TENDF);
+        SIM_I2C_Step();
+    } else if ((u32Addr & ~3UL) == SIM_I2C_CLR) {
+        SIM_REG32(SIM_I2C_SR) &= ~(SIM_REG32(SIM_I2C_CLR) & SIM_I2C_CLR_MASK);
+        SIM_REG32(SIM_I2C_CLR) = 0UL;
+    } else if ((u32Addr & ~3UL) == SIM_I2C_CR1) {
+        /* Disabling or resetting the I2C releases the bus */
+        if ((0UL == (SIM_REG32(SIM_I2C_CR1) & I2C_CR1_PE)) || (0UL != (SIM_REG32(SIM_I2C_CR1) & I2C_CR1_SWRST))) {
+            SIM_I2C_Clear();
+            SIM_REG32(SIM_I2C_SR) = 0UL;
+        }
+        SIM_I2C_Step();
+    } else {
+        /* Plain register */
+    }
+}
+
+/**
+ * @brief  Register the I2C model.
+ * @param  None
+ * @retval int32_t:
+ *           - LL_OK:                   Registered.
+ *           - Others:                  @ref SIM_RegisterModel
+ */
+int32_t SIM_I2C_Init(void)
+{
+    const stc_sim_model_t stcModel = {
+        .u32Base = CM_I2C_BASE,
+        .u32Size = SIM_I2C_SIZE,
+        .pfnReset = &SIM_I2C_Reset,
+        .pfnRead = &SIM_I2C_Read,
+        .pfnReadDone = &SIM_I2C_ReadDone,
+        .pfnWrite = &SIM_I2C_Write,
+    };
+
+    return SIM_RegisterModel(&stcModel);
+}
+
+/**
+ * @brief  Connect a slave device to the I2C bus.
+ * @param  [in] pfnSlave                Slave device, NULL to disconnect
+ * @param  [in] pvArg                   Argument passed to pfnSlave
+ * @retval None
+ */
+void SIM_I2C_SetSlave(func_ptr_sim_i2c_slave_t pfnSlave, void *pvArg)
+{
+    m_stcI2c.pfnSlave = pfnSlave;
+    m_stcI2c.pvSlaveArg = pvArg;
+}
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
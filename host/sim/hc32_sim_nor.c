@@ -0,0 +1,515 @@
+/**
+ *******************************************************************************
+ * @file  host/sim/hc32_sim_nor.c
+ * @brief This file provides the model of a SPI NOR flash on the simulated SPI.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-17       CDT             First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2022-2023, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include <stdlib.h>
+#include <string.h>
+
+#include "hc32_sim.h"
+
+/**
+ * @addtogroup HC32F120_DDL_Host
+ * @{
+ */
+
+/**
+ * @defgroup SIM_NOR SIM NOR
+ * @brief SPI NOR flash model, a 25-series part behind the SPI slave of
+ *        SIM_SPI_SetSlave() and a GPIO chip select. It keeps a clock of its
+ *        own: every frame the SPI shifts takes its SCK time, whether the part
+ *        is selected or not, and SIM_NOR_Advance() adds the time the
+ *        application spends between transfers. Page program and erase start
+ *        on the rising edge of the chip select and keep WIP set for their
+ *        busy time of that clock, the array is updated at once.
+ *        Commands: 0x9F, 0x05, 0x06, 0x04, 0x03, 0x0B, 0x02, 0x20, 0x52,
+ *        0xD8, 0xC7 and 0x60, the others are ignored.
+ * @note  The chip select is seen on writes to the PODR register of its port,
+ *        as done by GPIO_FAST_WritePin() and GPIO_WritePort(), not on the
+ *        POSR/PORR/POTR writes of GPIO_SetPins() and the like.
+ * @{
+ */
+
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @brief SPI NOR flash model state.
+ */
+typedef struct {
+    stc_sim_nor_cfg_t stcCfg;           /*!< Part configuration. */
+    uint8_t *pu8Array;                  /*!< Flash array. */
+    uint32_t u32Size;                   /*!< Array size in bytes. */
+    uint32_t u32CsWord;                 /*!< Device address of the PODR word of the chip select. */
+    uint32_t u32CsMask;                 /*!< Chip select bit in that word. */
+    uint64_t u64Time;                   /*!< Model clock in ns. */
+    uint64_t u64BusyEnd;                /*!< WIP is set until this time. */
+    uint32_t u32Index;                  /*!< Bytes since the chip select fell. */
+    uint32_t u32Addr;                   /*!< Address of the command. */
+    uint8_t u8Cmd;                      /*!< Command of the current chip select. */
+    uint8_t u8Valid;                    /*!< 1U while the command is accepted. */
+    uint8_t u8Selected;                 /*!< 1U while the chip select is low. */
+    uint8_t u8Wel;                      /*!< Write enable latch. */
+    uint8_t au8Page[SIM_NOR_PAGE_SIZE]; /*!< Page program data latch. */
+    stc_sim_nor_stat_t stcStat;         /*!< Operation counters. */
+} stc_sim_nor_t;
+
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+#define SIM_NOR_CMD_JEDEC_ID            (0x9FU)
+#define SIM_NOR_CMD_READ_STATUS         (0x05U)
+#define SIM_NOR_CMD_WRITE_ENABLE        (0x06U)
+#define SIM_NOR_CMD_WRITE_DISABLE       (0x04U)
+#define SIM_NOR_CMD_READ                (0x03U)
+#define SIM_NOR_CMD_FAST_READ           (0x0BU)
+#define SIM_NOR_CMD_PAGE_PROGRAM        (0x02U)
+#define SIM_NOR_CMD_SECTOR_ERASE        (0x20U)
+#define SIM_NOR_CMD_BLOCK32_ERASE       (0x52U)
+#define SIM_NOR_CMD_BLOCK64_ERASE       (0xD8U)
+#define SIM_NOR_CMD_CHIP_ERASE          (0xC7U)
+#define SIM_NOR_CMD_CHIP_ERASE_ALT      (0x60U)
+
+#define SIM_NOR_STATUS_WIP              (0x01U)
+#define SIM_NOR_STATUS_WEL              (0x02U)
+
+/* Command byte and 3 address bytes */
+#define SIM_NOR_ADDR_END                (4UL)
+
+#define SIM_NOR_CAPACITY_MIN            (10UL)  /* 1KB */
+#define SIM_NOR_CAPACITY_MAX            (24UL)  /* 16MB, 3 address bytes */
+
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+static stc_sim_nor_t m_stcNor;
+static uint8_t m_u8NorRegistered = 0U;
+
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @brief  Get the status register.
+ * @param  None
+ * @retval Status register
+ */
+static uint8_t SIM_NOR_Status(void)
+{
+    uint8_t u8Status = (0U != m_stcNor.u8Wel) ? SIM_NOR_STATUS_WEL : 0U;
+
+    if (m_stcNor.u64Time < m_stcNor.u64BusyEnd) {
+        u8Status |= SIM_NOR_STATUS_WIP;
+    }
+    return u8Status;
+}
+
+/**
+ * @brief  Decode the command byte.
+ * @param  [in] u8Cmd                   Command
+ * @retval None
+ */
+static void SIM_NOR_Command(uint8_t u8Cmd)
+{
+    m_stcNor.u8Cmd = u8Cmd;
+    m_stcNor.u32Addr = 0UL;
+    m_stcNor.u8Valid = 1U;
+
+    if ((m_stcNor.u64Time < m_stcNor.u64BusyEnd) && (SIM_NOR_CMD_READ_STATUS != u8Cmd)) {
+        /* Only the status can be read while busy */
+        m_stcNor.u8Valid = 0U;
+        m_stcNor.stcStat.u32ErrorCount++;
+        return;
+    }
+    switch (u8Cmd) {
+        case SIM_NOR_CMD_WRITE_ENABLE:
+            m_stcNor.u8Wel = 1U;
+            break;
+        case SIM_NOR_CMD_WRITE_DISABLE:
+            m_stcNor.u8Wel = 0U;
+            break;
+        case SIM_NOR_CMD_PAGE_PROGRAM:
+        case SIM_NOR_CMD_SECTOR_ERASE:
+        case SIM_NOR_CMD_BLOCK32_ERASE:
+        case SIM_NOR_CMD_BLOCK64_ERASE:
+        case SIM_NOR_CMD_CHIP_ERASE:
+        case SIM_NOR_CMD_CHIP_ERASE_ALT:
+            if (0U == m_stcNor.u8Wel) {
+                m_stcNor.u8Valid = 0U;
+                m_stcNor.stcStat.u32ErrorCount++;
+            }
+            break;
+        case SIM_NOR_CMD_JEDEC_ID:
+        case SIM_NOR_CMD_READ_STATUS:
+        case SIM_NOR_CMD_READ:
+        case SIM_NOR_CMD_FAST_READ:
+            break;
+        default:
+            m_stcNor.u8Valid = 0U;
+            break;
+    }
+}
+
+/**
+ * @brief  Exchange one byte of the current command.
+ * @param  [in] u8Mosi                  Byte sent by the master
+ * @retval Byte returned on MISO
+ */
+static uint8_t SIM_NOR_Byte(uint8_t u8Mosi)
+{
+    uint32_t u32Index = m_stcNor.u32Index++;
+    uint32_t u32Dummy = 0UL;
+    uint8_t u8Miso = 0xFFU;
+
+    if (0UL == u32Index) {
+        SIM_NOR_Command(u8Mosi);
+        return u8Miso;
+    }
+    if (0U == m_stcNor.u8Valid) {
+        return u8Miso;
+    }
+    if ((SIM_NOR_CMD_READ_STATUS != m_stcNor.u8Cmd) && (SIM_NOR_CMD_JEDEC_ID != m_stcNor.u8Cmd) &&
+        (u32Index < SIM_NOR_ADDR_END)) {
+        m_stcNor.u32Addr = ((m_stcNor.u32Addr << 8U) | u8Mosi) & (m_stcNor.u32Size - 1UL);
+        if ((SIM_NOR_CMD_PAGE_PROGRAM == m_stcNor.u8Cmd) && ((SIM_NOR_ADDR_END - 1UL) == u32Index)) {
+            (void)memset(m_stcNor.au8Page, 0xFF, sizeof(m_stcNor.au8Page));
+        }
+        return u8Miso;
+    }
+
+    switch (m_stcNor.u8Cmd) {
+        case SIM_NOR_CMD_READ_STATUS:
+            u8Miso = SIM_NOR_Status();
+            m_stcNor.stcStat.u32StatusPolls++;
+            if (0U != (u8Miso & SIM_NOR_STATUS_WIP)) {
+                m_stcNor.stcStat.u32BusyPolls++;
+            }
+            break;
+        case SIM_NOR_CMD_JEDEC_ID:
+            if (u32Index <= 3UL) {
+                u8Miso = (uint8_t)(m_stcNor.stcCfg.u32JedecId >> (8UL * (3UL - u32Index)));
+            }
+            break;
+        case SIM_NOR_CMD_FAST_READ:
+            u32Dummy = 1UL;
+            /* Fall through */
+        case SIM_NOR_CMD_READ:
+            if (u32Index >= (SIM_NOR_ADDR_END + u32Dummy)) {
+                u8Miso = m_stcNor.pu8Array[m_stcNor.u32Addr];
+                m_stcNor.u32Addr = (m_stcNor.u32Addr + 1UL) & (m_stcNor.u32Size - 1UL);
+                m_stcNor.stcStat.u32ReadBytes++;
+            }
+            break;
+        case SIM_NOR_CMD_PAGE_PROGRAM:
+            /* The address wraps inside the page, a byte shifted twice keeps the 0 bits of both */
+            m_stcNor.au8Page[m_stcNor.u32Addr & (SIM_NOR_PAGE_SIZE - 1UL)] &= u8Mosi;
+            m_stcNor.u32Addr = (m_stcNor.u32Addr & ~(SIM_NOR_PAGE_SIZE - 1UL)) |
+                               ((m_stcNor.u32Addr + 1UL) & (SIM_NOR_PAGE_SIZE - 1UL));
+            m_stcNor.stcStat.u32ProgramBytes++;
+            break;
+        default:
+            break;
+    }
+    return u8Miso;
+}
+
+/**
+ * @brief  Erase a range of the array and start the busy time.
+ * @param  [in] u32Size                 Erase size, a power of 2
+ * @param  [in] u32BusyUs               Busy time
+ * @retval None
+ */
+static void SIM_NOR_Erase(uint32_t u32Size, uint32_t u32BusyUs)
+{
+    uint32_t u32Addr;
+
+    if (u32Size > m_stcNor.u32Size) {
+        u32Size = m_stcNor.u32Size;
+    }
+    u32Addr = m_stcNor.u32Addr & ~(u32Size - 1UL);
+    (void)memset(&m_stcNor.pu8Array[u32Addr], 0xFF, u32Size);
+    m_stcNor.u64BusyEnd = m_stcNor.u64Time + ((uint64_t)u32BusyUs * 1000ULL);
+    m_stcNor.u8Wel = 0U;
+    m_stcNor.stcStat.u32EraseCount++;
+}
+
+/**
+ * @brief  Chip select rising edge, start a program or erase.
+ * @param  None
+ * @retval None
+ */
+static void SIM_NOR_Release(void)
+{
+    uint32_t u32Base;
+    uint32_t i;
+
+    if (0U != m_stcNor.u8Valid) {
+        switch (m_stcNor.u8Cmd) {
+            case SIM_NOR_CMD_PAGE_PROGRAM:
+                if (m_stcNor.u32Index > SIM_NOR_ADDR_END) {
+                    u32Base = m_stcNor.u32Addr & ~(SIM_NOR_PAGE_SIZE - 1UL);
+                    for (i = 0UL; i < SIM_NOR_PAGE_SIZE; i++) {
+                        m_stcNor.pu8Array[u32Base + i] &= m_stcNor.au8Page[i];
+                    }
+                    m_stcNor.u64BusyEnd = m_stcNor.u64Time + ((uint64_t)m_stcNor.stcCfg.u32PageProgramUs * 1000ULL);
+                    m_stcNor.u8Wel = 0U;
+                    m_stcNor.stcStat.u32ProgramCount++;
+                }
+                break;
+            case SIM_NOR_CMD_SECTOR_ERASE:
+                if (m_stcNor.u32Index >= SIM_NOR_ADDR_END) {
+                    SIM_NOR_Erase(0x1000UL, m_stcNor.stcCfg.u32SectorEraseUs);
+                }
+                break;
+            case SIM_NOR_CMD_BLOCK32_ERASE:
+                if (m_stcNor.u32Index >= SIM_NOR_ADDR_END) {
+                    SIM_NOR_Erase(0x8000UL, m_stcNor.stcCfg.u32Block32EraseUs);
+                }
+                break;
+            case SIM_NOR_CMD_BLOCK64_ERASE:
+                if (m_stcNor.u32Index >= SIM_NOR_ADDR_END) {
+                    SIM_NOR_Erase(0x10000UL, m_stcNor.stcCfg.u32Block64EraseUs);
+                }
+                break;
+            case SIM_NOR_CMD_CHIP_ERASE:
+            case SIM_NOR_CMD_CHIP_ERASE_ALT:
+                if (1UL == m_stcNor.u32Index) {
+                    m_stcNor.u32Addr = 0UL;
+                    SIM_NOR_Erase(m_stcNor.u32Size, m_stcNor.stcCfg.u32ChipEraseUs);
+                }
+                break;
+            default:
+                break;
+        }
+    }
+    m_stcNor.u8Valid = 0U;
+    m_stcNor.u32Index = 0UL;
+}
+
+/**
+ * @brief  SPI slave, one frame of the master.
+ * @param  [in] u32Mosi                 Frame sent by the master
+ * @param  [in] pvArg                   Not used
+ * @retval Frame returned on MISO, 16-bit frames are two bytes MSB first
+ */
+static uint32_t SIM_NOR_Frame(uint32_t u32Mosi, void *pvArg)
+{
+    uint32_t u32Cfg2 = SIM_REG32(CM_SPI_BASE + 0x18UL);
+    uint32_t u32Bits = (0UL != (u32Cfg2 & SPI_CFG2_DSIZE)) ? 16UL : 8UL;
+    uint64_t u64SckHz = (uint64_t)m_stcNor.stcCfg.u32PclkHz >> (((u32Cfg2 & SPI_CFG2_MBR) >> SPI_CFG2_MBR_POS) + 1UL);
+    uint32_t u32Miso;
+
+    (void)pvArg;
+    m_stcNor.u64Time += (((uint64_t)u32Bits * 1000000000ULL) + u64SckHz - 1ULL) / u64SckHz;
+    if (0U == m_stcNor.u8Selected) {
+        return 0xFFFFUL;
+    }
+    if (16UL == u32Bits) {
+        u32Miso = (uint32_t)SIM_NOR_Byte((uint8_t)(u32Mosi >> 8U)) << 8U;
+        u32Miso |= SIM_NOR_Byte((uint8_t)u32Mosi);
+    } else {
+        u32Miso = SIM_NOR_Byte((uint8_t)u32Mosi);
+    }
+    return u32Miso;
+}
+
+/**
+ * @brief  Follow the chip select level.
+ * @param  [in] u32Level                PODR word holding the chip select
+ * @retval None
+ */
+static void SIM_NOR_Select(uint32_t u32Level)
+{
+    if (0UL == (u32Level & m_stcNor.u32CsMask)) {
+        if (0U == m_stcNor.u8Selected) {
+            m_stcNor.u8Selected = 1U;
+            m_stcNor.u32Index = 0UL;
+        }
+    } else {
+        if (0U != m_stcNor.u8Selected) {
+            m_stcNor.u8Selected = 0U;
+            SIM_NOR_Release();
+        }
+    }
+}
+
+/**
+ * @brief  A write to the PODR word of the chip select.
+ * @param  [in] u32Addr                 Device address
+ * @param  [in] u32Old                  Register word before the write
+ * @retval None
+ */
+static void SIM_NOR_CsWrite(uint32_t u32Addr, uint32_t u32Old)
+{
+    (void)u32Addr;
+    (void)u32Old;
+    SIM_NOR_Select(SIM_REG32(m_stcNor.u32CsWord));
+}
+
+/**
+ * @brief  SIM_Reset() cleared PODR, the part sees the chip select fall.
+ * @param  None
+ * @retval None
+ */
+static void SIM_NOR_Reset(void)
+{
+    SIM_NOR_Select(SIM_REG32(m_stcNor.u32CsWord));
+}
+
+/**
+ * @brief  Connect a SPI NOR flash to the SPI, erase its array.
+ * @param  [in] pstcCfg                 Pointer to the part configuration, copied.
+ * @retval int32_t:
+ *           - LL_OK:                   Connected.
+ *           - LL_ERR_INVD_PARAM:       pstcCfg is NULL or invalid.
+ *           - LL_ERR:                  No memory for the array.
+ *           - Others:                  @ref SIM_RegisterModel
+ * @note   The part replaces the slave set with SIM_SPI_SetSlave(). Calling the
+ *         function again replaces the part, the chip select stays the first one.
+ */
+int32_t SIM_NOR_Init(const stc_sim_nor_cfg_t *pstcCfg)
+{
+    stc_sim_model_t stcModel = {
+        .u32Base = 0UL,
+        .u32Size = 4UL,
+        .pfnReset = &SIM_NOR_Reset,
+        .pfnRead = NULL,
+        .pfnReadDone = NULL,
+        .pfnWrite = &SIM_NOR_CsWrite,
+    };
+    uint32_t u32Capacity;
+    uint32_t u32Podr;
+    uint32_t u32PinPos;
+    uint32_t u32CsWord = m_stcNor.u32CsWord;
+    uint32_t u32CsMask = m_stcNor.u32CsMask;
+    int32_t i32Ret = LL_OK;
+
+    if ((NULL == pstcCfg) || (0UL == pstcCfg->u32PclkHz) || (0U == pstcCfg->u16CsPin) ||
+        (0U != (pstcCfg->u16CsPin & (pstcCfg->u16CsPin - 1U))) || (pstcCfg->u16CsPin > 0x80U)) {
+        return LL_ERR_INVD_PARAM;
+    }
+    u32Capacity = pstcCfg->u32JedecId & 0xFFUL;
+    if ((u32Capacity < SIM_NOR_CAPACITY_MIN) || (u32Capacity > SIM_NOR_CAPACITY_MAX)) {
+        return LL_ERR_INVD_PARAM;
+    }
+
+    free(m_stcNor.pu8Array);
+    (void)memset(&m_stcNor, 0, sizeof(m_stcNor));
+    m_stcNor.u32Size = 1UL << u32Capacity;
+    m_stcNor.pu8Array = (uint8_t *)malloc(m_stcNor.u32Size);
+    if (NULL == m_stcNor.pu8Array) {
+        return LL_ERR;
+    }
+    (void)memset(m_stcNor.pu8Array, 0xFF, m_stcNor.u32Size);
+    m_stcNor.stcCfg = *pstcCfg;
+
+    if (0U == m_u8NorRegistered) {
+        u32Podr = (uint32_t)&CM_GPIO->PODR0 + pstcCfg->u8CsPort;
+        for (u32PinPos = 0UL; 0U == (pstcCfg->u16CsPin & (1U << u32PinPos)); u32PinPos++) {
+        }
+        m_stcNor.u32CsWord = u32Podr & ~3UL;
+        m_stcNor.u32CsMask = 1UL << (((u32Podr & 3UL) * 8UL) + u32PinPos);
+        stcModel.u32Base = m_stcNor.u32CsWord;
+        i32Ret = SIM_RegisterModel(&stcModel);
+        if (LL_OK == i32Ret) {
+            m_u8NorRegistered = 1U;
+        }
+    } else {
+        /* Keep the chip select of the registered model */
+        m_stcNor.u32CsWord = u32CsWord;
+        m_stcNor.u32CsMask = u32CsMask;
+    }
+    if (LL_OK == i32Ret) {
+        SIM_NOR_Select(SIM_REG32(m_stcNor.u32CsWord));
+        SIM_SPI_SetSlave(&SIM_NOR_Frame, NULL);
+    }
+    return i32Ret;
+}
+
+/**
+ * @brief  Get the flash array, for checks and preloading.
+ * @param  None
+ * @retval Pointer to the array, NULL before SIM_NOR_Init()
+ */
+uint8_t *SIM_NOR_GetArray(void)
+{
+    return m_stcNor.pu8Array;
+}
+
+/**
+ * @brief  Get the model clock.
+ * @param  None
+ * @retval Time in ns since SIM_NOR_Init()
+ */
+uint64_t SIM_NOR_GetTime(void)
+{
+    return m_stcNor.u64Time;
+}
+
+/**
+ * @brief  Advance the model clock, for the time the application spends
+ *         between transfers.
+ * @param  [in] u32Ns                   Time in ns
+ * @retval None
+ */
+void SIM_NOR_Advance(uint32_t u32Ns)
+{
+    m_stcNor.u64Time += u32Ns;
+}
+
+/**
+ * @brief  Get the operation counters.
+ * @param  None
+ * @retval Pointer to the counters
+ */
+const stc_sim_nor_stat_t *SIM_NOR_GetStat(void)
+{
+    return &m_stcNor.stcStat;
+}
+
+/**
+ * @brief  Clear the operation counters, the clock keeps running.
+ * @param  None
+ * @retval None
+ */
+void SIM_NOR_ClearStat(void)
+{
+    (void)memset(&m_stcNor.stcStat, 0, sizeof(m_stcNor.stcStat));
+}
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
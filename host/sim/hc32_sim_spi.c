@@ -0,0 +1,263 @@
+/**
+ *******************************************************************************
+ * @file  host/sim/hc32_sim_spi.c
+ * @brief SPI behavioral model of the simulated register file.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-16       CDT             First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2022-2023, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_sim.h"
+
+/**
+ * @addtogroup HC32F120_DDL_Host
+ * @{
+ */
+
+/**
+ * @defgroup SIM_SPI SIM SPI
+ * @brief SPI master model with the TX buffer, shift register and RX buffer of
+ *        the hardware. A frame moves one stage each time SR or DR is accessed,
+ *        a finished frame waits in the shift register while the RX buffer is
+ *        full, so the model never overloads. MISO is MOSI (inverted) in
+ *        loopback mode, otherwise the frame returned by the slave set with
+ *        SIM_SPI_SetSlave(), 0xFFFF without slave. No interrupt is raised.
+ * @{
+ */
+
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @brief SPI model state.
+ */
+typedef struct {
+    func_ptr_sim_spi_slave_t pfnSlave;  /*!< Slave device. */
+    void *pvSlaveArg;                   /*!< Slave device argument. */
+    uint32_t u32TxBuf;                  /*!< Frame written to DR, not yet shifted. */
+    uint32_t u32Shift;                  /*!< Frame being shifted. */
+    uint32_t u32RxBuf;                  /*!< Received frame read from DR. */
+    uint8_t u8TxFull;                   /*!< 1U while u32TxBuf is valid. */
+    uint8_t u8ShiftBusy;                /*!< 1U while u32Shift is valid. */
+    uint8_t u8RxFull;                   /*!< 1U while u32RxBuf is valid. */
+} stc_sim_spi_t;
+
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+#define SIM_SPI_SIZE                    (0x400UL)
+
+#define SIM_SPI_DR                      (CM_SPI_BASE + 0x00UL)
+#define SIM_SPI_CR1                     (CM_SPI_BASE + 0x04UL)
+#define SIM_SPI_SR                      (CM_SPI_BASE + 0x14UL)
+#define SIM_SPI_CFG2                    (CM_SPI_BASE + 0x18UL)
+
+#define SIM_SPI_SR_RST                  (SPI_SR_TDEF)
+#define SIM_SPI_CFG2_RST                (0x0000011DUL)
+
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+static stc_sim_spi_t m_stcSpi;
+
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @brief  Get the value received for one frame.
+ * @param  [in] u32Mosi                 Frame shifted out
+ * @retval Frame shifted in
+ */
+static uint32_t SIM_SPI_Exchange(uint32_t u32Mosi)
+{
+    uint32_t u32Cr1 = SIM_REG32(SIM_SPI_CR1);
+    uint32_t u32Mask = (0UL != (SIM_REG32(SIM_SPI_CFG2) & SPI_CFG2_DSIZE)) ? 0xFFFFUL : 0xFFUL;
+    uint32_t u32Miso;
+
+    if (0UL != (u32Cr1 & SPI_CR1_SPLPBK2)) {
+        u32Miso = u32Mosi;
+    } else if (0UL != (u32Cr1 & SPI_CR1_SPLPBK)) {
+        u32Miso = ~u32Mosi;
+    } else if (NULL != m_stcSpi.pfnSlave) {
+        u32Miso = m_stcSpi.pfnSlave(u32Mosi & u32Mask, m_stcSpi.pvSlaveArg);
+    } else {
+        u32Miso = 0xFFFFUL;
+    }
+    return u32Miso & u32Mask;
+}
+
+/**
+ * @brief  Move the frames one stage on and update SR.
+ * @param  None
+ * @retval None
+ */
+static void SIM_SPI_Step(void)
+{
+    uint32_t u32Sr;
+
+    if (0UL != (SIM_REG32(SIM_SPI_CR1) & SPI_CR1_SPE)) {
+        if ((0U != m_stcSpi.u8ShiftBusy) && (0U == m_stcSpi.u8RxFull)) {
+            m_stcSpi.u32RxBuf = SIM_SPI_Exchange(m_stcSpi.u32Shift);
+            m_stcSpi.u8RxFull = 1U;
+            m_stcSpi.u8ShiftBusy = 0U;
+        }
+        if ((0U == m_stcSpi.u8ShiftBusy) && (0U != m_stcSpi.u8TxFull)) {
+            m_stcSpi.u32Shift = m_stcSpi.u32TxBuf;
+            m_stcSpi.u8ShiftBusy = 1U;
+            m_stcSpi.u8TxFull = 0U;
+        }
+    }
+
+    u32Sr = SIM_REG32(SIM_SPI_SR) & ~(SPI_SR_TDEF | SPI_SR_RDFF | SPI_SR_IDLNF);
+    if (0U == m_stcSpi.u8TxFull) {
+        u32Sr |= SPI_SR_TDEF;
+    }
+    if (0U != m_stcSpi.u8RxFull) {
+        u32Sr |= SPI_SR_RDFF;
+    }
+    if ((0U != m_stcSpi.u8TxFull) || (0U != m_stcSpi.u8ShiftBusy)) {
+        u32Sr |= SPI_SR_IDLNF;
+    }
+    SIM_REG32(SIM_SPI_SR) = u32Sr;
+}
+
+/**
+ * @brief  Reset the SPI registers.
+ * @param  None
+ * @retval None
+ */
+static void SIM_SPI_Reset(void)
+{
+    m_stcSpi.u8TxFull = 0U;
+    m_stcSpi.u8ShiftBusy = 0U;
+    m_stcSpi.u8RxFull = 0U;
+    SIM_REG32(SIM_SPI_SR) = SIM_SPI_SR_RST;
+    SIM_REG32(SIM_SPI_CFG2) = SIM_SPI_CFG2_RST;
+}
+
+/**
+ * @brief  Update SR and DR before a read.
+ * @param  [in] u32Addr                 Device address
+ * @retval None
+ */
+static void SIM_SPI_Read(uint32_t u32Addr)
+{
+    if ((u32Addr & ~3UL) == SIM_SPI_DR) {
+        SIM_REG32(SIM_SPI_DR) = m_stcSpi.u32RxBuf;
+    } else if ((u32Addr & ~3UL) == SIM_SPI_SR) {
+        SIM_SPI_Step();
+    } else {
+        /* Plain register */
+    }
+}
+
+/**
+ * @brief  Reading DR empties the RX buffer.
+ * @param  [in] u32Addr                 Device address
+ * @retval None
+ */
+static void SIM_SPI_ReadDone(uint32_t u32Addr)
+{
+    if ((u32Addr & ~3UL) == SIM_SPI_DR) {
+        m_stcSpi.u8RxFull = 0U;
+        SIM_SPI_Step();
+    }
+}
+
+/**
+ * @brief  Writing DR fills the TX buffer, SR keeps the model flags.
+ * @param  [in] u32Addr                 Device address
+ * @param  [in] u32Old                  Register word before the write
+ * @retval None
+ */
+static void SIM_SPI_Write(uint32_t u32Addr, uint32_t u32Old)
+{
+    (void)u32Old;
+    if ((u32Addr & ~3UL) == SIM_SPI_DR) {
+        /* A frame written to a full TX buffer is lost */
+        if (0U == m_stcSpi.u8TxFull) {
+            m_stcSpi.u32TxBuf = SIM_REG32(SIM_SPI_DR);
+            m_stcSpi.u8TxFull = 1U;
+        }
+        SIM_SPI_Step();
+    } else if ((u32Addr & ~3UL) == SIM_SPI_CR1) {
+        /* Disabling the SPI discards the frames */
+        if (0UL == (SIM_REG32(SIM_SPI_CR1) & SPI_CR1_SPE)) {
+            m_stcSpi.u8TxFull = 0U;
+            m_stcSpi.u8ShiftBusy = 0U;
+            m_stcSpi.u8RxFull = 0U;
+        }
+        SIM_SPI_Step();
+    } else if ((u32Addr & ~3UL) == SIM_SPI_SR) {
+        SIM_SPI_Step();
+    } else {
+        /* Plain register */
+    }
+}
+
+/**
+ * @brief  Register the SPI model.
+ * @param  None
+ * @retval int32_t:
+ *           - LL_OK:                   Registered.
+ *           - Others:                  @ref SIM_RegisterModel
+ */
+int32_t SIM_SPI_Init(void)
+{
+    const stc_sim_model_t stcModel = {
+        .u32Base = CM_SPI_BASE,
+        .u32Size = SIM_SPI_SIZE,
+        .pfnReset = &SIM_SPI_Reset,
+        .pfnRead = &SIM_SPI_Read,
+        .pfnReadDone = &SIM_SPI_ReadDone,
+        .pfnWrite = &SIM_SPI_Write,
+    };
+
+    return SIM_RegisterModel(&stcModel);
+}
+
+/**
+ * @brief  Connect a slave device to the SPI.
+ * @param  [in] pfnSlave                Slave device, NULL to disconnect
+ * @param  [in] pvArg                   Argument passed to pfnSlave
+ * @retval None
+ */
+void SIM_SPI_SetSlave(func_ptr_sim_spi_slave_t pfnSlave, void *pvArg)
+{
+    m_stcSpi.pfnSlave = pfnSlave;
+    m_stcSpi.pvSlaveArg = pvArg;
+}
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
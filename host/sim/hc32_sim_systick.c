@@ -0,0 +1,233 @@
+/**
+ *******************************************************************************
+ * @file  host/sim/hc32_sim_systick.c
+ * @brief SysTick behavioral model of the simulated register file.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-17       CDT             First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2022-2023, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_sim.h"
+
+/**
+ * @addtogroup HC32F120_DDL_Host
+ * @{
+ */
+
+/**
+ * @defgroup SIM_SYSTICK SIM SysTick
+ * @brief SysTick model: the host has no notion of time, the counter moves on by a
+ *        fixed number of HCLK cycles at every read of the SCS (SysTick, SCB and
+ *        NVIC registers), and to its next interrupt at __WFI(). Reaching 0 sets CTRL.COUNTFLAG and, with
+ *        CTRL.TICKINT, pends SysTick in SCB->ICSR. The pending SysTick is taken
+ *        before the next read of the SCS while PRIMASK is clear, as the target
+ *        takes it after the instruction that pended it.
+ *        The model is registered by SIM_SYSTICK_Init() over the whole SCS, whose
+ *        reads all trap from then on. It is stopped until SIM_SYSTICK_SetCycle(),
+ *        stopped the SCS is plain memory as without the model.
+ * @{
+ */
+
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+#define SIM_SYSTICK_SCS_SIZE            (0x1000UL)
+
+#define SIM_SYSTICK_CTRL                (SysTick_BASE + 0x00UL)
+#define SIM_SYSTICK_LOAD                (SysTick_BASE + 0x04UL)
+#define SIM_SYSTICK_VAL                 (SysTick_BASE + 0x08UL)
+#define SIM_SYSTICK_ICSR                (SCB_BASE + 0x04UL)
+
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+static uint32_t m_u32CyclePerRead = 0UL;
+static uint64_t m_u64Cycle = 0ULL;
+
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @brief  Check whether the counter runs.
+ * @param  None
+ * @retval An @ref en_flag_status_t enumeration type value.
+ */
+static en_flag_status_t SIM_SYSTICK_IsRunning(void)
+{
+    return ((0UL != m_u32CyclePerRead) && (0UL != (SIM_REG32(SIM_SYSTICK_CTRL) & SysTick_CTRL_ENABLE_Msk))) ?
+           SET : RESET;
+}
+
+/**
+ * @brief  Count HCLK cycles down on the counter.
+ * @param  [in] u32Cycle                HCLK cycles
+ * @retval None
+ */
+static void SIM_SYSTICK_Advance(uint32_t u32Cycle)
+{
+    uint32_t u32Val = SIM_REG32(SIM_SYSTICK_VAL) & SysTick_VAL_CURRENT_Msk;
+
+    m_u64Cycle += u32Cycle;
+    while (u32Cycle > 0UL) {
+        if (0UL == u32Val) {
+            /* Reload */
+            u32Val = SIM_REG32(SIM_SYSTICK_LOAD) & SysTick_LOAD_RELOAD_Msk;
+            u32Cycle--;
+        } else if (u32Cycle >= u32Val) {
+            /* 1 to 0 */
+            u32Cycle -= u32Val;
+            u32Val = 0UL;
+            SIM_REG32(SIM_SYSTICK_CTRL) |= SysTick_CTRL_COUNTFLAG_Msk;
+            if (0UL != (SIM_REG32(SIM_SYSTICK_CTRL) & SysTick_CTRL_TICKINT_Msk)) {
+                SIM_REG32(SIM_SYSTICK_ICSR) |= SCB_ICSR_PENDSTSET_Msk;
+            }
+        } else {
+            u32Val -= u32Cycle;
+            u32Cycle = 0UL;
+        }
+    }
+    SIM_REG32(SIM_SYSTICK_VAL) = u32Val;
+}
+
+/**
+ * @brief  Take a pending SysTick, then count the cycles of the read.
+ * @param  [in] u32Addr                 Device address
+ * @retval None
+ */
+static void SIM_SYSTICK_Read(uint32_t u32Addr)
+{
+    (void)u32Addr;
+    if (SET == SIM_SYSTICK_IsRunning()) {
+        SIM_TakeSysTick();
+        SIM_SYSTICK_Advance(m_u32CyclePerRead);
+    }
+}
+
+/**
+ * @brief  CTRL.COUNTFLAG clears on read.
+ * @param  [in] u32Addr                 Device address
+ * @retval None
+ */
+static void SIM_SYSTICK_ReadDone(uint32_t u32Addr)
+{
+    if ((SET == SIM_SYSTICK_IsRunning()) && ((u32Addr & ~3UL) == SIM_SYSTICK_CTRL)) {
+        SIM_REG32(SIM_SYSTICK_CTRL) &= ~SysTick_CTRL_COUNTFLAG_Msk;
+    }
+}
+
+/**
+ * @brief  A write to VAL clears it and CTRL.COUNTFLAG.
+ * @param  [in] u32Addr                 Device address
+ * @param  [in] u32Old                  Register word before the write
+ * @retval None
+ */
+static void SIM_SYSTICK_Write(uint32_t u32Addr, uint32_t u32Old)
+{
+    (void)u32Old;
+    if ((SET == SIM_SYSTICK_IsRunning()) && ((u32Addr & ~3UL) == SIM_SYSTICK_VAL)) {
+        SIM_REG32(SIM_SYSTICK_VAL) = 0UL;
+        SIM_REG32(SIM_SYSTICK_CTRL) &= ~SysTick_CTRL_COUNTFLAG_Msk;
+    }
+}
+
+/**
+ * @brief  Register the SysTick model, stopped.
+ * @param  None
+ * @retval int32_t:
+ *           - LL_OK:                   Registered.
+ *           - Others:                  @ref SIM_RegisterModel
+ * @note   Call once, the model cannot be removed.
+ */
+int32_t SIM_SYSTICK_Init(void)
+{
+    const stc_sim_model_t stcModel = {
+        .u32Base = SCS_BASE,
+        .u32Size = SIM_SYSTICK_SCS_SIZE,
+        .pfnReset = NULL,
+        .pfnRead = &SIM_SYSTICK_Read,
+        .pfnReadDone = &SIM_SYSTICK_ReadDone,
+        .pfnWrite = &SIM_SYSTICK_Write,
+    };
+
+    m_u32CyclePerRead = 0UL;
+    m_u64Cycle = 0ULL;
+    return SIM_RegisterModel(&stcModel);
+}
+
+/**
+ * @brief  Set the HCLK cycles of a read of the SCS.
+ * @param  [in] u32CyclePerRead         Cycles, 0 stops the counter.
+ * @retval None
+ * @note   Keep it well below the SysTick period: SysTick_WaitCycle() and the
+ *         target need a loop pass shorter than one period.
+ */
+void SIM_SYSTICK_SetCycle(uint32_t u32CyclePerRead)
+{
+    m_u32CyclePerRead = u32CyclePerRead;
+}
+
+/**
+ * @brief  Get the HCLK cycles counted since SIM_SYSTICK_Init().
+ * @param  None
+ * @retval Cycles
+ */
+uint64_t SIM_SYSTICK_GetCycle(void)
+{
+    return m_u64Cycle;
+}
+
+/**
+ * @brief  Move the counter on to its next 1 to 0 step, for SIM_WaitForInterrupt().
+ * @param  None
+ * @retval None
+ */
+void SIM_SYSTICK_Wait(void)
+{
+    uint32_t u32Val;
+
+    if (SET == SIM_SYSTICK_IsRunning()) {
+        u32Val = SIM_REG32(SIM_SYSTICK_VAL) & SysTick_VAL_CURRENT_Msk;
+        if (0UL == u32Val) {
+            u32Val = (SIM_REG32(SIM_SYSTICK_LOAD) & SysTick_LOAD_RELOAD_Msk) + 1UL;
+        }
+        SIM_SYSTICK_Advance(u32Val);
+    }
+}
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
@@ -0,0 +1,283 @@
+/**
+ *******************************************************************************
+ * @file  host/sim/hc32_sim_usart.c
+ * @brief USART behavioral model of the simulated register file.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-16       CDT             First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2022-2023, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include "hc32_sim.h"
+
+/**
+ * @addtogroup HC32F120_DDL_Host
+ * @{
+ */
+
+/**
+ * @defgroup SIM_USART SIM USART
+ * @brief USART model: transmission completes instantly, TXE and TC always read
+ *        as set. Frames written to the data register go to the TX callback,
+ *        frames injected with SIM_USART_InjectRx() are received one by one
+ *        while CR1.RE is set. No interrupt is raised.
+ * @{
+ */
+
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @brief USART model state of one unit.
+ */
+typedef struct {
+    func_ptr_sim_usart_tx_t pfnTx;      /*!< TX sink. */
+    void *pvTxArg;                      /*!< TX sink argument. */
+    uint16_t au16Rx[SIM_USART_RX_BUF_SIZE];
+                                        /*!< Injected RX frames. */
+    uint32_t u32RxIn;                   /*!< RX write index, free running. */
+    uint32_t u32RxOut;                  /*!< RX read index, free running. */
+} stc_sim_usart_t;
+
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+#define SIM_USART_UNIT_NUM              (4U)
+#define SIM_USART_SIZE                  (0x400UL)
+
+#define SIM_USART_SR                    (0x00UL)
+#define SIM_USART_DR                    (0x04UL)
+#define SIM_USART_CR1                   (0x0CUL)
+/* Offset of the RDR half of DR */
+#define SIM_USART_RDR                   (0x06UL)
+
+/* Reset value of SR: TXE and TC */
+#define SIM_USART_SR_RST                (USART_SR_TXE | USART_SR_TC)
+/* CR1 bits clearing SR error flags, read as 0 */
+#define SIM_USART_CR1_CLR               (USART_CR1_CPE | USART_CR1_CFE | USART_CR1_CORE)
+
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+static const uint32_t m_au32UsartBase[SIM_USART_UNIT_NUM] = {
+    CM_USART1_BASE, CM_USART2_BASE, CM_USART3_BASE, CM_USART4_BASE
+};
+
+static stc_sim_usart_t m_astcUsart[SIM_USART_UNIT_NUM];
+
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @brief  Get the unit index of an address.
+ * @param  [in] u32Addr                 Device address inside a USART unit
+ * @retval Unit index, SIM_USART_UNIT_NUM if not a USART.
+ */
+static uint32_t SIM_USART_Unit(uint32_t u32Addr)
+{
+    uint32_t i;
+
+    for (i = 0UL; i < SIM_USART_UNIT_NUM; i++) {
+        if ((u32Addr >= m_au32UsartBase[i]) && ((u32Addr - m_au32UsartBase[i]) < SIM_USART_SIZE)) {
+            break;
+        }
+    }
+    return i;
+}
+
+/**
+ * @brief  Reset the USART registers.
+ * @param  None
+ * @retval None
+ */
+static void SIM_USART_Reset(void)
+{
+    uint32_t i;
+
+    for (i = 0UL; i < SIM_USART_UNIT_NUM; i++) {
+        SIM_REG32(m_au32UsartBase[i] + SIM_USART_SR) = SIM_USART_SR_RST;
+        m_astcUsart[i].u32RxIn = 0UL;
+        m_astcUsart[i].u32RxOut = 0UL;
+    }
+}
+
+/**
+ * @brief  Update SR and RDR before a read.
+ * @param  [in] u32Addr                 Device address
+ * @retval None
+ */
+static void SIM_USART_Read(uint32_t u32Addr)
+{
+    uint32_t u32Unit = SIM_USART_Unit(u32Addr);
+    uint32_t u32Base = m_au32UsartBase[u32Unit];
+    stc_sim_usart_t *pstcUsart = &m_astcUsart[u32Unit];
+    uint32_t u32Sr = SIM_REG32(u32Base + SIM_USART_SR) | SIM_USART_SR_RST;
+
+    if ((0UL != (SIM_REG32(u32Base + SIM_USART_CR1) & USART_CR1_RE)) && (pstcUsart->u32RxIn != pstcUsart->u32RxOut)) {
+        u32Sr |= USART_SR_RXNE;
+        SIM_REG16(u32Base + SIM_USART_RDR) = pstcUsart->au16Rx[pstcUsart->u32RxOut % SIM_USART_RX_BUF_SIZE];
+    } else {
+        u32Sr &= ~USART_SR_RXNE;
+    }
+    SIM_REG32(u32Base + SIM_USART_SR) = u32Sr;
+}
+
+/**
+ * @brief  Reading RDR consumes the received frame.
+ * @param  [in] u32Addr                 Device address
+ * @retval None
+ */
+static void SIM_USART_ReadDone(uint32_t u32Addr)
+{
+    uint32_t u32Unit = SIM_USART_Unit(u32Addr);
+    stc_sim_usart_t *pstcUsart = &m_astcUsart[u32Unit];
+
+    if (((u32Addr - m_au32UsartBase[u32Unit]) & ~1UL) == SIM_USART_RDR) {
+        if (pstcUsart->u32RxIn != pstcUsart->u32RxOut) {
+            pstcUsart->u32RxOut++;
+        }
+    }
+}
+
+/**
+ * @brief  Transmit frames written to TDR, apply the flag clear bits of CR1.
+ * @param  [in] u32Addr                 Device address
+ * @param  [in] u32Old                  Register word before the write
+ * @retval None
+ */
+static void SIM_USART_Write(uint32_t u32Addr, uint32_t u32Old)
+{
+    uint32_t u32Unit = SIM_USART_Unit(u32Addr);
+    uint32_t u32Base = m_au32UsartBase[u32Unit];
+    stc_sim_usart_t *pstcUsart = &m_astcUsart[u32Unit];
+    uint32_t u32Cr1;
+
+    switch ((u32Addr - u32Base) & ~3UL) {
+        case SIM_USART_SR:
+            /* Read only */
+            SIM_REG32(u32Base + SIM_USART_SR) = u32Old;
+            break;
+        case SIM_USART_DR:
+            if (((u32Addr - u32Base) < SIM_USART_RDR) && (NULL != pstcUsart->pfnTx) &&
+                (0UL != (SIM_REG32(u32Base + SIM_USART_CR1) & USART_CR1_TE))) {
+                pstcUsart->pfnTx((uint16_t)(SIM_REG32(u32Base + SIM_USART_DR) & USART_DR_TDR), pstcUsart->pvTxArg);
+            }
+            break;
+        case SIM_USART_CR1:
+            u32Cr1 = SIM_REG32(u32Base + SIM_USART_CR1);
+            if (0UL != (u32Cr1 & USART_CR1_CPE)) {
+                SIM_REG32(u32Base + SIM_USART_SR) &= ~USART_SR_PE;
+            }
+            if (0UL != (u32Cr1 & USART_CR1_CFE)) {
+                SIM_REG32(u32Base + SIM_USART_SR) &= ~USART_SR_FE;
+            }
+            if (0UL != (u32Cr1 & USART_CR1_CORE)) {
+                SIM_REG32(u32Base + SIM_USART_SR) &= ~USART_SR_ORE;
+            }
+            SIM_REG32(u32Base + SIM_USART_CR1) = u32Cr1 & ~SIM_USART_CR1_CLR;
+            break;
+        default:
+            break;
+    }
+}
+
+/**
+ * @brief  Register the models of all USART units.
+ * @param  None
+ * @retval int32_t:
+ *           - LL_OK:                   Registered.
+ *           - Others:                  @ref SIM_RegisterModel
+ */
+int32_t SIM_USART_Init(void)
+{
+    stc_sim_model_t stcModel;
+    int32_t i32Ret = LL_OK;
+    uint32_t i;
+
+    stcModel.u32Size = SIM_USART_SIZE;
+    stcModel.pfnReset = NULL;
+    stcModel.pfnRead = &SIM_USART_Read;
+    stcModel.pfnReadDone = &SIM_USART_ReadDone;
+    stcModel.pfnWrite = &SIM_USART_Write;
+    for (i = 0UL; (i < SIM_USART_UNIT_NUM) && (LL_OK == i32Ret); i++) {
+        stcModel.u32Base = m_au32UsartBase[i];
+        /* Reset all units once, from the first model */
+        stcModel.pfnReset = (0UL == i) ? &SIM_USART_Reset : NULL;
+        i32Ret = SIM_RegisterModel(&stcModel);
+    }
+    return i32Ret;
+}
+
+/**
+ * @brief  Set the sink of the transmitted frames.
+ * @param  [in] USARTx                  Pointer to USART instance register base
+ * @param  [in] pfnTx                   TX sink, NULL to drop the frames
+ * @param  [in] pvArg                   Argument passed to pfnTx
+ * @retval None
+ */
+void SIM_USART_SetTxCallback(const CM_USART_TypeDef *USARTx, func_ptr_sim_usart_tx_t pfnTx, void *pvArg)
+{
+    uint32_t u32Unit = SIM_USART_Unit((uint32_t)(uintptr_t)USARTx);
+
+    if (u32Unit < SIM_USART_UNIT_NUM) {
+        m_astcUsart[u32Unit].pfnTx = pfnTx;
+        m_astcUsart[u32Unit].pvTxArg = pvArg;
+    }
+}
+
+/**
+ * @brief  Queue frames to be received.
+ * @param  [in] USARTx                  Pointer to USART instance register base
+ * @param  [in] pu16Data                Frames
+ * @param  [in] u32Len                  Number of frames
+ * @retval Number of frames queued, less than u32Len if the queue is full.
+ */
+uint32_t SIM_USART_InjectRx(const CM_USART_TypeDef *USARTx, const uint16_t *pu16Data, uint32_t u32Len)
+{
+    uint32_t u32Unit = SIM_USART_Unit((uint32_t)(uintptr_t)USARTx);
+    stc_sim_usart_t *pstcUsart;
+    uint32_t i = 0UL;
+
+    if ((u32Unit < SIM_USART_UNIT_NUM) && (NULL != pu16Data)) {
+        pstcUsart = &m_astcUsart[u32Unit];
+        while ((i < u32Len) && ((pstcUsart->u32RxIn - pstcUsart->u32RxOut) < SIM_USART_RX_BUF_SIZE)) {
+            pstcUsart->au16Rx[pstcUsart->u32RxIn % SIM_USART_RX_BUF_SIZE] = pu16Data[i] & (USART_DR_RDR >> USART_DR_RDR_POS);
+            pstcUsart->u32RxIn++;
+            i++;
+        }
+    }
+    return i;
+}
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
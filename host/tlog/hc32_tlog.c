@@ -0,0 +1,470 @@
+/**
+ *******************************************************************************
+ * @file  host/tlog/hc32_tlog.c
+ * @brief Decodes the TLOG record stream of a firmware into text, with the
+ *        format strings of its ELF file.
+ @verbatim
+   Change Logs:
+   Date             Author          Notes
+   2026-10-16       CDT             First version
+ @endverbatim
+ *******************************************************************************
+ * Copyright (C) 2022-2023, Xiaohua Semiconductor Co., Ltd. All rights reserved.
+ *
+ * This software component is licensed by XHSC under BSD 3-Clause license
+ * (the "License"); You may not use this file except in compliance with the
+ * License. You may obtain a copy of the License at:
+ *                    opensource.org/licenses/BSD-3-Clause
+ *
+ *******************************************************************************
+ */
+
+/*******************************************************************************
+ * Include files
+ ******************************************************************************/
+#include <elf.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "hc32_ll_def.h"
+#include "hc32_ll_tlog.h"
+
+/**
+ * @addtogroup HC32F120_DDL_Host
+ * @{
+ */
+
+/**
+ * @defgroup TLOG_DEC TLOG_DEC
+ * @brief TLOG decoder: usage "hc32_tlog fw.elf [capture.bin]", the capture is read from
+ *        stdin when not given.
+ * @note  The format string of a record is looked up by its ID in the .tlog section of the
+ *        ELF file, or at the address of the ID in the loaded sections when there is no
+ *        .tlog section. "%s" arguments are looked up in the loaded sections.
+ * @note  Bytes which do not start a record header are skipped, so a capture may start in
+ *        the middle of a record. 32-bit Arm images and 64-bit host images are accepted.
+ * @{
+ */
+
+/*******************************************************************************
+ * Local type definitions ('typedef')
+ ******************************************************************************/
+/**
+ * @brief Section of the ELF file.
+ */
+typedef struct {
+    uint64_t u64Addr;                   /*!< Address. */
+    uint64_t u64Size;                   /*!< Size. */
+    uint64_t u64Offset;                 /*!< File offset, no contents if SHT_NOBITS. */
+    uint32_t u32Alloc;                  /*!< 1 if loaded. */
+} stc_tlog_dec_section_t;
+
+/**
+ * @brief ELF image.
+ */
+typedef struct {
+    uint8_t *pu8File;                   /*!< ELF file contents. */
+    size_t uSize;                       /*!< ELF file size. */
+    stc_tlog_dec_section_t *pstcSection; /*!< Sections with contents. */
+    uint32_t u32SectionNum;             /*!< Number of sections. */
+    int32_t i32Tlog;                    /*!< Index of .tlog in pstcSection, -1 if none. */
+} stc_tlog_dec_image_t;
+
+/*******************************************************************************
+ * Local pre-processor symbols/macros ('#define')
+ ******************************************************************************/
+#define TLOG_DEC_SPEC_LEN               (32U)
+#define TLOG_DEC_HDR_MARK_MASK          (0xF0000000UL)
+#define TLOG_DEC_ARGN_MASK              (0x0FUL)
+
+/*******************************************************************************
+ * Global variable definitions (declared in header file with 'extern')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local function prototypes ('static')
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Local variable definitions ('static')
+ ******************************************************************************/
+static stc_tlog_dec_image_t m_stcImage;
+
+/*******************************************************************************
+ * Function implementation - global ('extern') and local ('static')
+ ******************************************************************************/
+/**
+ * @brief  Add a section to the image.
+ * @param  [in] pstcImage               Pointer to the image
+ * @param  [in] pcName                  Section name
+ * @param  [in] u32Type                 Section type
+ * @param  [in] u64Flags                Section flags
+ * @param  [in] pstcSection             Address, size and file offset of the section
+ * @retval None
+ */
+static void TLOG_DEC_AddSection(stc_tlog_dec_image_t *pstcImage, const char *pcName, uint32_t u32Type,
+                                uint64_t u64Flags, const stc_tlog_dec_section_t *pstcSection)
+{
+    stc_tlog_dec_section_t *pstcDest;
+
+    /* Only sections whose contents are in the file */
+    if ((SHT_PROGBITS != u32Type) || (0ULL == pstcSection->u64Size) ||
+        ((pstcSection->u64Offset + pstcSection->u64Size) > pstcImage->uSize)) {
+        return;
+    }
+    pstcDest = &pstcImage->pstcSection[pstcImage->u32SectionNum];
+    *pstcDest = *pstcSection;
+    pstcDest->u32Alloc = (0ULL != (u64Flags & SHF_ALLOC)) ? 1UL : 0UL;
+    if (0 == strcmp(pcName, ".tlog")) {
+        pstcImage->i32Tlog = (int32_t)pstcImage->u32SectionNum;
+    }
+    pstcImage->u32SectionNum++;
+}
+
+/**
+ * @brief  Load the sections of an ELF file.
+ * @param  [in] pcPath                  File name
+ * @param  [out] pstcImage              Pointer to the image
+ * @retval int32_t:
+ *           - LL_OK:                   Loaded.
+ *           - LL_ERR:                  Not a 32-bit or 64-bit little-endian ELF file.
+ */
+static int32_t TLOG_DEC_Load(const char *pcPath, stc_tlog_dec_image_t *pstcImage)
+{
+    FILE *pFile = fopen(pcPath, "rb");
+    stc_tlog_dec_section_t stcSection;
+    const Elf32_Ehdr *pstcEhdr32;
+    const Elf32_Shdr *pstcShdr32;
+    const Elf64_Ehdr *pstcEhdr64;
+    const Elf64_Shdr *pstcShdr64;
+    const char *pcNames;
+    uint32_t i;
+
+    if (NULL == pFile) {
+        return LL_ERR;
+    }
+    (void)fseek(pFile, 0L, SEEK_END);
+    pstcImage->uSize = (size_t)ftell(pFile);
+    (void)fseek(pFile, 0L, SEEK_SET);
+    pstcImage->pu8File = (uint8_t *)malloc(pstcImage->uSize);
+    if ((NULL == pstcImage->pu8File) || (pstcImage->uSize < sizeof(Elf64_Ehdr)) ||
+        (1U != fread(pstcImage->pu8File, pstcImage->uSize, 1U, pFile))) {
+        (void)fclose(pFile);
+        return LL_ERR;
+    }
+    (void)fclose(pFile);
+    pstcImage->i32Tlog = -1;
+
+    pstcEhdr32 = (const Elf32_Ehdr *)pstcImage->pu8File;
+    if ((0 != memcmp(pstcEhdr32->e_ident, ELFMAG, SELFMAG)) || (ELFDATA2LSB != pstcEhdr32->e_ident[EI_DATA])) {
+        return LL_ERR;
+    }
+
+    if (ELFCLASS32 == pstcEhdr32->e_ident[EI_CLASS]) {
+        pstcImage->pstcSection = (stc_tlog_dec_section_t *)calloc(pstcEhdr32->e_shnum + 1U, sizeof(stc_tlog_dec_section_t));
+        pstcShdr32 = (const Elf32_Shdr *)&pstcImage->pu8File[pstcEhdr32->e_shoff +
+                                                              (pstcEhdr32->e_shstrndx * pstcEhdr32->e_shentsize)];
+        pcNames = (const char *)&pstcImage->pu8File[pstcShdr32->sh_offset];
+        for (i = 0UL; (NULL != pstcImage->pstcSection) && (i < pstcEhdr32->e_shnum); i++) {
+            pstcShdr32 = (const Elf32_Shdr *)&pstcImage->pu8File[pstcEhdr32->e_shoff + (i * pstcEhdr32->e_shentsize)];
+            stcSection.u64Addr = pstcShdr32->sh_addr;
+            stcSection.u64Size = pstcShdr32->sh_size;
+            stcSection.u64Offset = pstcShdr32->sh_offset;
+            TLOG_DEC_AddSection(pstcImage, &pcNames[pstcShdr32->sh_name], pstcShdr32->sh_type,
+                                pstcShdr32->sh_flags, &stcSection);
+        }
+    } else if (ELFCLASS64 == pstcEhdr32->e_ident[EI_CLASS]) {
+        pstcEhdr64 = (const Elf64_Ehdr *)pstcImage->pu8File;
+        pstcImage->pstcSection = (stc_tlog_dec_section_t *)calloc(pstcEhdr64->e_shnum + 1U, sizeof(stc_tlog_dec_section_t));
+        pstcShdr64 = (const Elf64_Shdr *)&pstcImage->pu8File[pstcEhdr64->e_shoff +
+                                                              (pstcEhdr64->e_shstrndx * pstcEhdr64->e_shentsize)];
+        pcNames = (const char *)&pstcImage->pu8File[pstcShdr64->sh_offset];
+        for (i = 0UL; (NULL != pstcImage->pstcSection) && (i < pstcEhdr64->e_shnum); i++) {
+            pstcShdr64 = (const Elf64_Shdr *)&pstcImage->pu8File[pstcEhdr64->e_shoff + (i * pstcEhdr64->e_shentsize)];
+            stcSection.u64Addr = pstcShdr64->sh_addr;
+            stcSection.u64Size = pstcShdr64->sh_size;
+            stcSection.u64Offset = pstcShdr64->sh_offset;
+            TLOG_DEC_AddSection(pstcImage, &pcNames[pstcShdr64->sh_name], pstcShdr64->sh_type,
+                                pstcShdr64->sh_flags, &stcSection);
+        }
+    } else {
+        return LL_ERR;
+    }
+
+    return (NULL != pstcImage->pstcSection) ? LL_OK : LL_ERR;
+}
+
+/**
+ * @brief  Get the string at an address of a section.
+ * @param  [in] pstcImage               Pointer to the image
+ * @param  [in] pstcSection             Section
+ * @param  [in] u64Addr                 Address
+ * @retval String, NULL if the address is outside the section or the string is not terminated.
+ */
+static const char *TLOG_DEC_SectionString(const stc_tlog_dec_image_t *pstcImage,
+                                          const stc_tlog_dec_section_t *pstcSection, uint64_t u64Addr)
+{
+    const char *pcStr;
+    uint64_t u64Pos;
+
+    if ((u64Addr < pstcSection->u64Addr) || ((u64Addr - pstcSection->u64Addr) >= pstcSection->u64Size)) {
+        return NULL;
+    }
+    u64Pos = u64Addr - pstcSection->u64Addr;
+    pcStr = (const char *)&pstcImage->pu8File[pstcSection->u64Offset + u64Pos];
+    if (NULL == memchr(pcStr, '\0', (size_t)(pstcSection->u64Size - u64Pos))) {
+        return NULL;
+    }
+    return pcStr;
+}
+
+/**
+ * @brief  Get a string of the loaded sections.
+ * @param  [in] pstcImage               Pointer to the image
+ * @param  [in] u64Addr                 Address
+ * @retval String, NULL if not found.
+ */
+static const char *TLOG_DEC_LoadedString(const stc_tlog_dec_image_t *pstcImage, uint64_t u64Addr)
+{
+    const char *pcStr = NULL;
+    uint32_t i;
+
+    for (i = 0UL; (NULL == pcStr) && (i < pstcImage->u32SectionNum); i++) {
+        if (0UL != pstcImage->pstcSection[i].u32Alloc) {
+            pcStr = TLOG_DEC_SectionString(pstcImage, &pstcImage->pstcSection[i], u64Addr);
+        }
+    }
+    return pcStr;
+}
+
+/**
+ * @brief  Get the format string of an ID.
+ * @param  [in] pstcImage               Pointer to the image
+ * @param  [in] u32Id                   Format string ID
+ * @retval Format string, NULL if not found.
+ */
+static const char *TLOG_DEC_Format(const stc_tlog_dec_image_t *pstcImage, uint32_t u32Id)
+{
+    const stc_tlog_dec_section_t *pstcTlog;
+
+    if (pstcImage->i32Tlog < 0) {
+        return TLOG_DEC_LoadedString(pstcImage, u32Id);
+    }
+    pstcTlog = &pstcImage->pstcSection[pstcImage->i32Tlog];
+    /* Not loaded: the IDs are offsets. Loaded (host build): the IDs are the low address bits. */
+    return TLOG_DEC_SectionString(pstcImage, pstcTlog, (pstcTlog->u64Addr & ~(uint64_t)TLOG_ID_MASK) | u32Id);
+}
+
+/**
+ * @brief  Print one conversion with the star arguments of its width and precision.
+ * @param  [in] pcSpec                  Conversion specification
+ * @param  [in] ai32Star                Star arguments
+ * @param  [in] u32StarNum              Number of star arguments, up to 2
+ * @param  [in] u32Val                  Argument
+ * @param  [in] pcStr                   String argument of "%s", NULL for the others
+ * @retval None
+ */
+static void TLOG_DEC_PrintConv(const char *pcSpec, const int32_t ai32Star[], uint32_t u32StarNum,
+                               uint32_t u32Val, const char *pcStr)
+{
+    const char cConv = pcSpec[strlen(pcSpec) - 1U];
+
+    if (NULL != pcStr) {
+        if (0UL == u32StarNum) {
+            (void)printf(pcSpec, pcStr);
+        } else if (1UL == u32StarNum) {
+            (void)printf(pcSpec, (int)ai32Star[0], pcStr);
+        } else {
+            (void)printf(pcSpec, (int)ai32Star[0], (int)ai32Star[1], pcStr);
+        }
+    } else if (('d' == cConv) || ('i' == cConv)) {
+        if (0UL == u32StarNum) {
+            (void)printf(pcSpec, (int)(int32_t)u32Val);
+        } else if (1UL == u32StarNum) {
+            (void)printf(pcSpec, (int)ai32Star[0], (int)(int32_t)u32Val);
+        } else {
+            (void)printf(pcSpec, (int)ai32Star[0], (int)ai32Star[1], (int)(int32_t)u32Val);
+        }
+    } else {
+        if (0UL == u32StarNum) {
+            (void)printf(pcSpec, (unsigned int)u32Val);
+        } else if (1UL == u32StarNum) {
+            (void)printf(pcSpec, (int)ai32Star[0], (unsigned int)u32Val);
+        } else {
+            (void)printf(pcSpec, (int)ai32Star[0], (int)ai32Star[1], (unsigned int)u32Val);
+        }
+    }
+}
+
+/**
+ * @brief  Print a record as its format string says.
+ * @param  [in] pstcImage               Pointer to the image
+ * @param  [in] pcFmt                   Format string
+ * @param  [in] au32Arg                 Arguments
+ * @param  [in] u32ArgNum               Number of arguments
+ * @retval None
+ * @note   The record ends the line, trailing line breaks of the format string are dropped.
+ */
+static void TLOG_DEC_Print(const stc_tlog_dec_image_t *pstcImage, const char *pcFmt,
+                           const uint32_t au32Arg[], uint32_t u32ArgNum)
+{
+    const char *pcEnd = pcFmt + strlen(pcFmt);
+    char acSpec[TLOG_DEC_SPEC_LEN];
+    int32_t ai32Star[2U];
+    uint32_t u32StarNum;
+    uint32_t u32Arg = 0UL;
+    uint32_t u32Len;
+    uint32_t u32Val;
+    const char *pcStr;
+    char cConv;
+
+    while ((pcEnd > pcFmt) && (('\n' == pcEnd[-1]) || ('\r' == pcEnd[-1]))) {
+        pcEnd--;
+    }
+    while (pcFmt < pcEnd) {
+        if ('%' != *pcFmt) {
+            (void)putchar(*pcFmt++);
+            continue;
+        }
+        /* Flags, width and precision are kept, the length dropped: all arguments are 32-bit */
+        acSpec[0] = '%';
+        u32Len = 1UL;
+        u32StarNum = 0UL;
+        pcFmt++;
+        while ((pcFmt < pcEnd) && (NULL != strchr("-+ #0123456789.*", *pcFmt)) && (u32Len < (TLOG_DEC_SPEC_LEN - 2U))) {
+            if (('*' == *pcFmt) && (u32StarNum < 2UL)) {
+                ai32Star[u32StarNum++] = (u32Arg < u32ArgNum) ? (int32_t)au32Arg[u32Arg++] : 0;
+            }
+            acSpec[u32Len++] = *pcFmt++;
+        }
+        while ((pcFmt < pcEnd) && (NULL != strchr("hljzt", *pcFmt))) {
+            pcFmt++;
+        }
+        if (pcFmt >= pcEnd) {
+            break;
+        }
+        cConv = *pcFmt++;
+        if ('%' == cConv) {
+            (void)putchar('%');
+            continue;
+        }
+        u32Val = (u32Arg < u32ArgNum) ? au32Arg[u32Arg++] : 0UL;
+        acSpec[u32Len++] = cConv;
+        acSpec[u32Len] = '\0';
+        if (NULL != strchr("diuxXoc", cConv)) {
+            TLOG_DEC_PrintConv(acSpec, ai32Star, u32StarNum, u32Val, NULL);
+        } else if ('s' == cConv) {
+            pcStr = TLOG_DEC_LoadedString(pstcImage, u32Val);
+            if (NULL != pcStr) {
+                TLOG_DEC_PrintConv(acSpec, ai32Star, u32StarNum, 0UL, pcStr);
+            } else {
+                (void)printf("<0x%08lx>", (unsigned long)u32Val);
+            }
+        } else {
+            /* %p and unknown conversions: the raw word */
+            (void)printf("0x%08lx", (unsigned long)u32Val);
+        }
+    }
+    (void)putchar('\n');
+}
+
+/**
+ * @brief  Main function of the TLOG decoder
+ * @param  [in] argc                    Argument count
+ * @param  [in] argv                    Arguments
+ * @retval 0 if the capture ended on a record boundary
+ */
+int main(int argc, char *argv[])
+{
+    FILE *pFile = stdin;
+    uint8_t au8Rec[4U * (1U + TLOG_DEC_ARGN_MASK)];
+    uint32_t au32Arg[TLOG_DEC_ARGN_MASK];
+    uint32_t u32Len = 0UL;
+    uint32_t u32Need = 4UL;
+    uint32_t u32Skipped = 0UL;
+    uint32_t u32Hdr = 0UL;
+    uint32_t u32ArgNum;
+    uint32_t i;
+    const char *pcFmt;
+    int iByte;
+
+    if ((argc < 2) || (argc > 3)) {
+        (void)fprintf(stderr, "usage: %s fw.elf [capture.bin]\n", argv[0]);
+        return 2;
+    }
+    if (LL_OK != TLOG_DEC_Load(argv[1], &m_stcImage)) {
+        (void)fprintf(stderr, "%s: cannot load %s\n", argv[0], argv[1]);
+        return 1;
+    }
+    if (3 == argc) {
+        pFile = fopen(argv[2], "rb");
+        if (NULL == pFile) {
+            (void)fprintf(stderr, "%s: cannot open %s\n", argv[0], argv[2]);
+            return 1;
+        }
+    }
+
+    while (EOF != (iByte = fgetc(pFile))) {
+        au8Rec[u32Len++] = (uint8_t)iByte;
+        if (u32Len < u32Need) {
+            continue;
+        }
+        if (4UL == u32Len) {
+            u32Hdr = (uint32_t)au8Rec[0] | ((uint32_t)au8Rec[1] << 8U) |
+                     ((uint32_t)au8Rec[2] << 16U) | ((uint32_t)au8Rec[3] << 24U);
+            if (TLOG_HDR_MARK != (u32Hdr & TLOG_DEC_HDR_MARK_MASK)) {
+                /* Not a header: resynchronize on the next byte */
+                (void)memmove(au8Rec, &au8Rec[1], 3U);
+                u32Len = 3UL;
+                u32Skipped++;
+                continue;
+            }
+            u32Need = 4UL * (1UL + ((u32Hdr >> TLOG_HDR_ARGN_POS) & TLOG_DEC_ARGN_MASK));
+            if (u32Len < u32Need) {
+                continue;
+            }
+        }
+        if (0UL != u32Skipped) {
+            (void)printf("<%lu bytes skipped>\n", (unsigned long)u32Skipped);
+            u32Skipped = 0UL;
+        }
+        u32ArgNum = (u32Need / 4UL) - 1UL;
+        for (i = 0UL; i < u32ArgNum; i++) {
+            (void)memcpy(&au32Arg[i], &au8Rec[4UL * (i + 1UL)], 4U);
+        }
+        if (TLOG_ID_DROP == (u32Hdr & TLOG_ID_MASK)) {
+            (void)printf("<%lu records dropped>\n", (unsigned long)((u32ArgNum > 0UL) ? au32Arg[0] : 0UL));
+        } else {
+            pcFmt = TLOG_DEC_Format(&m_stcImage, u32Hdr & TLOG_ID_MASK);
+            if (NULL != pcFmt) {
+                TLOG_DEC_Print(&m_stcImage, pcFmt, au32Arg, u32ArgNum);
+            } else {
+                (void)printf("<unknown id 0x%06lx>", (unsigned long)(u32Hdr & TLOG_ID_MASK));
+                for (i = 0UL; i < u32ArgNum; i++) {
+                    (void)printf(" 0x%08lx", (unsigned long)au32Arg[i]);
+                }
+                (void)putchar('\n');
+            }
+        }
+        u32Len = 0UL;
+        u32Need = 4UL;
+    }
+
+    if (stdin != pFile) {
+        (void)fclose(pFile);
+    }
+    return ((0UL == u32Len) && (0UL == u32Skipped)) ? 0 : 1;
+}
+
+/**
+ * @}
+ */
+
+/**
+ * @}
+ */
+
+/*******************************************************************************
+ * EOF (not truncated)
+ ******************************************************************************/
@@ -46,29 +46,75 @@ extern "C"
  * @note LL_UTILITY_ENABLE must be turned on(DDL_ON) if using Device Driver
  * Library.
  * @note LL_PRINT_ENABLE must be turned on(DDL_ON) if using printf function.
+ * @note LL_USART_ASYNC_ENABLE requires LL_USART_ENABLE and LL_SPSC_ENABLE, and
+ * LL_INTERRUPTS_ENABLE for USART_Async_IrqSignIn().
+ * @note LL_I2C_INT_ENABLE requires LL_I2C_ENABLE, and LL_INTERRUPTS_ENABLE
+ * for I2C_Int_IrqSignIn().
+ * @note LL_EFM_KV_ENABLE requires LL_EFM_ENABLE.
+ * @note LL_ADC_ACQ_ENABLE requires LL_ADC_ENABLE and LL_AOS_ENABLE, and
+ * LL_INTERRUPTS_ENABLE for ADC_ACQ_IrqSignIn().
+ * @note LL_TMR0_WHEEL_ENABLE requires LL_TMR0_ENABLE, and LL_INTERRUPTS_ENABLE
+ * for TMR0_Wheel_IrqSignIn().
+ * @note LL_SCHED_ENABLE enters sleep mode when idle with LL_PWC_ENABLE, WFI
+ * without.
+ * @note LL_PWC_IDLE_ENABLE requires LL_PWC_ENABLE, LL_CLK_ENABLE and
+ * LL_INTERRUPTS_ENABLE, it follows the TMR0 timer wheel with LL_TMR0_WHEEL_ENABLE.
+ * @note LL_DVFS_ENABLE requires LL_CLK_ENABLE, LL_EFM_ENABLE and LL_PWC_ENABLE,
+ * its USART and I2C notifier callbacks follow LL_USART_ENABLE and LL_I2C_ENABLE.
+ * @note LL_TLOG_ENABLE requires LL_USART_ASYNC_ENABLE, the records are decoded by
+ * host/tlog.
+ * @note LL_PROF_ENABLE requires LL_TMRB_ENABLE and LL_USART_ENABLE, and
+ * LL_INTERRUPTS_ENABLE for PROF_IrqSignIn(). The dumps are decoded by host/prof.
+ * @note LL_INTC_STAT_ENABLE requires SysTick_Init(), and LL_USART_ENABLE for
+ * INTC_STAT_Dump().
+ * @note LL_SPI_INT_ENABLE requires LL_SPI_ENABLE and LL_GPIO_ENABLE, and
+ * LL_INTERRUPTS_ENABLE for SPI_Int_IrqSignIn().
+ * @note LL_KERNEL_ENABLE takes SysTick and PendSV: SysTick_Handler() must call
+ * KERNEL_TickHandler().
  */
 #define LL_ICG_ENABLE                               (DDL_ON)
 #define LL_UTILITY_ENABLE                           (DDL_ON)
 #define LL_PRINT_ENABLE                             (DDL_OFF)
 
 #define LL_ADC_ENABLE                               (DDL_OFF)
+#define LL_ADC_ACQ_ENABLE                           (DDL_OFF)
 #define LL_AOS_ENABLE                               (DDL_OFF)
 #define LL_CLK_ENABLE                               (DDL_OFF)
 #define LL_CRC_ENABLE                               (DDL_OFF)
 #define LL_CTC_ENABLE                               (DDL_OFF)
+#define LL_DVFS_ENABLE                              (DDL_OFF)
 #define LL_EFM_ENABLE                               (DDL_OFF)
+#define LL_EFM_KV_ENABLE                            (DDL_OFF)
 #define LL_FCG_ENABLE                               (DDL_OFF)
 #define LL_GPIO_ENABLE                              (DDL_ON)
 #define LL_I2C_ENABLE                               (DDL_OFF)
+#define LL_I2C_INT_ENABLE                           (DDL_OFF)
+#define LL_INTC_STAT_ENABLE                         (DDL_OFF)
 #define LL_INTERRUPTS_ENABLE                        (DDL_OFF)
 #define LL_INTERRUPTS_SHARE_ENABLE                  (DDL_OFF)
+#define LL_KERNEL_ENABLE                            (DDL_OFF)
 #define LL_PWC_ENABLE                               (DDL_OFF)
+#define LL_PWC_IDLE_ENABLE                          (DDL_OFF)
+#define LL_PROF_ENABLE                              (DDL_OFF)
 #define LL_RMU_ENABLE                               (DDL_OFF)
+#define LL_SCHED_ENABLE                             (DDL_OFF)
 #define LL_SPI_ENABLE                               (DDL_OFF)
+#define LL_SPI_INT_ENABLE                           (DDL_OFF)
+#define LL_SPSC_ENABLE                              (DDL_OFF)
 #define LL_SWDT_ENABLE                              (DDL_OFF)
+#define LL_TLOG_ENABLE                              (DDL_OFF)
 #define LL_TMR0_ENABLE                              (DDL_OFF)
+#define LL_TMR0_WHEEL_ENABLE                        (DDL_OFF)
 #define LL_TMRB_ENABLE                              (DDL_OFF)
 #define LL_USART_ENABLE                             (DDL_OFF)
+#define LL_USART_ASYNC_ENABLE                       (DDL_OFF)
+
+/**
+ * @brief Link the EFM program and erase functions to .ramfunc, so that the core
+ * keeps running from RAM while the flash is busy.
+ * @note  The functions take RAM space, and are copied from flash at startup.
+ */
+#define LL_EFM_RAM_FUNC_ENABLE                      (DDL_OFF)
 
 /**
  * @brief The following is a list of currently supported BSP boards.
@@ -87,8 +133,10 @@ extern "C"
 /**
  * @brief This is the list of BSP components to be used.
  * Select the components you need to use to DDL_ON.
+ * @note  BSP_SPI_NOR_ENABLE requires LL_SPI_ENABLE and LL_GPIO_ENABLE.
  */
 #define BSP_INT_KEY_ENABLE                          (DDL_OFF)
+#define BSP_SPI_NOR_ENABLE                          (DDL_OFF)
 
 /*******************************************************************************
  * Global variable definitions ('extern')
@@ -6,6 +6,8 @@
    Change Logs:
    Date             Author          Notes
    2022-03-31       CDT             First version
+   2026-10-17       CDT             Toggle the LEDs by GPIO_FAST_TogglePins()
+                                    Initialize the LED pins by GPIO_InitTable()
  @endverbatim
  *******************************************************************************
  * Copyright (C) 2022-2023, Xiaohua Semiconductor Co., Ltd. All rights reserved.
@@ -50,9 +52,9 @@
 #define LED_B_PORT          (GPIO_PORT_2)
 #define LED_B_PIN           (GPIO_PIN_07)
 /* LED toggle definition */
-#define LED_R_TOGGLE()      (GPIO_TogglePins(LED_R_PORT, LED_R_PIN))
-#define LED_Y_TOGGLE()      (GPIO_TogglePins(LED_Y_PORT, LED_Y_PIN))
-#define LED_B_TOGGLE()      (GPIO_TogglePins(LED_B_PORT, LED_B_PIN))
+#define LED_R_TOGGLE()      (GPIO_FAST_TogglePins(LED_R_PORT, LED_R_PIN))
+#define LED_Y_TOGGLE()      (GPIO_FAST_TogglePins(LED_Y_PORT, LED_Y_PIN))
+#define LED_B_TOGGLE()      (GPIO_FAST_TogglePins(LED_B_PORT, LED_B_PIN))
 
 #define DLY_MS              (500UL)
 #define DLY_2               (100UL)
@@ -68,6 +70,11 @@
 /*******************************************************************************
  * Local variable definitions ('static')
  ******************************************************************************/
+static const stc_gpio_pin_cfg_t m_astcLedPinCfg[] = {
+    GPIO_PIN_CFG(LED_R_PORT, LED_R_PIN, GPIO_FUNC_0, PIN_DIR_OUT | PIN_STAT_SET),
+    GPIO_PIN_CFG(LED_Y_PORT, LED_Y_PIN, GPIO_FUNC_0, PIN_DIR_OUT | PIN_STAT_SET),
+    GPIO_PIN_CFG(LED_B_PORT, LED_B_PIN, GPIO_FUNC_0, PIN_DIR_OUT | PIN_STAT_SET),
+};
 
 /*******************************************************************************
  * Function implementation - global ('extern') and local ('static')
@@ -79,14 +86,7 @@
  */
 static void LED_Init(void)
 {
-    stc_gpio_init_t stcGpioInit;
-
-    (void)GPIO_StructInit(&stcGpioInit);
-    stcGpioInit.u16PinState = PIN_STAT_SET;
-    stcGpioInit.u16PinDir = PIN_DIR_OUT;
-    (void)GPIO_Init(LED_R_PORT, LED_R_PIN, &stcGpioInit);
-    (void)GPIO_Init(LED_Y_PORT, LED_Y_PIN, &stcGpioInit);
-    (void)GPIO_Init(LED_B_PORT, LED_B_PIN, &stcGpioInit);
+    (void)GPIO_InitTable(m_astcLedPinCfg, ARRAY_SZ(m_astcLedPinCfg));
 }
 
 /**